@@ -34,8 +34,8 @@ pylith::faults::FaultOps::createDAEMassWeighting(pylith::feassemble::Integration
     const pylith::topology::Field::SubfieldInfo& velocityInfo = solution->getSubfieldInfo("velocity");
     const pylith::topology::Field::SubfieldInfo& lagrangeInfo = solution->getSubfieldInfo("lagrange_multiplier_fault");
 
-    pylith::topology::Mesh* wtMesh = solution->getMesh().clone();
-    pylith::topology::Field* wtField = new pylith::topology::Field(*wtMesh);
+    // Weighting field only has a subset of the solution subfields, so it cannot share the solution layout.
+    pylith::topology::Field* wtField = new pylith::topology::Field(solution->getMesh());
     wtField->setName("dae_mass_weighting");
     wtField->subfieldAdd(velocityInfo.description, velocityInfo.fe);
     wtField->subfieldAdd(lagrangeInfo.description, lagrangeInfo.fe);
@@ -44,7 +44,6 @@ pylith::faults::FaultOps::createDAEMassWeighting(pylith::feassemble::Integration
     wtField->allocate();
 
     const char* dae_mass_weighting = pylith::feassemble::IntegrationData::dae_mass_weighting.c_str();
-    integrationData->setMesh(dae_mass_weighting, wtMesh);
     integrationData->setField(dae_mass_weighting, wtField);
 
     { // TEMPORARY DEBUGGING
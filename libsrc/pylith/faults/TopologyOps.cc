@@ -44,7 +44,7 @@ pylith::faults::TopologyOps::createFault(pylith::topology::Mesh* faultMesh,
 
     PetscInt maxConeSizeLocal = 0, maxConeSize = 0;
     err = DMPlexGetMaxSizes(subdm, &maxConeSizeLocal, NULL);PYLITH_CHECK_ERROR(err);
-    err = MPI_Allreduce(&maxConeSizeLocal, &maxConeSize, 1, MPI_INT, MPI_MAX,
+    err = MPI_Allreduce(&maxConeSizeLocal, &maxConeSize, 1, MPIU_INT, MPI_MAX,
                         PetscObjectComm((PetscObject) subdm));PYLITH_CHECK_ERROR(err);
 
     if (maxConeSize <= 0) {
@@ -0,0 +1,368 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/feassemble/AuxiliaryCache.hh" // implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
+#include <cassert> // USES assert()
+#include <cstdint> // USES uint64_t
+#include <iomanip> // USES std::setw(), std::setfill()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace feassemble {
+        class _AuxiliaryCache {
+public:
+
+            /// 64-bit FNV-1a hash accumulated over raw bytes.
+            class Hash {
+public:
+
+                Hash(void) :
+                    value(14695981039346656037ULL) {}
+
+
+                void add(const void* data,
+                         const size_t numBytes) {
+                    const unsigned char* bytes = (const unsigned char*)data;
+                    for (size_t i = 0; i < numBytes; ++i) {
+                        value ^= bytes[i];
+                        value *= 1099511628211ULL;
+                    } // for
+                } // add
+
+
+                template<typename T>
+                void add(const T& data) {
+                    add(&data, sizeof(T));
+                } // add
+
+
+                void add(const std::string& data) {
+                    add(data.length());
+                    add(data.c_str(), data.length());
+                } // add
+
+
+                uint64_t value; ///< Current value of hash.
+            }; // Hash
+
+            /** Add mesh topology, coordinates, and partition of DM to hash.
+             *
+             * @param[inout] hash Hash.
+             * @param[in] dm PETSc DM.
+             */
+            static
+            void addMesh(Hash* hash,
+                         PetscDM dm);
+
+            /** Add layout of local section to hash.
+             *
+             * @param[inout] hash Hash.
+             * @param[in] section PETSc section.
+             */
+            static
+            void addSection(Hash* hash,
+                            PetscSection section);
+
+            static const char* valuesName; ///< Name of dataset with values.
+            static const char* keyAttribute; ///< Name of attribute with key.
+            static const char* sizeAttribute; ///< Name of attribute with storage size.
+        }; // _AuxiliaryCache
+    } // feassemble
+} // pylith
+
+const char* pylith::feassemble::_AuxiliaryCache::valuesName = "auxiliary_values";
+const char* pylith::feassemble::_AuxiliaryCache::keyAttribute = "pylith_auxiliary_key";
+const char* pylith::feassemble::_AuxiliaryCache::sizeAttribute = "storage_size";
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::feassemble::AuxiliaryCache::AuxiliaryCache(const char* directory,
+                                                   const char* name,
+                                                   const char* signature) :
+    _directory(directory),
+    _name(name),
+    _signature(signature) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::feassemble::AuxiliaryCache::~AuxiliaryCache(void) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute key for auxiliary field.
+std::string
+pylith::feassemble::AuxiliaryCache::computeKey(const pylith::topology::Field& field,
+                                               const spatialdata::units::Nondimensional& normalizer) const {
+    PYLITH_METHOD_BEGIN;
+
+    _AuxiliaryCache::Hash hash;
+    _AuxiliaryCache::addMesh(&hash, field.getDM());
+    _AuxiliaryCache::addSection(&hash, field.getLocalSection());
+
+    const pylith::string_vector& subfieldNames = field.getSubfieldNames();
+    for (size_t i = 0; i < subfieldNames.size(); ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(subfieldNames[i].c_str());
+        hash.add(info.description.label);
+        hash.add(info.description.vectorFieldType);
+        hash.add(info.description.numComponents);
+        hash.add(info.description.scale);
+        for (size_t iComponent = 0; iComponent < info.description.componentNames.size(); ++iComponent) {
+            hash.add(info.description.componentNames[iComponent]);
+        } // for
+        hash.add(info.fe.basisOrder);
+        hash.add(info.fe.quadOrder);
+        hash.add(info.fe.dimension);
+        hash.add(info.fe.isFaultOnly);
+        hash.add(info.fe.cellBasis);
+        hash.add(info.fe.feSpace);
+        hash.add(info.fe.isBasisContinuous);
+        hash.add(info.index);
+    } // for
+
+    hash.add(normalizer.getLengthScale());
+    hash.add(normalizer.getTimeScale());
+    hash.add(normalizer.getPressureScale());
+    hash.add(normalizer.getDensityScale());
+
+    hash.add(_signature);
+
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hash.value;
+
+    PYLITH_METHOD_RETURN(key.str());
+} // computeKey
+
+
+// ------------------------------------------------------------------------------------------------
+// Load values of auxiliary field from cache.
+bool
+pylith::feassemble::AuxiliaryCache::load(pylith::topology::Field* field,
+                                         const std::string& key) const {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    const std::string& filename = getFilename(*field, key);
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscViewer viewer = NULL;
+    PetscVec cacheVec = NULL;
+
+    // Read the cache file on this process. Any error (missing attributes, truncated or corrupt
+    // file) means the cache is not current; it must not prevent this process from reaching the
+    // reduction below, or the other processes would deadlock.
+    int isCurrent = 0;
+    try {
+        PetscBool exists = PETSC_FALSE;
+        err = PetscTestFile(filename.c_str(), 'r', &exists);PYLITH_CHECK_ERROR(err);
+        if (exists) {
+            err = PetscViewerHDF5Open(PETSC_COMM_SELF, filename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+            PetscBool hasKey = PETSC_FALSE;
+            err = PetscViewerHDF5HasAttribute(viewer, "/", _AuxiliaryCache::keyAttribute, &hasKey);PYLITH_CHECK_ERROR(err);
+            if (hasKey) {
+                char* cacheKey = NULL;
+                PetscInt storageSize = 0;
+                err = PetscViewerHDF5ReadAttribute(viewer, "/", _AuxiliaryCache::keyAttribute, PETSC_STRING, NULL, &cacheKey);PYLITH_CHECK_ERROR(err);
+                const bool sameKey = std::string(cacheKey) == key;
+                err = PetscFree(cacheKey);PYLITH_CHECK_ERROR(err);
+                err = PetscViewerHDF5ReadAttribute(viewer, "/", _AuxiliaryCache::sizeAttribute, PETSC_INT, NULL, &storageSize);PYLITH_CHECK_ERROR(err);
+                if (sameKey && (storageSize == field->getStorageSize())) {
+                    err = VecDuplicate(field->getLocalVector(), &cacheVec);PYLITH_CHECK_ERROR(err);
+                    err = PetscObjectSetName((PetscObject) cacheVec, _AuxiliaryCache::valuesName);PYLITH_CHECK_ERROR(err);
+                    err = VecLoad(cacheVec, viewer);PYLITH_CHECK_ERROR(err);
+                    isCurrent = 1;
+                } // if
+            } // if
+            err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+        } // if
+    } catch (const std::exception&) {
+        isCurrent = 0;
+        VecDestroy(&cacheVec);
+        PetscViewerDestroy(&viewer);
+    } // try/catch
+
+    // Only use the cache if it is current on every process.
+    int allCurrent = 0;
+    err = MPI_Allreduce(&isCurrent, &allCurrent, 1, MPI_INT, MPI_MIN, field->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+    if (allCurrent) {
+        assert(cacheVec);
+        err = VecCopy(cacheVec, field->getLocalVector());PYLITH_CHECK_ERROR(err);
+    } // if
+    err = VecDestroy(&cacheVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(allCurrent ? true : false);
+} // load
+
+
+// ------------------------------------------------------------------------------------------------
+// Save values of auxiliary field to cache.
+void
+pylith::feassemble::AuxiliaryCache::save(const pylith::topology::Field& field,
+                                         const std::string& key) const {
+    PYLITH_METHOD_BEGIN;
+
+    const std::string& filename = getFilename(field, key);
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscViewer viewer = NULL;
+    PetscVec cacheVec = NULL;
+    try {
+        err = VecDuplicate(field.getLocalVector(), &cacheVec);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectSetName((PetscObject) cacheVec, _AuxiliaryCache::valuesName);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(field.getLocalVector(), cacheVec);PYLITH_CHECK_ERROR(err);
+
+        err = PetscViewerHDF5Open(PETSC_COMM_SELF, filename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+        err = VecView(cacheVec, viewer);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&cacheVec);PYLITH_CHECK_ERROR(err);
+
+        // Write key last, so an incomplete file is never considered current.
+        const PetscInt storageSize = field.getStorageSize();
+        err = PetscViewerHDF5WriteAttribute(viewer, "/", _AuxiliaryCache::sizeAttribute, PETSC_INT, &storageSize);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerHDF5WriteAttribute(viewer, "/", _AuxiliaryCache::keyAttribute, PETSC_STRING, key.c_str());PYLITH_CHECK_ERROR(err);
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    } catch (const std::exception& err) {
+        VecDestroy(&cacheVec);
+        PetscViewerDestroy(&viewer);
+        std::ostringstream msg;
+        msg << "Error while writing auxiliary field cache file '" << filename << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // save
+
+
+// ------------------------------------------------------------------------------------------------
+// Get name of cache file for the local process.
+std::string
+pylith::feassemble::AuxiliaryCache::getFilename(const pylith::topology::Field& field,
+                                                const std::string& key) const {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMPIInt commRank = 0, commSize = 0;
+    err = MPI_Comm_rank(field.getMesh().getComm(), &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(field.getMesh().getComm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+    std::ostringstream filename;
+    filename << _directory << "/" << _name << "-" << key << "-p" << commRank << "of" << commSize << ".h5";
+
+    PYLITH_METHOD_RETURN(filename.str());
+} // getFilename
+
+
+// ------------------------------------------------------------------------------------------------
+// Add mesh topology, coordinates, and partition of DM to hash.
+void
+pylith::feassemble::_AuxiliaryCache::addMesh(Hash* hash,
+                                             PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(hash);
+    assert(dm);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMPIInt commRank = 0, commSize = 0;
+    err = MPI_Comm_rank(PetscObjectComm((PetscObject) dm), &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(PetscObjectComm((PetscObject) dm), &commSize);PYLITH_CHECK_ERROR(err);
+    hash->add(commRank);
+    hash->add(commSize);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    hash->add(pStart);
+    hash->add(pEnd);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt coneSize = 0;
+        const PetscInt* cone = NULL;
+        const PetscInt* coneOrientation = NULL;
+        err = DMPlexGetConeSize(dm, point, &coneSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetCone(dm, point, &cone);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetConeOrientation(dm, point, &coneOrientation);PYLITH_CHECK_ERROR(err);
+        hash->add(coneSize);
+        hash->add(cone, coneSize*sizeof(PetscInt));
+        hash->add(coneOrientation, coneSize*sizeof(PetscInt));
+    } // for
+
+    PetscVec coordsVec = NULL;
+    err = DMGetCoordinatesLocal(dm, &coordsVec);PYLITH_CHECK_ERROR(err);
+    if (coordsVec) {
+        PetscInt coordsSize = 0;
+        const PetscScalar* coordsArray = NULL;
+        err = VecGetLocalSize(coordsVec, &coordsSize);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+        hash->add(coordsSize);
+        hash->add(coordsArray, coordsSize*sizeof(PetscScalar));
+        err = VecRestoreArrayRead(coordsVec, &coordsArray);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscSF pointSF = NULL;
+    err = DMGetPointSF(dm, &pointSF);PYLITH_CHECK_ERROR(err);
+    if (pointSF) {
+        PetscInt numRoots = 0, numLeaves = 0;
+        const PetscInt* localPoints = NULL;
+        const PetscSFNode* remotePoints = NULL;
+        err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &localPoints, &remotePoints);PYLITH_CHECK_ERROR(err);
+        hash->add(numRoots);
+        hash->add(numLeaves);
+        for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+            hash->add(localPoints ? localPoints[iLeaf] : iLeaf);
+            hash->add(remotePoints[iLeaf].rank);
+            hash->add(remotePoints[iLeaf].index);
+        } // for
+    } // if
+
+    PYLITH_METHOD_END;
+} // addMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Add layout of local section to hash.
+void
+pylith::feassemble::_AuxiliaryCache::addSection(Hash* hash,
+                                                PetscSection section) {
+    PYLITH_METHOD_BEGIN;
+    assert(hash);
+    assert(section);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt pStart = 0, pEnd = 0, numFields = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetNumFields(section, &numFields);PYLITH_CHECK_ERROR(err);
+    hash->add(pStart);
+    hash->add(pEnd);
+    hash->add(numFields);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, offset = 0;
+        err = PetscSectionGetDof(section, point, &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(section, point, &offset);PYLITH_CHECK_ERROR(err);
+        hash->add(dof);
+        hash->add(offset);
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            err = PetscSectionGetFieldDof(section, point, iField, &dof);PYLITH_CHECK_ERROR(err);
+            hash->add(dof);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // addSection
+
+
+// End of file
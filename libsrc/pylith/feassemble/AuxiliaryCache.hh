@@ -0,0 +1,103 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
+
+#include <string> // HASA std::string
+
+/** @brief Persistent cache of auxiliary field values evaluated from spatial databases.
+ *
+ * The values of the local vector of an auxiliary field are written to an HDF5 file for each
+ * process. The key for the cache is a hash of the mesh topology and coordinates, the partition,
+ * the layout and discretization of the auxiliary subfields, the scales for nondimensionalization,
+ * and a signature of the spatial databases (provided by the Python layer from the database
+ * parameters and file metadata). A later run with the same key loads the values instead of
+ * querying the spatial databases.
+ *
+ * Cache files are named `<name>-<key>-pNofM.h5`, so a change in the setup writes new files with a
+ * new key. Files for stale keys are never removed; users must prune the cache directory
+ * themselves.
+ */
+class pylith::feassemble::AuxiliaryCache {
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Constructor.
+     *
+     * @param[in] directory Directory for cache files.
+     * @param[in] name Name of cache (physics identifier).
+     * @param[in] signature Signature of spatial databases used to populate the auxiliary field.
+     */
+    AuxiliaryCache(const char* directory,
+                   const char* name,
+                   const char* signature);
+
+    /// Destructor.
+    ~AuxiliaryCache(void);
+
+    /** Compute key for auxiliary field.
+     *
+     * @param[in] field Auxiliary field (subfields setup and allocated).
+     * @param[in] normalizer Scales for nondimensionalization.
+     * @returns Key for cache.
+     */
+    std::string computeKey(const pylith::topology::Field& field,
+                           const spatialdata::units::Nondimensional& normalizer) const;
+
+    /** Load values of auxiliary field from cache.
+     *
+     * Collective over the processes of the field's mesh; the values are only loaded if every
+     * process has a valid cache file for the key. Errors reading the cache file on a process
+     * (for example, a missing attribute or a truncated file) are treated as a stale cache.
+     *
+     * @param[inout] field Auxiliary field.
+     * @param[in] key Key for cache.
+     * @returns True if values were loaded, false otherwise.
+     */
+    bool load(pylith::topology::Field* field,
+              const std::string& key) const;
+
+    /** Save values of auxiliary field to cache.
+     *
+     * @param[in] field Auxiliary field.
+     * @param[in] key Key for cache.
+     */
+    void save(const pylith::topology::Field& field,
+              const std::string& key) const;
+
+    /** Get name of cache file for the local process.
+     *
+     * @param[in] field Auxiliary field.
+     * @param[in] key Key for cache.
+     * @returns Name of cache file.
+     */
+    std::string getFilename(const pylith::topology::Field& field,
+                            const std::string& key) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _directory; ///< Directory for cache files.
+    std::string _name; ///< Name of cache.
+    std::string _signature; ///< Signature of spatial databases.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////
+private:
+
+    AuxiliaryCache(const AuxiliaryCache&); ///< Not implemented.
+    const AuxiliaryCache& operator=(const AuxiliaryCache&); ///< Not implemented
+
+}; // class AuxiliaryCache
+
+// End of file
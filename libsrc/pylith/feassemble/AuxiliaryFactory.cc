@@ -12,6 +12,7 @@
 
 #include "pylith/feassemble/AuxiliaryFactory.hh" // implementation of object methods
 
+#include "pylith/feassemble/AuxiliaryCache.hh" // HOLDSA AuxiliaryCache
 #include "pylith/topology/Field.hh" // HOLDSA AuxiliaryField
 #include "pylith/topology/FieldQuery.hh" // USES FieldQuery
 
@@ -21,12 +22,14 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL*
 
 #include <cassert>
+#include <cstring> // USES strlen()
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::feassemble::AuxiliaryFactory::AuxiliaryFactory(void) :
     _queryDB(NULL),
-    _fieldQuery(NULL) {
+    _fieldQuery(NULL),
+    _cache(NULL) {
     GenericComponent::setName("auxiliaryfactory");
 } // constructor
 
@@ -37,6 +40,7 @@ pylith::feassemble::AuxiliaryFactory::~AuxiliaryFactory(void) {
     _queryDB = NULL; // :TODO: use shared pointer
 
     delete _fieldQuery;_fieldQuery = NULL;
+    delete _cache;_cache = NULL;
 } // destructor
 
 
@@ -56,6 +60,24 @@ pylith::feassemble::AuxiliaryFactory::getQueryDB(void) const {
 } // getQueryDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set cache for values of auxiliary subfields from spatial database.
+void
+pylith::feassemble::AuxiliaryFactory::setCache(const char* directory,
+                                               const char* name,
+                                               const char* signature) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setCache(directory="<<directory<<", name="<<name<<", signature="<<signature<<")");
+
+    delete _cache;_cache = NULL;
+    if (directory && strlen(directory) > 0) {
+        _cache = new pylith::feassemble::AuxiliaryCache(directory, name, signature);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setCache
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialie factory for setting up auxiliary subfields.
 void
@@ -83,10 +105,19 @@ pylith::feassemble::AuxiliaryFactory::setValuesFromDB(void) {
     assert(_normalizer);
 
     if (_queryDB) {
+        assert(_field);
         assert(_fieldQuery);
-        _fieldQuery->openDB(_queryDB, _normalizer->getLengthScale());
-        _fieldQuery->queryDB();
-        _fieldQuery->closeDB(_queryDB);
+        const std::string& cacheKey = (_cache) ? _cache->computeKey(*_field, *_normalizer) : std::string();
+        if (_cache && _cache->load(_field, cacheKey)) {
+            PYLITH_JOURNAL_INFO("Loaded auxiliary subfields from cache '"<<_cache->getFilename(*_field, cacheKey)<<"'.");
+        } else {
+            _fieldQuery->openDB(_queryDB, _normalizer->getLengthScale());
+            _fieldQuery->queryDB();
+            _fieldQuery->closeDB(_queryDB);
+            if (_cache) {
+                _cache->save(*_field, cacheKey);
+            } // if
+        } // if/else
     } else {
         PYLITH_JOURNAL_ERROR("Unknown case for filling auxiliary subfields.");
         throw std::logic_error("Unknown case for filling auxiliary subfields.");
@@ -42,6 +42,19 @@ public:
      */
     const spatialdata::spatialdb::SpatialDB* getQueryDB(void) const;
 
+    /** Set cache for values of auxiliary subfields from spatial database.
+     *
+     * If the cache is current, the values are loaded from the cache instead of querying the spatial
+     * database; otherwise, the values are written to the cache after querying the spatial database.
+     *
+     * @param[in] directory Directory for cache files.
+     * @param[in] name Name of cache (physics identifier).
+     * @param[in] signature Signature of spatial databases used to populate the auxiliary field.
+     */
+    void setCache(const char* directory,
+                  const char* name,
+                  const char* signature);
+
     /** Initialize factory for setting up auxiliary subfields.
      *
      * @param[inout] field Auxiliary field for which subfields are to be created.
@@ -84,6 +97,9 @@ protected:
     /// Field query for filling subfield values via spatial database.
     pylith::topology::FieldQuery* _fieldQuery;
 
+    /// Cache for subfield values (NULL if not used).
+    pylith::feassemble::AuxiliaryCache* _cache;
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
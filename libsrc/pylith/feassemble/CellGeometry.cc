@@ -0,0 +1,139 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/feassemble/CellGeometry.hh" // implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <petscsnes.h> // USES DMSNESGetFEGeom()
+#include <petscfe.h> // USES PetscFEGeom
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace feassemble {
+        class _CellGeometry {
+public:
+
+            /** Create geometry for cells at points of quadrature.
+             *
+             * @param[in] coordField Coordinate field.
+             * @param[in] cellsIS PETSc IS of cells.
+             * @param[in] quadrature Quadrature.
+             * @returns Number of bytes in geometry.
+             */
+            static
+            size_t createFEGeom(DMField coordField,
+                                PetscIS cellsIS,
+                                PetscQuadrature quadrature);
+
+        }; // _CellGeometry
+    } // feassemble
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Create geometry at quadrature points for cells.
+size_t
+pylith::feassemble::CellGeometry::create(PetscDM dm,
+                                         PetscDS ds,
+                                         PetscIS cellsIS) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+    assert(ds);
+
+    if (!cellsIS) {
+        PYLITH_METHOD_RETURN(0);
+    } // if
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    DMField coordField = NULL;
+    PetscInt maxDegree = PETSC_INT_MAX;
+    err = DMGetCoordinateField(dm, &coordField);PYLITH_CHECK_ERROR(err);assert(coordField);
+    err = DMFieldGetDegree(coordField, cellsIS, NULL, &maxDegree);PYLITH_CHECK_ERROR(err);
+
+    size_t numBytes = 0;
+    PetscQuadrature affineQuadrature = NULL;
+    if (maxDegree <= 1) {
+        err = DMFieldCreateDefaultQuadrature(coordField, cellsIS, &affineQuadrature);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (affineQuadrature) {
+        numBytes += _CellGeometry::createFEGeom(coordField, cellsIS, affineQuadrature);
+        err = PetscQuadratureDestroy(&affineQuadrature);PYLITH_CHECK_ERROR(err);
+    } else {
+        PetscInt numFields = 0;
+        err = PetscDSGetNumFields(ds, &numFields);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            PetscObject discretization = NULL;
+            PetscClassId classId = 0;
+            err = PetscDSGetDiscretization(ds, iField, &discretization);PYLITH_CHECK_ERROR(err);
+            err = PetscObjectGetClassId(discretization, &classId);PYLITH_CHECK_ERROR(err);
+            if (classId != PETSCFE_CLASSID) { continue; }
+
+            PetscQuadrature quadrature = NULL;
+            err = PetscFEGetQuadrature((PetscFE) discretization, &quadrature);PYLITH_CHECK_ERROR(err);
+            numBytes += _CellGeometry::createFEGeom(coordField, cellsIS, quadrature);
+        } // for
+    } // if/else
+
+    PYLITH_METHOD_RETURN(numBytes);
+} // create
+
+
+// ------------------------------------------------------------------------------------------------
+// Get PETSc IS of cells to use in assembly.
+PetscIS
+pylith::feassemble::CellGeometry::getCellsIS(PetscIS cellsIS,
+                                             const bool cacheGeometry) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscIS assemblyIS = NULL;
+    if (!cellsIS) {
+        PYLITH_METHOD_RETURN(assemblyIS);
+    } else if (cacheGeometry) {
+        err = PetscObjectReference((PetscObject) cellsIS);PYLITH_CHECK_ERROR(err);
+        assemblyIS = cellsIS;
+    } else {
+        err = ISDuplicate(cellsIS, &assemblyIS);PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    PYLITH_METHOD_RETURN(assemblyIS);
+} // getCellsIS
+
+
+// ------------------------------------------------------------------------------------------------
+// Create geometry for cells at points of quadrature.
+size_t
+pylith::feassemble::_CellGeometry::createFEGeom(DMField coordField,
+                                                PetscIS cellsIS,
+                                                PetscQuadrature quadrature) {
+    PYLITH_METHOD_BEGIN;
+    assert(quadrature);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscFEGeom* geometry = NULL;
+    err = DMSNESGetFEGeom(coordField, cellsIS, quadrature, PETSC_FEGEOM_BASIC, &geometry);PYLITH_CHECK_ERROR(err);
+    assert(geometry);
+
+    // Coordinates, Jacobian, inverse of Jacobian, and determinant of Jacobian at each point.
+    const size_t numPoints = size_t(geometry->numCells) * size_t(geometry->numPoints);
+    const size_t dimEmbed = size_t(geometry->dimEmbed);
+    const size_t numBytes = numPoints * (dimEmbed + 2*dimEmbed*dimEmbed + 1) * sizeof(PetscReal);
+
+    err = DMSNESRestoreFEGeom(coordField, cellsIS, quadrature, PETSC_FALSE, &geometry);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(numBytes);
+} // createFEGeom
+
+
+// End of file
@@ -0,0 +1,73 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM, PetscDS, PetscIS
+
+#include <cstddef> // USES size_t
+
+/** @brief Cell geometry at quadrature points reused across residual and Jacobian evaluations.
+ *
+ * PETSc finite-element assembly gets the cell geometry (coordinates, Jacobians, inverse Jacobians,
+ * and determinants at the quadrature points) from DMSNESGetFEGeom(), which keeps the geometry with
+ * the PETSc IS of cells. Integrators hold persistent IS of cells, so PETSc already reuses the
+ * geometry computed for an IS until the IS is destroyed.
+ *
+ * When the geometry is cached (default), we create it when the IS of cells is created, so the
+ * memory shows up in the memory registry rather than in the first evaluation. When it is not cached
+ * (to reduce memory use), assembly uses a temporary copy of the IS of cells, so the geometry is
+ * computed on the fly and discarded after each evaluation.
+ */
+class pylith::feassemble::CellGeometry {
+    friend class TestCellGeometry; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Create geometry at quadrature points for cells.
+     *
+     * Uses the same quadrature as PETSc assembly: the default quadrature of the coordinate field
+     * for affine cells and the quadrature of each field in the PetscDS otherwise.
+     *
+     * @param[in] dm PETSc DM for mesh.
+     * @param[in] ds PETSc DS for cells.
+     * @param[in] cellsIS PETSc IS of cells (geometry is kept with the IS).
+     * @returns Number of bytes in geometry.
+     */
+    static
+    size_t create(PetscDM dm,
+                  PetscDS ds,
+                  PetscIS cellsIS);
+
+    /** Get PETSc IS of cells to use in assembly.
+     *
+     * The caller is responsible for calling ISDestroy() on the returned IS.
+     *
+     * @param[in] cellsIS PETSc IS of cells.
+     * @param[in] cacheGeometry True if geometry is kept with the IS of cells, false if geometry is
+     * computed on the fly.
+     * @returns PETSc IS of cells (new reference to cellsIS if geometry is cached, otherwise a copy).
+     */
+    static
+    PetscIS getCellsIS(PetscIS cellsIS,
+                       const bool cacheGeometry);
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    CellGeometry(void); ///< Not implemented.
+    CellGeometry(const CellGeometry&); ///< Not implemented.
+    const CellGeometry& operator=(const CellGeometry&); ///< Not implemented
+
+}; // class CellGeometry
+
+// End of file
@@ -80,6 +80,47 @@ public:
     /// Remove overlap from list of cells in label.
     void removeOverlap(void);
 
+    /** Split cells into interior cells and ghosted cells.
+     *
+     * Interior cells have no ghost points (leaves of the point SF) and no points in the labels of
+     * essential boundary conditions in their closure, so their residual depends only on values
+     * the scatter of the solution copies on this process. Ghosted cells are all other cells.
+     *
+     * @important The essential boundary conditions must be in the PetscDS of the DM, so call this
+     * after the constraints have been added.
+     */
+    void splitGhostedCells(void);
+
+    /** Check whether cells have been split into interior and ghosted cells.
+     *
+     * @returns True if splitGhostedCells() has been called, false otherwise.
+     */
+    bool hasSplitCells(void) const;
+
+    /** Get PETSc IS of interior cells.
+     *
+     * @returns PETSc IS (NULL if there are no cells or splitGhostedCells() has not been called).
+     */
+    PetscIS interiorCellsIS(void) const;
+
+    /** Get number of interior cells.
+     *
+     * @returns Number of cells.
+     */
+    PetscInt numInteriorCells(void) const;
+
+    /** Get PETSc IS of ghosted cells.
+     *
+     * @returns PETSc IS (NULL if there are no cells or splitGhostedCells() has not been called).
+     */
+    PetscIS ghostedCellsIS(void) const;
+
+    /** Get number of ghosted cells.
+     *
+     * @returns Number of cells.
+     */
+    PetscInt numGhostedCells(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -89,6 +130,11 @@ private:
     PetscWeakForm _weakForm; ///< Cached PETSc weak form for PetscDS.
     PetscIS _cellsIS; ///< Cached PETSc IS of cells for label and value.
     PetscInt _numCells; ///< Number of cells in PETSc IS.
+    PetscIS _interiorCellsIS; ///< Cached PETSc IS of interior cells.
+    PetscInt _numInteriorCells; ///< Number of interior cells.
+    PetscIS _ghostedCellsIS; ///< Cached PETSc IS of ghosted cells.
+    PetscInt _numGhostedCells; ///< Number of ghosted cells.
+    bool _hasSplitCells; ///< True if cells have been split into interior and ghosted cells.
     PetscInt _value; ///< Label value.
     std::string _name; ///< Name of label;
 
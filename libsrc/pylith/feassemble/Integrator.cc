@@ -182,9 +182,9 @@ pylith::feassemble::Integrator::initialize(const pylith::topology::Field& soluti
     PYLITH_JOURNAL_DEBUG("initialize(solution="<<solution.getLabel()<<")");
     _Integrator::Events::logger.eventBegin(_Integrator::Events::initialize);
 
-    const pylith::topology::Mesh& physicsDomainMesh = getPhysicsDomainMesh();
-    delete _auxiliaryField;_auxiliaryField = _physics->createAuxiliaryField(solution, physicsDomainMesh);
-    delete _diagnosticField;_diagnosticField = _physics->createDiagnosticField(solution, physicsDomainMesh);
+    const pylith::topology::Mesh& fieldsMesh = _getFieldsMesh();
+    delete _auxiliaryField;_auxiliaryField = _physics->createAuxiliaryField(solution, fieldsMesh);
+    delete _diagnosticField;_diagnosticField = _physics->createDiagnosticField(solution, fieldsMesh);
     _computeDiagnosticField();
     _observers = _physics->getObservers(); // Memory managed by Physics
     if (_observers) {
@@ -196,7 +196,7 @@ pylith::feassemble::Integrator::initialize(const pylith::topology::Field& soluti
     } // if
     delete _diagnosticField;_diagnosticField = NULL;
 
-    delete _derivedField;_derivedField = _physics->createDerivedField(solution, physicsDomainMesh);
+    delete _derivedField;_derivedField = _physics->createDerivedField(solution, fieldsMesh);
 
     _Integrator::Events::logger.eventEnd(_Integrator::Events::initialize);
     PYLITH_METHOD_END;
@@ -227,7 +227,10 @@ pylith::feassemble::Integrator::poststep(const PylithReal t,
     _Integrator::Events::logger.eventBegin(_Integrator::Events::poststep);
 
     _updateStateVars(t, dt, solution);
-    _computeDerivedField(t, dt, solution);
+    // Derived field is only used for output.
+    if ((notification != pylith::problems::Observer::SOLUTION) || observersWillWrite(t, tindex, solution)) {
+        _computeDerivedField(t, dt, solution);
+    } // if
     notifyObservers(t, tindex, solution, notification);
 
     _Integrator::Events::logger.eventEnd(_Integrator::Events::poststep);
@@ -235,6 +238,49 @@ pylith::feassemble::Integrator::poststep(const PylithReal t,
 } // poststep
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute RHS residual for G(t,s) over subset of cells.
+void
+pylith::feassemble::Integrator::computeRHSResidualCells(pylith::topology::Field* residual,
+                                                        const pylith::feassemble::IntegrationData& integrationData,
+                                                        const ResidualCells cells) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeRHSResidualCells(residual="<<residual<<", cells="<<cells<<")");
+
+    // Without a split of the cells, integrate over all cells once the ghost values are available.
+    if (INTERIOR_CELLS != cells) {
+        computeRHSResidual(residual, integrationData);
+    } // if
+
+    PYLITH_METHOD_END;
+} // computeRHSResidualCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute LHS residual for F(t,s,\dot{s}) over subset of cells.
+void
+pylith::feassemble::Integrator::computeLHSResidualCells(pylith::topology::Field* residual,
+                                                        const pylith::feassemble::IntegrationData& integrationData,
+                                                        const ResidualCells cells) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeLHSResidualCells(residual="<<residual<<", cells="<<cells<<")");
+
+    if (INTERIOR_CELLS != cells) {
+        computeLHSResidual(residual, integrationData);
+    } // if
+
+    PYLITH_METHOD_END;
+} // computeLHSResidualCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get mesh for auxiliary, diagnostic, and derived fields.
+const pylith::topology::Mesh&
+pylith::feassemble::Integrator::_getFieldsMesh(void) const {
+    return getPhysicsDomainMesh();
+} // _getFieldsMesh
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set constants used in finite-element kernels (point-wise functions).
 void
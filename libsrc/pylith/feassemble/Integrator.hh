@@ -37,6 +37,12 @@ public:
         NEW_JACOBIAN_UPDATE_STATE_VARS=0x4, // Needs new Jacobian after updating state variables.
     };
 
+    enum ResidualCells {
+        ALL_CELLS=0, // All cells in integration domain.
+        INTERIOR_CELLS=1, // Cells without ghost points or constrained DOF in their closure.
+        GHOSTED_CELLS=2, // Cells with ghost points or constrained DOF in their closure.
+    };
+
     // PUBLIC STRUCTS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -167,6 +173,35 @@ public:
     void computeLHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData) = 0;
 
+    /** Compute RHS residual for G(t,s) over subset of cells.
+     *
+     * Residuals over interior cells do not depend on the values of the solution at ghost points
+     * or on constrained values, so they can be computed before the ghost values have been
+     * received and the constrained values have been set. The default implementation computes the
+     * residual over all cells with the ghosted cells.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] cells Subset of cells in integration domain.
+     */
+    virtual
+    void computeRHSResidualCells(pylith::topology::Field* residual,
+                                 const pylith::feassemble::IntegrationData& integrationData,
+                                 const ResidualCells cells);
+
+    /** Compute LHS residual for F(t,s,\dot{s}) over subset of cells.
+     *
+     * The default implementation computes the residual over all cells with the ghosted cells.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] cells Subset of cells in integration domain.
+     */
+    virtual
+    void computeLHSResidualCells(pylith::topology::Field* residual,
+                                 const pylith::feassemble::IntegrationData& integrationData,
+                                 const ResidualCells cells);
+
     /** Compute LHS Jacobian and preconditioner for F(t,s,\dot{s}) with implicit time-stepping.
      *
      * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
@@ -190,6 +225,15 @@ public:
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
+    /** Get mesh for auxiliary, diagnostic, and derived fields.
+     *
+     * The default implementation uses the mesh associated with the integration domain.
+     *
+     * @returns Mesh for auxiliary, diagnostic, and derived fields.
+     */
+    virtual
+    const pylith::topology::Mesh& _getFieldsMesh(void) const;
+
     /** Set constants used in finite-element kernels.
      *
      * @param[in] solution Solution field.
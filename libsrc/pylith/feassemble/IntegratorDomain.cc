@@ -14,20 +14,21 @@
 
 #include "pylith/feassemble/UpdateStateVars.hh" // HOLDSA UpdateStateVars
 #include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
+#include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
 #include "pylith/problems/Physics.hh" // USES Physics
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
 #include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface::FaceEnum
 #include "pylith/feassemble/InterfacePatches.hh" // USES InterfacePatches
 #include "pylith/topology/Mesh.hh" // USES Mesh
-#include "pylith/topology/MeshOps.hh" // USES createSubdomainMesh()
+#include "pylith/topology/SubdomainView.hh" // HOLDSA SubdomainView
 #include "pylith/topology/Field.hh" // USES Field
-#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "spatialdata/spatialdb/GravityField.hh" // HASA GravityField
 #include "petscds.h" // USES PetscDS
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
@@ -86,6 +87,24 @@ public:
                 static PylithInt updateStateVars;
                 static PylithInt computeDerivedField;
             };
+
+            /** Get cells for subset of integration domain.
+             *
+             * When cells are split into interior and ghosted cells, all cells are the interior cells plus
+             * the ghosted cells, so cell geometry is cached only once for each cell.
+             *
+             * @param[out] cellsIS Array of PETSc IS with cells [maxNumCellsIS].
+             * @param[in] dsLabel Label for integration domain.
+             * @param[in] cells Subset of cells.
+             * @returns Number of PETSc IS with cells to integrate over.
+             */
+            static
+            size_t getCellsIS(PetscIS cellsIS[],
+                              const pylith::feassemble::DSLabelAccess& dsLabel,
+                              const pylith::feassemble::Integrator::ResidualCells cells);
+
+            static const size_t maxNumCellsIS; ///< Maximum number of IS with cells for subset of integration domain.
+
         };
 
     }
@@ -118,14 +137,58 @@ pylith::feassemble::_IntegratorDomain::Events::init(void) {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+const size_t pylith::feassemble::_IntegratorDomain::maxNumCellsIS = 2;
+
+// ------------------------------------------------------------------------------------------------
+// Get cells for subset of integration domain.
+size_t
+pylith::feassemble::_IntegratorDomain::getCellsIS(PetscIS cellsIS[],
+                                                  const pylith::feassemble::DSLabelAccess& dsLabel,
+                                                  const pylith::feassemble::Integrator::ResidualCells cells) {
+    assert(cellsIS);
+
+    // Without ghosted cells, the interior cells are all of the cells, so we use the IS of all cells.
+    const bool isSplit = dsLabel.numGhostedCells() > 0;
+    size_t numIS = 0;
+    switch (cells) {
+    case pylith::feassemble::Integrator::ALL_CELLS:
+        if (!isSplit) {
+            cellsIS[numIS++] = dsLabel.cellsIS();
+        } else {
+            if (dsLabel.numInteriorCells() > 0) {
+                cellsIS[numIS++] = dsLabel.interiorCellsIS();
+            } // if
+            cellsIS[numIS++] = dsLabel.ghostedCellsIS();
+        } // if/else
+        break;
+    case pylith::feassemble::Integrator::INTERIOR_CELLS:
+        if (dsLabel.numInteriorCells() > 0) {
+            cellsIS[numIS++] = isSplit ? dsLabel.interiorCellsIS() : dsLabel.cellsIS();
+        } // if
+        break;
+    case pylith::feassemble::Integrator::GHOSTED_CELLS:
+        if (isSplit) {
+            cellsIS[numIS++] = dsLabel.ghostedCellsIS();
+        } // if
+        break;
+    default:
+        PYLITH_JOURNAL_LOGICERROR("Unknown subset of cells '" << cells << "'.");
+    } // switch
+    assert(numIS <= maxNumCellsIS);
+    return numIS;
+} // getCellsIS
+
+
 // ------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::feassemble::IntegratorDomain::IntegratorDomain(pylith::problems::Physics* const physics) :
     Integrator(physics),
-    _materialMesh(NULL),
+    _materialView(NULL),
     _updateState(NULL),
     _jacobianValues(NULL),
-    _dsLabel(NULL) {
+    _dsLabel(NULL),
+    _cellGeometryBytes(0) {
     GenericComponent::setName("integratordomain");
     _IntegratorDomain::Events::init();
 } // constructor
@@ -146,9 +209,10 @@ pylith::feassemble::IntegratorDomain::deallocate(void) {
 
     pylith::feassemble::Integrator::deallocate();
 
-    delete _materialMesh;_materialMesh = NULL;
+    delete _materialView;_materialView = NULL;
     delete _updateState;_updateState = NULL;
     delete _jacobianValues;_jacobianValues = NULL;
+    pylith::utils::MemoryRegistry::remove(_dsLabel);
     delete _dsLabel;_dsLabel = NULL;
 
     PYLITH_METHOD_END;
@@ -159,11 +223,29 @@ pylith::feassemble::IntegratorDomain::deallocate(void) {
 // Get mesh associated with integration domain.
 const pylith::topology::Mesh&
 pylith::feassemble::IntegratorDomain::getPhysicsDomainMesh(void) const {
-    assert(_materialMesh);
-    return *_materialMesh;
+    assert(_materialView);
+    return _materialView->getMesh();
 } // domainMesh
 
 
+// ------------------------------------------------------------------------------------------------
+// Get view of material cells in domain mesh.
+const pylith::topology::SubdomainView&
+pylith::feassemble::IntegratorDomain::getPhysicsDomainView(void) const {
+    assert(_materialView);
+    return *_materialView;
+} // getPhysicsDomainView
+
+
+// ------------------------------------------------------------------------------------------------
+// Get mesh for auxiliary, diagnostic, and derived fields.
+const pylith::topology::Mesh&
+pylith::feassemble::IntegratorDomain::_getFieldsMesh(void) const {
+    assert(_materialView);
+    return _materialView->getRegionMesh();
+} // _getFieldsMesh
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::feassemble::IntegratorDomain::setKernelsResidual(const std::vector<ResidualKernels>& kernels,
@@ -284,9 +366,8 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
     PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" initialize(solution="<<solution.getLabel()<<")");
     _IntegratorDomain::Events::logger.eventBegin(_IntegratorDomain::Events::initialize);
 
-    delete _materialMesh;
-    _materialMesh = pylith::topology::MeshOps::createSubdomainMesh(solution.getMesh(), _labelName.c_str(), _labelValue, ":UNKOWN:");
-    pylith::topology::CoordsVisitor::optimizeClosure(_materialMesh->getDM());
+    delete _materialView;
+    _materialView = new pylith::topology::SubdomainView(solution.getMesh(), _labelName.c_str(), _labelValue, ":UNKOWN:");
 
     Integrator::initialize(solution);
 
@@ -304,9 +385,12 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
         _updateState->initialize(*_auxiliaryField);
     } // if
 
+    pylith::utils::MemoryRegistry::remove(_dsLabel);
     delete _dsLabel;_dsLabel = new DSLabelAccess(solution.getDM(), _labelName.c_str(), _labelValue);assert(_dsLabel);
     _dsLabel->removeOverlap();
 
+    _splitCells();
+
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing auxiliary field.");
@@ -431,9 +515,35 @@ pylith::feassemble::IntegratorDomain::setState(const PylithReal t) {
 void
 pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field* residual,
                                                          const pylith::feassemble::IntegrationData& integrationData) {
+    computeRHSResidualCells(residual, integrationData, ALL_CELLS);
+} // computeRHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute LHS residual for F(t,s,\dot{s}).
+void
+pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field* residual,
+                                                         const pylith::feassemble::IntegrationData& integrationData) {
+    computeLHSResidualCells(residual, integrationData, ALL_CELLS);
+} // computeLHSResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute RHS residual for G(t,s) over subset of cells.
+void
+pylith::feassemble::IntegratorDomain::computeRHSResidualCells(pylith::topology::Field* residual,
+                                                              const pylith::feassemble::IntegrationData& integrationData,
+                                                              const ResidualCells cells) {
     if (!_hasRHSResidual) { return; }
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeRHSResidualCells(residual="<<residual<<", integrationData="<<integrationData.str()<<", cells="<<cells<<")");
+
+    assert(_dsLabel);
+    PetscIS cellsIS[_IntegratorDomain::maxNumCellsIS];
+    const size_t numCellsIS = _IntegratorDomain::getCellsIS(cellsIS, *_dsLabel, cells);
+    if (!numCellsIS) {
+        PYLITH_METHOD_END;
+    } // if
     _IntegratorDomain::Events::logger.eventBegin(_IntegratorDomain::Events::computeRHSResidual);
     assert(residual);
 
@@ -444,7 +554,6 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
 
     _setKernelConstants(*solution, dt);
 
-    assert(_dsLabel);
     PetscFormKey key;
     key.label = _dsLabel->label();
     key.value = _dsLabel->value();
@@ -454,22 +563,34 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
     assert(solution->getLocalVector());
     assert(residual->getLocalVector());
     PetscVec solutionDotVec = NULL;
-    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
-                                         solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    for (size_t iIS = 0; iIS < numCellsIS; ++iIS) {
+        PetscIS assemblyIS = CellGeometry::getCellsIS(cellsIS[iIS], _physics->getCacheCellGeometry());
+        err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, assemblyIS, PETSC_MIN_REAL, solution->getLocalVector(),
+                                             solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+    } // for
 
     _IntegratorDomain::Events::logger.eventEnd(_IntegratorDomain::Events::computeRHSResidual);
     PYLITH_METHOD_END;
-} // computeRHSResidual
+} // computeRHSResidualCells
 
 
 // ------------------------------------------------------------------------------------------------
-// Compute LHS residual for F(t,s,\dot{s}).
+// Compute LHS residual for F(t,s,\dot{s}) over subset of cells.
 void
-pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field* residual,
-                                                         const pylith::feassemble::IntegrationData& integrationData) {
+pylith::feassemble::IntegratorDomain::computeLHSResidualCells(pylith::topology::Field* residual,
+                                                              const pylith::feassemble::IntegrationData& integrationData,
+                                                              const ResidualCells cells) {
     if (!_hasLHSResidual) { return; }
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidual(residual="<<residual<<", integrationData="<<integrationData.str()<<")");
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" computeLHSResidualCells(residual="<<residual<<", integrationData="<<integrationData.str()<<", cells="<<cells<<")");
+
+    assert(_dsLabel);
+    PetscIS cellsIS[_IntegratorDomain::maxNumCellsIS];
+    const size_t numCellsIS = _IntegratorDomain::getCellsIS(cellsIS, *_dsLabel, cells);
+    if (!numCellsIS) {
+        PYLITH_METHOD_END;
+    } // if
     _IntegratorDomain::Events::logger.eventBegin(_IntegratorDomain::Events::computeLHSResidual);
 
     const pylith::topology::Field* solution = integrationData.getField(pylith::feassemble::IntegrationData::solution);
@@ -481,7 +602,6 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
 
     _setKernelConstants(*solution, dt);
 
-    assert(_dsLabel);
     PetscFormKey key;
     key.label = _dsLabel->label();
     key.value = _dsLabel->value();
@@ -491,12 +611,16 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
     assert(solution->getLocalVector());
     assert(solutionDot->getLocalVector());
     assert(residual->getLocalVector());
-    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
-                                         solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    for (size_t iIS = 0; iIS < numCellsIS; ++iIS) {
+        PetscIS assemblyIS = CellGeometry::getCellsIS(cellsIS[iIS], _physics->getCacheCellGeometry());
+        err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, assemblyIS, PETSC_MIN_REAL, solution->getLocalVector(),
+                                             solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+    } // for
 
     _IntegratorDomain::Events::logger.eventEnd(_IntegratorDomain::Events::computeLHSResidual);
     PYLITH_METHOD_END;
-} // computeLHSResidual
+} // computeLHSResidualCells
 
 
 // ------------------------------------------------------------------------------------------------
@@ -532,8 +656,14 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
     assert(solutionDot->getLocalVector());
     assert(jacobianMat);
     assert(precondMat);
-    err = DMPlexComputeJacobian_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), t, s_tshift, solution->getLocalVector(),
-                                         solutionDot->getLocalVector(), jacobianMat, precondMat, NULL);PYLITH_CHECK_ERROR(err);
+    PetscIS cellsIS[_IntegratorDomain::maxNumCellsIS];
+    const size_t numCellsIS = _IntegratorDomain::getCellsIS(cellsIS, *_dsLabel, ALL_CELLS);
+    for (size_t iIS = 0; iIS < numCellsIS; ++iIS) {
+        PetscIS assemblyIS = CellGeometry::getCellsIS(cellsIS[iIS], _physics->getCacheCellGeometry());
+        err = DMPlexComputeJacobian_Internal(_dsLabel->dm(), key, assemblyIS, t, s_tshift, solution->getLocalVector(),
+                                             solutionDot->getLocalVector(), jacobianMat, precondMat, NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+    } // for
 
     if (_jacobianValues) {
         _jacobianValues->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, *solution, *_dsLabel);
@@ -583,8 +713,14 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
 
     assert(jacobianInv);
     assert(jacobianInv->getLocalVector());
-    err = DMPlexComputeJacobian_Action_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), t, s_tshift, vecRowSum, NULL,
-                                                vecRowSum, jacobianInv->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    PetscIS cellsIS[_IntegratorDomain::maxNumCellsIS];
+    const size_t numCellsIS = _IntegratorDomain::getCellsIS(cellsIS, *_dsLabel, ALL_CELLS);
+    for (size_t iIS = 0; iIS < numCellsIS; ++iIS) {
+        PetscIS assemblyIS = CellGeometry::getCellsIS(cellsIS[iIS], _physics->getCacheCellGeometry());
+        err = DMPlexComputeJacobian_Action_Internal(_dsLabel->dm(), key, assemblyIS, t, s_tshift, vecRowSum, NULL,
+                                                    vecRowSum, jacobianInv->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+    } // for
 
     err = DMRestoreLocalVector(_dsLabel->dm(), &vecRowSum);PYLITH_CHECK_ERROR(err);
     // Compute the Jacobian inverse.
@@ -680,4 +816,31 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
 } // _computeDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Split cells into interior and ghosted cells.
+void
+pylith::feassemble::IntegratorDomain::_splitCells(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_dsLabel);
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" _splitCells()");
+
+    _dsLabel->splitGhostedCells();
+
+    assert(_physics);
+    _cellGeometryBytes = 0;
+    if (_physics->getCacheCellGeometry()) {
+        // Operations over all cells use the IS of interior and ghosted cells when the cells are split,
+        // so geometry is created only for the IS used in assembly and not also for the IS of all cells.
+        PetscIS cellsIS[_IntegratorDomain::maxNumCellsIS];
+        const size_t numCellsIS = _IntegratorDomain::getCellsIS(cellsIS, *_dsLabel, ALL_CELLS);
+        for (size_t iIS = 0; iIS < numCellsIS; ++iIS) {
+            _cellGeometryBytes += CellGeometry::create(_dsLabel->dm(), _dsLabel->ds(), cellsIS[iIS]);
+        } // for
+        pylith::utils::MemoryRegistry::add(_dsLabel, "geometry", "cell geometry", _cellGeometryBytes);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _splitCells
+
+
 // End of file
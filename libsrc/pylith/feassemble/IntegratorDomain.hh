@@ -15,6 +15,8 @@
 #include "pylith/feassemble/JacobianValues.hh" // USES JacobianValues::JacobianKernels
 #include "pylith/utils/arrayfwd.hh" // HASA std::vector
 
+#include <cstddef> // HASA size_t
+
 class pylith::feassemble::IntegratorDomain : public pylith::feassemble::Integrator {
     friend class TestIntegratorDomain; // unit testing
 
@@ -99,11 +101,20 @@ public:
     void deallocate(void);
 
     /** Get mesh associated with integrator domain.
+     *
+     * The mesh is created from the view of the material cells the first time it is requested, for
+     * example by observers writing output over the material.
      *
      * @returns Mesh associated with integrator domain.
      */
     const pylith::topology::Mesh& getPhysicsDomainMesh(void) const;
 
+    /** Get view of material cells in domain mesh.
+     *
+     * @returns View of material cells.
+     */
+    const pylith::topology::SubdomainView& getPhysicsDomainView(void) const;
+
     /** Set kernels for residual.
      *
      * @param[in] kernels Array of kernels for computing the residual.
@@ -177,6 +188,26 @@ public:
     void computeLHSResidual(pylith::topology::Field* residual,
                             const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Compute RHS residual for G(t,s) over subset of cells.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] cells Subset of cells in integration domain.
+     */
+    void computeRHSResidualCells(pylith::topology::Field* residual,
+                                 const pylith::feassemble::IntegrationData& integrationData,
+                                 const ResidualCells cells);
+
+    /** Compute LHS residual for F(t,s,\dot{s}) over subset of cells.
+     *
+     * @param[out] residual Field for residual.
+     * @param[in] integrationData Data needed to integrate governing equations.
+     * @param[in] cells Subset of cells in integration domain.
+     */
+    void computeLHSResidualCells(pylith::topology::Field* residual,
+                                 const pylith::feassemble::IntegrationData& integrationData,
+                                 const ResidualCells cells);
+
     /** Compute LHS Jacobian and preconditioner for F(t,s,\dot{s}) with implicit time-stepping.
      *
      * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
@@ -198,6 +229,16 @@ public:
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
+    /** Get mesh for auxiliary, diagnostic, and derived fields.
+     *
+     * The fields use the region mesh of the material view, which shares the topology of the domain
+     * mesh, so assembly uses them with the material label on the solution DM and the material mesh
+     * is not created unless an observer requests it.
+     *
+     * @returns Mesh for auxiliary, diagnostic, and derived fields.
+     */
+    const pylith::topology::Mesh& _getFieldsMesh(void) const;
+
     /** Update state variables as needed.
      *
      * @param[in] t Current time.
@@ -218,17 +259,28 @@ protected:
                               const PylithReal dt,
                               const pylith::topology::Field& solution);
 
+    /** Split cells into interior and ghosted cells.
+     *
+     * Called once from initialize(). The split uses the essential boundary conditions in the
+     * PetscDS of the solution, so the constraints must be initialized before the integrators.
+     * When cell geometry is cached, it is created once for each cell: for the IS of all cells if no
+     * cells are ghosted, otherwise for the IS of interior and ghosted cells, which operations over
+     * all cells (Jacobian, residual without overlap) then loop over.
+     */
+    void _splitCells(void);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     std::vector<ProjectKernels> _kernelsUpdateStateVars; ///< kernels for updating state variables.
     std::vector<ProjectKernels> _kernelsDerivedField; ///< kernels for computing derived field.
 
-    pylith::topology::Mesh* _materialMesh; ///< Mesh associated with material.
+    pylith::topology::SubdomainView* _materialView; ///< View of material cells in domain mesh.
 
     pylith::feassemble::UpdateStateVars* _updateState; ///< Data structure for layout needed to update state vars.
     pylith::feassemble::JacobianValues* _jacobianValues; ///< Jacobian values without finite-element integration.
     pylith::feassemble::DSLabelAccess* _dsLabel; ///< Information about integration (PETSc DS, Label, label value, etc).
+    size_t _cellGeometryBytes; ///< Number of bytes in cached cell geometry.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
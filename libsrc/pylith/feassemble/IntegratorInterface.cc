@@ -15,6 +15,7 @@
 
 #include "pylith/feassemble/InterfacePatches.hh" // USES InterfacePatches
 #include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
+#include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
 #include "pylith/problems/Physics.hh" // USES Physics
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
 #include "pylith/topology/Mesh.hh" // USES Mesh
@@ -686,8 +687,10 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
 
         assert(solution->getLocalVector());
         assert(residual->getLocalVector());
-        err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, weakFormKeys, patchCellsIS, t, solution->getLocalVector(),
+        PetscIS assemblyIS = CellGeometry::getCellsIS(patchCellsIS, integrator->_physics->getCacheCellGeometry());
+        err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, weakFormKeys, assemblyIS, t, solution->getLocalVector(),
                                                     solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
         err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
         err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
     } // for
@@ -753,9 +756,11 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
         assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, patchCells[0]));
 
         assert(solution->getLocalVector());
-        err = DMPlexComputeJacobian_Hybrid_Internal(dmSoln, weakFormKeys, patchCellsIS, t, s_tshift, solution->getLocalVector(),
+        PetscIS assemblyIS = CellGeometry::getCellsIS(patchCellsIS, integrator->_physics->getCacheCellGeometry());
+        err = DMPlexComputeJacobian_Hybrid_Internal(dmSoln, weakFormKeys, assemblyIS, t, s_tshift, solution->getLocalVector(),
                                                     solutionDot->getLocalVector(), jacobianMat, precondMat,
                                                     NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
         err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
         err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
     }
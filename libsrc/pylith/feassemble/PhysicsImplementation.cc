@@ -58,6 +58,15 @@ pylith::feassemble::PhysicsImplementation::deallocate(void) {
 } // deallocate
 
 
+// ------------------------------------------------------------------------------------------------
+// Get identifier of physics.
+const char*
+pylith::feassemble::PhysicsImplementation::getPhysicsIdentifier(void) const {
+    assert(_physics);
+    return _physics->getIdentifier();
+} // getPhysicsIdentifier
+
+
 // ------------------------------------------------------------------------------------------------
 // Get name of label marking material.
 const char*
@@ -100,6 +109,16 @@ pylith::feassemble::PhysicsImplementation::getDerivedField(void) const {
 } // getDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer of the physics will write output at time t.
+bool
+pylith::feassemble::PhysicsImplementation::observersWillWrite(const PylithReal t,
+                                                              const PylithInt tindex,
+                                                              const pylith::topology::Field& solution) {
+    return (_observers) ? _observers->willWrite(t, tindex, solution) : false;
+} // observersWillWrite
+
+
 // ------------------------------------------------------------------------------------------------
 // Notify observers of current solution.
 void
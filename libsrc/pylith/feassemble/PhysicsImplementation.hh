@@ -47,6 +47,12 @@ public:
     virtual
     const pylith::topology::Mesh& getPhysicsDomainMesh(void) const = 0;
 
+    /** Get identifier of physics.
+     *
+     * @returns Identifier of physics (name of component).
+     */
+    const char* getPhysicsIdentifier(void) const;
+
     /** Get name of label marking material.
      *
      * @returns Name of label for material (from mesh generator).
@@ -77,6 +83,17 @@ public:
      */
     const pylith::topology::Field* getDerivedField(void) const;
 
+    /** Check whether any observer of the physics will write output at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if at least one observer will write output at time t, false otherwise.
+     */
+    bool observersWillWrite(const PylithReal t,
+                            const PylithInt tindex,
+                            const pylith::topology::Field& solution);
+
     /** Notify observers of current solution.
      *
      * @param[in] t Current time.
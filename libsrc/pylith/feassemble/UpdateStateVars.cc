@@ -13,6 +13,7 @@
 #include "pylith/feassemble/UpdateStateVars.hh" // implementation of object methods
 
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 
@@ -24,7 +25,6 @@ pylith::feassemble::UpdateStateVars::UpdateStateVars(void) :
     _stateVarsIS(NULL),
     _stateVarsDM(NULL),
     _stateVarsVecLocal(NULL),
-    _stateVarsVecGlobal(NULL),
     _auxiliaryFieldVecGlobal(NULL) {}
 
 
@@ -45,7 +45,6 @@ pylith::feassemble::UpdateStateVars::deallocate(void) {
     err = ISDestroy(&_stateVarsIS);PYLITH_CHECK_ERROR(err);
     err = DMDestroy(&_stateVarsDM);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
-    err = VecDestroy(&_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
@@ -91,12 +90,20 @@ pylith::feassemble::UpdateStateVars::initialize(const pylith::topology::Field& a
     std::sort(&stateSubfieldIndices[0], &stateSubfieldIndices[numStateSubfields]);
 
     // Create subDM holding only the state vars, which we want to update.
-    err = DMCreateSubDM(auxiliaryDM, numStateSubfields, &stateSubfieldIndices[0], &_stateVarsIS,
+    err = DMCreateSubDM(auxiliaryDM, numStateSubfields, &stateSubfieldIndices[0], NULL,
                         &_stateVarsDM);PYLITH_CHECK_ERROR(err);
-    err = DMCreateGlobalVector(_stateVarsDM, &_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
     err = DMCreateLocalVector(_stateVarsDM, &_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
-
-    err = DMCreateGlobalVector(auxiliaryDM, &_auxiliaryFieldVecGlobal);
+    err = DMCreateGlobalVector(auxiliaryDM, &_auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+
+    // Indices of state vars in the local vector of the auxiliary field, in the layout of the subDM local vector.
+    PetscSection stateVarsSection = NULL;
+    err = DMGetLocalSection(_stateVarsDM, &stateVarsSection);PYLITH_CHECK_ERROR(err);
+    _stateVarsIS = pylith::topology::FieldOps::createSubfieldsIS(auxiliaryField.getLocalSection(), &stateSubfieldIndices[0],
+                                                                 numStateSubfields, stateVarsSection);
+    PetscInt stateVarsSize = 0, isSize = 0;
+    err = VecGetLocalSize(_stateVarsVecLocal, &stateVarsSize);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(_stateVarsIS, &isSize);PYLITH_CHECK_ERROR(err);
+    assert(stateVarsSize == isSize);
 
     PYLITH_METHOD_END;
 } // initialize
@@ -108,17 +115,14 @@ void
 pylith::feassemble::UpdateStateVars::prepare(pylith::topology::Field* auxiliaryField) {
     PYLITH_METHOD_BEGIN;
 
-    // :TODO: Verify that we need the global vectors and can't get by with just using VecISCopy() with the local vector.
+    // The state variables are computed at all points in the local vector (including ghost points)
+    // from the local solution and auxiliary field, so nothing needs to be gathered here. The values
+    // at shared points are made consistent with the owning process in restore().
+    assert(auxiliaryField);
 
     PetscErrorCode err = 0;
     err = VecSet(_stateVarsVecLocal, 0.0);PYLITH_CHECK_ERROR(err);
 
-    // Move auxiliaryDM data to global vector.
-    assert(auxiliaryField);
-    PetscDM auxiliaryDM = auxiliaryField->getDM();
-    err = DMLocalToGlobalBegin(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(auxiliaryDM, auxiliaryField->getLocalVector(), INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
-
     PYLITH_METHOD_END;
 } // prepare
 
@@ -131,18 +135,21 @@ pylith::feassemble::UpdateStateVars::restore(pylith::topology::Field* auxiliaryF
 
     PetscErrorCode err = 0;
     assert(auxiliaryField);
-    PetscDM auxiliaryDM = auxiliaryField->getDM();
-
-    // Move statevarDM data to global vector.
-    err = DMLocalToGlobalBegin(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
 
-    // Copy global data from stateVars to auxiliaryField
-    err = VecISCopy(_auxiliaryFieldVecGlobal, _stateVarsIS, SCATTER_FORWARD, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
-
-    // Move auxiliaryDM data to local vector
-    err = DMGlobalToLocalBegin(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
-    err = DMGlobalToLocalEnd(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryField->getLocalVector());PYLITH_CHECK_ERROR(err);
+    PetscDM auxiliaryDM = auxiliaryField->getDM();
+    PetscVec auxiliaryFieldVecLocal = auxiliaryField->getLocalVector();
+
+    // Copy state vars into local vector of auxiliary field.
+    err = VecISCopy(auxiliaryFieldVecLocal, _stateVarsIS, SCATTER_FORWARD, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+
+    // Values at shared points computed on different processes may differ (for example, with a
+    // continuous discretization the contributions come from different cells), so the value on the
+    // owning process is authoritative. One local-to-global/global-to-local pass of the auxiliary
+    // field replaces the ghost values with the owner's values.
+    err = DMLocalToGlobalBegin(auxiliaryDM, auxiliaryFieldVecLocal, INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(auxiliaryDM, auxiliaryFieldVecLocal, INSERT_VALUES, _auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryFieldVecLocal);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(auxiliaryDM, _auxiliaryFieldVecGlobal, INSERT_VALUES, auxiliaryFieldVecLocal);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // restore
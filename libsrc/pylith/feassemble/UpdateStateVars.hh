@@ -66,10 +66,9 @@ public:
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
-    PetscIS _stateVarsIS; ///< Petsc IS for state vars in auxiliary field.
+    PetscIS _stateVarsIS; ///< Petsc IS for state vars in local vector of auxiliary field.
     PetscDM _stateVarsDM; ///< Petsc DM for state vars subfield.
-    PetscVec _stateVarsVecLocal; ///< Petsc Vec with global vector for state vars.
-    PetscVec _stateVarsVecGlobal; ///< Petsc Vec with global vector for state vars.
+    PetscVec _stateVarsVecLocal; ///< Petsc Vec with local vector for state vars.
     PetscVec _auxiliaryFieldVecGlobal; ///< Petsc Vec with global vector for auxiliary field.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
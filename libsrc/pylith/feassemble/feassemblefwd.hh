@@ -12,6 +12,7 @@
 namespace pylith {
     namespace feassemble {
         class AuxiliaryFactory; ///< Creates auxiliary subfields.
+        class AuxiliaryCache; ///< Persistent cache of auxiliary subfield values.
 
         class PhysicsImplementation; ///< Abstract base class for constraints and integrators.
 
@@ -25,6 +26,7 @@ namespace pylith {
         class InterfacePatches; ///< Interface integration patches.
         class UpdateStateVars; ///< Manager for updating state variables.
         class JacobianValues; ///< Manager for setting Jacobian values without finite-element integration.
+        class CellGeometry; ///< Cell geometry at quadrature points reused across integrations.
 
         class Constraint; ///< Abstract base class for finite-element constraints.
         class ConstraintSpatialDB; ///< Finite-element constraints via auxiliary field from spatial database.
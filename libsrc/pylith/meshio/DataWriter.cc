@@ -18,12 +18,16 @@
 #include "pylith/utils/error.hh" \
     // USES PYLITH_METHOD_BEGIN/END
 
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::out_of_range
+
 // Constructor
 pylith::meshio::DataWriter::DataWriter(void) :
     _timeScale(1.0),
     _context(""),
     _isInfo(false),
-    _isOpen(false) {}
+    _isOpen(false),
+    _distributionIndex(0) {}
 
 
 // ----------------------------------------------------------------------
@@ -66,6 +70,32 @@ pylith::meshio::DataWriter::isOpen(void) const {
 } // isOpen
 
 
+// ----------------------------------------------------------------------
+// Set index of distribution of the mesh among processes.
+void
+pylith::meshio::DataWriter::setDistributionIndex(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Index of mesh distribution (" << value << ") must be nonnegative.";
+        throw std::out_of_range(msg.str());
+    } // if
+
+    _distributionIndex = value;
+
+    PYLITH_METHOD_END;
+} // setDistributionIndex
+
+
+// ----------------------------------------------------------------------
+// Get index of distribution of the mesh among processes.
+int
+pylith::meshio::DataWriter::getDistributionIndex(void) const {
+    return _distributionIndex;
+} // getDistributionIndex
+
+
 // ----------------------------------------------------------------------
 // Prepare for writing files.
 void
@@ -120,7 +150,8 @@ pylith::meshio::DataWriter::closeTimeStep(void) {
 pylith::meshio::DataWriter::DataWriter(const DataWriter& w) :
     _context(w._context),
     _isInfo(w._isInfo),
-    _isOpen(w._isOpen) {}
+    _isOpen(w._isOpen),
+    _distributionIndex(w._distributionIndex) {}
 
 
 // ----------------------------------------------------------------------
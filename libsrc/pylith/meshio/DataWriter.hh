@@ -56,6 +56,21 @@ public:
      */
     bool isOpen(void) const;
 
+    /** Set index of distribution of the mesh among processes.
+     *
+     * Output for a redistributed mesh goes to new files with the index of the distribution in the
+     * filename, so it does not overwrite output written before the mesh was redistributed.
+     *
+     * @param[in] value Index of distribution (0 for the initial distribution).
+     */
+    void setDistributionIndex(const int value);
+
+    /** Get index of distribution of the mesh among processes.
+     *
+     * @returns Index of distribution.
+     */
+    int getDistributionIndex(void) const;
+
     /** Prepare for writing files.
      *
      * @param[in] mesh Finite-element mesh.
@@ -153,6 +168,7 @@ protected:
     std::string _context; ///< Context of scatters for DataWriter.
     bool _isInfo; ///< True if only writing info values.
     bool _isOpen; ///< True if writer is ready for openTimeStep()/closeTimeStep().
+    int _distributionIndex; ///< Index of distribution of the mesh among processes.
 
 }; // DataWriter
 
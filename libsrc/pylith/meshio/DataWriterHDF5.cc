@@ -302,11 +302,11 @@ pylith::meshio::DataWriterHDF5::writePointNames(const pylith::string_vector& nam
         mpierr = MPI_Comm_size(comm, &nprocs);assert(MPI_SUCCESS == mpierr);
 
         // Number of names on each process.
-        const int numNamesLocal = names.size();
+        const PylithInt numNamesLocal = names.size();
         int_array numNamesArray(nprocs);
         // Use void* for compatibility with OpenMPI 1.3 on Travis-CI
-        mpierr = MPI_Allgather((void*)&numNamesLocal, 1, MPI_INT, &numNamesArray[0], 1, MPI_INT, comm);assert(MPI_SUCCESS == mpierr);
-        const int numNames = numNamesArray.sum();
+        mpierr = MPI_Allgather((void*)&numNamesLocal, 1, MPIU_INT, &numNamesArray[0], 1, MPIU_INT, comm);assert(MPI_SUCCESS == mpierr);
+        const PylithInt numNames = numNamesArray.sum();
 
         // Get maximum string length.
         int maxStringLengthLocal = 0;
@@ -429,11 +429,14 @@ pylith::meshio::DataWriterHDF5::hdf5Filename(void) const {
 
     std::ostringstream filename;
     const int indexExt = _filename.find(".h5");
+    filename << std::string(_filename, 0, indexExt);
+    if (DataWriter::_distributionIndex > 0) {
+        filename << "_dist" << DataWriter::_distributionIndex;
+    } // if
     if (DataWriter::_isInfo) {
-        filename << std::string(_filename, 0, indexExt) << "_info.h5";
-    } else {
-        filename << _filename;
-    } // if/else
+        filename << "_info";
+    } // if
+    filename << ".h5";
 
     PYLITH_METHOD_RETURN(std::string(filename.str()));
 } // hdf5Filename
@@ -118,8 +118,8 @@ public:
     void writePointNames(const pylith::string_vector& names,
                          const topology::Mesh& mesh);
 
-    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
-private:
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
 
     /** Copy constructor.
      *
@@ -135,8 +135,8 @@ private:
     void _writeTimeStamp(const PylithScalar t,
                          const int commRank);
 
-    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
-private:
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
 
     std::string _filename; ///< Name of HDF5 file.
     PetscViewer _viewer; ///< Output file.
@@ -19,6 +19,7 @@
 #include "pylith/topology/Stratum.hh" /// USES StratumIS
 #include "pylith/topology/MeshOps.hh" /// USES isCohesiveCell
 #include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/utils/array.hh" // USES int_array, scalar_array
 
 #include "spatialdata/geocoords/CoordSys.hh" /// USES CoordSys
 
@@ -26,6 +27,8 @@
 #include <mpi.h> // USES MPI routines
 
 #include <cassert> // USES assert()
+#include <limits> // USES std::numeric_limits
+#include <vector> // USES std::vector
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
@@ -34,7 +37,10 @@
 pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(void) :
     _filename("output.h5"),
     _h5(new HDF5),
-    _tstampIndex(0) { // constructor
+    _tstampIndex(0),
+    _ranksPerAggregator(0),
+    _groupComm(MPI_COMM_NULL),
+    _aggregatorComm(MPI_COMM_NULL) { // constructor
 } // constructor
 
 
@@ -60,19 +66,50 @@ pylith::meshio::DataWriterHDF5Ext::deallocate(void) {
          d_iter != dEnd;
          ++d_iter) {
         err = PetscViewerDestroy(&d_iter->second.viewer);PYLITH_CHECK_ERROR(err);
+        if (d_iter->second.file != MPI_FILE_NULL) {
+            err = MPI_File_close(&d_iter->second.file);PYLITH_CHECK_ERROR(err);
+        } // if
     } // for
+    _datasets.clear();
+
+    if (_groupComm != MPI_COMM_NULL) {
+        err = MPI_Comm_free(&_groupComm);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_aggregatorComm != MPI_COMM_NULL) {
+        err = MPI_Comm_free(&_aggregatorComm);PYLITH_CHECK_ERROR(err);
+    } // if
 
     PYLITH_METHOD_END;
 } // deallocate
 
 
+// ----------------------------------------------------------------------
+// Set number of processes per aggregator for writing external datasets.
+void
+pylith::meshio::DataWriterHDF5Ext::setRanksPerAggregator(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Number of processes per aggregator (" << value << ") must be nonnegative.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _ranksPerAggregator = value;
+
+    PYLITH_METHOD_END;
+} // setRanksPerAggregator
+
+
 // ----------------------------------------------------------------------
 // Copy constructor.
 pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(const DataWriterHDF5Ext& w) :
     DataWriter(w),
     _filename(w._filename),
     _h5(new HDF5),
-    _tstampIndex(0) { // copy constructor
+    _tstampIndex(0),
+    _ranksPerAggregator(w._ranksPerAggregator),
+    _groupComm(MPI_COMM_NULL),
+    _aggregatorComm(MPI_COMM_NULL) { // copy constructor
 } // copy constructor
 
 
@@ -104,6 +141,17 @@ pylith::meshio::DataWriterHDF5Ext::open(const pylith::topology::Mesh& mesh,
 
         _tstampIndex = 0;
 
+        if (_ranksPerAggregator > 0) {
+            // Groups of consecutive processes share an aggregator (first process in group).
+            const int commRank = mesh.getCommRank();
+            const int groupIndex = commRank / _ranksPerAggregator;
+            const bool isAggregator = 0 == commRank % _ranksPerAggregator;
+            assert(MPI_COMM_NULL == _groupComm);
+            assert(MPI_COMM_NULL == _aggregatorComm);
+            err = MPI_Comm_split(mesh.getComm(), groupIndex, commRank, &_groupComm);PYLITH_CHECK_ERROR(err);
+            err = MPI_Comm_split(mesh.getComm(), isAggregator ? 0 : MPI_UNDEFINED, commRank, &_aggregatorComm);PYLITH_CHECK_ERROR(err);
+        } // if
+
     } catch (const std::exception& err) {
         std::ostringstream msg;
         msg << "Error while opening HDF5 file " << _filename << ".\n" << err.what();
@@ -160,24 +208,10 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
         const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
 
         // Create external dataset if necessary
-        PetscViewer binaryViewer;
-        bool createdExternalDataset = false;
-        if (_datasets.find(name) != _datasets.end()) {
-            binaryViewer = _datasets[name].viewer;
-        } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
-            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
-            ExternalDataset dataset;
-            dataset.numTimeSteps = 0;
-            dataset.viewer = binaryViewer;
-            _datasets[name] = dataset;
-
-            createdExternalDataset = true;
-        } // else
-        assert(binaryViewer);
+        const bool createdExternalDataset = _createExternalDataset(name, comm);
 
         PetscVec vector = subfield.getVector();assert(vector);
-        DataWriter::_writeVec(vector, binaryViewer);
+        _writeExternalDataset(vector, name);
 
         ExternalDataset& datasetInfo = _datasets[name];
         ++datasetInfo.numTimeSteps;
@@ -216,7 +250,7 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
             int fiberDimLocal = dof;
             int fiberDim = 0;
             err = MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
-            err = MPI_Allreduce(&numVerticesLocal, &numVertices, 1, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+            err = MPI_Allreduce(&numVerticesLocal, &numVertices, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
             assert(fiberDim > 0);assert(numVertices > 0);
 
             datasetInfo.numPoints = numVertices;
@@ -298,24 +332,10 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
         const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
 
         // Create external dataset if necessary
-        PetscViewer binaryViewer;
-        bool createdExternalDataset = false;
-        if (_datasets.find(name) != _datasets.end()) {
-            binaryViewer = _datasets[name].viewer;
-        } else {
-            err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &binaryViewer);PYLITH_CHECK_ERROR(err);
-            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
-            ExternalDataset dataset;
-            dataset.numTimeSteps = 0;
-            dataset.viewer = binaryViewer;
-            _datasets[name] = dataset;
-
-            createdExternalDataset = true;
-        } // else
-        assert(binaryViewer);
+        const bool createdExternalDataset = _createExternalDataset(name, comm);
 
         PetscVec vector = subfield.getVector();assert(vector);
-        DataWriter::_writeVec(vector, binaryViewer);
+        _writeExternalDataset(vector, name);
 
         ExternalDataset& datasetInfo = _datasets[name];
         ++datasetInfo.numTimeSteps;
@@ -353,7 +373,7 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
             int fiberDimLocal = dof;
             int fiberDim = 0;
             MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPI_INT, MPI_MAX, comm);
-            err = MPI_Allreduce(&numLocalCells, &numCells, 1, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+            err = MPI_Allreduce(&numLocalCells, &numCells, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
             assert(fiberDim > 0);assert(numCells > 0);
 
             datasetInfo.numPoints = numCells;
@@ -413,6 +433,155 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
 } // writeCellField
 
 
+// ----------------------------------------------------------------------
+// Create external dataset if it does not exist.
+bool
+pylith::meshio::DataWriterHDF5Ext::_createExternalDataset(const char* name,
+                                                          MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_datasets.find(name) != _datasets.end()) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    ExternalDataset dataset;
+    dataset.viewer = NULL;
+    dataset.file = MPI_FILE_NULL;
+    dataset.numTimeSteps = 0;
+    dataset.numPoints = 0;
+    dataset.fiberDim = 0;
+    if (_ranksPerAggregator > 0) {
+        if (_aggregatorComm != MPI_COMM_NULL) {
+            const int amode = MPI_MODE_WRONLY | MPI_MODE_CREATE;
+            err = MPI_File_open(_aggregatorComm, _datasetFilename(name).c_str(), amode, MPI_INFO_NULL, &dataset.file);
+            if (err != MPI_SUCCESS) {
+                std::ostringstream msg;
+                msg << "Could not open external dataset file '" << _datasetFilename(name) << "'.";
+                throw std::runtime_error(msg.str());
+            } // if
+            err = MPI_File_set_size(dataset.file, 0);PYLITH_CHECK_ERROR(err);
+        } // if
+    } else {
+        err = PetscViewerBinaryOpen(comm, _datasetFilename(name).c_str(), FILE_MODE_WRITE, &dataset.viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerBinarySetSkipHeader(dataset.viewer, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    _datasets[name] = dataset;
+
+    PYLITH_METHOD_RETURN(true);
+} // _createExternalDataset
+
+
+// ----------------------------------------------------------------------
+// Append values of vector to external dataset.
+void
+pylith::meshio::DataWriterHDF5Ext::_writeExternalDataset(PetscVec vector,
+                                                         const char* name) {
+    PYLITH_METHOD_BEGIN;
+    assert(_datasets.find(name) != _datasets.end());
+
+    const ExternalDataset& dataset = _datasets[name];
+    if (_ranksPerAggregator > 0) {
+        _writeVecAggregated(vector, dataset.file, dataset.numTimeSteps);
+    } else {
+        assert(dataset.viewer);
+        DataWriter::_writeVec(vector, dataset.viewer);
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // _writeExternalDataset
+
+
+// ----------------------------------------------------------------------
+// Write vector to external dataset file through aggregator processes.
+void
+pylith::meshio::DataWriterHDF5Ext::_writeVecAggregated(PetscVec vector,
+                                                       MPI_File file,
+                                                       const PetscInt timeStep) {
+    PYLITH_METHOD_BEGIN;
+    assert(_groupComm != MPI_COMM_NULL);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt globalSize = 0, rStart = 0, rEnd = 0;
+    err = VecGetSize(vector, &globalSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(vector, &rStart, &rEnd);PYLITH_CHECK_ERROR(err);
+
+    int groupRank = 0, groupSize = 0;
+    err = MPI_Comm_rank(_groupComm, &groupRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(_groupComm, &groupSize);PYLITH_CHECK_ERROR(err);
+    const bool isAggregator = 0 == groupRank;
+    assert(isAggregator == (file != MPI_FILE_NULL));
+
+    // Gather values from processes in group. Processes in a group are consecutive, so the values
+    // are contiguous in the global ordering, starting at the aggregator's ownership range.
+    const PetscInt numValuesLocal = rEnd - rStart;
+    std::vector<int> numValuesGroup;
+    std::vector<int> offsetsGroup;
+    std::vector<PetscInt> numValuesGroupInt(isAggregator ? groupSize : 0);
+    err = MPI_Gather((void*)&numValuesLocal, 1, MPIU_INT, isAggregator ? &numValuesGroupInt[0] : NULL, 1, MPIU_INT, 0, _groupComm);PYLITH_CHECK_ERROR(err);
+    const PetscInt numValuesAggregated = isAggregator ? _getAggregatedLayout(&numValuesGroup, &offsetsGroup, numValuesGroupInt) : 0;
+
+    scalar_array values(numValuesAggregated);
+    const PetscScalar* vectorArray = NULL;
+    err = VecGetArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(err);
+    err = MPI_Gatherv((void*)vectorArray, int(numValuesLocal), MPIU_SCALAR,
+                      numValuesAggregated > 0 ? &values[0] : NULL,
+                      isAggregator ? &numValuesGroup[0] : NULL,
+                      isAggregator ? &offsetsGroup[0] : NULL,
+                      MPIU_SCALAR, 0, _groupComm);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(err);
+
+    if (isAggregator) {
+        // External datasets are big-endian, consistent with PETSc binary viewers.
+#if !defined(PETSC_WORDS_BIGENDIAN)
+        if (numValuesAggregated > 0) {
+            err = PetscByteSwap(&values[0], PETSC_SCALAR, numValuesAggregated);PYLITH_CHECK_ERROR(err);
+        } // if
+#endif
+        const MPI_Offset offset = (MPI_Offset(timeStep) * MPI_Offset(globalSize) + MPI_Offset(rStart)) * MPI_Offset(sizeof(PetscScalar));
+        err = MPI_File_write_at_all(file, offset, numValuesAggregated > 0 ? &values[0] : NULL, int(numValuesAggregated),
+                                    MPIU_SCALAR, MPI_STATUS_IGNORE);
+        if (err != MPI_SUCCESS) {
+            throw std::runtime_error("Could not write values to external dataset file.");
+        } // if
+    } // if
+
+    PYLITH_METHOD_END;
+} // _writeVecAggregated
+
+
+// ----------------------------------------------------------------------
+// Get MPI counts and displacements for values gathered by an aggregator.
+PetscInt
+pylith::meshio::DataWriterHDF5Ext::_getAggregatedLayout(std::vector<int>* counts,
+                                                        std::vector<int>* offsets,
+                                                        const std::vector<PetscInt>& numValuesGroup) {
+    PYLITH_METHOD_BEGIN;
+    assert(counts);
+    assert(offsets);
+
+    // Accumulate in 64-bit integers, so the sum does not overflow with 32-bit PetscInt.
+    const size_t groupSize = numValuesGroup.size();
+    counts->resize(groupSize);
+    offsets->resize(groupSize);
+    PetscInt64 numValuesAggregated = 0;
+    for (size_t i = 0; i < groupSize; ++i) {
+        assert(numValuesGroup[i] >= 0);
+        numValuesAggregated += PetscInt64(numValuesGroup[i]);
+        if (numValuesAggregated > PetscInt64(std::numeric_limits<int>::max())) {
+            std::ostringstream msg;
+            msg << "Number of values gathered by aggregator for external dataset exceeds the maximum MPI count ("
+                << std::numeric_limits<int>::max() << "). Decrease the number of processes per aggregator.";
+            throw std::runtime_error(msg.str());
+        } // if
+        (*counts)[i] = int(numValuesGroup[i]);
+        (*offsets)[i] = int(numValuesAggregated) - (*counts)[i];
+    } // for
+
+    PYLITH_METHOD_RETURN(PetscInt(numValuesAggregated));
+} // _getAggregatedLayout
+
+
 // ----------------------------------------------------------------------
 // Write dataset with names of points to file.
 void
@@ -435,10 +604,10 @@ pylith::meshio::DataWriterHDF5Ext::writePointNames(const pylith::string_vector&
         mpierr = MPI_Comm_size(comm, &nprocs);assert(MPI_SUCCESS == mpierr);
 
         // Number of names on each process.
-        const int numNamesLocal = names.size();
+        const PylithInt numNamesLocal = names.size();
         int_array numNamesArray(nprocs);
-        mpierr = MPI_Allgather((void*)&numNamesLocal, 1, MPI_INT, &numNamesArray[0], 1, MPI_INT, comm);assert(MPI_SUCCESS == mpierr);
-        const int numNames = numNamesArray.sum();
+        mpierr = MPI_Allgather((void*)&numNamesLocal, 1, MPIU_INT, &numNamesArray[0], 1, MPIU_INT, comm);assert(MPI_SUCCESS == mpierr);
+        const PylithInt numNames = numNamesArray.sum();
 
         // Get maximum string length.
         int maxStringLengthLocal = 0;
@@ -462,17 +631,22 @@ pylith::meshio::DataWriterHDF5Ext::writePointNames(const pylith::string_vector&
 
         char_array namesFixedLength;
         if (isMPIRoot) {namesFixedLength.resize(numNames*maxStringLength);}
-        // Convert numNames array from number of names to total size of names array.
-        numNamesArray *= maxStringLength;
-        int_array offsets;
+        // Convert numNames array from number of names to total size of names array (MPI counts are int).
+        std::vector<int> namesSizes;
+        std::vector<int> offsets;
         if (isMPIRoot) {
+            namesSizes.resize(nprocs);
             offsets.resize(nprocs);
             offsets[0] = 0;
-            for (int i = 1; i < nprocs; ++i) {
-                offsets[i] = offsets[i-1] + numNamesArray[i-1];
+            for (int i = 0; i < nprocs; ++i) {
+                namesSizes[i] = int(numNamesArray[i]*maxStringLength);
+                if (i > 0) {
+                    offsets[i] = offsets[i-1] + namesSizes[i-1];
+                } // if
             } // for
         } // if
-        mpierr = MPI_Gatherv(&namesFixedLengthLocal[0], numNamesLocal*maxStringLength, MPI_CHAR, &namesFixedLength[0], &numNamesArray[0], &offsets[0], MPI_CHAR, commRoot, comm);
+        mpierr = MPI_Gatherv(&namesFixedLengthLocal[0], int(numNamesLocal*maxStringLength), MPI_CHAR, &namesFixedLength[0],
+                             isMPIRoot ? &namesSizes[0] : NULL, isMPIRoot ? &offsets[0] : NULL, MPI_CHAR, commRoot, comm);
 
         if (isMPIRoot) {
             _h5->open(hdf5Filename().c_str(), H5F_ACC_RDWR);
@@ -502,11 +676,14 @@ pylith::meshio::DataWriterHDF5Ext::hdf5Filename(void) const {
 
     std::ostringstream filename;
     const int indexExt = _filename.find(".h5");
+    filename << std::string(_filename, 0, indexExt);
+    if (DataWriter::_distributionIndex > 0) {
+        filename << "_dist" << DataWriter::_distributionIndex;
+    } // if
     if (DataWriter::_isInfo) {
-        filename << std::string(_filename, 0, indexExt) << "_info.h5";
-    } else {
-        filename << _filename;
-    } // if/else
+        filename << "_info";
+    } // if
+    filename << ".h5";
 
     PYLITH_METHOD_RETURN(std::string(filename.str()));
 } // hdf5Filename
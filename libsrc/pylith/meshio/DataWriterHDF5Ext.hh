@@ -25,12 +25,19 @@
  *   cell_fields - group
  *     CELL_FIELD (name of cell field) - dataset
  *       [ntimesteps, ncells, fiberdim]
+ *
+ * The external binary files can be written through aggregator processes. Each aggregator
+ * gathers the values from a group of consecutive processes, so the values form one
+ * contiguous slab in the file, and the aggregators write the slabs with a collective MPI-IO
+ * write. This replaces many small writes with a few large ones on parallel file systems.
  */
 
 #include "pylith/meshio/DataWriter.hh" // ISA DataWriter
 
 #include <string> // USES std::string
 #include <map> // HASA std::map
+#include <vector> // USES std::vector
+#include <mpi.h> // HASA MPI_Comm, MPI_File
 
 // DataWriterHDF5Ext ----------------------------------------------------
 /// Object for writing finite-element data to HDF5 file.
@@ -40,6 +47,7 @@ class pylith::meshio::DataWriterHDF5Ext : public DataWriter { // DataWriterHDF5E
     friend class TestDataWriterHDF5ExtPoints; // unit testing
     friend class TestDataWriterHDF5ExtBCMesh; // unit testing
     friend class TestDataWriterHDF5ExtFaultMesh; // unit testing
+    friend class TestDataWriterHDF5ExtAggregators; // unit testing
 
     // PUBLIC METHODS ///////////////////////////////////////////////////////
 public:
@@ -65,6 +73,18 @@ public:
      */
     void filename(const char* filename);
 
+    /** Set number of processes per aggregator for writing external datasets.
+     *
+     * @param[in] value Number of processes per aggregator (0 to write without aggregators).
+     */
+    void setRanksPerAggregator(const int value);
+
+    /** Get number of processes per aggregator for writing external datasets.
+     *
+     * @returns Number of processes per aggregator.
+     */
+    int getRanksPerAggregator(void) const;
+
     /** Generate filename for HDF5 file.
      *
      * Appends _info if only writing parameters.
@@ -124,6 +144,48 @@ private:
     /// Generate filename for external dataset file.
     std::string _datasetFilename(const char* field) const;
 
+    /** Create external dataset if it does not exist.
+     *
+     * @param[in] name Name of field.
+     * @param[in] comm MPI communicator for field.
+     * @returns True if dataset was created, false if it already exists.
+     */
+    bool _createExternalDataset(const char* name,
+                                MPI_Comm comm);
+
+    /** Append values of vector to external dataset.
+     *
+     * @param[in] vector PETSc vector with values.
+     * @param[in] name Name of field.
+     */
+    void _writeExternalDataset(PetscVec vector,
+                               const char* name);
+
+    /** Write vector to external dataset file through aggregator processes.
+     *
+     * @param[in] vector PETSc vector with values.
+     * @param[in] file MPI file for external dataset (MPI_FILE_NULL if not an aggregator).
+     * @param[in] timeStep Index of time step in external dataset.
+     */
+    void _writeVecAggregated(PetscVec vector,
+                             MPI_File file,
+                             const PetscInt timeStep);
+
+    /** Get MPI counts and displacements for values gathered by an aggregator.
+     *
+     * MPI counts and displacements are int, so the total number of values gathered by an
+     * aggregator must not exceed the maximum int value.
+     *
+     * @param[out] counts Number of values from each process in group.
+     * @param[out] offsets Offset of values from each process in group.
+     * @param[in] numValuesGroup Number of values on each process in group.
+     * @returns Total number of values gathered by aggregator.
+     */
+    static
+    PetscInt _getAggregatedLayout(std::vector<int>* counts,
+                                  std::vector<int>* offsets,
+                                  const std::vector<PetscInt>& numValuesGroup);
+
     /** Write time stamp to file.
      *
      * @param[in] t Time in seconds.
@@ -140,6 +202,7 @@ private:
 
     struct ExternalDataset {
         PetscViewer viewer;
+        MPI_File file; ///< File for writing with aggregators.
         PetscInt numTimeSteps;
         PetscInt numPoints;
         PetscInt fiberDim;
@@ -153,6 +216,9 @@ private:
     HDF5* _h5; ///< HDF5 file
     dataset_type _datasets; ///< Datasets
     int _tstampIndex; ///< Index of last time stamp written.
+    int _ranksPerAggregator; ///< Number of processes per aggregator (0 for no aggregators).
+    MPI_Comm _groupComm; ///< Communicator for processes sharing an aggregator.
+    MPI_Comm _aggregatorComm; ///< Communicator for aggregators (MPI_COMM_NULL on other processes).
 
 }; // DataWriterHDF5Ext
 
@@ -0,0 +1,539 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/DataWriterHDF5Stations.hh" // Implementation of class methods
+
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT*
+
+#include "petscviewerhdf5.h"
+#include <mpi.h> // USES MPI routines
+
+#include <algorithm> // USES std::max(), std::min()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+#if H5_VERS_MAJOR == 1 && H5_VERS_MINOR >= 8
+#define PYLITH_HDF5_USE_API_18
+#endif
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _DataWriterHDF5Stations {
+public:
+
+            /// Target size of chunks in bytes.
+            static const size_t chunkTargetSize;
+
+            /** Compute number of stations in a chunk.
+             *
+             * @param[in] numStations Total number of stations.
+             * @param[in] bufferSize Number of time steps in buffer.
+             * @param[in] numComponents Number of components in field.
+             * @returns Number of stations in chunk.
+             */
+            static
+            hsize_t stationsPerChunk(const size_t numStations,
+                                     const int bufferSize,
+                                     const int numComponents);
+
+        }; // _DataWriterHDF5Stations
+    } // meshio
+} // pylith
+
+// 1 MiB chunks keep the number of chunks small without making time series reads too coarse.
+const size_t pylith::meshio::_DataWriterHDF5Stations::chunkTargetSize = 1024*1024;
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterHDF5Stations::DataWriterHDF5Stations(void) :
+    _comm(MPI_COMM_NULL),
+    _bufferSize(100),
+    _numBuffered(0),
+    _numWritten(0),
+    _numStations(0),
+    _numStationsLocal(0),
+    _stationsOffset(0) {
+    PyreComponent::setName("datawriterhdf5stations");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterHDF5Stations::~DataWriterHDF5Stations(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterHDF5Stations::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterHDF5::deallocate();
+
+    _buffers.clear();
+    _tstamps.resize(0);
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterHDF5Stations::DataWriterHDF5Stations(const DataWriterHDF5Stations& w) :
+    DataWriterHDF5(w),
+    _comm(MPI_COMM_NULL),
+    _bufferSize(w._bufferSize),
+    _numBuffered(0),
+    _numWritten(0),
+    _numStations(0),
+    _numStationsLocal(0),
+    _stationsOffset(0) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Set number of time steps accumulated in memory before writing.
+void
+pylith::meshio::DataWriterHDF5Stations::setBufferSize(const int value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value <= 0) {
+        std::ostringstream msg;
+        msg << "Number of time steps in buffer (" << value << ") for station output must be positive.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _bufferSize = value;
+
+    PYLITH_METHOD_END;
+} // setBufferSize
+
+
+// ------------------------------------------------------------------------------------------------
+// Open output file.
+void
+pylith::meshio::DataWriterHDF5Stations::open(const pylith::topology::Mesh& mesh,
+                                             const bool isInfo) {
+    PYLITH_METHOD_BEGIN;
+
+    // Creates file and writes geometry of stations.
+    DataWriterHDF5::open(mesh, isInfo);
+
+    try {
+        PetscErrorCode err = PETSC_SUCCESS;
+
+        _comm = mesh.getComm();
+        _buffers.clear();
+        _numBuffered = 0;
+        _numWritten = 0;
+        _tstamps.resize(_bufferSize);
+        _tstamps = 0.0;
+
+        // Stations are the vertices of the point mesh and are not shared across processes.
+        PetscInt vStart = 0, vEnd = 0;
+        err = DMPlexGetDepthStratum(mesh.getDM(), 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+        _numStationsLocal = std::max(vEnd - vStart, PetscInt(0));
+
+        unsigned long long numStationsLocal = _numStationsLocal;
+        unsigned long long numStations = 0;
+        unsigned long long stationsOffset = 0;
+        err = MPI_Allreduce(&numStationsLocal, &numStations, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, _comm);PYLITH_CHECK_ERROR(err);
+        err = MPI_Exscan(&numStationsLocal, &stationsOffset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, _comm);PYLITH_CHECK_ERROR(err);
+        if (!mesh.getCommRank()) { stationsOffset = 0; } // Result of MPI_Exscan() is undefined on process 0.
+        _numStations = numStations;
+        _stationsOffset = stationsOffset;
+
+        hid_t h5 = -1;
+        err = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(err);assert(h5 >= 0);
+#if defined(PYLITH_HDF5_USE_API_18)
+        hid_t group = H5Gcreate2(h5, "/station_fields", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+#else
+        hid_t group = H5Gcreate(h5, "/station_fields", 0);
+#endif
+        if (group < 0) { throw std::runtime_error("Could not create group 'station_fields'."); }
+        if (H5Gclose(group) < 0) { throw std::runtime_error("Could not close group 'station_fields'."); }
+
+        // Time stamps are stored in an extendible 1-D dataset.
+        const hsize_t dims[1] = { 0 };
+        const hsize_t maxDims[1] = { H5S_UNLIMITED };
+        const hsize_t dimsChunk[1] = { hsize_t(_bufferSize) };
+        hid_t filespace = H5Screate_simple(1, dims, maxDims);
+        if (filespace < 0) { throw std::runtime_error("Could not create filespace for 'time'."); }
+        hid_t property = H5Pcreate(H5P_DATASET_CREATE);
+        if (property < 0) { throw std::runtime_error("Could not create property for 'time'."); }
+        if (H5Pset_chunk(property, 1, dimsChunk) < 0) { throw std::runtime_error("Could not set chunk size for 'time'."); }
+#if defined(PYLITH_HDF5_USE_API_18)
+        hid_t dataset = H5Dcreate2(h5, "/time", H5T_IEEE_F64LE, filespace, H5P_DEFAULT, property, H5P_DEFAULT);
+#else
+        hid_t dataset = H5Dcreate(h5, "/time", H5T_IEEE_F64LE, filespace, property);
+#endif
+        if (dataset < 0) { throw std::runtime_error("Could not create dataset 'time'."); }
+        if (H5Dclose(dataset) < 0) { throw std::runtime_error("Could not close dataset 'time'."); }
+        if (H5Pclose(property) < 0) { throw std::runtime_error("Could not close property for 'time'."); }
+        if (H5Sclose(filespace) < 0) { throw std::runtime_error("Could not close filespace for 'time'."); }
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while opening HDF5 file " << _filename << ".\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Unknown error while opening HDF5 file " << _filename << ".";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // open
+
+
+// ------------------------------------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterHDF5Stations::close(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_viewer && (_numBuffered > 0)) {
+        _flush();
+    } // if
+
+    // Skip DataWriterHDF5::close(), because the layout is not compatible with Xdmf files.
+    DataWriterHDF5::deallocate();
+    _buffers.clear();
+    _numBuffered = 0;
+    _numWritten = 0;
+
+    DataWriter::close();
+
+    PYLITH_METHOD_END;
+} // close
+
+
+// ------------------------------------------------------------------------------------------------
+// Prepare for data at a new time step.
+void
+pylith::meshio::DataWriterHDF5Stations::openTimeStep(const PylithScalar t,
+                                                     const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(_viewer);
+    assert(_numBuffered < _bufferSize);
+
+    _tstamps[_numBuffered++] = t * DataWriter::_timeScale;
+
+    PYLITH_METHOD_END;
+} // openTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Write buffered data if the buffer is full.
+void
+pylith::meshio::DataWriterHDF5Stations::closeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_numBuffered == _bufferSize) {
+        _flush();
+    } // if
+
+    PYLITH_METHOD_END;
+} // closeTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterHDF5Stations::writeVertexField(const PylithScalar t,
+                                                         const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+    assert(_viewer);
+
+    if (!_numBuffered) {
+        PYLITH_COMPONENT_LOGICERROR("Cannot write field '" << subfield.getDescription().label
+                                                           << "' to station output before opening time step.");
+    } // if
+
+    const pylith::topology::FieldBase::Description& description = subfield.getDescription();
+    const char* name = description.label.c_str();
+    const int numComponents = description.numComponents;
+
+    if (0 == _buffers.count(name)) {
+        FieldBuffer& buffer = _buffers[name];
+        buffer.numComponents = numComponents;
+        buffer.vectorFieldType = pylith::topology::FieldBase::vectorFieldString(description.vectorFieldType);
+        buffer.hasDataset = false;
+        buffer.values.resize(_numStationsLocal * _bufferSize * numComponents);
+        buffer.values = 0.0;
+    } // if
+    FieldBuffer& buffer = _buffers[name];
+    assert(buffer.numComponents == numComponents);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscVec vector = subfield.getVector();assert(vector);
+    PetscInt vectorSize = 0;
+    err = VecGetLocalSize(vector, &vectorSize);PYLITH_CHECK_ERROR(err);
+    if (size_t(vectorSize) != _numStationsLocal * numComponents) {
+        std::ostringstream msg;
+        msg << "Size of field '" << name << "' (" << vectorSize << ") does not match number of stations ("
+            << _numStationsLocal << ") times number of components (" << numComponents << ").";
+        throw std::logic_error(msg.str());
+    } // if
+
+    // Store values in station-major order: [station, time step, component].
+    const PetscScalar* vectorArray = NULL;
+    err = VecGetArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(err);
+    const size_t iStep = _numBuffered-1;
+    for (size_t iStation = 0; iStation < _numStationsLocal; ++iStation) {
+        const size_t offset = (iStation*_bufferSize + iStep) * numComponents;
+        for (int iComponent = 0; iComponent < numComponents; ++iComponent) {
+            buffer.values[offset+iComponent] = vectorArray[iStation*numComponents+iComponent];
+        } // for
+    } // for
+    err = VecRestoreArrayRead(vector, &vectorArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // writeVertexField
+
+
+// ------------------------------------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterHDF5Stations::writeCellField(const PylithScalar t,
+                                                       const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    PYLITH_COMPONENT_LOGICERROR("Station output does not support fields over cells. Cannot write field '"
+                                << subfield.getDescription().label << "'.");
+
+    PYLITH_METHOD_END;
+} // writeCellField
+
+
+// ------------------------------------------------------------------------------------------------
+// Write buffered time steps to file.
+void
+pylith::meshio::DataWriterHDF5Stations::_flush(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_viewer);
+
+    try {
+        _writeTimeStamps();
+
+        // Iteration over std::map is ordered by name, so all processes create and write datasets
+        // in the same order as required for collective operations.
+        for (std::map<std::string, FieldBuffer>::iterator iter = _buffers.begin(); iter != _buffers.end(); ++iter) {
+            if (!_numStations) { break; }
+            if (!iter->second.hasDataset) {
+                _createDataset(iter->first.c_str(), iter->second);
+                iter->second.hasDataset = true;
+            } // if
+            _writeBuffer(iter->first.c_str(), iter->second);
+        } // for
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while writing station output to HDF5 file '" << _filename << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Error while writing station output to HDF5 file '" << _filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    _numWritten += _numBuffered;
+    _numBuffered = 0;
+
+    PYLITH_METHOD_END;
+} // _flush
+
+
+// ------------------------------------------------------------------------------------------------
+// Create extendible dataset for field.
+void
+pylith::meshio::DataWriterHDF5Stations::_createDataset(const char* name,
+                                                       const FieldBuffer& buffer) {
+    PYLITH_METHOD_BEGIN;
+
+    hid_t h5 = -1;
+    PetscErrorCode petscerr = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(petscerr);assert(h5 >= 0);
+
+    const std::string fullName = std::string("/station_fields/") + std::string(name);
+    const int ndims = 3;
+    const hsize_t dims[ndims] = { hsize_t(_numStations), 0, hsize_t(buffer.numComponents) };
+    const hsize_t maxDims[ndims] = { hsize_t(_numStations), H5S_UNLIMITED, hsize_t(buffer.numComponents) };
+    const hsize_t dimsChunk[ndims] = {
+        _DataWriterHDF5Stations::stationsPerChunk(_numStations, _bufferSize, buffer.numComponents),
+        hsize_t(_bufferSize),
+        hsize_t(buffer.numComponents),
+    };
+
+    hid_t filespace = H5Screate_simple(ndims, dims, maxDims);
+    if (filespace < 0) { throw std::runtime_error("Could not create filespace."); }
+    hid_t property = H5Pcreate(H5P_DATASET_CREATE);
+    if (property < 0) { throw std::runtime_error("Could not create property."); }
+    if (H5Pset_chunk(property, ndims, dimsChunk) < 0) { throw std::runtime_error("Could not set chunk size."); }
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dcreate2(h5, fullName.c_str(), H5T_IEEE_F64LE, filespace, H5P_DEFAULT, property, H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dcreate(h5, fullName.c_str(), H5T_IEEE_F64LE, filespace, property);
+#endif
+    if (dataset < 0) { throw std::runtime_error("Could not create dataset."); }
+    if (H5Dclose(dataset) < 0) { throw std::runtime_error("Could not close dataset."); }
+    if (H5Pclose(property) < 0) { throw std::runtime_error("Could not close property."); }
+    if (H5Sclose(filespace) < 0) { throw std::runtime_error("Could not close filespace."); }
+
+    HDF5::writeAttribute(h5, fullName.c_str(), "vector_field_type", buffer.vectorFieldType.c_str());
+
+    PYLITH_METHOD_END;
+} // _createDataset
+
+
+// ------------------------------------------------------------------------------------------------
+// Write buffered values of field to file.
+void
+pylith::meshio::DataWriterHDF5Stations::_writeBuffer(const char* name,
+                                                     const FieldBuffer& buffer) {
+    PYLITH_METHOD_BEGIN;
+
+    hid_t h5 = -1;
+    PetscErrorCode petscerr = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(petscerr);assert(h5 >= 0);
+
+    const std::string fullName = std::string("/station_fields/") + std::string(name);
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dopen2(h5, fullName.c_str(), H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dopen(h5, fullName.c_str());
+#endif
+    if (dataset < 0) { throw std::runtime_error("Could not open dataset."); }
+
+    const int ndims = 3;
+    const hsize_t numComponents = buffer.numComponents;
+    const hsize_t dims[ndims] = { hsize_t(_numStations), hsize_t(_numWritten + _numBuffered), numComponents };
+    herr_t err = H5Dset_extent(dataset, dims);
+    if (err < 0) { throw std::runtime_error("Could not extend dataset."); }
+
+    hid_t filespace = H5Dget_space(dataset);
+    if (filespace < 0) { throw std::runtime_error("Could not get filespace."); }
+    const hsize_t dimsMem[ndims] = { std::max(hsize_t(_numStationsLocal), hsize_t(1)), hsize_t(_bufferSize), numComponents };
+    hid_t memspace = H5Screate_simple(ndims, dimsMem, NULL);
+    if (memspace < 0) { throw std::runtime_error("Could not create memspace."); }
+
+    if (_numStationsLocal > 0) {
+        const hsize_t offsetFile[ndims] = { hsize_t(_stationsOffset), hsize_t(_numWritten), 0 };
+        const hsize_t offsetMem[ndims] = { 0, 0, 0 };
+        const hsize_t count[ndims] = { hsize_t(_numStationsLocal), hsize_t(_numBuffered), numComponents };
+        err = H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offsetFile, NULL, count, NULL);
+        if (err < 0) { throw std::runtime_error("Could not select hyperslab in file."); }
+        err = H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offsetMem, NULL, count, NULL);
+        if (err < 0) { throw std::runtime_error("Could not select hyperslab in memory."); }
+    } else {
+        // Process without stations still participates in the collective write.
+        err = H5Sselect_none(filespace);
+        if (err < 0) { throw std::runtime_error("Could not clear selection in file."); }
+        err = H5Sselect_none(memspace);
+        if (err < 0) { throw std::runtime_error("Could not clear selection in memory."); }
+    } // if/else
+
+    hid_t property = H5Pcreate(H5P_DATASET_XFER);
+    if (property < 0) { throw std::runtime_error("Could not create property."); }
+    H5Pset_dxpl_mpio(property, H5FD_MPIO_COLLECTIVE);
+
+    const PylithScalar* values = (buffer.values.size() > 0) ? &buffer.values[0] : NULL;
+    err = H5Dwrite(dataset, H5T_NATIVE_DOUBLE, memspace, filespace, property, values);
+    if (err < 0) { throw std::runtime_error("Could not write dataset."); }
+
+    if (H5Pclose(property) < 0) { throw std::runtime_error("Could not close property."); }
+    if (H5Sclose(memspace) < 0) { throw std::runtime_error("Could not close memspace."); }
+    if (H5Sclose(filespace) < 0) { throw std::runtime_error("Could not close filespace."); }
+    if (H5Dclose(dataset) < 0) { throw std::runtime_error("Could not close dataset."); }
+
+    PYLITH_METHOD_END;
+} // _writeBuffer
+
+
+// ------------------------------------------------------------------------------------------------
+// Write buffered time stamps to file.
+void
+pylith::meshio::DataWriterHDF5Stations::_writeTimeStamps(void) {
+    PYLITH_METHOD_BEGIN;
+
+    hid_t h5 = -1;
+    PetscErrorCode petscerr = PetscViewerHDF5GetFileId(_viewer, &h5);PYLITH_CHECK_ERROR(petscerr);assert(h5 >= 0);
+    PetscMPIInt commRank = 0;
+    petscerr = MPI_Comm_rank(_comm, &commRank);PYLITH_CHECK_ERROR(petscerr);
+
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dopen2(h5, "/time", H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dopen(h5, "/time");
+#endif
+    if (dataset < 0) { throw std::runtime_error("Could not open dataset 'time'."); }
+
+    const hsize_t dims[1] = { hsize_t(_numWritten + _numBuffered) };
+    herr_t err = H5Dset_extent(dataset, dims);
+    if (err < 0) { throw std::runtime_error("Could not extend dataset 'time'."); }
+
+    hid_t filespace = H5Dget_space(dataset);
+    if (filespace < 0) { throw std::runtime_error("Could not get filespace for 'time'."); }
+    const hsize_t dimsMem[1] = { hsize_t(_bufferSize) };
+    hid_t memspace = H5Screate_simple(1, dimsMem, NULL);
+    if (memspace < 0) { throw std::runtime_error("Could not create memspace for 'time'."); }
+
+    // Only process 0 writes the time stamps.
+    if (!commRank) {
+        const hsize_t offsetFile[1] = { hsize_t(_numWritten) };
+        const hsize_t offsetMem[1] = { 0 };
+        const hsize_t count[1] = { hsize_t(_numBuffered) };
+        err = H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offsetFile, NULL, count, NULL);
+        if (err < 0) { throw std::runtime_error("Could not select hyperslab in file for 'time'."); }
+        err = H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offsetMem, NULL, count, NULL);
+        if (err < 0) { throw std::runtime_error("Could not select hyperslab in memory for 'time'."); }
+    } else {
+        err = H5Sselect_none(filespace);
+        if (err < 0) { throw std::runtime_error("Could not clear selection in file for 'time'."); }
+        err = H5Sselect_none(memspace);
+        if (err < 0) { throw std::runtime_error("Could not clear selection in memory for 'time'."); }
+    } // if/else
+
+    hid_t property = H5Pcreate(H5P_DATASET_XFER);
+    if (property < 0) { throw std::runtime_error("Could not create property for 'time'."); }
+    H5Pset_dxpl_mpio(property, H5FD_MPIO_COLLECTIVE);
+
+    err = H5Dwrite(dataset, H5T_NATIVE_DOUBLE, memspace, filespace, property, &_tstamps[0]);
+    if (err < 0) { throw std::runtime_error("Could not write dataset 'time'."); }
+
+    if (H5Pclose(property) < 0) { throw std::runtime_error("Could not close property for 'time'."); }
+    if (H5Sclose(memspace) < 0) { throw std::runtime_error("Could not close memspace for 'time'."); }
+    if (H5Sclose(filespace) < 0) { throw std::runtime_error("Could not close filespace for 'time'."); }
+    if (H5Dclose(dataset) < 0) { throw std::runtime_error("Could not close dataset 'time'."); }
+
+    PYLITH_METHOD_END;
+} // _writeTimeStamps
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute number of stations in a chunk.
+hsize_t
+pylith::meshio::_DataWriterHDF5Stations::stationsPerChunk(const size_t numStations,
+                                                          const int bufferSize,
+                                                          const int numComponents) {
+    const size_t stationSize = size_t(bufferSize) * size_t(numComponents) * sizeof(double);
+    const size_t numStationsChunk = std::max(chunkTargetSize / std::max(stationSize, size_t(1)), size_t(1));
+
+    return hsize_t(std::max(std::min(numStationsChunk, numStations), size_t(1)));
+} // stationsPerChunk
+
+
+// End of file
@@ -0,0 +1,177 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+/*
+ * HDF5 schema for PyLith station output with time series stored contiguously for each station.
+ *
+ * / - root group
+ *   geometry - group
+ *     vertices - dataset [nstations, spacedim]
+ *   stations - dataset
+ *     [nstations, 64]
+ *   time - dataset
+ *     [ntimesteps]
+ *   station_fields - group
+ *     STATION_FIELD (name of field) - dataset
+ *       [nstations, ntimesteps, fiberdim]
+ *
+ * Values are accumulated in memory for a number of time steps and then written with one
+ * collective write per field. The chunks span the buffered time steps for a small number of
+ * stations, so reading the time series for a station touches only a few chunks.
+ *
+ * Because the layout differs from the one used for visualization, no Xdmf file is generated.
+ */
+
+#include "pylith/meshio/DataWriterHDF5.hh" // ISA DataWriterHDF5
+
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+#include <string> // USES std::string
+#include <map> // HASA std::map
+
+class pylith::meshio::DataWriterHDF5Stations : public DataWriterHDF5 {
+    friend class TestDataWriterHDF5Stations; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    DataWriterHDF5Stations(void);
+
+    /// Destructor
+    ~DataWriterHDF5Stations(void);
+
+    /** Make copy of this object.
+     *
+     * @returns Copy of this.
+     */
+    DataWriter* clone(void) const;
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set number of time steps accumulated in memory before writing.
+     *
+     * @param[in] value Number of time steps in buffer.
+     */
+    void setBufferSize(const int value);
+
+    /** Get number of time steps accumulated in memory before writing.
+     *
+     * @returns Number of time steps in buffer.
+     */
+    int getBufferSize(void) const;
+
+    /** Open output file.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] isInfo True if only writing info values.
+     */
+    void open(const topology::Mesh& mesh,
+              const bool isInfo);
+
+    /// Close output files.
+    void close(void);
+
+    /** Prepare for data at a new time step.
+     *
+     * @param[in] t Time stamp for new data
+     * @param[in] mesh PETSc mesh object
+     */
+    void openTimeStep(const PylithScalar t,
+                      const topology::Mesh& mesh);
+
+    /// Write buffered data if the buffer is full.
+    void closeTimeStep(void);
+
+    /** Write field over vertices to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 1.
+     */
+    void writeVertexField(const PylithScalar t,
+                          const pylith::meshio::OutputSubfield& subfield);
+
+    /** Write field over cells to file.
+     *
+     * @param[in] t Time associated with field.
+     * @param[in] subfield Subfield with basis order 0.
+     */
+    void writeCellField(const PylithScalar t,
+                        const pylith::meshio::OutputSubfield& subfield);
+
+    // PRIVATE STRUCTS /////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Buffer with values of a field at the local stations.
+    struct FieldBuffer {
+        int numComponents; ///< Number of components in field.
+        std::string vectorFieldType; ///< Name of vector field type.
+        bool hasDataset; ///< True if dataset has been created.
+        pylith::scalar_array values; ///< Values [numStationsLocal, bufferSize, numComponents].
+    };
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Copy constructor.
+     *
+     * @param[in] w Object to copy.
+     */
+    DataWriterHDF5Stations(const DataWriterHDF5Stations& w);
+
+    /// Write buffered time steps to file.
+    void _flush(void);
+
+    /** Create extendible dataset for field.
+     *
+     * @param[in] name Name of field.
+     * @param[in] buffer Buffer for field.
+     */
+    void _createDataset(const char* name,
+                        const FieldBuffer& buffer);
+
+    /** Write buffered values of field to file.
+     *
+     * @param[in] name Name of field.
+     * @param[in] buffer Buffer for field.
+     */
+    void _writeBuffer(const char* name,
+                      const FieldBuffer& buffer);
+
+    /// Write buffered time stamps to file.
+    void _writeTimeStamps(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////
+private:
+
+    MPI_Comm _comm; ///< MPI communicator for stations.
+
+    std::map<std::string, FieldBuffer> _buffers; ///< Buffers for fields.
+    pylith::scalar_array _tstamps; ///< Buffered time stamps.
+
+    int _bufferSize; ///< Number of time steps in buffer.
+    int _numBuffered; ///< Number of time steps currently in buffer.
+    size_t _numWritten; ///< Number of time steps written to file.
+    size_t _numStations; ///< Total number of stations.
+    size_t _numStationsLocal; ///< Number of stations on this process.
+    size_t _stationsOffset; ///< Index of first station on this process.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////
+private:
+
+    const DataWriterHDF5Stations& operator=(const DataWriterHDF5Stations&); ///< Not implemented
+
+}; // DataWriterHDF5Stations
+
+#include "DataWriterHDF5Stations.icc" // inline methods
+
+// End of file
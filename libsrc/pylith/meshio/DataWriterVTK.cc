@@ -251,6 +251,10 @@ pylith::meshio::DataWriterVTK::_vtkFilename(const PylithScalar t) const {
 
     std::ostringstream filename;
     const int indexExt = _filename.find(".vtk");
+    filename << std::string(_filename, 0, indexExt);
+    if (DataWriter::_distributionIndex > 0) {
+        filename << "_dist" << DataWriter::_distributionIndex;
+    } // if
     if (!DataWriter::_isInfo) {
         // If data with multiple time steps, then add time stamp to filename
         char sbuffer[256];
@@ -260,9 +264,9 @@ pylith::meshio::DataWriterVTK::_vtkFilename(const PylithScalar t) const {
         if (pos != std::string::npos) {
             timestamp.erase(pos, 1);
         } // if
-        filename << std::string(_filename, 0, indexExt) << "_t" << timestamp << ".vtk";
+        filename << "_t" << timestamp << ".vtk";
     } else {
-        filename << std::string(_filename, 0, indexExt) << "_info.vtk";
+        filename << "_info.vtk";
     } // if/else
 
     PYLITH_METHOD_RETURN(std::string(filename.str()));
@@ -194,7 +194,7 @@ pylith::meshio::ExodusII::hasVar(const char* name,
 
 // ----------------------------------------------------------------------
 // Get value for dimension.
-int
+PylithInt
 pylith::meshio::ExodusII::getDim(const char* name) const { // getDim
     PYLITH_METHOD_BEGIN;
 
@@ -223,7 +223,7 @@ pylith::meshio::ExodusII::getDim(const char* name) const { // getDim
 // Get values for variable as an array of PylithScalars.
 void
 pylith::meshio::ExodusII::getVar(PylithScalar* values,
-                                 int* dims,
+                                 const PylithInt* dims,
                                  int ndims,
                                  const char* name) const { // getVar
     PYLITH_METHOD_BEGIN;
@@ -293,10 +293,10 @@ pylith::meshio::ExodusII::getVar(PylithScalar* values,
 
 
 // ----------------------------------------------------------------------
-// Get values for variable as an array of ints.
+// Get values for variable as an array of PylithInts.
 void
-pylith::meshio::ExodusII::getVar(int* values,
-                                 int* dims,
+pylith::meshio::ExodusII::getVar(PylithInt* values,
+                                 const PylithInt* dims,
                                  int ndims,
                                  const char* name) const { // getVar
     PYLITH_METHOD_BEGIN;
@@ -349,7 +349,14 @@ pylith::meshio::ExodusII::getVar(int* values,
     } // for
     delete[] dimIds;dimIds = 0;
 
-    err = nc_get_var_int(_file, vid, values);
+    if (sizeof(PylithInt) == sizeof(int)) {
+        err = nc_get_var_int(_file, vid, reinterpret_cast<int*>(values));
+    } else if (sizeof(PylithInt) == sizeof(long long)) {
+        err = nc_get_var_longlong(_file, vid, reinterpret_cast<long long*>(values));
+    } else {
+        assert(0);
+        throw std::logic_error("Unknown size of PylithInt in ExodusII::getVar().");
+    } // if/else
     if (err != NC_NOERR) {
         std::ostringstream msg;
         msg << "Coult not get values for variable '" << name << ".";
@@ -360,11 +367,77 @@ pylith::meshio::ExodusII::getVar(int* values,
 } // getVar
 
 
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of PylithScalars.
+void
+pylith::meshio::ExodusII::getVar(PylithScalar* values,
+                                 const size_t* start,
+                                 const size_t* count,
+                                 int ndims,
+                                 const char* name) const { // getVar
+    PYLITH_METHOD_BEGIN;
+
+    assert(_file);
+    assert(values);
+
+    const int vid = _checkHyperslab(start, count, ndims, name);
+
+    int err = NC_NOERR;
+    if (sizeof(PylithScalar) == sizeof(double)) {
+        err = nc_get_vara_double(_file, vid, start, count, values);
+    } else {
+        assert(0);
+        throw std::logic_error("Unknown size of PylithScalar in ExodusII::getVar().");
+    } // if/else
+    if (err != NC_NOERR) {
+        std::ostringstream msg;
+        msg << "Could not get hyperslab of values for variable '" << name << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // getVar
+
+
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of PylithInts.
+void
+pylith::meshio::ExodusII::getVar(PylithInt* values,
+                                 const size_t* start,
+                                 const size_t* count,
+                                 int ndims,
+                                 const char* name) const { // getVar
+    PYLITH_METHOD_BEGIN;
+
+    assert(_file);
+    assert(values);
+
+    const int vid = _checkHyperslab(start, count, ndims, name);
+
+    int err = NC_NOERR;
+    if (sizeof(PylithInt) == sizeof(int)) {
+        err = nc_get_vara_int(_file, vid, start, count, reinterpret_cast<int*>(values));
+    } else if (sizeof(PylithInt) == sizeof(long long)) {
+        err = nc_get_vara_longlong(_file, vid, start, count, reinterpret_cast<long long*>(values));
+    } else {
+        assert(0);
+        throw std::logic_error("Unknown size of PylithInt in ExodusII::getVar().");
+    } // if/else
+    if (err != NC_NOERR) {
+        std::ostringstream msg;
+        msg << "Could not get hyperslab of values for variable '" << name << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // getVar
+
+
 // ----------------------------------------------------------------------
 // Get values for variable as an array of strings.
 void
 pylith::meshio::ExodusII::getVar(string_vector* values,
-                                 int dim,
+                                 const PylithInt dim,
                                  const char* name) const { // getVar
     PYLITH_METHOD_BEGIN;
 
@@ -423,7 +496,7 @@ pylith::meshio::ExodusII::getVar(string_vector* values,
     char* buffer = (bufferSize > 0) ? new char[bufferSize] : 0;
     size_t indices[2] = { 0, 0 };
     size_t chunk[2] = { 1, bufferSize };
-    for (int i = 0; i < dim; ++i) {
+    for (PylithInt i = 0; i < dim; ++i) {
         indices[0] = i;
         err = nc_get_vara_text(_file, vid, indices, chunk, buffer);
         if (err != NC_NOERR) {
@@ -441,4 +514,65 @@ pylith::meshio::ExodusII::getVar(string_vector* values,
 } // getVar
 
 
+// ----------------------------------------------------------------------
+// Get id of variable and check that hyperslab is within bounds of variable.
+int
+pylith::meshio::ExodusII::_checkHyperslab(const size_t* start,
+                                          const size_t* count,
+                                          int ndims,
+                                          const char* name) const { // _checkHyperslab
+    PYLITH_METHOD_BEGIN;
+
+    assert(_file);
+    assert(start);
+    assert(count);
+
+    int vid = -1;
+    if (!hasVar(name, &vid)) {
+        std::ostringstream msg;
+        msg << "Missing variable '" << name << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    int vndims = 0;
+    int err = nc_inq_varndims(_file, vid, &vndims);
+    if (ndims != vndims) {
+        std::ostringstream msg;
+        msg << "Expecting " << ndims << " dimensions for variable '" << name
+            << "' but variable only has " << vndims << " dimensions.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    int* dimIds = (ndims > 0) ? new int[ndims] : 0;
+    err = nc_inq_vardimid(_file, vid, dimIds);
+    if (err != NC_NOERR) {
+        delete[] dimIds;dimIds = 0;
+        std::ostringstream msg;
+        msg << "Could not get dimensions for variable '" << name << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    for (int iDim = 0; iDim < ndims; ++iDim) {
+        size_t dimSize = 0;
+        err = nc_inq_dimlen(_file, dimIds[iDim], &dimSize);
+        if (err != NC_NOERR) {
+            delete[] dimIds;dimIds = 0;
+            std::ostringstream msg;
+            msg << "Could not get dimension '" << iDim << "' for variable '" << name << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        if (start[iDim] + count[iDim] > dimSize) {
+            delete[] dimIds;dimIds = 0;
+            std::ostringstream msg;
+            msg << "Hyperslab [" << start[iDim] << ", " << start[iDim]+count[iDim] << ") in dimension " << iDim
+                << " of variable '" << name << "' exceeds size of dimension (" << dimSize << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+    delete[] dimIds;dimIds = 0;
+
+    PYLITH_METHOD_RETURN(vid);
+} // _checkHyperslab
+
+
 // End of file
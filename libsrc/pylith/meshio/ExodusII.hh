@@ -89,7 +89,7 @@ public:
      * @param name Name of dimension.
      * @returns Value of dimension.
      */
-    int getDim(const char* name) const;
+    PylithInt getDim(const char* name) const;
 
     /** Get values for variable as an array of PylithScalars.
      *
@@ -99,19 +99,47 @@ public:
      * @param name Name of variable.
      */
     void getVar(PylithScalar* values,
-                int* dims,
+                const PylithInt* dims,
                 int ndims,
                 const char* name) const;
 
-    /** Get values for variable as an array of ints.
+    /** Get values for variable as an array of PylithInts.
      *
      * @param values Array of values.
      * @param dims Expected dimensions for variable.
      * @param ndims Number of dimension for variable.
      * @param name Name of variable.
      */
-    void getVar(int* values,
-                int* dims,
+    void getVar(PylithInt* values,
+                const PylithInt* dims,
+                int ndims,
+                const char* name) const;
+
+    /** Get hyperslab of values for variable as an array of PylithScalars.
+     *
+     * @param values Array of values [product of count].
+     * @param start Index of first value in each dimension.
+     * @param count Number of values in each dimension.
+     * @param ndims Number of dimension for variable.
+     * @param name Name of variable.
+     */
+    void getVar(PylithScalar* values,
+                const size_t* start,
+                const size_t* count,
+                int ndims,
+                const char* name) const;
+
+    /** Get hyperslab of values for variable as an array of PylithInts.
+     *
+     * @param values Array of values [product of count].
+     * @param start Index of first value in each dimension.
+     * @param count Number of values in each dimension.
+     * @param ndims Number of dimension for variable.
+     * @param name Name of variable.
+     */
+    void getVar(PylithInt* values,
+                const size_t* start,
+                const size_t* count,
                 int ndims,
                 const char* name) const;
 
@@ -122,9 +150,25 @@ public:
      * @param name Name of variable.
      */
     void getVar(string_vector* values,
-                int dim,
+                const PylithInt dim,
                 const char* name) const;
 
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Get id of variable and check that hyperslab is within bounds of variable.
+     *
+     * @param start Index of first value in each dimension.
+     * @param count Number of values in each dimension.
+     * @param ndims Number of dimension for variable.
+     * @param name Name of variable.
+     * @returns Id of variable.
+     */
+    int _checkHyperslab(const size_t* start,
+                        const size_t* count,
+                        int ndims,
+                        const char* name) const;
+
     // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
@@ -22,6 +22,7 @@
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
 
 namespace pylith {
     namespace meshio {
@@ -36,18 +37,36 @@ public:
 
                 static pylith::utils::EventLogger logger;
                 static PylithInt buildMesh;
+                static PylithInt buildMeshParallel;
                 static PylithInt setGroup;
                 static PylithInt setGroupAddPoints;
+                static PylithInt setGroupParallel;
 
                 static bool isInitialized;
             };
+
+            /** Reorder vertices in 3D cells from the cell-list convention to the DMPlex convention.
+             *
+             * @param[inout] cells Array of indices of vertices in cells.
+             * @param[in] numCells Number of cells.
+             * @param[in] numCorners Number of vertices per cell.
+             * @param[in] dim Dimension of cells.
+             */
+            static
+            void invertCells(int_array& cells,
+                             const PylithInt numCells,
+                             const int numCorners,
+                             const int dim);
+
         };
     }
 }
 pylith::utils::EventLogger pylith::meshio::_MeshBuilder::Events::logger;
 PylithInt pylith::meshio::_MeshBuilder::Events::buildMesh;
+PylithInt pylith::meshio::_MeshBuilder::Events::buildMeshParallel;
 PylithInt pylith::meshio::_MeshBuilder::Events::setGroup;
 PylithInt pylith::meshio::_MeshBuilder::Events::setGroupAddPoints;
+PylithInt pylith::meshio::_MeshBuilder::Events::setGroupParallel;
 bool pylith::meshio::_MeshBuilder::Events::isInitialized = false;
 
 void
@@ -59,21 +78,48 @@ pylith::meshio::_MeshBuilder::Events::init(void) {
     logger.setClassName("MeshBuilder");
     logger.initialize();
     buildMesh = logger.registerEvent("PL:MeshBuilder:buildMesh");
+    buildMeshParallel = logger.registerEvent("PL:MeshBuilder:buildMeshParallel");
     setGroup = logger.registerEvent("PL:MeshBuilder:setGroup");
     setGroupAddPoints = logger.registerEvent("PL:MeshBuilder:setGroupAddPoints");
+    setGroupParallel = logger.registerEvent("PL:MeshBuilder:setGroupParallel");
     isInitialized = true;
 }
 
 
+void
+pylith::meshio::_MeshBuilder::invertCells(int_array& cells,
+                                          const PylithInt numCells,
+                                          const int numCorners,
+                                          const int dim) {
+    if (dim < 3) {
+        return;
+    } // if
+
+    DMPolytopeType ct;
+    switch (numCorners) {
+    case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
+    case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
+    case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
+    default: return;
+    } // switch
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    const PetscInt bound = numCells*numCorners;
+    for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+        err = DMPlexInvertCell(ct, &cells[coff]);PYLITH_CHECK_ERROR(err);
+    } // for
+}
+
+
 // ----------------------------------------------------------------------
 // Set vertices and cells in mesh.
 void
 pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
                                        scalar_array* coordinates,
-                                       const int numVertices,
+                                       const PylithInt numVertices,
                                        int spaceDim,
                                        const int_array& cells,
-                                       const int numCells,
+                                       const PylithInt numCells,
                                        const int numCorners,
                                        const int meshDim,
                                        const bool isParallel) {
@@ -90,12 +136,12 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
     { // Check to make sure every vertex is in at least one cell.
       // This is required by PETSc
         std::vector<bool> vertexInCell(numVertices, false);
-        const int size = cells.size();
-        for (int i = 0; i < size; ++i) {
+        const size_t size = cells.size();
+        for (size_t i = 0; i < size; ++i) {
             vertexInCell[cells[i]] = true;
         }
-        int count = 0;
-        for (int i = 0; i < numVertices; ++i) {
+        PylithInt count = 0;
+        for (PylithInt i = 0; i < numVertices; ++i) {
             if (!vertexInCell[i]) {
                 ++count;
             }
@@ -113,20 +159,10 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 
     err = MPI_Bcast(&dim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
     err = MPI_Bcast(&spaceDim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
-    const PetscInt bound = numCells*numCorners;
-    for (PetscInt coff = 0; coff < bound; coff += numCorners) {
-        DMPolytopeType ct;
-
-        if (dim < 3) { continue;}
-        switch (numCorners) {
-        case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
-        case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
-        case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
-        default: continue;
-        }
-        err = DMPlexInvertCell(ct, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
-    }
-    err = DMPlexCreateFromCellListPetsc(comm, dim, numCells, numVertices, numCorners, interpolate, &cells[0], spaceDim, &(*coordinates)[0], &dmMesh);PYLITH_CHECK_ERROR(err);
+    _MeshBuilder::invertCells(const_cast<int_array&>(cells), numCells, numCorners, dim);
+    err = DMPlexCreateFromCellListPetsc(comm, dim, numCells, numVertices, numCorners, interpolate,
+                                        cells.size() ? &cells[0] : NULL, spaceDim,
+                                        coordinates->size() ? &(*coordinates)[0] : NULL, &dmMesh);PYLITH_CHECK_ERROR(err);
     mesh->setDM(dmMesh);
 
     _MeshBuilder::Events::logger.eventEnd(_MeshBuilder::Events::buildMesh);
@@ -134,6 +170,51 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 } // buildMesh
 
 
+// ----------------------------------------------------------------------
+// Set vertices and cells in distributed mesh from blocks read on each process.
+void
+pylith::meshio::MeshBuilder::buildMeshParallel(topology::Mesh* mesh,
+                                               PetscSF* vertexSF,
+                                               scalar_array* coordinates,
+                                               const PylithInt numVerticesLocal,
+                                               const PylithInt numVertices,
+                                               const int spaceDim,
+                                               const int_array& cells,
+                                               const PylithInt numCellsLocal,
+                                               const int numCorners,
+                                               const int meshDim) {
+    PYLITH_METHOD_BEGIN;
+    _MeshBuilder::Events::init();
+    _MeshBuilder::Events::logger.eventBegin(_MeshBuilder::Events::buildMeshParallel);
+
+    assert(mesh);
+    assert(vertexSF);
+    assert(coordinates);
+    assert(cells.size() == size_t(numCellsLocal)*size_t(numCorners));
+    assert(coordinates->size() == size_t(numVerticesLocal)*size_t(spaceDim));
+
+    // Vertices not in any cell cannot be detected without a global pass over the cells, so
+    // this check is left to the topology check after the mesh is built.
+
+    MPI_Comm comm = mesh->getComm();
+    PetscErrorCode err = PETSC_SUCCESS;
+
+    _MeshBuilder::invertCells(const_cast<int_array&>(cells), numCellsLocal, numCorners, meshDim);
+
+    PetscDM dmMesh = NULL;
+    const PetscBool interpolate = PETSC_TRUE;
+    const PetscReal* coordsArray = (numVerticesLocal > 0) ? &(*coordinates)[0] : NULL;
+    const PetscInt* cellsArray = (numCellsLocal > 0) ? &cells[0] : NULL;
+    err = DMPlexCreateFromCellListParallelPetsc(comm, meshDim, numCellsLocal, numVerticesLocal, numVertices, numCorners,
+                                                interpolate, cellsArray, spaceDim, coordsArray, vertexSF, NULL,
+                                                &dmMesh);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmMesh);
+
+    _MeshBuilder::Events::logger.eventEnd(_MeshBuilder::Events::buildMeshParallel);
+    PYLITH_METHOD_END;
+} // buildMeshParallel
+
+
 // ----------------------------------------------------------------------
 // Build a point group as an int section.
 void
@@ -158,39 +239,71 @@ pylith::meshio::MeshBuilder::setGroup(pylith::topology::Mesh* mesh,
             err = DMLabelSetValue(label, points[p], 1);PYLITH_CHECK_ERROR(err);
         } // for
     } else if (VERTEX == groupType) {
-        PetscInt cStart, cEnd, vStart, vEnd, numCells;
+        PetscInt cStart, cEnd, pStart, pEnd, depth, numCells;
 
         err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
         numCells = cEnd - cStart;
+
+        // Mark vertices in group along with any points already in the label.
+        std::vector<bool> marked(pEnd - pStart, false);
         for (PetscInt p = 0; p < numPoints; ++p) {
-            err = DMLabelSetValue(label, numCells+points[p], 1);PYLITH_CHECK_ERROR(err);
+            marked[numCells+points[p]-pStart] = true;
         } // for
-          // Also add any non-cells which have all vertices marked
-        _MeshBuilder::Events::logger.eventBegin(_MeshBuilder::Events::setGroupAddPoints);
-        for (PetscInt p = 0; p < numPoints; ++p) {
-            const PetscInt vertex = numCells+points[p];
-            PetscInt      *star = NULL, starSize, s;
-
-            err = DMPlexGetTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
-            for (s = 0; s < starSize*2; s += 2) {
-                const PetscInt point = star[s];
-                PetscInt      *closure = NULL, closureSize, c, value;
-                PetscBool marked = PETSC_TRUE;
+        IS existingIS = NULL;
+        err = DMLabelGetStratumIS(label, 1, &existingIS);PYLITH_CHECK_ERROR(err);
+        if (existingIS) {
+            PetscInt numExisting = 0;
+            const PetscInt* existingPoints = NULL;
+            err = ISGetLocalSize(existingIS, &numExisting);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(existingIS, &existingPoints);PYLITH_CHECK_ERROR(err);
+            for (PetscInt i = 0; i < numExisting; ++i) {
+                marked[existingPoints[i]-pStart] = true;
+            } // for
+            err = ISRestoreIndices(existingIS, &existingPoints);PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&existingIS);PYLITH_CHECK_ERROR(err);
+        } // if
 
+        // Also add any non-cells which have all vertices marked. Sweep upward through the depth
+        // strata; a point has all vertices in its closure marked if and only if all points in its
+        // cone are marked.
+        _MeshBuilder::Events::logger.eventBegin(_MeshBuilder::Events::setGroupAddPoints);
+        for (PetscInt d = 1; d < depth; ++d) {
+            PetscInt dStart = 0, dEnd = 0;
+            err = DMPlexGetDepthStratum(dmMesh, d, &dStart, &dEnd);PYLITH_CHECK_ERROR(err);
+            for (PetscInt point = dStart; point < dEnd; ++point) {
                 if ((point >= cStart) && (point < cEnd)) { continue;}
-                err = DMPlexGetTransitiveClosure(dmMesh, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
-                for (c = 0; c < closureSize*2; c += 2) {
-                    if ((closure[c] >= vStart) && (closure[c] < vEnd)) {
-                        err = DMLabelGetValue(label, closure[c], &value);PYLITH_CHECK_ERROR(err);
-                        if (value != 1) {marked = PETSC_FALSE;break;}
-                    }
-                }
-                err = DMPlexRestoreTransitiveClosure(dmMesh, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
-                if (marked) {err = DMLabelSetValue(label, point, 1);PYLITH_CHECK_ERROR(err);}
-            }
-            err = DMPlexRestoreTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
-        }
+                const PetscInt* cone = NULL;
+                PetscInt coneSize = 0, numMarked = 0;
+                err = DMPlexGetConeSize(dmMesh, point, &coneSize);PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetCone(dmMesh, point, &cone);PYLITH_CHECK_ERROR(err);
+                for (PetscInt c = 0; c < coneSize; ++c) {
+                    numMarked += marked[cone[c]-pStart] ? 1 : 0;
+                } // for
+                if ((coneSize > 0) && (numMarked == coneSize)) {
+                    marked[point-pStart] = true;
+                } // if
+            } // for
+        } // for
+
+        // Set label values in bulk.
+        PetscInt numMarked = 0;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            numMarked += marked[point-pStart] ? 1 : 0;
+        } // for
+        PetscInt* markedPoints = NULL;
+        err = PetscMalloc1(numMarked, &markedPoints);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart, index = 0; point < pEnd; ++point) {
+            if (marked[point-pStart]) {
+                markedPoints[index++] = point;
+            } // if
+        } // for
+        IS markedIS = NULL;
+        err = ISCreateGeneral(PETSC_COMM_SELF, numMarked, markedPoints, PETSC_OWN_POINTER, &markedIS);PYLITH_CHECK_ERROR(err);
+        err = ISSetInfo(markedIS, IS_SORTED, IS_LOCAL, PETSC_TRUE, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+        err = DMLabelSetStratumIS(label, 1, markedIS);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&markedIS);PYLITH_CHECK_ERROR(err);
         _MeshBuilder::Events::logger.eventEnd(_MeshBuilder::Events::setGroupAddPoints);
     } // if/else
 
@@ -199,4 +312,69 @@ pylith::meshio::MeshBuilder::setGroup(pylith::topology::Mesh* mesh,
 } // setGroup
 
 
+// ----------------------------------------------------------------------
+// Build a vertex group in a mesh created with buildMeshParallel().
+void
+pylith::meshio::MeshBuilder::setGroupParallel(pylith::topology::Mesh* mesh,
+                                              const char* name,
+                                              PetscSF vertexSF,
+                                              const int_array& points) {
+    PYLITH_METHOD_BEGIN;
+    _MeshBuilder::Events::init();
+    _MeshBuilder::Events::logger.eventBegin(_MeshBuilder::Events::setGroupParallel);
+    assert(mesh);
+    assert(vertexSF);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+
+    // Mark vertices in the group on the processes holding their coordinates (roots of vertexSF).
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leafIndices = NULL;
+    err = PetscSFGetGraph(vertexSF, &numRoots, &numLeaves, &leafIndices, NULL);PYLITH_CHECK_ERROR(err);
+    PetscLayout rootLayout = NULL;
+    err = PetscLayoutCreateFromSizes(mesh->getComm(), numRoots, PETSC_DECIDE, 1, &rootLayout);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt numPoints = points.size();
+    PetscSF groupSF = NULL;
+    err = PetscSFCreate(mesh->getComm(), &groupSF);PYLITH_CHECK_ERROR(err);
+    err = PetscSFSetGraphLayout(groupSF, rootLayout, numPoints, NULL, PETSC_COPY_VALUES,
+                                (numPoints > 0) ? &points[0] : NULL);PYLITH_CHECK_ERROR(err);
+    err = PetscLayoutDestroy(&rootLayout);PYLITH_CHECK_ERROR(err);
+
+    int_array pointMarks(1, numPoints);
+    int_array rootMarks(0, numRoots);
+    PylithInt* pointMarksArray = pointMarks.size() ? &pointMarks[0] : NULL;
+    PylithInt* rootMarksArray = rootMarks.size() ? &rootMarks[0] : NULL;
+    err = PetscSFReduceBegin(groupSF, MPIU_INT, pointMarksArray, rootMarksArray, MPI_MAX);PYLITH_CHECK_ERROR(err);
+    err = PetscSFReduceEnd(groupSF, MPIU_INT, pointMarksArray, rootMarksArray, MPI_MAX);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&groupSF);PYLITH_CHECK_ERROR(err);
+
+    // Send marks to all local copies of the vertices (leaves of vertexSF).
+    PetscInt leafStart = 0, leafEnd = 0;
+    err = PetscSFGetLeafRange(vertexSF, &leafStart, &leafEnd);PYLITH_CHECK_ERROR(err);
+    int_array leafMarks(0, leafEnd+1);
+    PylithInt* leafMarksArray = leafMarks.size() ? &leafMarks[0] : NULL;
+    err = PetscSFBcastBegin(vertexSF, MPIU_INT, rootMarksArray, leafMarksArray, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(vertexSF, MPIU_INT, rootMarksArray, leafMarksArray, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+
+    size_t numVerticesGroup = 0;
+    for (PetscInt i = 0; i < numLeaves; ++i) {
+        const PetscInt v = leafIndices ? leafIndices[i] : i;
+        numVerticesGroup += leafMarks[v] ? 1 : 0;
+    } // for
+    int_array verticesGroup(numVerticesGroup);
+    for (PetscInt i = 0, index = 0; i < numLeaves; ++i) {
+        const PetscInt v = leafIndices ? leafIndices[i] : i;
+        if (leafMarks[v]) {
+            verticesGroup[index++] = v;
+        } // if
+    } // for
+
+    setGroup(mesh, name, VERTEX, verticesGroup);
+
+    _MeshBuilder::Events::logger.eventEnd(_MeshBuilder::Events::setGroupParallel);
+    PYLITH_METHOD_END;
+} // setGroupParallel
+
+
 // End of file
@@ -12,6 +12,7 @@
 #include "pylith/meshio/meshiofwd.hh" // forward declarations
 
 #include "pylith/topology/topologyfwd.hh" // USES Mesh
+#include "pylith/utils/petscfwd.h" // USES PetscSF
 #include "pylith/utils/arrayfwd.hh" // USES scalar_array, int_array,
                                     // string_vector
 #include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
@@ -51,19 +52,51 @@ public:
     static
     void buildMesh(pylith::topology::Mesh* mesh,
                    scalar_array* coordinates,
-                   const int numVertices,
+                   const PylithInt numVertices,
                    int spaceDim,
                    const int_array& cells,
-                   const int numCells,
+                   const PylithInt numCells,
                    const int numCorners,
                    const int meshDim,
                    const bool isParallel=false);
 
+    /** Build distributed mesh topology and set vertex coordinates from blocks of cells and vertices
+     * read on each process.
+     *
+     * Each process provides a contiguous block of cells and a contiguous block of vertices, with the
+     * blocks of vertices ordered by process. Vertex indices in the cells are global (first index is 0).
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[out] vertexSF Star forest from block of vertices on each process (roots) to local vertices (leaves).
+     * @param[in] coordinates Array of coordinates of vertices in block on this process.
+     * @param[in] numVerticesLocal Number of vertices in block on this process.
+     * @param[in] numVertices Total number of vertices.
+     * @param[in] spaceDim Dimension of vector space for vertex coordinates.
+     * @param[in] cells Array of global indices of vertices in cells in block on this process.
+     * @param[in] numCellsLocal Number of cells in block on this process.
+     * @param[in] numCorners Number of vertices per cell.
+     * @param[in] meshDim Dimension of cells in mesh.
+     */
+    static
+    void buildMeshParallel(pylith::topology::Mesh* mesh,
+                           PetscSF* vertexSF,
+                           scalar_array* coordinates,
+                           const PylithInt numVerticesLocal,
+                           const PylithInt numVertices,
+                           const int spaceDim,
+                           const int_array& cells,
+                           const PylithInt numCellsLocal,
+                           const int numCorners,
+                           const int meshDim);
+
     /** Build a point group
      *
      * The indices in the points array must use zero based indices. In
      * other words, the lowest index MUST be 0 not 1.
      *
+     * For vertex groups, edges and faces with all of their vertices in the group are also added
+     * to the group. This uses only the local topology, so it also works on distributed meshes.
+     *
      * @param[inout] mesh PyLith finite-element mesh.
      * @param[in] name The group name
      * @param[in] groupType The point type, e.g. VERTEX, CELL
@@ -75,6 +108,22 @@ public:
                   const GroupPtType groupType,
                   const int_array& points);
 
+    /** Build a vertex group in a mesh created with buildMeshParallel().
+     *
+     * Each process provides any subset of the vertices in the group using global indices (first
+     * index is 0). The group is marked on every local copy of the vertices.
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[in] name The group name
+     * @param[in] vertexSF Star forest from buildMeshParallel().
+     * @param[in] points Array of global indices of vertices in the group.
+     */
+    static
+    void setGroupParallel(pylith::topology::Mesh* mesh,
+                          const char* name,
+                          PetscSF vertexSF,
+                          const int_array& points);
+
 }; // MeshBuilder
 
 // End of file
@@ -132,7 +132,7 @@ pylith::meshio::MeshIO::write(pylith::topology::Mesh* const mesh) { // write
 // Get coordinates of vertices in mesh.
 void
 pylith::meshio::MeshIO::_getVertices(scalar_array* coordinates,
-                                     int* numVertices,
+                                     PylithInt* numVertices,
                                      int* spaceDim) const { // _getVertices
     PYLITH_METHOD_BEGIN;
 
@@ -175,7 +175,7 @@ pylith::meshio::MeshIO::_getVertices(scalar_array* coordinates,
 // Get cells in mesh.
 void
 pylith::meshio::MeshIO::_getCells(int_array* cells,
-                                  int* numCells,
+                                  PylithInt* numCells,
                                   int* numCorners,
                                   int* meshDim) const {
     PYLITH_METHOD_BEGIN;
@@ -241,24 +241,22 @@ pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds) {
     PetscErrorCode err = 0;
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
 
-    if (!_mesh->getCommRank()) {
-        PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
-        topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
-        const PetscInt cStart = cellsStratum.begin();
-        const PetscInt cEnd = cellsStratum.end();
-
-        if (size_t(cellsStratum.size()) != materialIds.size()) {
-            std::ostringstream msg;
-            msg << "Mismatch in size of materials identifier array ("
-                << materialIds.size() << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
-            throw std::runtime_error(msg.str());
-        } // if
-        for (PetscInt c = cStart; c < cEnd; ++c) {
-            err = DMSetLabelValue(dmMesh, labelName, c, materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
-        } // for
-    } else {
-        err = DMCreateLabel(dmMesh, labelName);PYLITH_CHECK_ERROR(err);
-    } // if/else
+    // Material identifiers are for the local cells, which are all of the cells on process 0 for a
+    // mesh built in serial and a block of cells on each process for a mesh built in parallel.
+    err = DMCreateLabel(dmMesh, labelName);PYLITH_CHECK_ERROR(err);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+
+    if (size_t(cellsStratum.size()) != materialIds.size()) {
+        std::ostringstream msg;
+        msg << "Mismatch in size of materials identifier array ("
+            << materialIds.size() << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        err = DMSetLabelValue(dmMesh, labelName, c, materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
+    } // for
 
     PYLITH_METHOD_END;
 } // _setMaterials
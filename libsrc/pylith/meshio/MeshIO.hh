@@ -74,7 +74,7 @@ protected:
      * @param spaceDim Poiner to dimension of vector space for coordinates
      */
     void _getVertices(scalar_array* coordinates,
-                      int* numVertices,
+                      PylithInt* numVertices,
                       int* spaceDim) const;
 
     /** Get information about cells in mesh.
@@ -91,7 +91,7 @@ protected:
      * @param meshDim Pointer to number of dimensions associated with cell
      */
     void _getCells(int_array* cells,
-                   int* numCells,
+                   PylithInt* numCells,
                    int* numCorners,
                    int* meshDim) const;
 
@@ -23,11 +23,23 @@
 
 #include <iomanip> // USES setw(), setiosflags(), resetiosflags()
 #include <strings.h> // USES strcasecmp()
+#include <algorithm> // USES std::min(), std::max()
 #include <cassert> // USES assert()
+#include <cctype> // USES isspace()
+#include <cstdlib> // USES strtod()
+#include <cstring> // USES memchr()
 #include <fstream> // USES std::ifstream, std::ofstream
+#include <functional> // USES std::function
+#include <limits> // USES std::numeric_limits
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <typeinfo> // USES std::typeid
+#include <thread> // USES std::thread
+#include <vector> // USES std::vector
+#include <fcntl.h> // USES open()
+#include <sys/mman.h> // USES mmap(), munmap()
+#include <sys/stat.h> // USES fstat()
+#include <unistd.h> // USES close()
 
 // ---------------------------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -36,6 +48,199 @@ namespace pylith {
 public:
 
             static const char* groupTypeNames[];
+
+            /// Read-only memory map of a file.
+            class MappedFile {
+public:
+
+                /** Constructor.
+                 *
+                 * @param[in] filename Name of file.
+                 */
+                MappedFile(const std::string& filename);
+
+                /// Destructor.
+                ~MappedFile(void);
+
+                /// Get pointer to beginning of file contents.
+                const char* begin(void) const;
+
+                /// Get pointer to end of file contents.
+                const char* end(void) const;
+
+private:
+
+                void* _data; ///< Mapped file contents.
+                size_t _size; ///< Size of file in bytes.
+            }; // MappedFile
+
+            /// Scanner for the keywords and settings of the mesh file.
+            class Scanner {
+public:
+
+                /** Constructor.
+                 *
+                 * @param[in] begin Beginning of file contents.
+                 * @param[in] end End of file contents.
+                 */
+                Scanner(const char* begin,
+                        const char* end);
+
+                /** Get next token.
+                 *
+                 * Tokens are separated by whitespace; '=', '{', and '}' are tokens by themselves.
+                 *
+                 * @param[out] token Next token.
+                 * @returns False if end of file is reached, true otherwise.
+                 */
+                bool next(std::string* token);
+
+                /** Check that next token matches expected value.
+                 *
+                 * @param[in] value Expected token.
+                 */
+                void expect(const char* value);
+
+                /** Get value of setting `= VALUE`.
+                 *
+                 * @returns Value as a string.
+                 */
+                std::string getValue(void);
+
+                /** Get integer value of setting `= VALUE`.
+                 *
+                 * @returns Value as an integer.
+                 */
+                PylithInt getInt(void);
+
+                /** Get remainder of line following '=' with comments and surrounding whitespace removed.
+                 *
+                 * @returns Remainder of line.
+                 */
+                std::string getLine(void);
+
+                /** Get contents of block `= { ... }` and advance past the closing brace.
+                 *
+                 * @param[out] begin Beginning of block contents.
+                 * @param[out] end End of block contents (closing brace).
+                 */
+                void getBlock(const char** begin,
+                              const char** end);
+
+private:
+
+                /// Skip whitespace and comments.
+                void _skip(void);
+
+                const char* _ptr; ///< Current position.
+                const char* _end; ///< End of file contents.
+            }; // Scanner
+
+            /** Parse rows of values in block using multiple threads.
+             *
+             * Each row contains `numLabels` labels followed by `numColumns` values. Labels are
+             * discarded. Values may span lines; comments are ignored.
+             *
+             * @param[out] values Array of values [numRows*numColumns].
+             * @param[in] numRows Number of rows.
+             * @param[in] numColumns Number of values in each row.
+             * @param[in] numLabels Number of labels at the beginning of each row.
+             * @param[in] begin Beginning of block.
+             * @param[in] end End of block.
+             * @param[in] numThreads Number of threads.
+             * @param[in] blockName Name of block for error messages.
+             */
+            template<typename T>
+            static
+            void parseBlock(T* values,
+                            const size_t numRows,
+                            const size_t numColumns,
+                            const size_t numLabels,
+                            const char* begin,
+                            const char* end,
+                            const size_t numThreads,
+                            const char* blockName);
+
+            /** Get next token in block.
+             *
+             * @param[in] ptr Current position.
+             * @param[in] end End of block.
+             * @param[out] tokenEnd End of token.
+             * @returns Beginning of token (end if there are no more tokens).
+             */
+            static
+            const char* nextToken(const char* ptr,
+                                  const char* end,
+                                  const char** tokenEnd);
+
+            /** Parse token into a value.
+             *
+             * @param[in] begin Beginning of token.
+             * @param[in] end End of token.
+             * @param[out] value Parsed value.
+             * @returns True if entire token was parsed, false otherwise.
+             */
+            static
+            bool parseValue(const char* begin,
+                            const char* end,
+                            PylithScalar* value);
+
+            static
+            bool parseValue(const char* begin,
+                            const char* end,
+                            PylithInt* value);
+
+            /** Read vertices section.
+             *
+             * @param[inout] scanner Scanner positioned after 'vertices'.
+             * @param[out] coordinates Array of vertex coordinates.
+             * @param[out] numVertices Number of vertices.
+             * @param[out] spaceDim Dimension of coordinate space.
+             * @param[in] numThreads Number of threads.
+             */
+            static
+            void readVertices(Scanner& scanner,
+                              scalar_array* coordinates,
+                              PylithInt* numVertices,
+                              int* spaceDim,
+                              const size_t numThreads);
+
+            /** Read cells section.
+             *
+             * @param[inout] scanner Scanner positioned after 'cells'.
+             * @param[out] cells Array of indices of cell vertices.
+             * @param[out] materialIds Array of material identifiers.
+             * @param[out] numCells Number of cells.
+             * @param[out] numCorners Number of vertices in each cell.
+             * @param[in] useIndexZero True if indices start at 0, false if they start at 1.
+             * @param[in] numThreads Number of threads.
+             */
+            static
+            void readCells(Scanner& scanner,
+                           int_array* cells,
+                           int_array* materialIds,
+                           PylithInt* numCells,
+                           PylithInt* numCorners,
+                           const bool useIndexZero,
+                           const size_t numThreads);
+
+            /** Read group section.
+             *
+             * @param[inout] scanner Scanner positioned after 'group'.
+             * @param[out] points Array of indices of points in group.
+             * @param[out] type Type of points in group.
+             * @param[out] name Name of group.
+             * @param[in] useIndexZero True if indices start at 0, false if they start at 1.
+             * @param[in] numThreads Number of threads.
+             */
+            static
+            void readGroup(Scanner& scanner,
+                           int_array* points,
+                           pylith::meshio::MeshBuilder::GroupPtType* type,
+                           std::string* name,
+                           const bool useIndexZero,
+                           const size_t numThreads);
+
         }; // _MeshIOAscii
         const char* _MeshIOAscii::_MeshIOAscii::groupTypeNames[2] = {
             "vertices",
@@ -48,7 +253,9 @@ public:
 // Constructor
 pylith::meshio::MeshIOAscii::MeshIOAscii(void) :
     _filename(""),
-    _useIndexZero(true) { // constructor
+    _numReadThreads(0),
+    _useIndexZero(true),
+    _useFastRead(false) { // constructor
     PyreComponent::setName("meshioascii");
 } // constructor
 
@@ -72,6 +279,21 @@ pylith::meshio::MeshIOAscii::deallocate(void) { // deallocate
 } // deallocate
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of threads used by the fast reader.
+void
+pylith::meshio::MeshIOAscii::setNumReadThreads(const int value) {
+    PYLITH_COMPONENT_DEBUG("setNumReadThreads(value="<<value<<")");
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Number of threads for reading ASCII mesh (" << value << ") must be nonnegative.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _numReadThreads = value;
+} // setNumReadThreads
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Read mesh.
 void
@@ -82,13 +304,18 @@ pylith::meshio::MeshIOAscii::_read(void) { // _read
     const int commRank = _mesh->getCommRank();
     int meshDim = 0;
     int spaceDim = 0;
-    int numVertices = 0;
-    int numCells = 0;
-    int numCorners = 0;
+    PylithInt numVertices = 0;
+    PylithInt numCells = 0;
+    PylithInt numCorners = 0;
     scalar_array coordinates;
     int_array cells;
     int_array materialIds;
 
+    if ((0 == commRank) && _useFastRead) {
+        _readFast();
+        PYLITH_METHOD_END;
+    } // if
+
     if (0 == commRank) {
         std::ifstream filein(_filename.c_str());
         if (!filein.is_open() || !filein.good()) {
@@ -237,7 +464,7 @@ pylith::meshio::MeshIOAscii::_write(void) const { // write
 void
 pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parser,
                                            scalar_array* coordinates,
-                                           int* numVertices,
+                                           PylithInt* numVertices,
                                            int* numDims) const { // _readVertices
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("_readVertices(parser="<<typeid(parser).name()<<", cordinates="<<coordinates<<", numVertices="<<numVertices<<", numDims="<<numDims<<")");
@@ -260,15 +487,15 @@ pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parse
             buffer.ignore(maxIgnore, '=');
             buffer >> *numVertices;
         } else if (0 == strcasecmp(token.c_str(), "coordinates")) {
-            const int size = (*numVertices) * (*numDims);
+            const PylithInt size = (*numVertices) * (*numDims);
             if (0 == size) {
                 const char* msg =
                     "Tokens 'dimension' and 'count' must precede 'coordinates'.";
                 throw std::runtime_error(msg);
             } // if
             coordinates->resize(size);
-            int label;
-            for (int iVertex = 0, i = 0; iVertex < *numVertices; ++iVertex) {
+            PylithInt label;
+            for (PylithInt iVertex = 0, i = 0; iVertex < *numVertices; ++iVertex) {
                 buffer.str(parser.next());
                 buffer.clear();
                 buffer >> label;
@@ -302,7 +529,7 @@ pylith::meshio::MeshIOAscii::_writeVertices(std::ostream& fileout) const { // _w
     PYLITH_COMPONENT_DEBUG("_writeVertices(fileout="<<typeid(fileout).name()<<")");
 
     int spaceDim = 0;
-    int numVertices = 0;
+    PylithInt numVertices = 0;
     scalar_array coordinates;
     _getVertices(&coordinates, &numVertices, &spaceDim);
 
@@ -314,7 +541,7 @@ pylith::meshio::MeshIOAscii::_writeVertices(std::ostream& fileout) const { // _w
         << std::resetiosflags(std::ios::fixed)
         << std::setiosflags(std::ios::scientific)
         << std::setprecision(6);
-    for (int iVertex = 0, i = 0; iVertex < numVertices; ++iVertex) {
+    for (PylithInt iVertex = 0, i = 0; iVertex < numVertices; ++iVertex) {
         fileout << "      ";
         fileout << std::setw(8) << iVertex;
         for (int iDim = 0; iDim < spaceDim; ++iDim) {
@@ -336,8 +563,8 @@ void
 pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
                                         int_array* cells,
                                         int_array* materialIds,
-                                        int* numCells,
-                                        int* numCorners) const { // _readCells
+                                        PylithInt* numCells,
+                                        PylithInt* numCorners) const { // _readCells
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("_readCells(parser="<<typeid(parser).name()<<", cells="<<cells<<", materialIds="<<materialIds<<", numCells="<<numCells<<",numCorners="<<numCorners<<")");
 
@@ -360,26 +587,26 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
             buffer.ignore(maxIgnore, '=');
             buffer >> *numCells;
         } else if (0 == strcasecmp(token.c_str(), "simplices")) {
-            const int size = (*numCells) * (*numCorners);
+            const PylithInt size = (*numCells) * (*numCorners);
             if (0 == size) {
                 const char* msg =
                     "Tokens 'num-corners' and 'count' must precede 'cells'.";
                 throw std::runtime_error(msg);
             } // if
             cells->resize(size);
-            int label;
-            for (int iCell = 0, i = 0; iCell < *numCells; ++iCell) {
+            PylithInt label;
+            for (PylithInt iCell = 0, i = 0; iCell < *numCells; ++iCell) {
                 buffer.str(parser.next());
                 buffer.clear();
                 buffer >> label;
-                for (int iCorner = 0; iCorner < *numCorners; ++iCorner) {
+                for (PylithInt iCorner = 0; iCorner < *numCorners; ++iCorner) {
                     buffer >> (*cells)[i++];
                 }
             } // for
             if (!_useIndexZero) {
                 // if files begins with index 1, then decrement to index 0
                 // for compatibility with PETSc
-                for (int i = 0; i < size; ++i) {
+                for (PylithInt i = 0; i < size; ++i) {
                     --(*cells)[i];
                 }
             } // if
@@ -390,10 +617,10 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
                     "Token 'count' must precede 'material-ids'.";
                 throw std::runtime_error(msg);
             } // if
-            const int size = *numCells;
+            const PylithInt size = *numCells;
             materialIds->resize(size);
-            int label = 0;
-            for (int iCell = 0; iCell < *numCells; ++iCell) {
+            PylithInt label = 0;
+            for (PylithInt iCell = 0; iCell < *numCells; ++iCell) {
                 buffer.str(parser.next());
                 buffer.clear();
                 buffer >> label;
@@ -418,7 +645,7 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
 
     // If no materials given, assign each cell material identifier of 0
     if ((0 == materialIds->size()) && (*numCells > 0)) {
-        const int size = *numCells;
+        const PylithInt size = *numCells;
         materialIds->resize(size);
         (*materialIds) = 0;
     } // if
@@ -435,7 +662,7 @@ pylith::meshio::MeshIOAscii::_writeCells(std::ostream& fileout) const { // _writ
     PYLITH_COMPONENT_DEBUG("_writeCells(fileout="<<typeid(fileout).name()<<")");
 
     int meshDim = 0;
-    int numCells = 0;
+    PylithInt numCells = 0;
     int numCorners = 0;
     int_array cells;
     _getCells(&cells, &numCells, &numCorners, &meshDim);
@@ -446,7 +673,7 @@ pylith::meshio::MeshIOAscii::_writeCells(std::ostream& fileout) const { // _writ
         << "    num-corners = " << numCorners << "\n"
         << "    simplices = {\n";
 
-    for (int iCell = 0, i = 0; iCell < numCells; ++iCell) {
+    for (PylithInt iCell = 0, i = 0; iCell < numCells; ++iCell) {
         fileout << "      " << std::setw(8) << iCell;
         for (int iCorner = 0; iCorner < numCorners; ++iCorner) {
             fileout << std::setw(8) << cells[i++];
@@ -460,7 +687,7 @@ pylith::meshio::MeshIOAscii::_writeCells(std::ostream& fileout) const { // _writ
     _getMaterials(&materialIds);
     assert(size_t(numCells) == materialIds.size());
     fileout << "    material-ids = {\n";
-    for (int iCell = 0; iCell < numCells; ++iCell) {
+    for (PylithInt iCell = 0; iCell < numCells; ++iCell) {
         fileout << "      " << std::setw(8) << iCell;
         fileout << std::setw(4) << materialIds[iCell] << "\n";
     } // for
@@ -489,7 +716,7 @@ pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
     std::string token;
     std::istringstream buffer;
     const int maxIgnore = 1024;
-    int numPoints = -1;
+    PylithInt numPoints = -1;
     buffer.str(parser.next());
     buffer.clear();
     buffer >> token;
@@ -525,7 +752,7 @@ pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
             points->resize(numPoints);
             buffer.str(parser.next());
             buffer.clear();
-            int i = 0;
+            PylithInt i = 0;
             while (buffer.good() && i < numPoints) {
                 buffer >> (*points)[i++];
                 buffer >> std::ws;
@@ -572,14 +799,14 @@ pylith::meshio::MeshIOAscii::_writeGroup(std::ostream& fileout,
 
     const int offset = _useIndexZero ? 0 : 1;
 
-    const int numPoints = points.size();
+    const PylithInt numPoints = points.size();
     fileout
         << "  group = {\n"
         << "    name = " << name << "\n"
         << "    type = " << _MeshIOAscii::groupTypeNames[type] << "\n"
         << "    count = " << numPoints << "\n"
         << "    indices = {\n";
-    for (int i = 0; i < numPoints; ++i) {
+    for (PylithInt i = 0; i < numPoints; ++i) {
         fileout << "      " << points[i]+offset << "\n";
     }
 
@@ -591,4 +818,655 @@ pylith::meshio::MeshIOAscii::_writeGroup(std::ostream& fileout,
 } // _writeGroup
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh using memory-mapped file and multithreaded parsing of numeric blocks.
+void
+pylith::meshio::MeshIOAscii::_readFast(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readFast()");
+
+    size_t numThreads = _numReadThreads > 0 ? size_t(_numReadThreads) : size_t(std::thread::hardware_concurrency());
+    numThreads = std::max(numThreads, size_t(1));
+
+    int meshDim = 0;
+    int spaceDim = 0;
+    PylithInt numVertices = 0;
+    PylithInt numCells = 0;
+    PylithInt numCorners = 0;
+    scalar_array coordinates;
+    int_array cells;
+    int_array materialIds;
+
+    try {
+        _MeshIOAscii::MappedFile file(_filename);
+        _MeshIOAscii::Scanner scanner(file.begin(), file.end());
+
+        std::string token;
+        scanner.next(&token);
+        if (strcasecmp(token.c_str(), "mesh")) {
+            std::ostringstream msg;
+            msg << "Expected 'mesh' token but encountered '" << token << "'\n";
+            throw std::runtime_error(msg.str());
+        } // if
+        scanner.expect("=");
+        scanner.expect("{");
+
+        bool readDim = false;
+        bool readCells = false;
+        bool readVertices = false;
+        bool builtMesh = false;
+
+        while (scanner.next(&token) && token != "}") {
+            if (0 == strcasecmp(token.c_str(), "dimension")) {
+                meshDim = scanner.getInt();
+                readDim = true;
+            } else if (0 == strcasecmp(token.c_str(), "use-index-zero")) {
+                const std::string& flag = scanner.getValue();
+                _useIndexZero = 0 == strcasecmp(flag.c_str(), "true");
+            } else if (0 == strcasecmp(token.c_str(), "vertices")) {
+                _MeshIOAscii::readVertices(scanner, &coordinates, &numVertices, &spaceDim, numThreads);
+                readVertices = true;
+            } else if (0 == strcasecmp(token.c_str(), "cells")) {
+                _MeshIOAscii::readCells(scanner, &cells, &materialIds, &numCells, &numCorners, _useIndexZero, numThreads);
+                readCells = true;
+            } else if (0 == strcasecmp(token.c_str(), "group")) {
+                std::string name;
+                pylith::meshio::MeshBuilder::GroupPtType type;
+                int_array points;
+
+                if (!builtMesh) {
+                    throw std::runtime_error("Both 'vertices' and 'cells' must "
+                                             "precede any groups in mesh file.");
+                }
+                _MeshIOAscii::readGroup(scanner, &points, &type, &name, _useIndexZero, numThreads);
+                pylith::meshio::MeshBuilder::setGroup(_mesh, name.c_str(), type, points);
+            } else {
+                std::ostringstream msg;
+                msg << "Could not parse '" << token << "' into a mesh setting.";
+                throw std::runtime_error(msg.str());
+            } // else
+
+            if (readDim && readCells && readVertices && !builtMesh) {
+                MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim);
+                _setMaterials(materialIds);
+                builtMesh = true;
+            } // if
+        } // while
+        if (token != "}") {
+            throw std::runtime_error("I/O error occurred while parsing mesh tokens.");
+        }
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error occurred while reading PyLith mesh ASCII file '"
+            << _filename << "'.\n"
+            << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Unknown I/O error while reading PyLith mesh ASCII file '"
+            << _filename << "'.\n";
+        throw std::runtime_error(msg.str());
+    } // catch
+
+    PYLITH_METHOD_END;
+} // _readFast
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Parse token into an integer.
+bool
+pylith::meshio::MeshIOAscii::_parseInt(const char* begin,
+                                       const char* end,
+                                       PylithInt* value) {
+    assert(value);
+
+    const char* ptr = begin;
+    const bool isNegative = (ptr < end) && ('-' == *ptr);
+    if ((ptr < end) && (('-' == *ptr) || ('+' == *ptr))) {
+        ++ptr;
+    } // if
+    if (ptr == end) {
+        return false;
+    } // if
+
+    // Reject values that do not fit in a PylithInt rather than silently wrapping.
+    const PylithInt maxValue = std::numeric_limits<PylithInt>::max();
+    PylithInt result = 0;
+    for (; ptr < end; ++ptr) {
+        if ((*ptr < '0') || (*ptr > '9')) {
+            return false;
+        } // if
+        const PylithInt digit = *ptr - '0';
+        if (result > (maxValue - digit) / 10) {
+            return false;
+        } // if
+        result = 10*result + digit;
+    } // for
+    *value = isNegative ? -result : result;
+
+    return true;
+} // _parseInt
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::_MeshIOAscii::MappedFile::MappedFile(const std::string& filename) :
+    _data(NULL),
+    _size(0) {
+    const int fd = open(filename.c_str(), O_RDONLY);
+    struct stat info;
+    if ((fd < 0) || (fstat(fd, &info) < 0)) {
+        if (fd >= 0) { close(fd); }
+        std::ostringstream msg;
+        msg << "Could not open mesh file '" << filename << "' for reading.\n";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _size = size_t(info.st_size);
+    if (_size > 0) {
+        _data = mmap(NULL, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    } // if
+    close(fd);
+    if (MAP_FAILED == _data) {
+        _data = NULL;
+        std::ostringstream msg;
+        msg << "Could not map mesh file '" << filename << "' into memory.\n";
+        throw std::runtime_error(msg.str());
+    } // if
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::_MeshIOAscii::MappedFile::~MappedFile(void) {
+    if (_data) {
+        munmap(_data, _size);
+    } // if
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get pointer to beginning of file contents.
+const char*
+pylith::meshio::_MeshIOAscii::MappedFile::begin(void) const {
+    return static_cast<const char*>(_data);
+} // begin
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get pointer to end of file contents.
+const char*
+pylith::meshio::_MeshIOAscii::MappedFile::end(void) const {
+    return static_cast<const char*>(_data) + _size;
+} // end
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::_MeshIOAscii::Scanner::Scanner(const char* begin,
+                                               const char* end) :
+    _ptr(begin),
+    _end(end) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Skip whitespace and comments.
+void
+pylith::meshio::_MeshIOAscii::Scanner::_skip(void) {
+    while (_ptr < _end) {
+        if (isspace(static_cast<unsigned char>(*_ptr))) {
+            ++_ptr;
+        } else if (('/' == *_ptr) && (_ptr+1 < _end) && ('/' == _ptr[1])) {
+            const char* eol = static_cast<const char*>(memchr(_ptr, '\n', _end-_ptr));
+            _ptr = eol ? eol : _end;
+        } else {
+            break;
+        } // if/else
+    } // while
+} // _skip
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get next token.
+bool
+pylith::meshio::_MeshIOAscii::Scanner::next(std::string* token) {
+    assert(token);
+
+    _skip();
+    if (_ptr >= _end) {
+        token->clear();
+        return false;
+    } // if
+
+    const char* begin = _ptr;
+    if (('=' == *_ptr) || ('{' == *_ptr) || ('}' == *_ptr)) {
+        ++_ptr;
+    } else {
+        while (_ptr < _end && !isspace(static_cast<unsigned char>(*_ptr)) && ('=' != *_ptr) && ('{' != *_ptr) && ('}' != *_ptr) &&
+               !(('/' == *_ptr) && (_ptr+1 < _end) && ('/' == _ptr[1]))) {
+            ++_ptr;
+        } // while
+    } // if/else
+    token->assign(begin, _ptr);
+    return true;
+} // next
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check that next token matches expected value.
+void
+pylith::meshio::_MeshIOAscii::Scanner::expect(const char* value) {
+    std::string token;
+    if (!next(&token) || (token != value)) {
+        std::ostringstream msg;
+        msg << "Expected '" << value << "' but encountered '" << token << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+} // expect
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get value of setting.
+std::string
+pylith::meshio::_MeshIOAscii::Scanner::getValue(void) {
+    expect("=");
+    std::string value;
+    if (!next(&value)) {
+        throw std::runtime_error("Unexpected end of file while reading value of setting.");
+    } // if
+    return value;
+} // getValue
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get integer value of setting.
+PylithInt
+pylith::meshio::_MeshIOAscii::Scanner::getInt(void) {
+    const std::string& token = getValue();
+    PylithInt value = 0;
+    if (!parseValue(token.c_str(), token.c_str() + token.length(), &value)) {
+        std::ostringstream msg;
+        msg << "Could not parse '" << token << "' into an integer.";
+        throw std::runtime_error(msg.str());
+    } // if
+    return value;
+} // getInt
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get remainder of line following '='.
+std::string
+pylith::meshio::_MeshIOAscii::Scanner::getLine(void) {
+    expect("=");
+    while (_ptr < _end && isspace(static_cast<unsigned char>(*_ptr)) && ('\n' != *_ptr)) {
+        ++_ptr;
+    } // while
+    const char* begin = _ptr;
+    while (_ptr < _end && ('\n' != *_ptr) && !(('/' == *_ptr) && (_ptr+1 < _end) && ('/' == _ptr[1]))) {
+        ++_ptr;
+    } // while
+    const char* end = _ptr;
+    while (end > begin && isspace(static_cast<unsigned char>(end[-1]))) {
+        --end;
+    } // while
+    return std::string(begin, end);
+} // getLine
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get contents of block and advance past the closing brace.
+void
+pylith::meshio::_MeshIOAscii::Scanner::getBlock(const char** begin,
+                                                const char** end) {
+    assert(begin);
+    assert(end);
+
+    expect("=");
+    expect("{");
+    *begin = _ptr;
+    while (_ptr < _end && ('}' != *_ptr)) {
+        if (('/' == *_ptr) && (_ptr+1 < _end) && ('/' == _ptr[1])) {
+            const char* eol = static_cast<const char*>(memchr(_ptr, '\n', _end-_ptr));
+            _ptr = eol ? eol : _end;
+        } else {
+            ++_ptr;
+        } // if/else
+    } // while
+    if (_ptr >= _end) {
+        throw std::runtime_error("Unexpected end of file while searching for closing brace of block.");
+    } // if
+    *end = _ptr++;
+} // getBlock
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get next token in block.
+const char*
+pylith::meshio::_MeshIOAscii::nextToken(const char* ptr,
+                                        const char* end,
+                                        const char** tokenEnd) {
+    assert(tokenEnd);
+
+    while (ptr < end) {
+        if (isspace(static_cast<unsigned char>(*ptr))) {
+            ++ptr;
+        } else if (('/' == *ptr) && (ptr+1 < end) && ('/' == ptr[1])) {
+            const char* eol = static_cast<const char*>(memchr(ptr, '\n', end-ptr));
+            ptr = eol ? eol : end;
+        } else {
+            break;
+        } // if/else
+    } // while
+
+    const char* tokenBegin = ptr;
+    while (ptr < end && !isspace(static_cast<unsigned char>(*ptr)) && !(('/' == *ptr) && (ptr+1 < end) && ('/' == ptr[1]))) {
+        ++ptr;
+    } // while
+    *tokenEnd = ptr;
+
+    return tokenBegin;
+} // nextToken
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Parse token into a floating point value.
+bool
+pylith::meshio::_MeshIOAscii::parseValue(const char* begin,
+                                         const char* end,
+                                         PylithScalar* value) {
+    assert(value);
+
+    // Tokens are terminated by whitespace, a comment, or the closing brace of the block, so strtod()
+    // stops at the end of the token. strtod() gives the same correctly rounded values as operator>>.
+    char* parseEnd = NULL;
+    *value = strtod(begin, &parseEnd);
+    return (begin < end) && (parseEnd == end);
+} // parseValue
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Parse token into an integer value.
+bool
+pylith::meshio::_MeshIOAscii::parseValue(const char* begin,
+                                         const char* end,
+                                         PylithInt* value) {
+    return MeshIOAscii::_parseInt(begin, end, value);
+} // parseValue
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Parse rows of values in block using multiple threads.
+template<typename T>
+void
+pylith::meshio::_MeshIOAscii::parseBlock(T* values,
+                                         const size_t numRows,
+                                         const size_t numColumns,
+                                         const size_t numLabels,
+                                         const char* begin,
+                                         const char* end,
+                                         const size_t numThreads,
+                                         const char* blockName) {
+    assert(values || !numRows);
+    assert(numThreads > 0);
+
+    // Split block into chunks that begin at the start of a line, so that comments are always
+    // detected within a chunk. Small blocks are parsed by a single thread.
+    const size_t minChunkSize = 64*1024;
+    const size_t numBytes = end - begin;
+    const size_t numChunks = std::min(numThreads, 1 + numBytes / minChunkSize);
+    std::vector<const char*> chunkBounds(numChunks+1);
+    chunkBounds[0] = begin;
+    chunkBounds[numChunks] = end;
+    for (size_t iChunk = 1; iChunk < numChunks; ++iChunk) {
+        const char* ptr = std::max(begin + iChunk * numBytes / numChunks, chunkBounds[iChunk-1]);
+        const char* eol = static_cast<const char*>(memchr(ptr, '\n', end-ptr));
+        chunkBounds[iChunk] = eol ? eol+1 : end;
+    } // for
+
+    std::vector<size_t> chunkOffsets(numChunks+1, 0);
+    std::vector<std::string> chunkErrors(numChunks);
+    const size_t rowSize = numLabels + numColumns;
+
+    // Pass 1: Count tokens in each chunk.
+    auto countTokens = [&](const size_t iChunk) {
+                           const char* tokenEnd = NULL;
+                           size_t count = 0;
+                           for (const char* ptr = nextToken(chunkBounds[iChunk], chunkBounds[iChunk+1], &tokenEnd);
+                                ptr < tokenEnd;
+                                ptr = nextToken(tokenEnd, chunkBounds[iChunk+1], &tokenEnd)) {
+                               ++count;
+                           } // for
+                           chunkOffsets[iChunk+1] = count;
+                       };
+
+    // Pass 2: Parse tokens in each chunk directly into the output array.
+    auto parseTokens = [&](const size_t iChunk) {
+                           const char* tokenEnd = NULL;
+                           size_t iToken = chunkOffsets[iChunk];
+                           for (const char* ptr = nextToken(chunkBounds[iChunk], chunkBounds[iChunk+1], &tokenEnd);
+                                ptr < tokenEnd;
+                                ptr = nextToken(tokenEnd, chunkBounds[iChunk+1], &tokenEnd), ++iToken) {
+                               const size_t iRow = iToken / rowSize;
+                               const size_t iColumn = iToken % rowSize;
+                               if (iColumn < numLabels) {
+                                   continue;
+                               } // if
+                               if (!parseValue(ptr, tokenEnd, &values[iRow*numColumns + iColumn-numLabels])) {
+                                   std::ostringstream msg;
+                                   msg << "Could not parse '" << std::string(ptr, tokenEnd) << "' in '" << blockName << "'.";
+                                   chunkErrors[iChunk] = msg.str();
+                                   return;
+                               } // if
+                           } // for
+                       };
+
+    auto runChunks = [&](const std::function<void(const size_t)>& task) {
+                         std::vector<std::thread> threads;
+                         threads.reserve(numChunks-1);
+                         for (size_t iChunk = 1; iChunk < numChunks; ++iChunk) {
+                             threads.push_back(std::thread(task, iChunk));
+                         } // for
+                         task(0);
+                         for (size_t i = 0; i < threads.size(); ++i) {
+                             threads[i].join();
+                         } // for
+                     };
+
+    runChunks(countTokens);
+    for (size_t iChunk = 0; iChunk < numChunks; ++iChunk) {
+        chunkOffsets[iChunk+1] += chunkOffsets[iChunk];
+    } // for
+    if (chunkOffsets[numChunks] != numRows*rowSize) {
+        std::ostringstream msg;
+        msg << "Expected " << numRows*rowSize << " values in '" << blockName << "' but found "
+            << chunkOffsets[numChunks] << ".";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    runChunks(parseTokens);
+    for (size_t iChunk = 0; iChunk < numChunks; ++iChunk) {
+        if (!chunkErrors[iChunk].empty()) {
+            throw std::runtime_error(chunkErrors[iChunk]);
+        } // if
+    } // for
+} // parseBlock
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read vertices section.
+void
+pylith::meshio::_MeshIOAscii::readVertices(Scanner& scanner,
+                                           scalar_array* coordinates,
+                                           PylithInt* numVertices,
+                                           int* spaceDim,
+                                           const size_t numThreads) {
+    assert(coordinates);
+    assert(numVertices);
+    assert(spaceDim);
+
+    scanner.expect("=");
+    scanner.expect("{");
+    std::string token;
+    while (scanner.next(&token) && token != "}") {
+        if (0 == strcasecmp(token.c_str(), "dimension")) {
+            *spaceDim = scanner.getInt();
+        } else if (0 == strcasecmp(token.c_str(), "count")) {
+            *numVertices = scanner.getInt();
+        } else if (0 == strcasecmp(token.c_str(), "coordinates")) {
+            const PylithInt size = (*numVertices) * (*spaceDim);
+            if (0 == size) {
+                const char* msg =
+                    "Tokens 'dimension' and 'count' must precede 'coordinates'.";
+                throw std::runtime_error(msg);
+            } // if
+            coordinates->resize(size);
+            const char* blockBegin = NULL;
+            const char* blockEnd = NULL;
+            scanner.getBlock(&blockBegin, &blockEnd);
+            parseBlock(&(*coordinates)[0], *numVertices, *spaceDim, 1, blockBegin, blockEnd, numThreads, "coordinates");
+        } else {
+            std::ostringstream msg;
+            msg << "Could not parse '" << token << "' into a vertices setting.";
+            throw std::runtime_error(msg.str());
+        } // else
+    } // while
+    if (token != "}") {
+        throw std::runtime_error("I/O error while parsing vertices.");
+    }
+} // readVertices
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read cells section.
+void
+pylith::meshio::_MeshIOAscii::readCells(Scanner& scanner,
+                                        int_array* cells,
+                                        int_array* materialIds,
+                                        PylithInt* numCells,
+                                        PylithInt* numCorners,
+                                        const bool useIndexZero,
+                                        const size_t numThreads) {
+    assert(cells);
+    assert(materialIds);
+    assert(numCells);
+    assert(numCorners);
+
+    scanner.expect("=");
+    scanner.expect("{");
+    std::string token;
+    while (scanner.next(&token) && token != "}") {
+        if (0 == strcasecmp(token.c_str(), "num-corners")) {
+            *numCorners = scanner.getInt();
+        } else if (0 == strcasecmp(token.c_str(), "count")) {
+            *numCells = scanner.getInt();
+        } else if (0 == strcasecmp(token.c_str(), "simplices")) {
+            const PylithInt size = (*numCells) * (*numCorners);
+            if (0 == size) {
+                const char* msg =
+                    "Tokens 'num-corners' and 'count' must precede 'cells'.";
+                throw std::runtime_error(msg);
+            } // if
+            cells->resize(size);
+            const char* blockBegin = NULL;
+            const char* blockEnd = NULL;
+            scanner.getBlock(&blockBegin, &blockEnd);
+            parseBlock(&(*cells)[0], *numCells, *numCorners, 1, blockBegin, blockEnd, numThreads, "simplices");
+            if (!useIndexZero) {
+                // if files begins with index 1, then decrement to index 0
+                // for compatibility with PETSc
+                *cells -= 1;
+            } // if
+        } else if (0 == strcasecmp(token.c_str(), "material-ids")) {
+            if (0 == *numCells) {
+                const char* msg =
+                    "Token 'count' must precede 'material-ids'.";
+                throw std::runtime_error(msg);
+            } // if
+            materialIds->resize(*numCells);
+            const char* blockBegin = NULL;
+            const char* blockEnd = NULL;
+            scanner.getBlock(&blockBegin, &blockEnd);
+            parseBlock(&(*materialIds)[0], *numCells, 1, 1, blockBegin, blockEnd, numThreads, "material-ids");
+
+            // Zero index does NOT apply to materialIds.
+        } else {
+            std::ostringstream msg;
+            msg << "Could not parse '" << token << "' into an cells setting.";
+            throw std::runtime_error(msg.str());
+        } // else
+    } // while
+    if (token != "}") {
+        throw std::runtime_error("I/O error while parsing cells.");
+    }
+
+    // If no materials given, assign each cell material identifier of 0
+    if ((0 == materialIds->size()) && (*numCells > 0)) {
+        materialIds->resize(*numCells);
+        (*materialIds) = 0;
+    } // if
+} // readCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read group section.
+void
+pylith::meshio::_MeshIOAscii::readGroup(Scanner& scanner,
+                                        int_array* points,
+                                        pylith::meshio::MeshBuilder::GroupPtType* type,
+                                        std::string* name,
+                                        const bool useIndexZero,
+                                        const size_t numThreads) {
+    assert(points);
+    assert(type);
+    assert(name);
+
+    scanner.expect("=");
+    scanner.expect("{");
+    PylithInt numPoints = -1;
+    std::string token;
+    while (scanner.next(&token) && token != "}") {
+        if (0 == strcasecmp(token.c_str(), "name")) {
+            *name = scanner.getLine();
+        } else if (0 == strcasecmp(token.c_str(), "type")) {
+            const std::string& typeName = scanner.getValue();
+            if (typeName == groupTypeNames[pylith::meshio::MeshBuilder::VERTEX]) {
+                *type = pylith::meshio::MeshBuilder::VERTEX;
+            } else if (typeName == groupTypeNames[pylith::meshio::MeshBuilder::CELL]) {
+                *type = pylith::meshio::MeshBuilder::CELL;
+            } else {
+                std::ostringstream msg;
+                msg << "Invalid point type " << typeName << ".";
+                throw std::runtime_error(msg.str());
+            } // else
+        } else if (0 == strcasecmp(token.c_str(), "count")) {
+            numPoints = scanner.getInt();
+        } else if (0 == strcasecmp(token.c_str(), "indices")) {
+            if (-1 == numPoints) {
+                std::ostringstream msg;
+                msg << "Tokens 'count' must precede 'indices'.";
+                throw std::runtime_error(msg.str());
+            } // if
+            points->resize(numPoints);
+            const char* blockBegin = NULL;
+            const char* blockEnd = NULL;
+            scanner.getBlock(&blockBegin, &blockEnd);
+            parseBlock(numPoints > 0 ? &(*points)[0] : NULL, numPoints, 1, 0, blockBegin, blockEnd, numThreads, "indices");
+        } else {
+            std::ostringstream msg;
+            msg << "Could not parse '" << token << "' into a group setting.";
+            throw std::runtime_error(msg.str());
+        } // else
+    } // while
+    if (token != "}") {
+        std::ostringstream msg;
+        msg << "I/O error while parsing group '" << *name << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    if (!useIndexZero) {
+        *points -= 1;
+    }
+} // readGroup
+
+
 // End of file
@@ -18,6 +18,7 @@
 
 class pylith::meshio::MeshIOAscii : public MeshIO {
     friend class TestMeshIOAscii; // unit testing
+    friend class _MeshIOAscii; // helpers for fast reader
 
     // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -43,6 +44,22 @@ public:
      */
     const char* getFilename(void) const;
 
+    /** Set flag on whether to use the fast reader.
+     *
+     * The fast reader maps the file into memory and parses the blocks of coordinates, cells,
+     * material identifiers, and group indices using multiple threads. The resulting mesh is
+     * identical to the one from the default reader.
+     *
+     * @param flag True to use the fast reader, false to use the default reader.
+     */
+    void setUseFastRead(const bool flag);
+
+    /** Set number of threads used by the fast reader.
+     *
+     * @param value Number of threads (0 means use the number of hardware threads).
+     */
+    void setNumReadThreads(const int value);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -64,7 +81,7 @@ private:
      */
     void _readVertices(spatialdata::utils::LineParser& parser,
                        scalar_array* coordinates,
-                       int* numVertices,
+                       PylithInt* numVertices,
                        int* spaceDim) const;
 
     /** Write mesh vertices.
@@ -84,8 +101,8 @@ private:
     void _readCells(spatialdata::utils::LineParser& parser,
                     int_array* pCells,
                     int_array* pMaterialIds,
-                    int* numCells,
-                    int* numCorners) const;
+                    PylithInt* numCells,
+                    PylithInt* numCorners) const;
 
     /** Write mesh cells.
      *
@@ -114,11 +131,28 @@ private:
     void _writeGroup(std::ostream& fileout,
                      const char* name) const;
 
+    /// Read mesh using memory-mapped file and multithreaded parsing of numeric blocks.
+    void _readFast(void);
+
+    /** Parse token into an integer.
+     *
+     * @param[in] begin Beginning of token.
+     * @param[in] end End of token.
+     * @param[out] value Parsed value.
+     * @returns True if entire token was parsed and the value fits in a PylithInt, false otherwise.
+     */
+    static
+    bool _parseInt(const char* begin,
+                   const char* end,
+                   PylithInt* value);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
     std::string _filename; ///< Name of file
+    int _numReadThreads; ///< Number of threads used by fast reader (0 means number of hardware threads).
     bool _useIndexZero; ///< Flag indicating if indicates start at 0 (T) or 1 (F)
+    bool _useFastRead; ///< Flag indicating if fast reader is used.
 
 }; // MeshIOAscii
 
@@ -25,12 +25,14 @@
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 #include <typeinfo> // USES std::typeid
+#include <algorithm> // USES std::min(), std::max()
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::MeshIOCubit::MeshIOCubit(void) :
     _filename(""),
-    _useNodesetNames(true) { // constructor
+    _useNodesetNames(true),
+    _useParallelRead(false) { // constructor
     PyreComponent::setName("meshiocubit");
 } // constructor
 
@@ -63,12 +65,17 @@ pylith::meshio::MeshIOCubit::_read(void) {
 
     assert(_mesh);
 
+    if (_useParallelRead) {
+        _readParallel();
+        PYLITH_METHOD_END;
+    } // if
+
     const int commRank = _mesh->getCommRank();
     int meshDim = 0;
     int spaceDim = 0;
-    int numVertices = 0;
-    int numCells = 0;
-    int numCorners = 0;
+    PylithInt numVertices = 0;
+    PylithInt numCells = 0;
+    PylithInt numCorners = 0;
     scalar_array coordinates;
     int_array cells;
     int_array materialIds;
@@ -129,7 +136,7 @@ pylith::meshio::MeshIOCubit::_write(void) const {
 void
 pylith::meshio::MeshIOCubit::_readVertices(ExodusII& exofile,
                                            scalar_array* coordinates,
-                                           int* numVertices,
+                                           PylithInt* numVertices,
                                            int* numDims) const {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("_readVertices(exofile="<<typeid(exofile).name()<<", coordinates="<<coordinates<<", numVertices="<<numVertices<<", numDims="<<numDims<<")");
@@ -148,14 +155,14 @@ pylith::meshio::MeshIOCubit::_readVertices(ExodusII& exofile,
 
     if (exofile.hasVar("coord", NULL)) {
         const int ndims = 2;
-        int dims[2];
+        PylithInt dims[2];
         dims[0] = *numDims;
         dims[1] = *numVertices;
         scalar_array buffer(*numVertices * *numDims);
         exofile.getVar(&buffer[0], dims, ndims, "coord");
 
         coordinates->resize(*numVertices * *numDims);
-        for (int iVertex = 0; iVertex < *numVertices; ++iVertex) {
+        for (PylithInt iVertex = 0; iVertex < *numVertices; ++iVertex) {
             for (int iDim = 0; iDim < *numDims; ++iDim) {
                 (*coordinates)[iVertex*(*numDims)+iDim] =
                     buffer[iDim*(*numVertices)+iVertex];
@@ -169,13 +176,13 @@ pylith::meshio::MeshIOCubit::_readVertices(ExodusII& exofile,
         scalar_array buffer(*numVertices);
 
         const int ndims = 1;
-        int dims[1];
+        PylithInt dims[1];
         dims[0] = *numVertices;
 
         for (int i = 0; i < *numDims; ++i) {
             exofile.getVar(&buffer[0], dims, ndims, coordNames[i]);
 
-            for (int iVertex = 0; iVertex < *numVertices; ++iVertex) {
+            for (PylithInt iVertex = 0; iVertex < *numVertices; ++iVertex) {
                 (*coordinates)[iVertex*(*numDims)+i] = buffer[iVertex];
             }
         } // for
@@ -191,8 +198,8 @@ void
 pylith::meshio::MeshIOCubit::_readCells(ExodusII& exofile,
                                         int_array* cells,
                                         int_array* materialIds,
-                                        int* numCells,
-                                        int* numCorners) const {
+                                        PylithInt* numCells,
+                                        PylithInt* numCorners) const {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("_readCells(exofile="<<typeid(exofile).name()<<", cells="<<cells<<", materialIds="<<materialIds<<", numCells="<<numCells<<", numCorners="<<numCorners<<")");
 
@@ -202,25 +209,25 @@ pylith::meshio::MeshIOCubit::_readCells(ExodusII& exofile,
     assert(numCorners);
 
     *numCells = exofile.getDim("num_elem");
-    const int numMaterials = exofile.getDim("num_el_blk");
+    const PylithInt numMaterials = exofile.getDim("num_el_blk");
 
     PYLITH_COMPONENT_INFO_ROOT("Reading " << *numCells << " cells in " << numMaterials << " blocks.");
 
     int_array blockIds(numMaterials);
     int ndims = 1;
-    int dims[2];
+    PylithInt dims[2];
     dims[0] = numMaterials;
     dims[1] = 0;
     exofile.getVar(&blockIds[0], dims, ndims, "eb_prop1");
 
     materialIds->resize(*numCells);
     *numCorners = 0;
-    for (int iMaterial = 0, index = 0; iMaterial < numMaterials; ++iMaterial) {
+    for (PylithInt iMaterial = 0, index = 0; iMaterial < numMaterials; ++iMaterial) {
         std::ostringstream varname;
         varname << "num_nod_per_el" << iMaterial+1;
         if (0 == *numCorners) {
             *numCorners = exofile.getDim(varname.str().c_str());
-            const int size = (*numCells) * (*numCorners);
+            const PylithInt size = (*numCells) * (*numCorners);
             cells->resize(size);
         } else if (exofile.getDim(varname.str().c_str()) != *numCorners) {
             std::ostringstream msg;
@@ -234,7 +241,7 @@ pylith::meshio::MeshIOCubit::_readCells(ExodusII& exofile,
 
         varname.str("");
         varname << "num_el_in_blk" << iMaterial+1;
-        const int blockSize = exofile.getDim(varname.str().c_str());
+        const PylithInt blockSize = exofile.getDim(varname.str().c_str());
 
         varname.str("");
         varname << "connect" << iMaterial+1;
@@ -244,7 +251,7 @@ pylith::meshio::MeshIOCubit::_readCells(ExodusII& exofile,
         exofile.getVar(&(*cells)[index* (*numCorners)], dims, ndims,
                        varname.str().c_str());
 
-        for (int i = 0; i < blockSize; ++i) {
+        for (PylithInt i = 0; i < blockSize; ++i) {
             (*materialIds)[index+i] = blockIds[iMaterial];
         }
 
@@ -264,13 +271,13 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("_readGroups(exofile="<<typeid(exofile).name()<<")");
 
-    const int numGroups = exofile.getDim("num_node_sets");
+    const PylithInt numGroups = exofile.getDim("num_node_sets");
 
     PYLITH_COMPONENT_INFO_ROOT("Found " << numGroups << " node sets.");
 
     int_array ids(numGroups);
     int ndims = 1;
-    int dims[2];
+    PylithInt dims[2];
     dims[0] = numGroups;
     dims[1] = 0;
     exofile.getVar(&ids[0], dims, ndims, "ns_prop1");
@@ -281,7 +288,7 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
         exofile.getVar(&groupNames, numGroups, "ns_names");
     } // if
 
-    for (int iGroup = 0; iGroup < numGroups; ++iGroup) {
+    for (PylithInt iGroup = 0; iGroup < numGroups; ++iGroup) {
         std::ostringstream varname;
         varname << "num_nod_ns" << iGroup+1;
         const size_t nodesetSize = exofile.getDim(varname.str().c_str());
@@ -312,6 +319,258 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile) {
 } // _readGroups
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh with each process reading a block of the mesh.
+void
+pylith::meshio::MeshIOCubit::_readParallel(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readParallel()");
+
+    assert(_mesh);
+
+    int meshDim = 0;
+    int spaceDim = 0;
+    PylithInt numVertices = 0;
+    PylithInt numVerticesLocal = 0;
+    PylithInt numCellsLocal = 0;
+    PylithInt numCorners = 0;
+    scalar_array coordinates;
+    int_array cells;
+    int_array materialIds;
+    PetscSF vertexSF = NULL;
+    PetscErrorCode err = 0;
+
+    try {
+        ExodusII exofile(_filename.c_str());
+
+        meshDim = exofile.getDim("num_dim");
+
+        _readVerticesParallel(exofile, &coordinates, &numVerticesLocal, &numVertices, &spaceDim);
+        _readCellsParallel(exofile, &cells, &materialIds, &numCellsLocal, &numCorners);
+        _orientCells(&cells, numCellsLocal, numCorners, meshDim);
+        MeshBuilder::buildMeshParallel(_mesh, &vertexSF, &coordinates, numVerticesLocal, numVertices, spaceDim,
+                                       cells, numCellsLocal, numCorners, meshDim);
+        _setMaterials(materialIds);
+        _readGroupsParallel(exofile, vertexSF);
+        err = PetscSFDestroy(&vertexSF);PYLITH_CHECK_ERROR(err);
+    } catch (std::exception& err) {
+        PetscSFDestroy(&vertexSF);
+        std::ostringstream msg;
+        msg << "Error while reading Cubit Exodus file '" << _filename << "' in parallel.\n"
+            << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        PetscSFDestroy(&vertexSF);
+        std::ostringstream msg;
+        msg << "Unknown error while reading Cubit Exodus file '" << _filename << "' in parallel.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // _readParallel
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read block of mesh vertices.
+void
+pylith::meshio::MeshIOCubit::_readVerticesParallel(ExodusII& exofile,
+                                                   scalar_array* coordinates,
+                                                   PylithInt* numVerticesLocal,
+                                                   PylithInt* numVertices,
+                                                   int* numDims) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readVerticesParallel(exofile="<<typeid(exofile).name()<<", coordinates="<<coordinates<<", numVerticesLocal="<<numVerticesLocal<<", numVertices="<<numVertices<<", numDims="<<numDims<<")");
+
+    assert(coordinates);
+    assert(numVerticesLocal);
+    assert(numVertices);
+    assert(numDims);
+
+    *numDims = exofile.getDim("num_dim");
+    *numVertices = exofile.getDim("num_nodes");
+
+    PYLITH_COMPONENT_INFO_ROOT("Reading " << *numVertices << " vertices in parallel.");
+
+    size_t vStart = 0;
+    size_t vCount = 0;
+    _getBlock(&vStart, &vCount, *numVertices);
+    *numVerticesLocal = vCount;
+
+    coordinates->resize(vCount * *numDims);
+    if (vCount > 0) {
+        scalar_array buffer(vCount);
+        const bool hasCoord = exofile.hasVar("coord", NULL);
+        const char* coordNames[3] = { "coordx", "coordy", "coordz" };
+        for (int iDim = 0; iDim < *numDims; ++iDim) {
+            if (hasCoord) {
+                const size_t start[2] = { size_t(iDim), vStart };
+                const size_t count[2] = { 1, vCount };
+                exofile.getVar(&buffer[0], start, count, 2, "coord");
+            } else {
+                exofile.getVar(&buffer[0], &vStart, &vCount, 1, coordNames[iDim]);
+            } // if/else
+
+            for (size_t iVertex = 0; iVertex < vCount; ++iVertex) {
+                (*coordinates)[iVertex*(*numDims)+iDim] = buffer[iVertex];
+            } // for
+        } // for
+    } // if
+
+    PYLITH_METHOD_END;
+} // _readVerticesParallel
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read block of mesh cells.
+void
+pylith::meshio::MeshIOCubit::_readCellsParallel(ExodusII& exofile,
+                                                int_array* cells,
+                                                int_array* materialIds,
+                                                PylithInt* numCellsLocal,
+                                                PylithInt* numCorners) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readCellsParallel(exofile="<<typeid(exofile).name()<<", cells="<<cells<<", materialIds="<<materialIds<<", numCellsLocal="<<numCellsLocal<<", numCorners="<<numCorners<<")");
+
+    assert(cells);
+    assert(materialIds);
+    assert(numCellsLocal);
+    assert(numCorners);
+
+    const PylithInt numCells = exofile.getDim("num_elem");
+    const PylithInt numMaterials = exofile.getDim("num_el_blk");
+
+    PYLITH_COMPONENT_INFO_ROOT("Reading " << numCells << " cells in " << numMaterials << " blocks in parallel.");
+
+    int_array blockIds(numMaterials);
+    PylithInt dims[1];
+    dims[0] = numMaterials;
+    exofile.getVar(&blockIds[0], dims, 1, "eb_prop1");
+
+    size_t cStart = 0;
+    size_t cCount = 0;
+    _getBlock(&cStart, &cCount, numCells);
+    *numCellsLocal = cCount;
+
+    // Cells in the block on this process may span several Exodus element blocks.
+    materialIds->resize(cCount);
+    *numCorners = 0;
+    size_t blockStart = 0;
+    for (PylithInt iMaterial = 0; iMaterial < numMaterials; ++iMaterial) {
+        std::ostringstream varname;
+        varname << "num_nod_per_el" << iMaterial+1;
+        if (0 == *numCorners) {
+            *numCorners = exofile.getDim(varname.str().c_str());
+            cells->resize(cCount * (*numCorners));
+        } else if (exofile.getDim(varname.str().c_str()) != *numCorners) {
+            std::ostringstream msg;
+            msg << "All materials must have the same number of vertices per cell.\n"
+                << "Expected " << *numCorners << " vertices per cell, but block "
+                << blockIds[iMaterial] << " has "
+                << exofile.getDim(varname.str().c_str())
+                << " vertices.";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        varname.str("");
+        varname << "num_el_in_blk" << iMaterial+1;
+        const size_t blockSize = exofile.getDim(varname.str().c_str());
+
+        const size_t lo = std::max(cStart, blockStart);
+        const size_t hi = std::min(cStart + cCount, blockStart + blockSize);
+        if (hi > lo) {
+            varname.str("");
+            varname << "connect" << iMaterial+1;
+            const size_t start[2] = { lo - blockStart, 0 };
+            const size_t count[2] = { hi - lo, size_t(*numCorners) };
+            exofile.getVar(&(*cells)[(lo - cStart) * (*numCorners)], start, count, 2, varname.str().c_str());
+
+            for (size_t i = lo; i < hi; ++i) {
+                (*materialIds)[i - cStart] = blockIds[iMaterial];
+            } // for
+        } // if
+
+        blockStart += blockSize;
+    } // for
+
+    *cells -= 1; // use zero index
+
+    PYLITH_METHOD_END;
+} // _readCellsParallel
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read block of each point group.
+void
+pylith::meshio::MeshIOCubit::_readGroupsParallel(ExodusII& exofile,
+                                                 PetscSF vertexSF) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readGroupsParallel(exofile="<<typeid(exofile).name()<<", vertexSF="<<vertexSF<<")");
+
+    const PylithInt numGroups = exofile.getDim("num_node_sets");
+
+    PYLITH_COMPONENT_INFO_ROOT("Found " << numGroups << " node sets.");
+
+    int_array ids(numGroups);
+    PylithInt dims[1];
+    dims[0] = numGroups;
+    exofile.getVar(&ids[0], dims, 1, "ns_prop1");
+
+    string_vector groupNames(numGroups);
+    if (_useNodesetNames) {
+        exofile.getVar(&groupNames, numGroups, "ns_names");
+    } // if
+
+    for (PylithInt iGroup = 0; iGroup < numGroups; ++iGroup) {
+        std::ostringstream varname;
+        varname << "num_nod_ns" << iGroup+1;
+        const size_t nodesetSize = exofile.getDim(varname.str().c_str());
+
+        PYLITH_COMPONENT_INFO_ROOT("Reading node set '" << groupNames[iGroup] << "' with id " << ids[iGroup] << " containing " << nodesetSize << " nodes in parallel.");
+
+        size_t start = 0;
+        size_t count = 0;
+        _getBlock(&start, &count, nodesetSize);
+        int_array points(count);
+        if (count > 0) {
+            varname.str("");
+            varname << "node_ns" << iGroup+1;
+            exofile.getVar(&points[0], &start, &count, 1, varname.str().c_str());
+            points -= 1; // use zero index
+        } // if
+
+        if (_useNodesetNames) {
+            pylith::meshio::MeshBuilder::setGroupParallel(_mesh, groupNames[iGroup].c_str(), vertexSF, points);
+        } else {
+            std::ostringstream name;
+            name << ids[iGroup];
+            pylith::meshio::MeshBuilder::setGroupParallel(_mesh, name.str().c_str(), vertexSF, points);
+        } // if/else
+    } // for
+
+    PYLITH_METHOD_END;
+} // _readGroupsParallel
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get block of items read by this process.
+void
+pylith::meshio::MeshIOCubit::_getBlock(size_t* start,
+                                       size_t* count,
+                                       const size_t numItems) const {
+    assert(start);
+    assert(count);
+    assert(_mesh);
+
+    int commSize = 1;
+    const int commRank = _mesh->getCommRank();
+    MPI_Comm_size(_mesh->getComm(), &commSize);
+
+    *start = (numItems * commRank) / commSize;
+    const size_t end = (numItems * (commRank+1)) / commSize;
+    *count = end - *start;
+} // _getBlock
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write mesh dimensions.
 void
@@ -340,13 +599,13 @@ pylith::meshio::MeshIOCubit::_writeAttributes(ExodusII& exofile) const {
 // Reorder vertices in cells to match PyLith conventions.
 void
 pylith::meshio::MeshIOCubit::_orientCells(int_array* const cells,
-                                          const int numCells,
-                                          const int numCorners,
+                                          const PylithInt numCells,
+                                          const PylithInt numCorners,
                                           const int meshDim) {
     PYLITH_METHOD_BEGIN;
 
     assert(cells);
-    assert(cells->size() == size_t(numCells*numCorners));
+    assert(cells->size() == size_t(numCells)*size_t(numCorners));
 
     if ((2 == meshDim) && (4 == numCorners)) { // QUAD4
         // do nothing
@@ -363,9 +622,9 @@ pylith::meshio::MeshIOCubit::_orientCells(int_array* const cells,
         // bottom edge, right edge, left edge, corners
 
         // Permutation: 3, 4, 5, 0, 1, 2
-        int tmp = 0;
-        for (int iCell = 0; iCell < numCells; ++iCell) {
-            const int ii = iCell*numCorners;
+        PylithInt tmp = 0;
+        for (PylithInt iCell = 0; iCell < numCells; ++iCell) {
+            const PylithInt ii = iCell*numCorners;
             tmp = (*cells)[ii+0];
             (*cells)[ii+0] = (*cells)[ii+3];
             (*cells)[ii+3] = tmp;
@@ -391,23 +650,23 @@ pylith::meshio::MeshIOCubit::_orientCells(int_array* const cells,
         // bottom edges, top edges, middle edges
         // left/right, front/back, bottom/top
         // interior
-        int tmp = 0;
-        for (int iCell = 0; iCell < numCells; ++iCell) {
-            const int i12 = iCell*numCorners+12;
-            const int i13 = iCell*numCorners+13;
-            const int i14 = iCell*numCorners+14;
-            const int i15 = iCell*numCorners+15;
-            const int i16 = iCell*numCorners+16;
-            const int i17 = iCell*numCorners+17;
-            const int i18 = iCell*numCorners+18;
-            const int i19 = iCell*numCorners+19;
-            const int i20 = iCell*numCorners+20;
-            const int i21 = iCell*numCorners+21;
-            const int i22 = iCell*numCorners+22;
-            const int i23 = iCell*numCorners+23;
-            const int i24 = iCell*numCorners+24;
-            const int i25 = iCell*numCorners+25;
-            const int i26 = iCell*numCorners+26;
+        PylithInt tmp = 0;
+        for (PylithInt iCell = 0; iCell < numCells; ++iCell) {
+            const PylithInt i12 = iCell*numCorners+12;
+            const PylithInt i13 = iCell*numCorners+13;
+            const PylithInt i14 = iCell*numCorners+14;
+            const PylithInt i15 = iCell*numCorners+15;
+            const PylithInt i16 = iCell*numCorners+16;
+            const PylithInt i17 = iCell*numCorners+17;
+            const PylithInt i18 = iCell*numCorners+18;
+            const PylithInt i19 = iCell*numCorners+19;
+            const PylithInt i20 = iCell*numCorners+20;
+            const PylithInt i21 = iCell*numCorners+21;
+            const PylithInt i22 = iCell*numCorners+22;
+            const PylithInt i23 = iCell*numCorners+23;
+            const PylithInt i24 = iCell*numCorners+24;
+            const PylithInt i25 = iCell*numCorners+25;
+            const PylithInt i26 = iCell*numCorners+26;
 
             tmp = (*cells)[i12];
             (*cells)[i12] = (*cells)[i16];
@@ -11,6 +11,8 @@
 
 #include "pylith/meshio/MeshIO.hh" // ISA MeshIO
 
+#include "pylith/utils/petscfwd.h" // USES PetscSF
+
 #include <string> // HASA std::string
 
 class pylith::meshio::MeshIOCubit : public MeshIO {
@@ -46,6 +48,16 @@ public:
      */
     void setUseNodesetNames(const bool flag);
 
+    /** Set flag on whether to read the mesh in parallel.
+     *
+     * In a parallel read every process reads a contiguous block of the cells, vertices, and node
+     * sets, so no process holds the entire mesh. The resulting mesh is distributed by blocks of
+     * cells and is repartitioned by the mesh distributor.
+     *
+     * @param flag True to read mesh in parallel.
+     */
+    void setUseParallelRead(const bool flag);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -67,7 +79,7 @@ private:
      */
     void _readVertices(ExodusII& filein,
                        scalar_array* coordinates,
-                       int* numVertices,
+                       PylithInt* numVertices,
                        int* spaceDim) const;
 
     /** Read mesh cells.
@@ -81,8 +93,8 @@ private:
     void _readCells(ExodusII& filein,
                     int_array* pCells,
                     int_array* pMaterialIds,
-                    int* numCells,
-                    int* numCorners) const;
+                    PylithInt* numCells,
+                    PylithInt* numCorners) const;
 
     /** Read point groups.
      *
@@ -90,6 +102,55 @@ private:
      */
     void _readGroups(ExodusII& filein);
 
+    /// Read mesh with each process reading a block of the mesh.
+    void _readParallel(void);
+
+    /** Read block of mesh vertices.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param coordinates Pointer to array of vertex coordinates in block.
+     * @param numVerticesLocal Pointer to number of vertices in block.
+     * @param numVertices Pointer to total number of vertices.
+     * @param spaceDim Pointer to dimension of coordinates vector space.
+     */
+    void _readVerticesParallel(ExodusII& filein,
+                               scalar_array* coordinates,
+                               PylithInt* numVerticesLocal,
+                               PylithInt* numVertices,
+                               int* spaceDim) const;
+
+    /** Read block of mesh cells.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param pCells Pointer to array of global indices of cell vertices in block.
+     * @param pMaterialIds Pointer to array of material identifiers in block.
+     * @param pNumCellsLocal Pointer to number of cells in block.
+     * @param pNumCorners Pointer to number of corners
+     */
+    void _readCellsParallel(ExodusII& filein,
+                            int_array* pCells,
+                            int_array* pMaterialIds,
+                            PylithInt* numCellsLocal,
+                            PylithInt* numCorners) const;
+
+    /** Read block of each point group.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param vertexSF Star forest from blocks of vertices to local vertices.
+     */
+    void _readGroupsParallel(ExodusII& filein,
+                             PetscSF vertexSF);
+
+    /** Get block of items read by this process.
+     *
+     * @param[out] start Index of first item in block.
+     * @param[out] count Number of items in block.
+     * @param[in] numItems Total number of items.
+     */
+    void _getBlock(size_t* start,
+                   size_t* count,
+                   const size_t numItems) const;
+
     /** Write mesh dimensions.
      *
      * @param ncfile Cubit Exodus file.
@@ -117,8 +178,8 @@ private:
      */
     static
     void _orientCells(int_array* const cells,
-                      const int numCells,
-                      const int numCorners,
+                      const PylithInt numCells,
+                      const PylithInt numCorners,
                       const int meshDim);
 
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -126,6 +187,7 @@ private:
 
     std::string _filename; ///< Name of file
     bool _useNodesetNames; ///< True to use node set names instead of ids.
+    bool _useParallelRead; ///< True to read mesh in parallel.
 
 }; // MeshIOCubit
 
@@ -19,6 +19,7 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 
 #include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
@@ -69,7 +70,11 @@ pylith::meshio::OutputObserver::OutputObserver(void) :
     _timeScale(1.0),
     _writer(NULL),
     _trigger(NULL),
-    _outputBasisOrder(1) {
+    _outputBasisOrder(1),
+    _pendingWriteTime(0.0),
+    _pendingWriteIndex(-1),
+    _pendingWrite(false),
+    _hasPendingWrite(false) {
     _OutputObserver::Events::init();
 }
 
@@ -98,6 +103,7 @@ pylith::meshio::OutputObserver::deallocate(void) {
 
     _writer = NULL; // :TODO: Use shared pointer
     _trigger = NULL; // :TODO: Use shared pointer
+    _hasPendingWrite = false;
 
 } // deallocate
 
@@ -109,6 +115,7 @@ pylith::meshio::OutputObserver::setTrigger(pylith::meshio::OutputTrigger* const
     PYLITH_COMPONENT_DEBUG("OutputObserver::setTrigger(otrigger="<<typeid(trigger).name()<<")");
 
     _trigger = trigger;
+    _hasPendingWrite = false;
 } // setTrigger
 
 
@@ -176,6 +183,7 @@ pylith::meshio::OutputObserver::_getSubfield(const pylith::topology::Field& fiel
     _OutputObserver::Events::logger.eventBegin(_OutputObserver::Events::getSubfield);
 
     if (0 == _subfields.count(name) ) {
+        pylith::utils::MemoryRegistry::OwnerScope owner(getIdentifier());
         _subfields[name] = OutputSubfield::create(field, submesh, name, _outputBasisOrder);
     } // if
 
@@ -216,4 +224,66 @@ pylith::meshio::OutputObserver::_appendField(const PylithReal t,
 } // _appendField
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether output will be written at time t without consuming the trigger decision.
+bool
+pylith::meshio::OutputObserver::_willWrite(const PylithReal t,
+                                           const PylithInt tindex,
+                                           const pylith::topology::Field& solution) {
+    if (!_hasPendingWrite || (t != _pendingWriteTime) || (tindex != _pendingWriteIndex)) {
+        assert(_trigger);
+        _pendingWrite = _trigger->shouldWrite(t, tindex, solution);
+        _pendingWriteTime = t;
+        _pendingWriteIndex = tindex;
+        _hasPendingWrite = true;
+    } // if
+
+    return _pendingWrite;
+} // _willWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether to write output at time t, consuming the trigger decision.
+bool
+pylith::meshio::OutputObserver::_shouldWrite(const PylithReal t,
+                                             const PylithInt tindex,
+                                             const pylith::topology::Field& solution) {
+    const bool shouldWrite = _willWrite(t, tindex, solution);
+    _hasPendingWrite = false;
+
+    return shouldWrite;
+} // _shouldWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Discard output data that depends on the distribution of the mesh among processes.
+void
+pylith::meshio::OutputObserver::_resetDistribution(const bool useNewFiles) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputObserver::_resetDistribution(useNewFiles="<<useNewFiles<<")");
+
+    // The datasets in the current files use the layout of the previous distribution, so output for
+    // the redistributed mesh goes to new files.
+    if (_writer) {
+        _writer->close();
+        if (useNewFiles) {
+            _writer->setDistributionIndex(_writer->getDistributionIndex() + 1);
+        } // if
+    } // if
+
+    typedef std::map<std::string, OutputSubfield*> subfield_t;
+    for (subfield_t::iterator iter = _subfields.begin(); iter != _subfields.end(); ++iter) {
+        delete iter->second;iter->second = NULL;
+    } // for
+    _subfields.clear();
+
+    if (_trigger) {
+        _trigger->resetDistribution();
+    } // if
+    _hasPendingWrite = false;
+
+    PYLITH_METHOD_END;
+} // _resetDistribution
+
+
 // End of file
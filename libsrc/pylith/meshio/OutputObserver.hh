@@ -92,6 +92,40 @@ protected:
     void _appendField(const PylithReal t,
                       const pylith::meshio::OutputSubfield& subfield);
 
+    /** Check whether output will be written at time t without consuming the trigger decision.
+     *
+     * The trigger is evaluated once for a given time and time step; the decision is kept until
+     * it is consumed by _shouldWrite().
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if output will be written, false otherwise.
+     */
+    bool _willWrite(const PylithReal t,
+                    const PylithInt tindex,
+                    const pylith::topology::Field& solution);
+
+    /** Check whether to write output at time t, consuming the trigger decision.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if output should be written, false otherwise.
+     */
+    bool _shouldWrite(const PylithReal t,
+                      const PylithInt tindex,
+                      const pylith::topology::Field& solution);
+
+    /** Discard output data that depends on the distribution of the mesh among processes.
+     *
+     * Closes the writer, discards the subfields extracted for output, and resets the trigger.
+     *
+     * @param[in] useNewFiles True if output for the redistributed mesh goes to new files, false
+     *   if nothing has been written for the previous distribution of the mesh.
+     */
+    void _resetDistribution(const bool useNewFiles=true);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -101,6 +135,14 @@ protected:
     OutputTrigger* _trigger; ///< Trigger for deciding how often to write output.
     int _outputBasisOrder; ///< Basis order for output.
 
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    PylithReal _pendingWriteTime; ///< Time of pending trigger decision.
+    PylithInt _pendingWriteIndex; ///< Time step of pending trigger decision.
+    bool _pendingWrite; ///< Pending trigger decision.
+    bool _hasPendingWrite; ///< True if trigger decision is pending.
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
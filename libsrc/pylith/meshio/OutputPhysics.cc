@@ -224,6 +224,24 @@ pylith::meshio::OutputPhysics::verifyConfiguration(const pylith::topology::Field
 } // verifyConfiguration
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer will write output at time t.
+bool
+pylith::meshio::OutputPhysics::willWrite(const PylithReal t,
+                                         const PylithInt tindex,
+                                         const pylith::topology::Field& solution) {
+    return _willWrite(t, tindex, solution);
+} // willWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Discard output data that depends on the distribution of the mesh among processes.
+void
+pylith::meshio::OutputPhysics::resetDistribution(PetscSF sfMigration) {
+    OutputObserver::_resetDistribution();
+} // resetDistribution
+
+
 // ------------------------------------------------------------------------------------------------
 // Get update from integrator (subject of observer).
 void
@@ -240,8 +258,7 @@ pylith::meshio::OutputPhysics::update(const PylithReal t,
         break;
     }
     case SOLUTION: {
-        assert(_trigger);
-        if (_trigger->shouldWrite(t, tindex)) {
+        if (_shouldWrite(t, tindex, solution)) {
             _writeDataStep(t, tindex, solution);
         } // if
         break;
@@ -398,37 +415,11 @@ pylith::meshio::OutputPhysics::_writeDataStep(const PylithReal t,
     _openDataStep(t, domainMesh);
 
     if (auxiliaryField) { auxiliaryField->scatterLocalToOutput(); }
-    PetscVec auxiliaryVector = (auxiliaryField) ? auxiliaryField->getOutputVector() : NULL;
-
     if (derivedField) { derivedField->scatterLocalToOutput(); }
-    PetscVec derivedVector = (derivedField) ? derivedField->getOutputVector() : NULL;
-
-    PetscVec solutionVector = solution.getOutputVector();assert(solutionVector);
-
-    const char* labelName = _physics->getPhysicsLabelName();
-    const int labelValue = _physics->getPhysicsLabelValue();
 
     const size_t numDataFields = dataNames.size();
     for (size_t i = 0; i < numDataFields; i++) {
-        OutputSubfield* subfield = NULL;
-        if (solution.hasSubfield(dataNames[i].c_str())) {
-            subfield = OutputObserver::_getSubfield(solution, domainMesh, dataNames[i].c_str());assert(subfield);
-            subfield->setLabel(labelName, labelValue);
-            subfield->projectWithLabel(solutionVector);
-        } else if (auxiliaryField && auxiliaryField->hasSubfield(dataNames[i].c_str())) {
-            subfield = OutputObserver::_getSubfield(*auxiliaryField, domainMesh, dataNames[i].c_str());assert(subfield);
-            subfield->project(auxiliaryVector);
-        } else if (derivedField && derivedField->hasSubfield(dataNames[i].c_str())) {
-            subfield = OutputObserver::_getSubfield(*derivedField, domainMesh, dataNames[i].c_str());assert(subfield);
-            subfield->setLabel(labelName, labelValue);
-            subfield->project(derivedVector);
-        } else {
-            std::ostringstream msg;
-            msg << "Internal Error: Could not find subfield '" << dataNames[i] << "' for data output.";
-            PYLITH_COMPONENT_ERROR(msg.str());
-            throw std::runtime_error(msg.str());
-        } // if/else
-
+        OutputSubfield* subfield = _projectDataSubfield(dataNames[i].c_str(), solution);assert(subfield);
         OutputObserver::_appendField(t, *subfield);
     } // for
     _closeDataStep();
@@ -438,6 +429,45 @@ pylith::meshio::OutputPhysics::_writeDataStep(const PylithReal t,
 } // _writeDataStep
 
 
+// ------------------------------------------------------------------------------------------------
+// Project data subfield for output at this solution step.
+pylith::meshio::OutputSubfield*
+pylith::meshio::OutputPhysics::_projectDataSubfield(const char* name,
+                                                    const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_physics);
+    const pylith::topology::Field* auxiliaryField = _physics->getAuxiliaryField();
+    const pylith::topology::Field* derivedField = _physics->getDerivedField();
+    const pylith::topology::Mesh& domainMesh = _physics->getPhysicsDomainMesh();
+
+    const char* labelName = _physics->getPhysicsLabelName();
+    const int labelValue = _physics->getPhysicsLabelValue();
+
+    OutputSubfield* subfield = NULL;
+    if (solution.hasSubfield(name)) {
+        PetscVec solutionVector = solution.getOutputVector();assert(solutionVector);
+        subfield = OutputObserver::_getSubfield(solution, domainMesh, name);assert(subfield);
+        subfield->setLabel(labelName, labelValue);
+        subfield->projectWithLabel(solutionVector);
+    } else if (auxiliaryField && auxiliaryField->hasSubfield(name)) {
+        subfield = OutputObserver::_getSubfield(*auxiliaryField, domainMesh, name);assert(subfield);
+        subfield->project(auxiliaryField->getOutputVector());
+    } else if (derivedField && derivedField->hasSubfield(name)) {
+        subfield = OutputObserver::_getSubfield(*derivedField, domainMesh, name);assert(subfield);
+        subfield->setLabel(labelName, labelValue);
+        subfield->project(derivedField->getOutputVector());
+    } else {
+        std::ostringstream msg;
+        msg << "Internal Error: Could not find subfield '" << name << "' for data output.";
+        PYLITH_COMPONENT_ERROR(msg.str());
+        throw std::runtime_error(msg.str());
+    } // if/else
+
+    PYLITH_METHOD_RETURN(subfield);
+} // _projectDataSubfield
+
+
 // ------------------------------------------------------------------------------------------------
 // Names of information fields for output.
 pylith::string_vector
@@ -81,6 +81,24 @@ public:
      */
     void verifyConfiguration(const pylith::topology::Field& solution) const override;
 
+    /** Check whether observer will write output at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if observer will write output at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex,
+                   const pylith::topology::Field& solution) override;
+
+    /** Discard output data that depends on the distribution of the mesh among processes.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void resetDistribution(PetscSF sfMigration) override;
+
     /** Receive update (subject of observer).
      *
      * @param[in] t Current time.
@@ -127,10 +145,22 @@ protected:
      * @param[in] tindex Current time step.
      * @param[in] solution Solution at time t.
      */
+    virtual
     void _writeDataStep(const PylithReal t,
                         const PylithInt tindex,
                         const pylith::topology::Field& solution);
 
+    /** Project data subfield for output at this solution step.
+     *
+     * The auxiliary and derived fields must already be scattered to their output vectors.
+     *
+     * @param[in] name Name of subfield.
+     * @param[in] solution Solution field.
+     * @returns Output subfield with values of subfield.
+     */
+    OutputSubfield* _projectDataSubfield(const char* name,
+                                         const pylith::topology::Field& solution);
+
     /** Names of information fields for output.
      *
      * Expand "all" into list of actual fields.
@@ -0,0 +1,212 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputPhysicsReductions.hh" // implementation of class methods
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/feassemble/PhysicsImplementation.hh" // USES PhysicsImplementation
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <algorithm> // USES std::find()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputPhysicsReductions::OutputPhysicsReductions(void) :
+    _mesh(NULL),
+    _tLast(0.0) {
+    PyreComponent::setName("outputphysicsreductions");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputPhysicsReductions::~OutputPhysicsReductions(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputPhysicsReductions::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputPhysics::deallocate();
+
+    _reductions.deallocate();
+    _reducedNames.clear();
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set names of reductions to compute.
+void
+pylith::meshio::OutputPhysicsReductions::setReductions(const char* names[],
+                                                       const int numNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsReductions::setReductions(names="<<names<<", numNames="<<numNames<<")");
+
+    try {
+        _reductions.setReductions(names, numNames);
+    } catch (const std::runtime_error& err) {
+        std::ostringstream msg;
+        msg << err.what() << " Error in physics observer '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // setReductions
+
+
+// ------------------------------------------------------------------------------------------------
+// Set threshold for computing time at which threshold is reached.
+void
+pylith::meshio::OutputPhysicsReductions::setThreshold(const PylithReal value) {
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsReductions::setThreshold(value="<<value<<")");
+
+    _reductions.setThreshold(value);
+} // setThreshold
+
+
+// ------------------------------------------------------------------------------------------------
+// Set name of subfield used for time at which threshold is reached.
+void
+pylith::meshio::OutputPhysicsReductions::setThresholdSubfield(const char* value) {
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsReductions::setThresholdSubfield(value="<<value<<")");
+
+    _reductions.setThresholdSubfield(value);
+} // setThresholdSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Migrate reductions to redistributed mesh.
+void
+pylith::meshio::OutputPhysicsReductions::resetDistribution(PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("resetDistribution(sfMigration="<<sfMigration<<")");
+
+    // Reduced fields are written once, at the end of the simulation, so they go to a single file
+    // with the layout of the final distribution of the mesh.
+    OutputObserver::_resetDistribution(false);
+    _reductions.migrate(sfMigration);
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // resetDistribution
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::meshio::OutputPhysicsReductions::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsReductions::verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    OutputPhysics::verifyConfiguration(solution);
+
+    if (_reductions.useThresholdTime()) {
+        assert(_physics);
+        const pylith::string_vector& dataNames = _expandDataFieldNames(solution, _physics->getAuxiliaryField(),
+                                                                       _physics->getDerivedField());
+        const std::string thresholdSubfield(_reductions.getThresholdSubfield());
+        if (std::find(dataNames.begin(), dataNames.end(), thresholdSubfield) == dataNames.end()) {
+            std::ostringstream msg;
+            msg << "Subfield '" << thresholdSubfield << "' for time at which threshold is reached (threshold_subfield) in physics observer '"
+                << PyreComponent::getIdentifier() << "' must be one of the data subfields included in output.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ------------------------------------------------------------------------------------------------
+// Write reduced fields to output.
+void
+pylith::meshio::OutputPhysicsReductions::writeReductions(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("writeReductions()");
+
+    if (!_reductions.getNumSamples()) {
+        PYLITH_METHOD_END;
+    } // if
+    if (!_mesh) {
+        // Mesh was repartitioned and no values have been reduced on the new distribution of the mesh.
+        PYLITH_COMPONENT_WARNING("Skipping output of reductions, because they were not updated after the mesh was repartitioned.");
+        PYLITH_METHOD_END;
+    } // if
+
+    _openDataStep(_tLast, *_mesh);
+    const size_t numReducedNames = _reducedNames.size();
+    for (size_t iName = 0; iName < numReducedNames; ++iName) {
+        const std::vector<OutputSubfield*>& reduced = _reductions.getReducedSubfields(_reducedNames[iName].c_str());
+        for (size_t i = 0; i < reduced.size(); ++i) {
+            OutputObserver::_appendField(_tLast, *reduced[i]);
+        } // for
+        if (_reductions.useFinal()) {
+            // Output subfield holds values from the last update.
+            assert(_subfields.count(_reducedNames[iName]));
+            OutputObserver::_appendField(_tLast, *_subfields[_reducedNames[iName]]);
+        } // if
+    } // for
+    _closeDataStep();
+
+    PYLITH_METHOD_END;
+} // writeReductions
+
+
+// ------------------------------------------------------------------------------------------------
+// Update reductions with subfields at time step.
+void
+pylith::meshio::OutputPhysicsReductions::_writeDataStep(const PylithReal t,
+                                                        const PylithInt tindex,
+                                                        const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputPhysicsReductions::_writeDataStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    assert(_physics);
+    const pylith::topology::Field* auxiliaryField = _physics->getAuxiliaryField();
+    const pylith::topology::Field* derivedField = _physics->getDerivedField();
+
+    _reducedNames = _expandDataFieldNames(solution, auxiliaryField, derivedField);
+
+    if (auxiliaryField) { auxiliaryField->scatterLocalToOutput(); }
+    if (derivedField) { derivedField->scatterLocalToOutput(); }
+
+    const PylithReal tDim = t * _timeScale;
+    const size_t numReducedNames = _reducedNames.size();
+    for (size_t i = 0; i < numReducedNames; i++) {
+        OutputSubfield* subfield = _projectDataSubfield(_reducedNames[i].c_str(), solution);assert(subfield);
+        _reductions.update(*subfield, tDim);
+    } // for
+    _reductions.finishStep();
+
+    _mesh = &_physics->getPhysicsDomainMesh();
+    _tLast = t;
+
+    PYLITH_METHOD_END;
+} // _writeDataStep
+
+
+// End of file
@@ -0,0 +1,108 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/meshio/meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputPhysics.hh" // ISA OutputPhysics
+
+#include "pylith/meshio/OutputReductions.hh" // HASA OutputReductions
+
+/** Observer that accumulates reductions over time of subfields over the domain of a physics
+ * object (material or boundary condition).
+ *
+ * Reductions of solution, auxiliary (for example, state variables), and derived subfields are
+ * updated in memory at every time step selected by the trigger. The reduced fields are written
+ * once, at the end of the simulation, when writeReductions() is called. Info output is written
+ * as in OutputPhysics.
+ *
+ * See OutputReductions for the supported reductions.
+ */
+class pylith::meshio::OutputPhysicsReductions : public pylith::meshio::OutputPhysics {
+    friend class TestOutputPhysicsReductions; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    OutputPhysicsReductions(void);
+
+    /// Destructor
+    virtual ~OutputPhysicsReductions(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void) override;
+
+    /** Set names of reductions to compute.
+     *
+     * @param[in] names Array of names of reductions.
+     * @param[in] numNames Length of array.
+     */
+    void setReductions(const char* names[],
+                       const int numNames);
+
+    /** Set threshold for computing time at which threshold is reached.
+     *
+     * @param[in] value Threshold (dimensioned) for absolute value of subfield components.
+     */
+    void setThreshold(const PylithReal value);
+
+    /** Set name of subfield used for time at which threshold is reached.
+     *
+     * @param[in] value Name of subfield.
+     */
+    void setThresholdSubfield(const char* value);
+
+    /** Migrate reductions to redistributed mesh.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void resetDistribution(PetscSF sfMigration) override;
+
+    /** Verify configuration.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const override;
+
+    /// Write reduced fields to output.
+    void writeReductions(void);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Update reductions with subfields at time step.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void _writeDataStep(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution) override;
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputReductions _reductions; ///< Reductions of subfields.
+    pylith::string_vector _reducedNames; ///< Names of subfields included in reductions.
+    const pylith::topology::Mesh* _mesh; ///< Mesh associated with physics.
+    PylithReal _tLast; ///< Time of last update.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputPhysicsReductions(const OutputPhysicsReductions&); ///< Not implemented.
+    const OutputPhysicsReductions& operator=(const OutputPhysicsReductions&); ///< Not implemented
+
+}; // OutputPhysicsReductions
+
+// End of file
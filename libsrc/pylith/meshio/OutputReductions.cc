@@ -0,0 +1,367 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputReductions.hh" // implementation of class methods
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <cmath> // USES fabs(), std::isnan()
+#include <limits> // USES std::numeric_limits
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputReductions::OutputReductions(void) :
+    _sfMigration(NULL),
+    _threshold(0.0),
+    _numSamples(0),
+    _usePeak(true),
+    _useRMS(false),
+    _useThresholdTime(false),
+    _useFinal(true) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputReductions::~OutputReductions(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputReductions::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    typedef std::map<std::string, Reductions> reductions_t;
+    for (reductions_t::iterator iter = _reductions.begin(); iter != _reductions.end(); ++iter) {
+        _deallocateReductions(&iter->second);
+    } // for
+    _reductions.clear();
+    for (reductions_t::iterator iter = _reductionsPrev.begin(); iter != _reductionsPrev.end(); ++iter) {
+        _deallocateReductions(&iter->second);
+    } // for
+    _reductionsPrev.clear();
+    PetscErrorCode err = PetscSFDestroy(&_sfMigration);PYLITH_CHECK_ERROR(err);
+    _numSamples = 0;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set names of reductions to compute.
+void
+pylith::meshio::OutputReductions::setReductions(const char* names[],
+                                                const int numNames) {
+    PYLITH_METHOD_BEGIN;
+
+    assert((names && numNames) || (!names && !numNames));
+
+    _usePeak = false;
+    _useRMS = false;
+    _useThresholdTime = false;
+    _useFinal = false;
+    for (int i = 0; i < numNames; ++i) {
+        assert(names[i]);
+        const std::string name(names[i]);
+        if (name == "peak") {
+            _usePeak = true;
+        } else if (name == "rms") {
+            _useRMS = true;
+        } else if (name == "threshold_time") {
+            _useThresholdTime = true;
+        } else if (name == "final") {
+            _useFinal = true;
+        } else {
+            std::ostringstream msg;
+            msg << "Unknown reduction '" << name << "'. Known reductions are 'peak', 'rms', 'threshold_time', and 'final'.";
+            throw std::runtime_error(msg.str());
+        } // if/else
+    } // for
+
+    PYLITH_METHOD_END;
+} // setReductions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set threshold for computing time at which threshold is reached.
+void
+pylith::meshio::OutputReductions::setThreshold(const PylithReal value) {
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Threshold (" << value << ") for time at which threshold is reached must be nonnegative.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _threshold = value;
+} // setThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of subfield used for time at which threshold is reached.
+void
+pylith::meshio::OutputReductions::setThresholdSubfield(const char* value) {
+    assert(value);
+    _thresholdSubfield = value;
+} // setThresholdSubfield
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of subfield used for time at which threshold is reached.
+const char*
+pylith::meshio::OutputReductions::getThresholdSubfield(void) const {
+    return _thresholdSubfield.c_str();
+} // getThresholdSubfield
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether time at which threshold is reached is computed.
+bool
+pylith::meshio::OutputReductions::useThresholdTime(void) const {
+    return _useThresholdTime;
+} // useThresholdTime
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether values at last time step are included in output.
+bool
+pylith::meshio::OutputReductions::useFinal(void) const {
+    return _useFinal;
+} // useFinal
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of time steps included in reductions.
+size_t
+pylith::meshio::OutputReductions::getNumSamples(void) const {
+    return _numSamples;
+} // getNumSamples
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update reductions with values of subfield.
+void
+pylith::meshio::OutputReductions::update(const OutputSubfield& subfield,
+                                         const PylithReal t) {
+    PYLITH_METHOD_BEGIN;
+
+    Reductions& reductions = _getReductions(subfield);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt numValues = 0;
+    const PetscScalar* valuesArray = NULL;
+    PetscScalar* peakArray = NULL;
+    PetscScalar* sumSquaresArray = NULL;
+    PetscScalar* thresholdTimeArray = NULL;
+    err = VecGetLocalSize(subfield.getVector(), &numValues);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(subfield.getVector(), &valuesArray);PYLITH_CHECK_ERROR(err);
+    if (reductions.peak) {
+        err = VecGetArray(reductions.peak->getVector(), &peakArray);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (reductions.sumSquares) {
+        err = VecGetArray(reductions.sumSquares, &sumSquaresArray);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (reductions.thresholdTime) {
+        err = VecGetArray(reductions.thresholdTime->getVector(), &thresholdTimeArray);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    for (PetscInt i = 0; i < numValues; ++i) {
+        const PylithReal valueAbs = fabs(valuesArray[i]);
+        if (peakArray && (valueAbs > peakArray[i])) {
+            peakArray[i] = valueAbs;
+        } // if
+        if (sumSquaresArray) {
+            sumSquaresArray[i] += valuesArray[i] * valuesArray[i];
+        } // if
+        if (thresholdTimeArray && std::isnan(thresholdTimeArray[i]) && (valueAbs >= _threshold)) {
+            thresholdTimeArray[i] = t;
+        } // if
+    } // for
+
+    if (thresholdTimeArray) {
+        err = VecRestoreArray(reductions.thresholdTime->getVector(), &thresholdTimeArray);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (sumSquaresArray) {
+        err = VecRestoreArray(reductions.sumSquares, &sumSquaresArray);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (peakArray) {
+        err = VecRestoreArray(reductions.peak->getVector(), &peakArray);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = VecRestoreArrayRead(subfield.getVector(), &valuesArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Finish updating reductions for the current time step.
+void
+pylith::meshio::OutputReductions::finishStep(void) {
+    ++_numSamples;
+} // finishStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get reduced subfields for output.
+std::vector<pylith::meshio::OutputSubfield*>
+pylith::meshio::OutputReductions::getReducedSubfields(const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    std::vector<OutputSubfield*> subfields;
+    if (!_reductions.count(name)) {
+        PYLITH_METHOD_RETURN(subfields);
+    } // if
+
+    Reductions& reductions = _reductions[name];
+    if (reductions.peak) {
+        subfields.push_back(reductions.peak);
+    } // if
+    if (reductions.rms) {
+        assert(reductions.sumSquares);
+        assert(_numSamples > 0);
+        PetscVec rmsVector = reductions.rms->getVector();
+        PetscErrorCode err = PETSC_SUCCESS;
+        err = VecCopy(reductions.sumSquares, rmsVector);PYLITH_CHECK_ERROR(err);
+        err = VecScale(rmsVector, 1.0 / PylithReal(_numSamples));PYLITH_CHECK_ERROR(err);
+        err = VecSqrtAbs(rmsVector);PYLITH_CHECK_ERROR(err);
+        subfields.push_back(reductions.rms);
+    } // if
+    if (reductions.thresholdTime) {
+        subfields.push_back(reductions.thresholdTime);
+    } // if
+
+    PYLITH_METHOD_RETURN(subfields);
+} // getReducedSubfields
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Migrate reductions to redistributed mesh.
+void
+pylith::meshio::OutputReductions::migrate(PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+    assert(sfMigration);
+
+    // Reductions still waiting for a previous migration were not updated since then and are discarded.
+    typedef std::map<std::string, Reductions> reductions_t;
+    for (reductions_t::iterator iter = _reductionsPrev.begin(); iter != _reductionsPrev.end(); ++iter) {
+        _deallocateReductions(&iter->second);
+    } // for
+    _reductionsPrev = _reductions;
+    _reductions.clear();
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = PetscObjectReference((PetscObject)sfMigration);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&_sfMigration);PYLITH_CHECK_ERROR(err);
+    _sfMigration = sfMigration;
+
+    PYLITH_METHOD_END;
+} // migrate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get reductions for subfield, creating if necessary.
+pylith::meshio::OutputReductions::Reductions&
+pylith::meshio::OutputReductions::_getReductions(const OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    const std::string& name = subfield.getDescription().label;
+    if (_reductions.count(name)) {
+        PYLITH_METHOD_RETURN(_reductions[name]);
+    } // if
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    Reductions& reductions = _reductions[name];
+    reductions.peak = NULL;
+    reductions.rms = NULL;
+    reductions.thresholdTime = NULL;
+    reductions.sumSquares = NULL;
+    if (_usePeak) {
+        reductions.peak = OutputSubfield::create(subfield, (name + "_peak").c_str());
+        err = VecSet(reductions.peak->getVector(), 0.0);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_useRMS) {
+        reductions.rms = OutputSubfield::create(subfield, (name + "_rms").c_str());
+        err = VecDuplicate(reductions.rms->getVector(), &reductions.sumSquares);PYLITH_CHECK_ERROR(err);
+        err = VecSet(reductions.sumSquares, 0.0);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_useThresholdTime && (name == _thresholdSubfield)) {
+        reductions.thresholdTime = OutputSubfield::create(subfield, (name + "_threshold_time").c_str());
+        err = VecSet(reductions.thresholdTime->getVector(), std::numeric_limits<PylithReal>::quiet_NaN());PYLITH_CHECK_ERROR(err);
+    } // if
+
+    if (_reductionsPrev.count(name)) {
+        _migrateReductions(&reductions, &_reductionsPrev[name]);
+        _reductionsPrev.erase(name);
+        if (_reductionsPrev.empty()) {
+            err = PetscSFDestroy(&_sfMigration);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // if
+
+    PYLITH_METHOD_RETURN(reductions);
+} // _getReductions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Migrate values of reductions for mesh before it was redistributed.
+void
+pylith::meshio::OutputReductions::_migrateReductions(Reductions* reductions,
+                                                     Reductions* reductionsPrev) {
+    PYLITH_METHOD_BEGIN;
+    assert(reductions);
+    assert(reductionsPrev);
+    assert(_sfMigration);
+
+    if (reductions->peak && reductionsPrev->peak) {
+        pylith::topology::FieldOps::migrateGlobalVector(reductions->peak->getVector(), reductions->peak->getDM(),
+                                                        reductionsPrev->peak->getVector(), reductionsPrev->peak->getDM(),
+                                                        _sfMigration);
+    } // if
+    if (reductions->sumSquares && reductionsPrev->sumSquares) {
+        assert(reductions->rms && reductionsPrev->rms);
+        pylith::topology::FieldOps::migrateGlobalVector(reductions->sumSquares, reductions->rms->getDM(),
+                                                        reductionsPrev->sumSquares, reductionsPrev->rms->getDM(),
+                                                        _sfMigration);
+    } // if
+    if (reductions->thresholdTime && reductionsPrev->thresholdTime) {
+        pylith::topology::FieldOps::migrateGlobalVector(reductions->thresholdTime->getVector(), reductions->thresholdTime->getDM(),
+                                                        reductionsPrev->thresholdTime->getVector(), reductionsPrev->thresholdTime->getDM(),
+                                                        _sfMigration);
+    } // if
+    _deallocateReductions(reductionsPrev);
+
+    PYLITH_METHOD_END;
+} // _migrateReductions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate reductions for subfield.
+void
+pylith::meshio::OutputReductions::_deallocateReductions(Reductions* reductions) {
+    PYLITH_METHOD_BEGIN;
+    assert(reductions);
+
+    delete reductions->peak;reductions->peak = NULL;
+    delete reductions->rms;reductions->rms = NULL;
+    delete reductions->thresholdTime;reductions->thresholdTime = NULL;
+    PetscErrorCode err = VecDestroy(&reductions->sumSquares);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _deallocateReductions
+
+
+// End of file
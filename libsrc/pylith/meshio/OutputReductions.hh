@@ -0,0 +1,184 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/meshio/meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // HASA PetscVec
+#include "pylith/utils/types.hh" // HASA PylithReal
+#include "pylith/utils/petscfwd.h" // HASA PetscSF
+
+#include <map> // HASA std::map
+#include <string> // HASA std::string
+#include <vector> // USES std::vector
+
+/** Reductions over time of output subfields.
+ *
+ * Used by observers that accumulate reductions in memory and write the reduced fields once, at
+ * the end of the simulation.
+ *
+ * Supported reductions (all are computed independently for each component):
+ *   - peak: Maximum absolute value.
+ *   - rms: Root-mean-square value over the time steps.
+ *   - threshold_time: First time at which the absolute value of the threshold subfield is greater
+ *     than or equal to the threshold (NaN if the threshold is never reached). Only one subfield
+ *     is used, so the threshold has the units of that subfield.
+ *   - final: Value at the last time step.
+ */
+class pylith::meshio::OutputReductions {
+    friend class TestOutputReductions; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    OutputReductions(void);
+
+    /// Destructor
+    ~OutputReductions(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set names of reductions to compute.
+     *
+     * @param[in] names Array of names of reductions.
+     * @param[in] numNames Length of array.
+     */
+    void setReductions(const char* names[],
+                       const int numNames);
+
+    /** Set threshold for computing time at which threshold is reached.
+     *
+     * @param[in] value Threshold (dimensioned) for absolute value of subfield components.
+     */
+    void setThreshold(const PylithReal value);
+
+    /** Set name of subfield used for time at which threshold is reached.
+     *
+     * @param[in] value Name of subfield.
+     */
+    void setThresholdSubfield(const char* value);
+
+    /** Get name of subfield used for time at which threshold is reached.
+     *
+     * @returns Name of subfield.
+     */
+    const char* getThresholdSubfield(void) const;
+
+    /** Check whether time at which threshold is reached is computed.
+     *
+     * @returns True if time at which threshold is reached is computed, false otherwise.
+     */
+    bool useThresholdTime(void) const;
+
+    /** Check whether values at last time step are included in output.
+     *
+     * @returns True if values at last time step are included, false otherwise.
+     */
+    bool useFinal(void) const;
+
+    /** Get number of time steps included in reductions.
+     *
+     * @returns Number of time steps.
+     */
+    size_t getNumSamples(void) const;
+
+    /** Update reductions with values of subfield.
+     *
+     * Call for each subfield at a time step and then call finishStep().
+     *
+     * @param[in] subfield Output subfield with (dimensioned) values at time t.
+     * @param[in] t Time (dimensioned).
+     */
+    void update(const OutputSubfield& subfield,
+                const PylithReal t);
+
+    /// Finish updating reductions for the current time step.
+    void finishStep(void);
+
+    /** Get reduced subfields for output.
+     *
+     * RMS values are computed from the running sums.
+     *
+     * @param[in] name Name of subfield.
+     * @returns Reduced subfields for subfield (empty if subfield has not been updated).
+     */
+    std::vector<OutputSubfield*> getReducedSubfields(const char* name);
+
+    /** Migrate reductions to redistributed mesh.
+     *
+     * The values of the reductions are migrated to the layout of the redistributed mesh the next
+     * time the reductions for each subfield are updated.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void migrate(PetscSF sfMigration);
+
+    // PRIVATE STRUCTS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Reductions for a subfield.
+    struct Reductions {
+        OutputSubfield* peak; ///< Maximum absolute value.
+        OutputSubfield* rms; ///< Root-mean-square value.
+        OutputSubfield* thresholdTime; ///< Time at which threshold is reached.
+        PetscVec sumSquares; ///< Running sum of squares for RMS value.
+    };
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get reductions for subfield, creating if necessary.
+     *
+     * @param[in] subfield Output subfield with values.
+     * @returns Reductions for subfield.
+     */
+    Reductions& _getReductions(const OutputSubfield& subfield);
+
+    /** Migrate values of reductions for mesh before it was redistributed.
+     *
+     * @param[inout] reductions Reductions for redistributed mesh.
+     * @param[inout] reductionsPrev Reductions for mesh before it was redistributed (deallocated on return).
+     */
+    void _migrateReductions(Reductions* reductions,
+                            Reductions* reductionsPrev);
+
+    /** Deallocate reductions for subfield.
+     *
+     * @param[inout] reductions Reductions for subfield.
+     */
+    static
+    void _deallocateReductions(Reductions* reductions);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::map<std::string, Reductions> _reductions; ///< Reductions for each subfield.
+    std::map<std::string, Reductions> _reductionsPrev; ///< Reductions waiting for migration to redistributed mesh.
+    PetscSF _sfMigration; ///< PETSc SF for migrating reductions to redistributed mesh.
+    std::string _thresholdSubfield; ///< Name of subfield for time at which threshold is reached.
+    PylithReal _threshold; ///< Threshold for time at which threshold is reached.
+    size_t _numSamples; ///< Number of time steps included in reductions.
+    bool _usePeak; ///< Compute peak values.
+    bool _useRMS; ///< Compute RMS values.
+    bool _useThresholdTime; ///< Compute time at which threshold is reached.
+    bool _useFinal; ///< Include values at last time step.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputReductions(const OutputReductions&); ///< Not implemented.
+    const OutputReductions& operator=(const OutputReductions&); ///< Not implemented
+
+}; // OutputReductions
+
+// End of file
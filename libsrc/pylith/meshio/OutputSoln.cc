@@ -111,6 +111,24 @@ pylith::meshio::OutputSoln::verifyConfiguration(const pylith::topology::Field& s
 } // verifyConfiguration
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer will write output at time t.
+bool
+pylith::meshio::OutputSoln::willWrite(const PylithReal t,
+                                      const PylithInt tindex,
+                                      const pylith::topology::Field& solution) {
+    return _willWrite(t, tindex, solution);
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Discard output data that depends on the distribution of the mesh among processes.
+void
+pylith::meshio::OutputSoln::resetDistribution(PetscSF sfMigration) {
+    OutputObserver::_resetDistribution();
+} // resetDistribution
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Get update from integrator (subject of observer).
 void
@@ -118,8 +136,7 @@ pylith::meshio::OutputSoln::update(const PylithReal t,
                                    const PylithInt tindex,
                                    const pylith::topology::Field& solution,
                                    const pylith::problems::Observer::NotificationType notification) {
-    assert(_trigger);
-    if (_trigger->shouldWrite(t, tindex)) {
+    if (_shouldWrite(t, tindex, solution)) {
         _writeSolnStep(t, tindex, solution);
     } // if
 } // update
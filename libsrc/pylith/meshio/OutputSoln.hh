@@ -61,6 +61,24 @@ public:
     virtual
     void verifyConfiguration(const pylith::topology::Field& solution) const override;
 
+    /** Check whether observer will write output at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if observer will write output at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex,
+                   const pylith::topology::Field& solution) override;
+
+    /** Discard output data that depends on the distribution of the mesh among processes.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void resetDistribution(PetscSF sfMigration) override;
+
     /** Receive update from subject.
      *
      * @param[in] t Current time.
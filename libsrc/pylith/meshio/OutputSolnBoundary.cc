@@ -76,6 +76,20 @@ pylith::meshio::OutputSolnBoundary::setLabelValue(const int value) {
 } // setLabelValue
 
 
+// ------------------------------------------------------------------------------------------------
+// Discard output data that depends on the distribution of the mesh among processes.
+void
+pylith::meshio::OutputSolnBoundary::resetDistribution(PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSoln::resetDistribution(sfMigration);
+
+    delete _boundaryMesh;_boundaryMesh = NULL;
+
+    PYLITH_METHOD_END;
+} // resetDistribution
+
+
 // ------------------------------------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
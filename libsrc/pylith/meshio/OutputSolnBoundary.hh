@@ -44,6 +44,13 @@ public:
      */
     void setLabelValue(const int value);
 
+    /** Discard output data that depends on the distribution of the mesh among processes.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void resetDistribution(PetscSF sfMigration);
+
     /** Verify configuration.
      *
      * @param[in] solution Solution field.
@@ -24,19 +24,22 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/geocoords/Converter.hh" // USES Converter
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::max()
 
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputSolnPoints::OutputSolnPoints(void) :
     _pointMesh(NULL),
     _pointSoln(NULL),
-    _interpolator(NULL) {
+    _interpolator(NULL),
+    _interpolatedValues(NULL) {
     PyreComponent::setName("outputsolnpoints");
 } // constructor
 
@@ -56,9 +59,9 @@ pylith::meshio::OutputSolnPoints::deallocate(void) {
 
     OutputSoln::deallocate();
 
-    if (_interpolator) {
-        PetscErrorCode err = DMInterpolationDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
-    } // if
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = MatDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_interpolatedValues);PYLITH_CHECK_ERROR(err);
 
     delete _pointMesh;_pointMesh = NULL;
     delete _pointSoln;_pointSoln = NULL;
@@ -88,15 +91,36 @@ pylith::meshio::OutputSolnPoints::setPoints(const PylithReal* pointCoords,
     } // for
 
     // Copy point names.
-    _pointNames.resize(numPointNames);
+    _pointNamesAll.resize(numPointNames);
     for (PylithInt i = 0; i < numPointNames; ++i) {
-        _pointNames[i] = pointNames[i];
+        _pointNamesAll[i] = pointNames[i];
     } // for
+    _pointNames = _pointNamesAll;
 
     PYLITH_METHOD_END;
 } // setPoints
 
 
+// ------------------------------------------------------------------------------------------------
+// Discard output data that depends on the distribution of the mesh among processes.
+void
+pylith::meshio::OutputSolnPoints::resetDistribution(PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSoln::resetDistribution(sfMigration);
+
+    // Points are located in the redistributed mesh when the interpolator is set up again.
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = MatDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_interpolatedValues);PYLITH_CHECK_ERROR(err);
+    delete _pointMesh;_pointMesh = NULL;
+    delete _pointSoln;_pointSoln = NULL;
+    _pointNames = _pointNamesAll;
+
+    PYLITH_METHOD_END;
+} // resetDistribution
+
+
 // ------------------------------------------------------------------------------------------------
 // Write solution at time step.
 void
@@ -123,9 +147,7 @@ pylith::meshio::OutputSolnPoints::_writeSolnStep(const PylithReal t,
     for (size_t iField = 0; iField < numSubfieldNames; iField++) {
         OutputSubfield* subfield = NULL;
         subfield = this->_getSubfield(*_pointSoln, *_pointMesh, subfieldNames[iField].c_str());assert(subfield);
-
-        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNames[iField].c_str());
-        subfield->extractSubfield(*_pointSoln, info.index);
+        _extractSubfield(subfield, iField);
 
         OutputObserver::_appendField(t, *subfield);
     } // for
@@ -145,6 +167,7 @@ pylith::meshio::OutputSolnPoints::_getSubfield(const pylith::topology::Field& fi
     PYLITH_COMPONENT_DEBUG("_getSubfield(field="<<field.getLabel()<<", name="<<name<<", submesh="<<typeid(submesh).name()<<")");
 
     if (_subfields.count(name) == 0) {
+        pylith::utils::MemoryRegistry::OwnerScope owner(getIdentifier());
         _subfields[name] = OutputSubfield::create(field, submesh, name);
     } // if
 
@@ -158,31 +181,30 @@ void
 pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
 
-    PetscErrorCode err;
-    if (_interpolator) {
-        err = DMInterpolationDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
-    } // if
-    assert(!_interpolator);
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = MatDestroy(&_interpolator);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_interpolatedValues);PYLITH_CHECK_ERROR(err);
 
     const spatialdata::geocoords::CoordSys* csMesh = solution.getMesh().getCoordSys();assert(csMesh);
     const int spaceDim = csMesh->getSpaceDim();
 
     MPI_Comm comm = solution.getMesh().getComm();
 
-    // Setup interpolator object
+    // Locate points in mesh.
     PetscDM dmSoln = solution.getDM();assert(dmSoln);
 
-    err = DMInterpolationCreate(comm, &_interpolator);PYLITH_CHECK_ERROR(err);
-    err = DMInterpolationSetDim(_interpolator, spaceDim);PYLITH_CHECK_ERROR(err);
-    err = DMInterpolationAddPoints(_interpolator, _pointNames.size(), (PetscReal*) &_pointCoords[0]);PYLITH_CHECK_ERROR(err);
+    DMInterpolationInfo interpolator = NULL;
+    err = DMInterpolationCreate(comm, &interpolator);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDim(interpolator, spaceDim);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationAddPoints(interpolator, _pointNamesAll.size(), (PetscReal*) &_pointCoords[0]);PYLITH_CHECK_ERROR(err);
     const PetscBool pointsAllProcs = PETSC_TRUE;
     const PetscBool ignoreOutsideDomain = PETSC_FALSE;
-    err = DMInterpolationSetUp(_interpolator, dmSoln, pointsAllProcs, ignoreOutsideDomain);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetUp(interpolator, dmSoln, pointsAllProcs, ignoreOutsideDomain);PYLITH_CHECK_ERROR(err);
 
     // Create mesh corresponding to local points.
-    const size_t numPointsLocal = _interpolator->n;
-    PylithScalar* pointsLocal = NULL;
-    err = VecGetArray(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
+    const size_t numPointsLocal = interpolator->n;
+    const PylithScalar* pointsLocal = NULL;
+    err = VecGetArrayRead(interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
 
     PylithReal lengthScale = 1.0;
     err = DMPlexGetScale(dmSoln, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
@@ -193,7 +215,7 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
 
     // Upate point names to only local points.
     pylith::string_vector pointNamesLocal(numPointsLocal);
-    const size_t numPoints = _pointNames.size();
+    const size_t numPoints = _pointNamesAll.size();
     for (size_t iPointLocal = 0; iPointLocal < numPointsLocal; ++iPointLocal) {
         // Find point in array of all points to get index for point name.
         for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
@@ -203,28 +225,123 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
                 dist += pow(_pointCoords[iPoint*spaceDim+iDim] - pointsLocal[iPointLocal*spaceDim+iDim], 2);
             } // for
             if (sqrt(dist) < tolerance) {
-                pointNamesLocal[iPointLocal] = _pointNames[iPoint];
+                pointNamesLocal[iPointLocal] = _pointNamesAll[iPoint];
                 break;
             } // if
         } // for
     } // for
-    err = VecGetArray(_interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
 
     _pointNames = pointNamesLocal;
-    _pointCoords.resize(0);
 
-    // Determine size of interpolated field that we will have.
-    PetscInt numDof = 0;
-    const pylith::string_vector& subfieldNames = solution.getSubfieldNames();
-    const size_t numSubfields = subfieldNames.size();
-    for (size_t i = 0; i < numSubfields; ++i) {
-        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNames[i].c_str());
-        if (!info.fe.isFaultOnly) {
-            numDof += info.description.numComponents;
-        } // if
+    // Layout of interpolated values: output subfields are stored one after the other with
+    // values at the local points for each subfield in point order.
+    const pylith::string_vector& subfieldNamesDomain = pylith::topology::FieldOps::getSubfieldNamesDomain(solution);
+    const size_t numSubfieldsDomain = subfieldNamesDomain.size();
+    _subfieldOffsets.resize(numSubfieldsDomain+1);
+    _subfieldOffsets[0] = 0;
+    for (size_t i = 0; i < numSubfieldsDomain; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNamesDomain[i].c_str());
+        _subfieldOffsets[i+1] = _subfieldOffsets[i] + numPointsLocal * info.description.numComponents;
+    } // for
+    const PetscInt numRows = _subfieldOffsets[numSubfieldsDomain];
+
+    PetscInt numCols = 0;
+    err = VecGetLocalSize(solution.getLocalVector(), &numCols);PYLITH_CHECK_ERROR(err);
+
+    // Create tabulation for each output subfield.
+    PetscInt maxNumBasis = 0;
+    std::vector<PetscTabulation> tabulations(numSubfieldsDomain, NULL);
+    std::vector<PetscFE> feSubfields(numSubfieldsDomain, NULL);
+    std::vector<PetscInt> feIndices(numSubfieldsDomain, -1);
+    for (size_t i = 0; i < numSubfieldsDomain; ++i) {
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNamesDomain[i].c_str());
+        PetscObject discretization = NULL;
+        err = DMGetField(dmSoln, info.index, NULL, &discretization);PYLITH_CHECK_ERROR(err);
+        feSubfields[i] = (PetscFE) discretization;
+        feIndices[i] = info.index;
+
+        PetscReal refCoordsZero[3] = { 0.0, 0.0, 0.0 };
+        err = PetscFECreateTabulation(feSubfields[i], 1, 1, refCoordsZero, 0, &tabulations[i]);PYLITH_CHECK_ERROR(err);
+        maxNumBasis = std::max(maxNumBasis, tabulations[i]->Nb);
+    } // for
+
+    // Assemble interpolation matrix.
+    err = MatCreateSeqAIJ(PETSC_COMM_SELF, numRows, numCols, maxNumBasis, NULL, &_interpolator);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)_interpolator, "station_interpolator");PYLITH_CHECK_ERROR(err);
+
+    PetscSection solnSection = solution.getLocalSection();assert(solnSection);
+    PetscInt numFields = 0;
+    err = PetscSectionGetNumFields(solnSection, &numFields);PYLITH_CHECK_ERROR(err);
+    pylith::int_array closureFieldOffsets(numFields+1);
+
+    pylith::real_array refCoords(spaceDim);
+    pylith::real_array values(maxNumBasis);
+    pylith::int_array indicesBasis(maxNumBasis);
+    for (size_t iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+        const PetscInt cell = interpolator->cells[iPoint];
+        err = DMPlexCoordinatesToReference(dmSoln, cell, 1, &pointsLocal[iPoint*spaceDim], &refCoords[0]);PYLITH_CHECK_ERROR(err);
+
+        // Closure is ordered by field, so we need the offset of each field in the closure.
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        closureFieldOffsets = 0;
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            PetscInt fieldClosureSize = 0;
+            for (PetscInt iClosure = 0; iClosure < closureSize*2; iClosure += 2) {
+                PetscInt fieldDof = 0;
+                err = PetscSectionGetFieldDof(solnSection, closure[iClosure], iField, &fieldDof);PYLITH_CHECK_ERROR(err);
+                fieldClosureSize += fieldDof;
+            } // for
+            closureFieldOffsets[iField+1] = closureFieldOffsets[iField] + fieldClosureSize;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+        PetscInt numIndices = 0;
+        PetscInt* indices = NULL;
+        err = DMPlexGetClosureIndices(dmSoln, solnSection, solnSection, cell, PETSC_TRUE, &numIndices, &indices,
+                                      NULL, NULL);PYLITH_CHECK_ERROR(err);
+        for (size_t iSubfield = 0; iSubfield < numSubfieldsDomain; ++iSubfield) {
+            PetscTabulation tabulation = tabulations[iSubfield];
+            err = PetscFEComputeTabulation(feSubfields[iSubfield], 1, &refCoords[0], 0, tabulation);PYLITH_CHECK_ERROR(err);
+            const PetscInt numBasis = tabulation->Nb;
+            const PetscInt numComponents = tabulation->Nc;
+            const PetscInt fieldIndex = feIndices[iSubfield];
+            const PetscInt closureOffset = closureFieldOffsets[fieldIndex];
+            assert(closureFieldOffsets[fieldIndex+1] - closureOffset == numBasis);
+            const PylithReal scale = solution.getSubfieldInfo(subfieldNamesDomain[iSubfield].c_str()).description.scale;
+
+            for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                PetscInt numValues = 0;
+                for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                    const PetscReal basis = tabulation->T[0][iBasis*numComponents+iComponent];
+                    if (basis == 0.0) { continue; }
+                    const PetscInt index = indices[closureOffset+iBasis];
+                    // Constrained DOF are returned as -(index+1); we want values from the local vector anyway.
+                    indicesBasis[numValues] = (index >= 0) ? index : -(index+1);
+                    values[numValues] = scale * basis;
+                    ++numValues;
+                } // for
+                const PetscInt row = _subfieldOffsets[iSubfield] + iPoint*numComponents + iComponent;
+                err = MatSetValues(_interpolator, 1, &row, numValues, &indicesBasis[0], &values[0], ADD_VALUES);PYLITH_CHECK_ERROR(err);
+            } // for
+        } // for
+        err = DMPlexRestoreClosureIndices(dmSoln, solnSection, solnSection, cell, PETSC_TRUE, &numIndices, &indices,
+                                          NULL, NULL);PYLITH_CHECK_ERROR(err);
     } // for
-    err = DMInterpolationSetDof(_interpolator, numDof);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyBegin(_interpolator, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_interpolator, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
 
+    for (size_t i = 0; i < numSubfieldsDomain; ++i) {
+        err = PetscTabulationDestroy(&tabulations[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecRestoreArrayRead(interpolator->coords, &pointsLocal);PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationDestroy(&interpolator);PYLITH_CHECK_ERROR(err);
+
+    err = MatCreateVecs(_interpolator, NULL, &_interpolatedValues);PYLITH_CHECK_ERROR(err);
+
+    // Field at points provides the layout of the output subfields.
+    const pylith::string_vector& subfieldNames = solution.getSubfieldNames();
     delete _pointSoln;_pointSoln = new pylith::topology::Field(*_pointMesh);
     for (size_t i = 0; i < subfieldNames.size(); ++i) {
         const pylith::topology::Field::SubfieldInfo& sinfo = solution.getSubfieldInfo(subfieldNames[i].c_str());
@@ -242,18 +359,47 @@ pylith::meshio::OutputSolnPoints::_setupInterpolator(const pylith::topology::Fie
 
 
 // ------------------------------------------------------------------------------------------------
-// Append finite-element field to file.
+// Interpolate solution field to points.
 void
 pylith::meshio::OutputSolnPoints::_interpolateField(const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    assert(_pointSoln);
+    assert(_interpolator);
+    assert(_interpolatedValues);
+
+    PetscErrorCode err = MatMult(_interpolator, solution.getLocalVector(), _interpolatedValues);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _interpolateField
 
-    PetscErrorCode err;
-    err = DMInterpolationEvaluate(_interpolator, solution.getDM(), solution.getLocalVector(),
-                                  _pointSoln->getLocalVector());PYLITH_CHECK_ERROR(err);
+
+// ------------------------------------------------------------------------------------------------
+// Copy interpolated values of subfield to output subfield.
+void
+pylith::meshio::OutputSolnPoints::_extractSubfield(OutputSubfield* subfield,
+                                                   const size_t index) {
+    PYLITH_METHOD_BEGIN;
+    assert(subfield);
+    assert(index+1 < _subfieldOffsets.size());
+
+    PetscVec subfieldVector = subfield->getVector();assert(subfieldVector);
+    const PetscInt offset = _subfieldOffsets[index];
+    const PetscInt size = _subfieldOffsets[index+1] - offset;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt subfieldSize = 0;
+    err = VecGetLocalSize(subfieldVector, &subfieldSize);PYLITH_CHECK_ERROR(err);
+    assert(subfieldSize == size);
+
+    const PetscScalar* valuesArray = NULL;
+    PetscScalar* subfieldArray = NULL;
+    err = VecGetArrayRead(_interpolatedValues, &valuesArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayWrite(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    err = PetscArraycpy(subfieldArray, &valuesArray[offset], size);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayWrite(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(_interpolatedValues, &valuesArray);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
-} // appendVertexField
+} // _extractSubfield
 
 
 // ------------------------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 
 class pylith::meshio::OutputSolnPoints : public pylith::meshio::OutputSoln {
     friend class TestOutputSolnPoints; // unit testing
+    friend class TestOutputSolnPointsInterpolator; // unit testing
 
     // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -46,6 +47,13 @@ public:
                    const char* const* pointNames,
                    const int numPointNames);
 
+    /** Discard output data that depends on the distribution of the mesh among processes.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void resetDistribution(PetscSF sfMigration);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -72,7 +80,12 @@ protected:
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
-    /** Setup interpolatior.
+    /** Setup interpolator.
+     *
+     * Locate the points in the mesh and assemble the sparse interpolation matrix that maps the
+     * local solution vector to the values of the output subfields at the local points. The
+     * selection of the subfields and the scale for dimensionalizing the values are included in
+     * the interpolation matrix.
      *
      * @param[in] solution Solution field.
      */
@@ -84,6 +97,14 @@ private:
      */
     void _interpolateField(const pylith::topology::Field& solution);
 
+    /** Copy interpolated values of subfield to output subfield.
+     *
+     * @param[inout] subfield Output subfield.
+     * @param[in] index Index of subfield in output subfields.
+     */
+    void _extractSubfield(OutputSubfield* subfield,
+                          const size_t index);
+
     /// Write dataset with names of points to file.
     void _writePointNames(void);
 
@@ -91,10 +112,13 @@ private:
 private:
 
     pylith::scalar_array _pointCoords; ///< Array of point coordinates.
-    pylith::string_vector _pointNames; ///< Array of point names.
+    pylith::string_vector _pointNamesAll; ///< Array of names of all points.
+    pylith::string_vector _pointNames; ///< Array of names of local points.
     pylith::topology::Mesh* _pointMesh; ///< Mesh for points (no cells).
-    pylith::topology::Field* _pointSoln; ///< Solution field at points.
-    DMInterpolationInfo _interpolator; ///< Field interpolator.
+    pylith::topology::Field* _pointSoln; ///< Layout of solution field at points.
+    PetscMat _interpolator; ///< Interpolation matrix [numPointsLocal*numComponents, solution local size].
+    PetscVec _interpolatedValues; ///< Values of output subfields at points.
+    pylith::int_array _subfieldOffsets; ///< Offsets of output subfields in interpolated values.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
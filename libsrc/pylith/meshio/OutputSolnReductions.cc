@@ -0,0 +1,229 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputSolnReductions.hh" // implementation of class methods
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/meshio/OutputTrigger.hh" // USES OutputTrigger
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <algorithm> // USES std::find()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputSolnReductions::OutputSolnReductions(void) :
+    _mesh(NULL),
+    _tLast(0.0) {
+    PyreComponent::setName("outputsolnreductions");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputSolnReductions::~OutputSolnReductions(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::OutputSolnReductions::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputSoln::deallocate();
+
+    _reductions.deallocate();
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set names of reductions to compute.
+void
+pylith::meshio::OutputSolnReductions::setReductions(const char* names[],
+                                                    const int numNames) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputSolnReductions::setReductions(names="<<names<<", numNames="<<numNames<<")");
+
+    try {
+        _reductions.setReductions(names, numNames);
+    } catch (const std::runtime_error& err) {
+        std::ostringstream msg;
+        msg << err.what() << " Error in solution observer '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // setReductions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set threshold for computing time at which threshold is reached.
+void
+pylith::meshio::OutputSolnReductions::setThreshold(const PylithReal value) {
+    PYLITH_COMPONENT_DEBUG("OutputSolnReductions::setThreshold(value="<<value<<")");
+
+    _reductions.setThreshold(value);
+} // setThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of subfield used for time at which threshold is reached.
+void
+pylith::meshio::OutputSolnReductions::setThresholdSubfield(const char* value) {
+    PYLITH_COMPONENT_DEBUG("OutputSolnReductions::setThresholdSubfield(value="<<value<<")");
+
+    _reductions.setThresholdSubfield(value);
+} // setThresholdSubfield
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Migrate reductions to redistributed mesh.
+void
+pylith::meshio::OutputSolnReductions::resetDistribution(PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("resetDistribution(sfMigration="<<sfMigration<<")");
+
+    // Reduced fields are written once, at the end of the simulation, so they go to a single file
+    // with the layout of the final distribution of the mesh.
+    OutputObserver::_resetDistribution(false);
+    _reductions.migrate(sfMigration);
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // resetDistribution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::meshio::OutputSolnReductions::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    OutputSoln::verifyConfiguration(solution);
+
+    if (_reductions.useThresholdTime()) {
+        const std::string thresholdSubfield(_reductions.getThresholdSubfield());
+        const bool useAll = _subfieldNames.empty() || (std::string("all") == _subfieldNames[0]);
+        const bool isOutput = (useAll) ?
+                              solution.hasSubfield(thresholdSubfield.c_str()) :
+                              std::find(_subfieldNames.begin(), _subfieldNames.end(), thresholdSubfield) != _subfieldNames.end();
+        if (!isOutput) {
+            std::ostringstream msg;
+            msg << "Subfield '" << thresholdSubfield << "' for time at which threshold is reached (threshold_subfield) in solution observer '"
+                << PyreComponent::getIdentifier() << "' must be one of the solution subfields included in output.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get update from integrator (subject of observer).
+void
+pylith::meshio::OutputSolnReductions::update(const PylithReal t,
+                                             const PylithInt tindex,
+                                             const pylith::topology::Field& solution,
+                                             const pylith::problems::Observer::NotificationType notification) {
+    if (notification != pylith::problems::Observer::SOLUTION) {
+        return;
+    } // if
+
+    if (_shouldWrite(t, tindex, solution)) {
+        _writeSolnStep(t, tindex, solution);
+    } // if
+} // update
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write reduced fields to output.
+void
+pylith::meshio::OutputSolnReductions::writeReductions(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("writeReductions()");
+
+    if (!_reductions.getNumSamples()) {
+        PYLITH_METHOD_END;
+    } // if
+    if (!_mesh) {
+        // Mesh was repartitioned and no values have been reduced on the new distribution of the mesh.
+        PYLITH_COMPONENT_WARNING("Skipping output of reductions, because they were not updated after the mesh was repartitioned.");
+        PYLITH_METHOD_END;
+    } // if
+
+    _openSolnStep(_tLast, *_mesh);
+    typedef std::map<std::string, OutputSubfield*> subfields_t;
+    for (subfields_t::iterator iter = _subfields.begin(); iter != _subfields.end(); ++iter) {
+        const std::vector<OutputSubfield*>& reduced = _reductions.getReducedSubfields(iter->first.c_str());
+        for (size_t i = 0; i < reduced.size(); ++i) {
+            OutputObserver::_appendField(_tLast, *reduced[i]);
+        } // for
+        if (_reductions.useFinal()) {
+            // Output subfield holds values from the last update.
+            OutputObserver::_appendField(_tLast, *iter->second);
+        } // if
+    } // for
+    _closeSolnStep();
+
+    PYLITH_METHOD_END;
+} // writeReductions
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update reductions with solution at time step.
+void
+pylith::meshio::OutputSolnReductions::_writeSolnStep(const PylithReal t,
+                                                     const PylithInt tindex,
+                                                     const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_writeSolnStep(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    const bool useAll = _subfieldNames.empty() || (std::string("all") == _subfieldNames[0]);
+    const pylith::string_vector& subfieldNames = (useAll) ?
+                                                 pylith::topology::FieldOps::getSubfieldNamesDomain(solution) : _subfieldNames;
+    PetscVec solutionVector = solution.getOutputVector();assert(solutionVector);
+
+    const PylithReal tDim = t * _timeScale;
+    const size_t numSubfieldNames = subfieldNames.size();
+    for (size_t iField = 0; iField < numSubfieldNames; iField++) {
+        assert(solution.hasSubfield(subfieldNames[iField].c_str()));
+
+        OutputSubfield* subfield = NULL;
+        subfield = OutputObserver::_getSubfield(solution, solution.getMesh(), subfieldNames[iField].c_str());assert(subfield);
+        subfield->project(solutionVector);
+        _reductions.update(*subfield, tDim);
+    } // for
+    _reductions.finishStep();
+
+    _mesh = &solution.getMesh();
+    _tLast = t;
+
+    PYLITH_METHOD_END;
+} // _writeSolnStep
+
+
+// End of file
@@ -0,0 +1,116 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/meshio/meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputSoln.hh" // ISA OutputSoln
+
+#include "pylith/meshio/OutputReductions.hh" // HASA OutputReductions
+
+/** Observer that accumulates reductions over time of solution subfields over the domain.
+ *
+ * Reductions are updated in memory at every time step selected by the trigger. The reduced
+ * fields are written once, at the end of the simulation, when writeReductions() is called.
+ *
+ * See OutputReductions for the supported reductions.
+ */
+class pylith::meshio::OutputSolnReductions : public pylith::meshio::OutputSoln {
+    friend class TestOutputSolnReductions; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    OutputSolnReductions(void);
+
+    /// Destructor
+    virtual ~OutputSolnReductions(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void) override;
+
+    /** Set names of reductions to compute.
+     *
+     * @param[in] names Array of names of reductions.
+     * @param[in] numNames Length of array.
+     */
+    void setReductions(const char* names[],
+                       const int numNames);
+
+    /** Set threshold for computing time at which threshold is reached.
+     *
+     * @param[in] value Threshold (dimensioned) for absolute value of subfield components.
+     */
+    void setThreshold(const PylithReal value);
+
+    /** Set name of subfield used for time at which threshold is reached.
+     *
+     * @param[in] value Name of subfield.
+     */
+    void setThresholdSubfield(const char* value);
+
+    /** Migrate reductions to redistributed mesh.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void resetDistribution(PetscSF sfMigration) override;
+
+    /** Verify observer is compatible with solution.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const override;
+
+    /** Receive update from subject.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @param[in] notification Type of notification.
+     */
+    void update(const PylithReal t,
+                const PylithInt tindex,
+                const pylith::topology::Field& solution,
+                const NotificationType notification) override;
+
+    /// Write reduced fields to output.
+    void writeReductions(void);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Update reductions with solution at time step.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void _writeSolnStep(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution) override;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputReductions _reductions; ///< Reductions of subfields.
+    const pylith::topology::Mesh* _mesh; ///< Mesh associated with solution.
+    PylithReal _tLast; ///< Time of last update.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputSolnReductions(const OutputSolnReductions&); ///< Not implemented.
+    const OutputSolnReductions& operator=(const OutputSolnReductions&); ///< Not implemented
+
+}; // OutputSolnReductions
+
+// End of file
@@ -20,6 +20,7 @@
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 
 #include "petscdm.h" // USES DMReorderSectionSetDefault()
 
@@ -46,6 +47,15 @@ public:
                 static PylithInt extractSubfield;
             };
 
+public:
+
+            /** Register memory of output subfield.
+             *
+             * @param[in] subfield Output subfield.
+             */
+            static
+            void registerMemory(const pylith::meshio::OutputSubfield& subfield);
+
         }; // _OutputSubfield
     } // meshio
 } // pylith
@@ -72,6 +82,22 @@ pylith::meshio::_OutputSubfield::Events::init(void) {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Register memory of output subfield.
+void
+pylith::meshio::_OutputSubfield::registerMemory(const pylith::meshio::OutputSubfield& subfield) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscSection section = NULL;
+    PetscErrorCode err = DMGetLocalSection(subfield.getDM(), &section);PYLITH_CHECK_ERROR(err);
+    const size_t bytes = pylith::utils::MemoryRegistry::vectorBytes(subfield.getVector()) +
+                         pylith::utils::MemoryRegistry::sectionBytes(section);
+    pylith::utils::MemoryRegistry::add(&subfield, "output", subfield.getDescription().label.c_str(), bytes);
+
+    PYLITH_METHOD_END;
+}
+
+
 // ------------------------------------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputSubfield::OutputSubfield(void) :
@@ -79,7 +105,10 @@ pylith::meshio::OutputSubfield::OutputSubfield(void) :
     _vector(NULL),
     _fn(pylith::fekernels::Solution::passThruSubfield),
     _label(NULL),
-    _labelValue(0) {
+    _labelValue(0),
+    _extractIS(NULL),
+    _extractSection(NULL),
+    _extractSubfieldIndex(-1) {
     _OutputSubfield::Events::init();
 }
 
@@ -95,9 +124,13 @@ pylith::meshio::OutputSubfield::~OutputSubfield(void) {
 // Deallocate PETSc and local data structures.
 void
 pylith::meshio::OutputSubfield::deallocate(void) {
+    pylith::utils::MemoryRegistry::remove(this);
+
     PetscErrorCode err;
     err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_vector);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_extractIS);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&_extractSection);PYLITH_CHECK_ERROR(err);
 
     _label = NULL; // Destroyed by DMDestroy()
 } // deallocate
@@ -139,6 +172,7 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
 
     err = DMCreateGlobalVector(subfield->_dm, &subfield->_vector);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_vector, name);PYLITH_CHECK_ERROR(err);
+    _OutputSubfield::registerMemory(*subfield);
 
     // _OutputSubfield::Events::logger.eventEnd(_OutputSubfield::Events::create);
     PYLITH_METHOD_RETURN(subfield);
@@ -182,12 +216,45 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     err = PetscSectionDestroy(&subfieldSection);PYLITH_CHECK_ERROR(err);
     err = DMCreateGlobalVector(subfield->_dm, &subfield->_vector);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject)subfield->_vector, name);PYLITH_CHECK_ERROR(err);
+    _OutputSubfield::registerMemory(*subfield);
 
     _OutputSubfield::Events::logger.eventEnd(_OutputSubfield::Events::createBasisOrder);
     PYLITH_METHOD_RETURN(subfield);
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Create OutputSubfield with the same layout as another OutputSubfield.
+pylith::meshio::OutputSubfield*
+pylith::meshio::OutputSubfield::create(const OutputSubfield& subfield,
+                                       const char* label) {
+    PYLITH_METHOD_BEGIN;
+    assert(subfield._dm);
+
+    OutputSubfield* derived = new OutputSubfield();assert(derived);
+    derived->_subfieldIndex = subfield._subfieldIndex;
+    derived->_description = subfield._description;
+    derived->_description.label = label;
+    derived->_discretization = subfield._discretization;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = DMClone(subfield._dm, &derived->_dm);PYLITH_CHECK_ERROR(err);
+    err = DMCopyDisc(subfield._dm, derived->_dm);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)derived->_dm, label);PYLITH_CHECK_ERROR(err);
+
+    // Subfields created without a projection have a section but no discretization.
+    PetscSection section = NULL;
+    err = DMGetLocalSection(subfield._dm, &section);PYLITH_CHECK_ERROR(err);
+    err = DMSetLocalSection(derived->_dm, section);PYLITH_CHECK_ERROR(err);
+
+    err = DMCreateGlobalVector(derived->_dm, &derived->_vector);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)derived->_vector, label);PYLITH_CHECK_ERROR(err);
+    _OutputSubfield::registerMemory(*derived);
+
+    PYLITH_METHOD_RETURN(derived);
+}
+
+
 // ------------------------------------------------------------------------------------------------
 // Set label name and value.
 void
@@ -291,36 +358,33 @@ pylith::meshio::OutputSubfield::extractSubfield(const pylith::topology::Field& f
     PYLITH_METHOD_BEGIN;
     _OutputSubfield::Events::logger.eventBegin(_OutputSubfield::Events::extractSubfield);
 
-    PetscErrorCode err;
-    PetscSection subfieldSection = NULL;
-    PetscInt storageSize = 0;
-    err = PetscSectionGetField(field.getLocalSection(), subfieldIndex, &subfieldSection);PYLITH_CHECK_ERROR(err);
-    err = PetscSectionGetStorageSize(subfieldSection, &storageSize);PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscSection fieldSection = field.getLocalSection();
+
+    // Index set depends only on the layout of the field, so we reuse it until the layout changes.
+    if (!_extractIS || (fieldSection != _extractSection) || (subfieldIndex != _extractSubfieldIndex)) {
+        err = ISDestroy(&_extractIS);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionDestroy(&_extractSection);PYLITH_CHECK_ERROR(err);
+
+        PetscSection subfieldSection = NULL;
+        err = DMGetLocalSection(_dm, &subfieldSection);PYLITH_CHECK_ERROR(err);
+        _extractIS = pylith::topology::FieldOps::createSubfieldsIS(fieldSection, &subfieldIndex, 1, subfieldSection);
+        _extractSection = fieldSection;
+        _extractSubfieldIndex = subfieldIndex;
+        err = PetscObjectReference((PetscObject)_extractSection);PYLITH_CHECK_ERROR(err);
+    } // if
 
     PetscVec subfieldVector = this->getVector();
-    PetscInt subfieldSize = 0;
+    PetscInt subfieldSize = 0, isSize = 0;
     err = VecGetLocalSize(subfieldVector, &subfieldSize);PYLITH_CHECK_ERROR(err);
-    assert(subfieldSize == storageSize);
-
-    PetscInt pStart = 0, pEnd = 0;
-    err = PetscSectionGetChart(subfieldSection, &pStart, &pEnd);
-
-    pylith::topology::VecVisitorMesh fieldVisitor(field);
-    PetscScalar* solnArray = fieldVisitor.localArray();
-    PetscScalar* subfieldArray = NULL;
-    err = VecGetArray(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(_extractIS, &isSize);PYLITH_CHECK_ERROR(err);
+    assert(subfieldSize == isSize);
 
-    for (PetscInt point = pStart, indexVec = 0; point < pEnd; ++point) {
-        const PetscInt solnOffset = fieldVisitor.sectionSubfieldOffset(subfieldIndex, point);
-        const PetscInt solnDof = fieldVisitor.sectionSubfieldDof(subfieldIndex, point);
-
-        for (PetscInt iDof = 0; iDof < solnDof; ++iDof) {
-            // Dimensionalize values while extracting subfield.
-            subfieldArray[indexVec++] = solnArray[solnOffset+iDof] * _description.scale;
-        } // for
-    } // for
-
-    err = VecRestoreArray(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+    // Gather subfield values and then dimensionalize them.
+    err = VecISCopy(field.getLocalVector(), _extractIS, SCATTER_REVERSE, subfieldVector);PYLITH_CHECK_ERROR(err);
+    if (_description.scale != 1.0) {
+        err = VecScale(subfieldVector, _description.scale);PYLITH_CHECK_ERROR(err);
+    } // if
 
     _OutputSubfield::Events::logger.eventEnd(_OutputSubfield::Events::extractSubfield);
     PYLITH_METHOD_END;
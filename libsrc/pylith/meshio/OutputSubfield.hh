@@ -16,7 +16,8 @@
 #include "pylith/topology/FieldBase.hh" // HASA Description, Discretization
 
 #include "pylith/topology/topologyfwd.hh" // USES Field
-#include "pylith/utils/petscfwd.h" // HASA PetscVec
+#include "pylith/utils/petscfwd.h" // HASA PetscVec, PetscIS
+#include "pylith/utils/types.hh" // HASA PetscSection
 
 class pylith::meshio::OutputSubfield : public pylith::utils::GenericComponent {
     friend class TestOutputSubfield; // unit testing
@@ -50,6 +51,18 @@ public:
                            const pylith::topology::Mesh& mesh,
                            const char* name);
 
+    /** Create OutputSubfield with the same layout as another OutputSubfield.
+     *
+     * @note Use this method for derived quantities, such as reductions over time, that are
+     * stored with the same layout as the original subfield.
+     *
+     * @param[in] subfield Subfield with layout.
+     * @param[in] label Label (name) of new subfield.
+     */
+    static
+    OutputSubfield* create(const OutputSubfield& subfield,
+                           const char* label);
+
     /// Destructor
     ~OutputSubfield(void);
 
@@ -129,6 +142,10 @@ protected:
     PetscDMLabel _label; ///< PETSc label associated with subfield.
     PetscInt _labelValue; ///< Value of PETSc label associated with subfield.
 
+    PetscIS _extractIS; ///< Indices of subfield in local vector of field for extractSubfield().
+    PetscSection _extractSection; ///< Local section of field used to create _extractIS.
+    PetscInt _extractSubfieldIndex; ///< Index of subfield used to create _extractIS.
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -37,4 +37,20 @@ pylith::meshio::OutputTrigger::setTimeScale(const PylithReal value) {
 } // setTimeScale
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t given the solution.
+bool
+pylith::meshio::OutputTrigger::shouldWrite(const PylithReal t,
+                                           const PylithInt tindex,
+                                           const pylith::topology::Field& solution) {
+    return shouldWrite(t, tindex);
+} // shouldWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Discard data that depends on the distribution of the mesh among processes.
+void
+pylith::meshio::OutputTrigger::resetDistribution(void) {}
+
+
 // End of file
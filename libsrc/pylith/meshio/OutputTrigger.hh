@@ -13,6 +13,7 @@
 
 #include "pylith/utils/PyreComponent.hh"
 
+#include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/types.hh" // USE PylithInt, PylithReal
 
 class pylith::meshio::OutputTrigger : public pylith::utils::PyreComponent {
@@ -43,6 +44,27 @@ public:
     bool shouldWrite(const PylithReal t,
                      const PylithInt tindex) = 0;
 
+    /** Check whether we want to write output at time t given the solution.
+     *
+     * Default implementation ignores the solution.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    virtual
+    bool shouldWrite(const PylithReal t,
+                     const PylithInt tindex,
+                     const pylith::topology::Field& solution);
+
+    /** Discard data that depends on the distribution of the mesh among processes.
+     *
+     * Default implementation does nothing.
+     */
+    virtual
+    void resetDistribution(void);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -0,0 +1,248 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputTriggerChange.hh" // Implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cmath> // USES fabs()
+#include <algorithm> // USES std::max()
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::OutputTriggerChange::OutputTriggerChange(void) :
+    _subfieldName("all"),
+    _relativeTolerance(0.01),
+    _absoluteTolerance(0.0),
+    _maxTimeSkip(0.0),
+    _timeNondimWrote(0.0),
+    _hasWrote(false) {
+    PyreComponent::setName("outputtriggerchange");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::OutputTriggerChange::~OutputTriggerChange(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of solution subfield used to detect changes.
+void
+pylith::meshio::OutputTriggerChange::setSubfield(const char* value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setSubfield(value="<<value<<")");
+
+    assert(value);
+    _subfieldName = value;
+} // setSubfield
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of solution subfield used to detect changes.
+const char*
+pylith::meshio::OutputTriggerChange::getSubfield(void) const {
+    return _subfieldName.c_str();
+} // getSubfield
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set relative tolerance for change in solution.
+void
+pylith::meshio::OutputTriggerChange::setRelativeTolerance(const double value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setRelativeTolerance(value="<<value<<")");
+
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Relative tolerance (" << value << ") for output trigger must be nonnegative.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _relativeTolerance = value;
+} // setRelativeTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get relative tolerance for change in solution.
+double
+pylith::meshio::OutputTriggerChange::getRelativeTolerance(void) const {
+    return _relativeTolerance;
+} // getRelativeTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set absolute tolerance for change in solution.
+void
+pylith::meshio::OutputTriggerChange::setAbsoluteTolerance(const double value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setAbsoluteTolerance(value="<<value<<")");
+
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Absolute tolerance (" << value << ") for output trigger must be nonnegative.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _absoluteTolerance = value;
+} // setAbsoluteTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get absolute tolerance for change in solution.
+double
+pylith::meshio::OutputTriggerChange::getAbsoluteTolerance(void) const {
+    return _absoluteTolerance;
+} // getAbsoluteTolerance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set maximum elapsed time between writes.
+void
+pylith::meshio::OutputTriggerChange::setMaxTimeSkip(const double value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::setMaxTimeSkip(value="<<value<<")");
+
+    _maxTimeSkip = (value >= 0.0) ? value : 0.0;
+} // setMaxTimeSkip
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get maximum elapsed time between writes.
+double
+pylith::meshio::OutputTriggerChange::getMaxTimeSkip(void) const {
+    return _maxTimeSkip;
+} // getMaxTimeSkip
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t.
+bool
+pylith::meshio::OutputTriggerChange::shouldWrite(const PylithReal t,
+                                                 const PylithInt timeStep) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::shouldWrite(t="<<t<<", timeStep="<<timeStep<<")");
+
+    // Without the solution, changes cannot exceed the tolerance.
+    const bool isWrite = _isWriteNeeded(t, 0.0, 0.0);
+    if (isWrite) {
+        _timeNondimWrote = t;
+        _hasWrote = true;
+    } // if
+
+    PYLITH_METHOD_RETURN(isWrite);
+} // shouldWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we want to write output at time t given the solution.
+bool
+pylith::meshio::OutputTriggerChange::shouldWrite(const PylithReal t,
+                                                 const PylithInt timeStep,
+                                                 const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::shouldWrite(t="<<t<<", timeStep="<<timeStep<<", solution="<<solution.getLabel()<<")");
+
+    const pylith::string_vector& subfieldNames = (_subfieldName == "all") ?
+                                                 solution.getSubfieldNames() : pylith::string_vector(1, _subfieldName);
+    const size_t numSubfields = subfieldNames.size();
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscSection localSection = solution.getLocalSection();assert(localSection);
+    PetscSection globalSection = solution.getGlobalSection();assert(globalSection);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(localSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    // Count values at points owned by this process, so each value is included only once.
+    size_t numValues = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt globalDof = 0;
+        err = PetscSectionGetDof(globalSection, point, &globalDof);PYLITH_CHECK_ERROR(err);
+        if (globalDof < 0) { continue; }
+        for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+            const PetscInt subfieldIndex = solution.getSubfieldInfo(subfieldNames[iSubfield].c_str()).index;
+            PetscInt subfieldDof = 0;
+            err = PetscSectionGetFieldDof(localSection, point, subfieldIndex, &subfieldDof);PYLITH_CHECK_ERROR(err);
+            numValues += subfieldDof;
+        } // for
+    } // for
+
+    pylith::scalar_array values(numValues);
+    const PetscScalar* solutionArray = NULL;
+    err = VecGetArrayRead(solution.getLocalVector(), &solutionArray);PYLITH_CHECK_ERROR(err);
+    for (size_t iSubfield = 0, index = 0; iSubfield < numSubfields; ++iSubfield) {
+        const pylith::topology::Field::SubfieldInfo& info = solution.getSubfieldInfo(subfieldNames[iSubfield].c_str());
+        const PylithReal scale = info.description.scale;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt globalDof = 0;
+            err = PetscSectionGetDof(globalSection, point, &globalDof);PYLITH_CHECK_ERROR(err);
+            if (globalDof < 0) { continue; }
+
+            PetscInt subfieldDof = 0, subfieldOffset = 0;
+            err = PetscSectionGetFieldDof(localSection, point, info.index, &subfieldDof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(localSection, point, info.index, &subfieldOffset);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDof = 0; iDof < subfieldDof; ++iDof) {
+                values[index++] = solutionArray[subfieldOffset+iDof] * scale;
+            } // for
+        } // for
+    } // for
+    err = VecRestoreArrayRead(solution.getLocalVector(), &solutionArray);PYLITH_CHECK_ERROR(err);
+
+    PylithReal maxLocal[2] = { 0.0, 0.0 }; // [max change, max previous value]
+    if (_hasWrote) {
+        assert(_valuesWrote.size() == values.size());
+        for (size_t i = 0; i < numValues; ++i) {
+            maxLocal[0] = std::max(maxLocal[0], fabs(values[i] - _valuesWrote[i]));
+            maxLocal[1] = std::max(maxLocal[1], fabs(_valuesWrote[i]));
+        } // for
+    } // if
+    PylithReal maxGlobal[2] = { 0.0, 0.0 };
+    err = MPI_Allreduce(maxLocal, maxGlobal, 2, MPIU_REAL, MPI_MAX, solution.getMesh().getComm());PYLITH_CHECK_ERROR(err);
+
+    const bool isWrite = _isWriteNeeded(t, maxGlobal[0], maxGlobal[1]);
+    if (isWrite) {
+        _valuesWrote.resize(numValues);
+        _valuesWrote = values;
+        _timeNondimWrote = t;
+        _hasWrote = true;
+    } // if
+
+    PYLITH_METHOD_RETURN(isWrite);
+} // shouldWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Discard values at previous write.
+void
+pylith::meshio::OutputTriggerChange::resetDistribution(void) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerChange::resetDistribution()");
+
+    _valuesWrote.resize(0);
+    _hasWrote = false;
+} // resetDistribution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether changes or elapsed time require a write.
+bool
+pylith::meshio::OutputTriggerChange::_isWriteNeeded(const PylithReal t,
+                                                    const PylithReal maxChange,
+                                                    const PylithReal maxPrevious) const {
+    if (!_hasWrote) {
+        return true;
+    } // if
+    if ((_maxTimeSkip > 0.0) && (t - _timeNondimWrote >= _maxTimeSkip / _timeScale)) {
+        return true;
+    } // if
+    return maxChange > _absoluteTolerance + _relativeTolerance * maxPrevious;
+} // _isWriteNeeded
+
+
+// End of file
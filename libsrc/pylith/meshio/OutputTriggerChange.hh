@@ -0,0 +1,153 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/meshio/meshiofwd.hh" // forward declarations
+
+#include "pylith/meshio/OutputTrigger.hh" // ISA OutputTrigger
+
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+#include <string> // HASA std::string
+
+/** Output trigger based on the change in the solution since the previous write.
+ *
+ * Output is written when the maximum absolute change in the (dimensioned) values of the selected
+ * subfield since the previous write exceeds
+ *
+ *   absolute_tolerance + relative_tolerance * (maximum absolute value at the previous write)
+ *
+ * or when the elapsed time since the previous write reaches the maximum elapsed time.
+ */
+class pylith::meshio::OutputTriggerChange : public pylith::meshio::OutputTrigger {
+    friend class TestOutputTriggerChange; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    OutputTriggerChange(void);
+
+    /// Destructor
+    virtual ~OutputTriggerChange(void);
+
+    /** Set name of solution subfield used to detect changes.
+     *
+     * @param[in] value Name of subfield ("all" for all subfields).
+     */
+    void setSubfield(const char* value);
+
+    /** Get name of solution subfield used to detect changes.
+     *
+     * @returns Name of subfield.
+     */
+    const char* getSubfield(void) const;
+
+    /** Set relative tolerance for change in solution.
+     *
+     * @param[in] value Relative tolerance.
+     */
+    void setRelativeTolerance(const double value);
+
+    /** Get relative tolerance for change in solution.
+     *
+     * @returns Relative tolerance.
+     */
+    double getRelativeTolerance(void) const;
+
+    /** Set absolute tolerance for change in solution.
+     *
+     * @param[in] value Absolute tolerance (dimensioned).
+     */
+    void setAbsoluteTolerance(const double value);
+
+    /** Get absolute tolerance for change in solution.
+     *
+     * @returns Absolute tolerance (dimensioned).
+     */
+    double getAbsoluteTolerance(void) const;
+
+    /** Set maximum elapsed time between writes.
+     *
+     * @param[in] value Maximum elapsed (dimensional) time between writes (0 for no limit).
+     */
+    void setMaxTimeSkip(const double value);
+
+    /** Get maximum elapsed time between writes.
+     *
+     * @returns Maximum elapsed (dimensional) time between writes.
+     */
+    double getMaxTimeSkip(void) const;
+
+    /** Check whether we want to write output at time t.
+     *
+     * Without the solution, only the maximum elapsed time is used.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    bool shouldWrite(const PylithReal t,
+                     const PylithInt tindex);
+
+    /** Check whether we want to write output at time t given the solution.
+     *
+     * @param[in] t Time of proposed write.
+     * @param[in] tindex Inxex of current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    bool shouldWrite(const PylithReal t,
+                     const PylithInt tindex,
+                     const pylith::topology::Field& solution);
+
+    /** Discard values at previous write.
+     *
+     * The values are stored for points owned by this process, so they cannot be compared after the
+     * mesh is redistributed. Output is written at the next time step.
+     */
+    void resetDistribution(void);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Check whether changes or elapsed time require a write.
+     *
+     * @param[in] t Time (nondimensional) of proposed write.
+     * @param[in] maxChange Maximum absolute change in values since previous write.
+     * @param[in] maxPrevious Maximum absolute value at previous write.
+     * @returns True if output should be written at time t, false otherwise.
+     */
+    bool _isWriteNeeded(const PylithReal t,
+                        const PylithReal maxChange,
+                        const PylithReal maxPrevious) const;
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _subfieldName; ///< Name of subfield used to detect changes.
+    pylith::scalar_array _valuesWrote; ///< Values of subfield (dimensioned) at previous write.
+    PylithReal _relativeTolerance; ///< Relative tolerance for change.
+    PylithReal _absoluteTolerance; ///< Absolute tolerance (dimensioned) for change.
+    PylithReal _maxTimeSkip; ///< Maximum elapsed (dimensional) time between writes.
+    PylithReal _timeNondimWrote; ///< Time (nondimensional) when data was previously written.
+    bool _hasWrote; ///< True if data has been written.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    OutputTriggerChange(const OutputTriggerChange&); ///< Not implemented.
+    const OutputTriggerChange& operator=(const OutputTriggerChange&); ///< Not implemented
+
+};
+
+// OutputTriggerChange
+
+// End of file
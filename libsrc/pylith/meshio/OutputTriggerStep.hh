@@ -34,6 +34,8 @@ public:
     bool shouldWrite(const PylithReal t,
                      const PylithInt tindex);
 
+    using OutputTrigger::shouldWrite; // Use default implementation with solution.
+
     /** Set number of steps to skip between writes.
      *
      * @param[in] Number of steps to skip between writes.
@@ -34,6 +34,8 @@ public:
     bool shouldWrite(const PylithReal t,
                      const PylithInt tindex);
 
+    using OutputTrigger::shouldWrite; // Use default implementation with solution.
+
     /** Set elapsed time between writes.
      *
      * @param[in] Elapsed time between writes.
@@ -33,13 +33,17 @@ namespace pylith {
         class OutputSolnDomain;
         class OutputSolnBoundary;
         class OutputSolnPoints;
+        class OutputSolnReductions;
+        class OutputReductions;
 
         class OutputPhysics;
+        class OutputPhysicsReductions;
         class OutputIntegrator;
         class OutputConstraint;
 
         class ObserverOutput;
         class OutputTrigger;
+        class OutputTriggerChange;
         class OutputTriggerStep;
         class OutputTriggerTime;
 
@@ -47,6 +51,7 @@ namespace pylith {
         class DataWriterVTK;
         class DataWriterHDF5;
         class DataWriterHDF5Ext;
+        class DataWriterHDF5Stations;
 
         class HDF5;
         class Xdmf;
@@ -308,7 +308,7 @@ pylith::problems::GreensFns::solve(void) {
     PetscInt numImpulsesLocal = _faultImpulses->getNumImpulsesLocal();
     PYLITH_COMPONENT_DEBUG("[" << mpiRank << "] Contributing " << numImpulsesLocal << " impulses for Green's functions.");
     int_array numImpulses(mpiNumProcs);
-    err = MPI_Allgather(&numImpulsesLocal, 1, MPI_INT, &numImpulses[0], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allgather(&numImpulsesLocal, 1, MPIU_INT, &numImpulses[0], 1, MPIU_INT, comm);PYLITH_CHECK_ERROR(err);
 
     size_t numImpulsesGlobal = 0;
     for (int iProc = 0; iProc < mpiNumProcs; ++iProc) {
@@ -316,8 +316,9 @@ pylith::problems::GreensFns::solve(void) {
     } // for
 
     const PylithReal tolerance = 1.0e-4;
-    for (int iProc = 0, iImpulseGlobal = 0; iProc < mpiNumProcs; ++iProc) {
-        for (int iImpulseLocal = 0; iImpulseLocal < numImpulses[iProc]; ++iImpulseLocal, ++iImpulseGlobal) {
+    size_t iImpulseGlobal = 0;
+    for (int iProc = 0; iProc < mpiNumProcs; ++iProc) {
+        for (PylithInt iImpulseLocal = 0; iImpulseLocal < numImpulses[iProc]; ++iImpulseLocal, ++iImpulseGlobal) {
             if (0 == mpiRank) {
                 PYLITH_COMPONENT_INFO_ROOT("Computing Green's function " << iImpulseGlobal+1 << " of " << numImpulsesGlobal << ".");
             } // if
@@ -329,7 +330,7 @@ pylith::problems::GreensFns::solve(void) {
             err = SNESSolve(_snes, residual->getGlobalVector(), solution->getGlobalVector());PYLITH_CHECK_ERROR(err);
             solution->scatterVectorToLocal(solution->getGlobalVector());
             solution->scatterLocalToOutput();
-            poststep(size_t(iImpulseGlobal), numImpulsesGlobal);
+            poststep(iImpulseGlobal, numImpulsesGlobal);
         } // for
     } // for
 
@@ -357,7 +358,9 @@ pylith::problems::GreensFns::poststep(const size_t impulse,
     // Update integrators.
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
         _integrators[i]->poststep(t, impulse, dt, *solution, notification);
+        _integratorEventEnd(i);
     } // for
 
     // Update constraints.
@@ -425,7 +428,9 @@ pylith::problems::GreensFns::computeResidual(PetscVec residualVec,
     const int numIntegrators = _integrators.size();
     assert(numIntegrators > 0); // must have at least 1 integrator
     for (int i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
         _integrators[i]->computeLHSResidual(residual, *_integrationData);
+        _integratorEventEnd(i);
     } // for
 
     // Assemble residual values across processes.
@@ -471,7 +476,9 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
     // Sum Jacobian contributions across integrators.
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
         _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, *_integrationData);
+        _integratorEventEnd(i);
     } // for
 
     // Assemble matrices
@@ -47,4 +47,20 @@ pylith::problems::ObserverPhysics::setPhysicsImplementation(const pylith::feasse
 } // setPhysicsImplemetation
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer will write output at time t.
+bool
+pylith::problems::ObserverPhysics::willWrite(const PylithReal t,
+                                             const PylithInt tindex,
+                                             const pylith::topology::Field& solution) {
+    return true;
+} // willWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Discard data that depends on the distribution of the mesh among processes.
+void
+pylith::problems::ObserverPhysics::resetDistribution(PetscSF sfMigration) {}
+
+
 // End of file
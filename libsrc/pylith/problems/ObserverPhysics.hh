@@ -15,6 +15,7 @@
 
 #include "pylith/feassemble/feassemblefwd.hh" // USES PhysicsImplementation
 #include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/petscfwd.h" // USES PetscSF
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
 class pylith::problems::ObserverPhysics : public pylith::problems::Observer {
@@ -53,6 +54,32 @@ public:
     virtual
     void verifyConfiguration(const pylith::topology::Field& solution) const = 0;
 
+    /** Check whether observer will write output at time t.
+     *
+     * Used to skip work, such as updating output vectors and computing derived fields, that is
+     * only needed for output. The default implementation always returns true.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if observer will write output at time t, false otherwise.
+     */
+    virtual
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex,
+                   const pylith::topology::Field& solution);
+
+    /** Discard data that depends on the distribution of the mesh among processes.
+     *
+     * Called after the mesh is redistributed during a simulation. The default implementation does
+     * nothing.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    virtual
+    void resetDistribution(PetscSF sfMigration);
+
     /** Receive update (subject of observer).
      *
      * @param[in] t Current time.
@@ -32,4 +32,20 @@ pylith::problems::ObserverSoln::deallocate(void) {
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer will write output at time t.
+bool
+pylith::problems::ObserverSoln::willWrite(const PylithReal t,
+                                          const PylithInt tindex,
+                                          const pylith::topology::Field& solution) {
+    return true;
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Discard data that depends on the distribution of the mesh among processes.
+void
+pylith::problems::ObserverSoln::resetDistribution(PetscSF sfMigration) {}
+
+
 // End of file
@@ -128,6 +128,41 @@ pylith::problems::ObserversPhysics::verifyObservers(const pylith::topology::Fiel
 } // verifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer will write output at time t.
+bool
+pylith::problems::ObserversPhysics::willWrite(const PylithReal t,
+                                              const PylithInt tindex,
+                                              const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("willWrite(t="<<t<<", tindex="<<tindex<<", solution="<<solution.getLabel()<<")");
+
+    bool isWrite = false;
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        isWrite = (*iter)->willWrite(t, tindex, solution) || isWrite;
+    } // for
+
+    PYLITH_METHOD_RETURN(isWrite);
+} // willWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Discard data in observers that depends on the distribution of the mesh among processes.
+void
+pylith::problems::ObserversPhysics::resetDistribution(PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("resetDistribution(sfMigration="<<sfMigration<<")");
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->resetDistribution(sfMigration);
+    } // for
+
+    PYLITH_METHOD_END;
+} // resetDistribution
+
+
 // ------------------------------------------------------------------------------------------------
 // Notify observers.
 void
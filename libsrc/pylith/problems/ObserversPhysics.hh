@@ -16,6 +16,7 @@
 #include "pylith/problems/ObserverPhysics.hh" // USES ObserverPhysics
 #include "pylith/feassemble/feassemblefwd.hh" // USES PhysicsImplementation
 #include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/petscfwd.h" // USES PetscSF
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
 #include <set> // USES std::set
@@ -73,6 +74,24 @@ public:
      */
     void verifyObservers(const pylith::topology::Field& solution) const;
 
+    /** Check whether any observer will write output at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if at least one observer will write output at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex,
+                   const pylith::topology::Field& solution);
+
+    /** Discard data in observers that depends on the distribution of the mesh among processes.
+     *
+     * @param[in] sfMigration PETSc SF from points of the previous mesh to points of the
+     *   redistributed mesh.
+     */
+    void resetDistribution(PetscSF sfMigration);
+
     /** Send observers an update.
      *
      * @param[in] t Current time.
@@ -30,6 +30,7 @@ pylith::problems::Physics::Physics(void) :
     _normalizer(NULL),
     _labelName(pylith::topology::Mesh::cells_label_name),
     _labelValue(1),
+    _cacheCellGeometry(true),
     _observers(new pylith::problems::ObserversPhysics) {}
 
 
@@ -125,6 +126,24 @@ pylith::problems::Physics::setFormulation(const FormulationEnum value) {
 } // setFormulation
 
 
+// ------------------------------------------------------------------------------------------------
+// Set flag for caching cell geometry at quadrature points.
+void
+pylith::problems::Physics::setCacheCellGeometry(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setCacheCellGeometry(value="<<value<<")");
+
+    _cacheCellGeometry = value;
+} // setCacheCellGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Get flag for caching cell geometry at quadrature points.
+bool
+pylith::problems::Physics::getCacheCellGeometry(void) const {
+    return _cacheCellGeometry;
+} // getCacheCellGeometry
+
+
 // ------------------------------------------------------------------------------------------------
 // Set database for auxiliary field.
 void
@@ -139,6 +158,21 @@ pylith::problems::Physics::setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB
 } // setAuxiliaryFieldDB
 
 
+// ------------------------------------------------------------------------------------------------
+// Set cache for auxiliary field values from spatial databases.
+void
+pylith::problems::Physics::setAuxiliaryFieldCache(const char* directory,
+                                                  const char* signature) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setAuxiliaryFieldCache(directory="<<directory<<", signature="<<signature<<")");
+
+    pylith::feassemble::AuxiliaryFactory* factory = _getAuxiliaryFactory();assert(factory);
+    factory->setCache(directory, getIdentifier(), signature);
+
+    PYLITH_METHOD_END;
+} // setAuxiliaryFieldCache
+
+
 // ------------------------------------------------------------------------------------------------
 // Set discretization information for auxiliary subfield.
 void
@@ -32,10 +32,13 @@
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 
 #include "pylith/utils/EventLogger.hh" // HASA EventLogger
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
+#include <algorithm> // USES std::min()
 #include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
 #include <typeinfo> // USES typeid()
 
 // ------------------------------------------------------------------------------------------------
@@ -122,6 +125,7 @@ pylith::problems::Problem::Problem() :
     _integrationData(new pylith::feassemble::IntegrationData),
     _normalizer(NULL),
     _gravityField(NULL),
+    _integratorTimeStart(0.0),
     _observers(new pylith::problems::ObserversSoln),
     _formulation(pylith::problems::Physics::QUASISTATIC),
     _solverType(LINEAR),
@@ -376,6 +380,8 @@ pylith::problems::Problem::preinitialize(const pylith::topology::Mesh& mesh) {
 
     assert(_normalizer);
 
+    pylith::utils::MemoryRegistry::add(&mesh, "mesh", "domain", pylith::utils::MemoryRegistry::dmBytes(mesh.getDM()));
+
     const size_t numMaterials = _materials.size();
     for (size_t i = 0; i < numMaterials; ++i) {
         assert(_materials[i]);
@@ -458,28 +464,120 @@ pylith::problems::Problem::initialize(void) {
     pylith::topology::Field* solution = _integrationData->getField("solution");
     assert(solution);
 
-    // Initialize solution field.
     pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
-    PetscErrorCode err = DMSetFromOptions(solution->getDM());PYLITH_CHECK_ERROR(err);
-    _setupSolution();
-    pylith::topology::CoordsVisitor::optimizeClosure(solution->getDM());
+    _setupDiscretization();
 
-    // Initialize integrators.
-    _createIntegrators();
+    // Register logging event for each integrator.
     const size_t numIntegrators = _integrators.size();
+    _integratorEvents.resize(numIntegrators);
+    _integratorTimes.assign(numIntegrators, 0.0);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        std::ostringstream eventName;
+        eventName << "PL:Problem:integrator[" << _integrators[i]->getLabelName() << "=" << _integrators[i]->getLabelValue() << "]";
+        _integratorEvents[i] = _Problem::Events::logger.registerEvent(eventName.str().c_str());
+    } // for
+
+    pythia::journal::debug_t debug(PyreComponent::getName());
+    if (debug.state()) {
+        PYLITH_COMPONENT_DEBUG("Displaying solution field layout");
+        solution->view("Solution field", pylith::topology::Field::VIEW_LAYOUT);
+    } // if
+
+    _Problem::Events::logger.eventEnd(_Problem::Events::initialize);
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Get time spent in integrators for cells with given label value.
+PylithReal
+pylith::problems::Problem::getIntegratorTime(const int labelValue) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::getIntegratorTime(labelValue="<<labelValue<<")");
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField("solution");
+    assert(solution);
+
+    PylithReal timeLocal = 0.0;
+    const size_t numIntegrators = std::min(_integrators.size(), _integratorTimes.size());
     for (size_t i = 0; i < numIntegrators; ++i) {
         assert(_integrators[i]);
-        _integrators[i]->initialize(*solution);
+        if ((std::string(pylith::topology::Mesh::cells_label_name) == _integrators[i]->getLabelName()) &&
+            (labelValue == _integrators[i]->getLabelValue())) {
+            timeLocal += _integratorTimes[i];
+        } // if
     } // for
 
-    // Initialize constraints.
+    PylithReal time = 0.0;
+    PetscErrorCode err = MPI_Allreduce(&timeLocal, &time, 1, MPIU_REAL, MPI_SUM, solution->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(time);
+} // getIntegratorTime
+
+
+// ------------------------------------------------------------------------------------------------
+// Start logging event for integrator.
+void
+pylith::problems::Problem::_integratorEventBegin(const size_t index) {
+    assert(index < _integratorEvents.size());
+    _Problem::Events::logger.eventBegin(_integratorEvents[index]);
+
+    PetscLogDouble time = 0.0;
+    PetscTime(&time);
+    _integratorTimeStart = time;
+} // _integratorEventBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// End logging event for integrator.
+void
+pylith::problems::Problem::_integratorEventEnd(const size_t index) {
+    assert(index < _integratorEvents.size());
+    PetscLogDouble time = 0.0;
+    PetscTime(&time);
+    _integratorTimes[index] += time - _integratorTimeStart;
+
+    _Problem::Events::logger.eventEnd(_integratorEvents[index]);
+} // _integratorEventEnd
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup solution field, integrators, and constraints for the current mesh.
+void
+pylith::problems::Problem::_setupDiscretization(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_setupDiscretization()");
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField("solution");
+    assert(solution);
+
+    // Initialize solution field.
+    PetscErrorCode err = DMSetFromOptions(solution->getDM());PYLITH_CHECK_ERROR(err);
+    _setupSolution();
+    pylith::topology::CoordsVisitor::optimizeClosure(solution->getDM());
+
+    // Initialize constraints before the integrators, because the integrators use the essential
+    // boundary conditions to split the cells for overlapping the residual with the solution scatter.
     _createConstraints();
     const size_t numConstraints = _constraints.size();
     for (size_t i = 0; i < numConstraints; ++i) {
         assert(_constraints[i]);
+        pylith::utils::MemoryRegistry::OwnerScope owner(_constraints[i]->getPhysicsIdentifier());
         _constraints[i]->initialize(*solution);
     } // for
 
+    // Initialize integrators.
+    _createIntegrators();
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        pylith::utils::MemoryRegistry::OwnerScope owner(_integrators[i]->getPhysicsIdentifier());
+        _integrators[i]->initialize(*solution);
+    } // for
+
+    solution->createCoarseDiscretization();
     solution->allocate();
     solution->createGlobalVector();
     solution->createOutputVector();
@@ -496,15 +594,8 @@ pylith::problems::Problem::initialize(void) {
     } // switch
     _Problem::setInterfaceData(solution, _integrators);
 
-    pythia::journal::debug_t debug(PyreComponent::getName());
-    if (debug.state()) {
-        PYLITH_COMPONENT_DEBUG("Displaying solution field layout");
-        solution->view("Solution field", pylith::topology::Field::VIEW_LAYOUT);
-    } // if
-
-    _Problem::Events::logger.eventEnd(_Problem::Events::initialize);
     PYLITH_METHOD_END;
-} // initialize
+} // _setupDiscretization
 
 
 // ------------------------------------------------------------------------------------------------
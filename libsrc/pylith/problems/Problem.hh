@@ -173,6 +173,38 @@ public:
     virtual
     void initialize(void);
 
+    /** Get time spent in integrators for cells with given value of the label identifying materials
+     * and interfaces.
+     *
+     * The time includes computing residuals, Jacobians, and updates at the end of time steps and is
+     * summed over all processes.
+     *
+     * @param[in] labelValue Value of label identifying materials and interfaces.
+     * @returns Elapsed time in seconds.
+     */
+    PylithReal getIntegratorTime(const int labelValue) const;
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Start logging event for integrator.
+     *
+     * @param[in] index Index of integrator.
+     */
+    void _integratorEventBegin(const size_t index);
+
+    /** End logging event for integrator.
+     *
+     * @param[in] index Index of integrator.
+     */
+    void _integratorEventEnd(const size_t index);
+
+    /** Setup solution field, integrators, and constraints for the current mesh.
+     *
+     * Creates and initializes the integrators and constraints and allocates the solution field.
+     */
+    void _setupDiscretization(void);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -186,6 +218,9 @@ protected:
     std::vector<pylith::faults::FaultCohesive*> _interfaces; ///< Array of interior interfaces.
 
     std::vector<pylith::feassemble::Integrator*> _integrators; ///< Array of integrators.
+    std::vector<int> _integratorEvents; ///< Logging events for integrators.
+    std::vector<PylithReal> _integratorTimes; ///< Time spent in each integrator.
+    PylithReal _integratorTimeStart; ///< Start time of current integrator event.
     std::vector<pylith::feassemble::Constraint*> _constraints; ///< Array of constraints.
     pylith::problems::ObserversSoln* _observers; ///< Subscribers of solution updates.
 
@@ -15,14 +15,22 @@
 #include "pylith/feassemble/IntegrationData.hh" // HOLDSA IntegrationData
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/topology/PartitionCostModel.hh" // USES PartitionCostModel
+#include "pylith/materials/Material.hh" // USES Material
+#include "pylith/bc/BoundaryCondition.hh" // USES BoundaryCondition
+#include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
 #include "pylith/faults/FaultOps.hh" // USES FaultOps
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/feassemble/Constraint.hh" // USES Constraint
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
 #include "pylith/problems/InitialCondition.hh" // USES InitialCondition
 #include "pylith/problems/ProgressMonitorTime.hh" // USES ProgressMonitorTime
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -30,6 +38,7 @@
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include <algorithm> // USES std::max()
 #include <cassert> // USES assert()
 #include <iostream> // USES std::cout in debugging
 
@@ -59,6 +68,7 @@ public:
                 static PylithInt computeLHSJacobian;
                 static PylithInt computeLHSJacobianLumpedInv;
                 static PylithInt setState;
+                static PylithInt rebalance;
             };
 
         };
@@ -75,6 +85,7 @@ public:
         PylithInt _TimeDependent::Events::computeLHSJacobian;
         PylithInt _TimeDependent::Events::computeLHSJacobianLumpedInv;
         PylithInt _TimeDependent::Events::setState;
+        PylithInt _TimeDependent::Events::rebalance;
     } // problems
 } // pylith
 
@@ -93,6 +104,7 @@ pylith::problems::_TimeDependent::Events::init(void) {
     computeLHSJacobian = logger.registerEvent("PL:TimeDependent:computeLHSJacobian");
     computeLHSJacobianLumpedInv = logger.registerEvent("PL:TimeDependent:computeLHSJacobianLumpedInv");
     setState = logger.registerEvent("PL:TimeDependent:setState");
+    rebalance = logger.registerEvent("PL:TimeDependent:rebalance");
 } // init
 
 
@@ -105,6 +117,14 @@ pylith::problems::TimeDependent::TimeDependent(void) :
     _maxTimeSteps(0),
     _ts(NULL),
     _monitor(NULL),
+    _mesh(NULL),
+    _partitionerName("parmetis"),
+    _loadImbalanceThreshold(0.0),
+    _loadImbalanceInterval(10),
+    _maxLoadImbalance(1.0),
+    _integratorTimeCheck(0.0),
+    _numRebalances(0),
+    _needRebalance(false),
     _needNewLHSJacobian(true),
     _haveNewLHSJacobian(false),
     _shouldNotifyIC(false) {
@@ -134,8 +154,16 @@ pylith::problems::TimeDependent::deallocate(void) {
     Problem::deallocate();
 
     _monitor = NULL; // Memory handle in Python. :TODO: Use shared pointer.
-
-    PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);
+    _mesh = NULL; // Memory handle in Python. :TODO: Use shared pointer.
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    if (_ts) {
+        PetscMat jacobianMat = NULL, precondMat = NULL;
+        err = TSGetIJacobian(_ts, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+        pylith::utils::MemoryRegistry::remove(jacobianMat);
+        pylith::utils::MemoryRegistry::remove(precondMat);
+    } // if
+    err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -264,6 +292,102 @@ pylith::problems::TimeDependent::setShouldNotifyIC(const bool value) {
 } // setShouldNotifyIC
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set threshold for repartitioning the mesh due to load imbalance.
+void
+pylith::problems::TimeDependent::setLoadImbalanceThreshold(const double value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setLoadImbalanceThreshold(value="<<value<<")");
+
+    if ((value != 0.0) && (value < 1.0)) {
+        std::ostringstream msg;
+        msg << "Threshold for load imbalance (" << value << ") must be 0 (disabled) or greater than or equal to 1.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _loadImbalanceThreshold = value;
+
+    PYLITH_METHOD_END;
+} // setLoadImbalanceThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get threshold for repartitioning the mesh due to load imbalance.
+double
+pylith::problems::TimeDependent::getLoadImbalanceThreshold(void) const {
+    return _loadImbalanceThreshold;
+} // getLoadImbalanceThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of time steps between checks of the load balance.
+void
+pylith::problems::TimeDependent::setLoadImbalanceInterval(const size_t value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setLoadImbalanceInterval(value="<<value<<")");
+
+    if (value <= 0) {
+        std::ostringstream msg;
+        msg << "Number of time steps between checks of load balance (" << value << ") must be positive.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _loadImbalanceInterval = value;
+
+    PYLITH_METHOD_END;
+} // setLoadImbalanceInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of time steps between checks of the load balance.
+size_t
+pylith::problems::TimeDependent::getLoadImbalanceInterval(void) const {
+    return _loadImbalanceInterval;
+} // getLoadImbalanceInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get largest load imbalance measured during the simulation.
+double
+pylith::problems::TimeDependent::getMaxLoadImbalance(void) const {
+    return _maxLoadImbalance;
+} // getMaxLoadImbalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Does the load imbalance exceed the threshold?
+bool
+pylith::problems::TimeDependent::exceededLoadImbalance(void) const {
+    return (_loadImbalanceThreshold > 0.0) && (_maxLoadImbalance > _loadImbalanceThreshold);
+} // exceededLoadImbalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of times the mesh was repartitioned during the simulation.
+size_t
+pylith::problems::TimeDependent::getNumRebalances(void) const {
+    return _numRebalances;
+} // getNumRebalances
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set finite-element mesh that is repartitioned when the load imbalance exceeds the threshold.
+void
+pylith::problems::TimeDependent::setMesh(pylith::topology::Mesh* mesh) {
+    PYLITH_COMPONENT_DEBUG("setMesh(mesh="<<mesh<<")");
+
+    _mesh = mesh;
+} // setMesh
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of PETSc partitioner used to repartition the mesh.
+void
+pylith::problems::TimeDependent::setPartitioner(const char* value) {
+    PYLITH_COMPONENT_DEBUG("setPartitioner(value="<<value<<")");
+
+    _partitionerName = value;
+} // setPartitioner
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set progress monitor.
 void
@@ -398,19 +522,15 @@ pylith::problems::TimeDependent::initialize(void) {
     assert(_observers);
     _observers->setTimeScale(timeScale);
 
-    PYLITH_COMPONENT_DEBUG("Setting up time derivative of solution and residual fields.");
-    pylith::topology::Field* solutionDot = new pylith::topology::Field(*solution);assert(solutionDot);
-    solutionDot->setLabel("solutionDot");
-    _integrationData->setField(pylith::feassemble::IntegrationData::solution_dot, solutionDot);
-
-    // Initialize residual.
-    pylith::topology::Field* residual = new pylith::topology::Field(*solution);assert(residual);
-    residual->setLabel("residual");
-    _integrationData->setField(pylith::feassemble::IntegrationData::residual, residual);
+    _createWorkFields();
 
     // Set callbacks.
     PYLITH_COMPONENT_DEBUG("Setting PetscTS callback for poststep().");
     err = TSSetPostStep(_ts, poststep);PYLITH_CHECK_ERROR(err);
+    if ((_loadImbalanceThreshold > 0.0) && _mesh) {
+        PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks for repartitioning mesh.");
+        err = TSSetResize(_ts, PETSC_FALSE, resizeSetup, resizeTransfer, (void*)this);PYLITH_CHECK_ERROR(err);
+    } // if
 
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC:
@@ -423,16 +543,9 @@ pylith::problems::TimeDependent::initialize(void) {
         err = TSSetIFunction(_ts, NULL, computeLHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
         err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
         err = TSSetEquationType(_ts, TS_EQ_EXPLICIT);PYLITH_CHECK_ERROR(err);
-        pylith::faults::FaultOps::createDAEMassWeighting(_integrationData);
     case pylith::problems::Physics::DYNAMIC: {
         PYLITH_COMPONENT_DEBUG("Setting PetscTS callback for computeRHSFunction().");
         err = TSSetRHSFunction(_ts, NULL, computeRHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-
-        PYLITH_COMPONENT_DEBUG("Setting up field for inverse of lumped LHS Jacobian.");
-        pylith::topology::Field* jacobianLHSLumpedInv = new pylith::topology::Field(*solution);assert(jacobianLHSLumpedInv);
-        jacobianLHSLumpedInv->setLabel("JacobianLHS_lumped_inverse");
-        jacobianLHSLumpedInv->createGlobalVector();
-        _integrationData->setField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse, jacobianLHSLumpedInv);
         break;
     }
     default: {
@@ -514,12 +627,16 @@ pylith::problems::TimeDependent::poststep(void) {
     assert(_integrationData);
     pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
     solution->scatterVectorToLocal(solutionVec);
-    solution->scatterLocalToOutput();
+    if (_observersWillWrite(t, tindex, *solution)) {
+        solution->scatterLocalToOutput();
+    } // if
 
     // Update integrators.
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
         _integrators[i]->poststep(t, tindex, dt, *solution, notification);
+        _integratorEventEnd(i);
     } // for
 
     // Update constraints.
@@ -532,6 +649,10 @@ pylith::problems::TimeDependent::poststep(void) {
     assert(_observers);
     _observers->notifyObservers(t, tindex, *solution, notification);
 
+    if ((_loadImbalanceThreshold > 0.0) && (tindex > 0) && (0 == tindex % _loadImbalanceInterval)) {
+        _checkLoadBalance(tindex, solution->getMesh().getComm());
+    } // if
+
     if (_monitor) {
         assert(_normalizer);
         const PylithReal timeScale = _normalizer->getTimeScale();
@@ -551,25 +672,10 @@ pylith::problems::TimeDependent::setSolutionLocal(const PylithReal t,
                                                   PetscVec solutionDotVec) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("setSolutionLocal(t="<<t<<", solutionVec="<<solutionVec<<")");
-    _TimeDependent::Events::logger.eventBegin(_TimeDependent::Events::setSolutionLocal);
-    assert(_integrationData);
-
-    // Update PyLith view of the solution and its time derivative.
-    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
-    solution->scatterVectorToLocal(solutionVec);
 
-    if (solutionDotVec) {
-        pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);assert(solution);
-        solutionDot->scatterVectorToLocal(solutionDotVec);
-    } // if
+    _setSolutionLocalBegin(solutionVec, solutionDotVec);
+    _setSolutionLocalEnd(t, solutionVec, solutionDotVec);
 
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
-    const size_t numConstraints = _constraints.size();
-    for (size_t i = 0; i < numConstraints; ++i) {
-        _constraints[i]->setSolution(_integrationData);
-    } // for
-
-    _TimeDependent::Events::logger.eventEnd(_TimeDependent::Events::setSolutionLocal);
     PYLITH_METHOD_END;
 } // setSolutionLocal
 
@@ -592,25 +698,34 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscVec residualVec,
     if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::t_state)) { _setState(t); }
     _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, t);
 
-    // Update PyLith view of the solution.
-    const PetscVec solutionDotVec = NULL;
-    setSolutionLocal(t, solutionVec, solutionDotVec);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
-    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
-
     const bool hasLumpedJacobianInverse = _integrationData->hasField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);
     if (hasLumpedJacobianInverse) {
         const PylithReal s_tshift = 1.0; // Keep shift terms on LHS, so use 1.0 for terms moved to RHS.
         computeLHSJacobianLumpedInv(t, dt, s_tshift, solutionVec);
     } // if
 
+    // Update PyLith view of the solution. Residual contributions from interior cells are computed
+    // while the ghost values are communicated; see _setSolutionLocalBegin() for the requirements.
+    const PetscVec solutionDotVec = NULL;
+    _setSolutionLocalBegin(solutionVec, solutionDotVec);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
+
     // Sum residual contributions across integrators.
     pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
     residual->zeroLocal();
     const size_t numIntegrators = _integrators.size();
     assert(numIntegrators > 0); // must have at least 1 integrator
     for (size_t i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeRHSResidual(residual, *_integrationData);
+        _integratorEventBegin(i);
+        _integrators[i]->computeRHSResidualCells(residual, *_integrationData, pylith::feassemble::Integrator::INTERIOR_CELLS);
+        _integratorEventEnd(i);
+    } // for
+    _setSolutionLocalEnd(t, solutionVec, solutionDotVec);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
+        _integrators[i]->computeRHSResidualCells(residual, *_integrationData, pylith::feassemble::Integrator::GHOSTED_CELLS);
+        _integratorEventEnd(i);
     } // for
 
     // Assemble residual values across processes.
@@ -655,8 +770,9 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
 
     if (t != _integrationData->getScalar(pylith::feassemble::IntegrationData::t_state)) { _setState(t); }
 
-    // Update PyLith view of the solution.
-    setSolutionLocal(t, solutionVec, solutionDotVec);
+    // Update PyLith view of the solution. Residual contributions from interior cells are computed
+    // while the ghost values are communicated; see _setSolutionLocalBegin() for the requirements.
+    _setSolutionLocalBegin(solutionVec, solutionDotVec);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
 
@@ -666,7 +782,15 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
     const int numIntegrators = _integrators.size();
     assert(numIntegrators > 0); // must have at least 1 integrator
     for (int i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeLHSResidual(residual, *_integrationData);
+        _integratorEventBegin(i);
+        _integrators[i]->computeLHSResidualCells(residual, *_integrationData, pylith::feassemble::Integrator::INTERIOR_CELLS);
+        _integratorEventEnd(i);
+    } // for
+    _setSolutionLocalEnd(t, solutionVec, solutionDotVec);
+    for (int i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
+        _integrators[i]->computeLHSResidualCells(residual, *_integrationData, pylith::feassemble::Integrator::GHOSTED_CELLS);
+        _integratorEventEnd(i);
     } // for
 
     // Assemble residual values across processes.
@@ -735,7 +859,9 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
     // Sum Jacobian contributions across integrators.
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
         _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, *_integrationData);
+        _integratorEventEnd(i);
     } // for
 
     _needNewLHSJacobian = false;
@@ -751,6 +877,11 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
     err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
     err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
 
+    if (jacobianMat != precondMat) {
+        pylith::utils::MemoryRegistry::add(jacobianMat, "matrix", "jacobian", pylith::utils::MemoryRegistry::matrixBytes(jacobianMat));
+    } // if
+    pylith::utils::MemoryRegistry::add(precondMat, "matrix", "preconditioner", pylith::utils::MemoryRegistry::matrixBytes(precondMat));
+
     _TimeDependent::Events::logger.eventEnd(_TimeDependent::Events::computeLHSJacobian);
     PYLITH_METHOD_END;
 } // computeLHSJacobian
@@ -797,7 +928,9 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
 
     // Sum Jacobian contributions across integrators.
     for (size_t i = 0; i < numIntegrators; ++i) {
+        _integratorEventBegin(i);
         _integrators[i]->computeLHSJacobianLumpedInv(jacobianLumpedInv, *_integrationData);
+        _integratorEventEnd(i);
     } // for
 
     // Insert values into global vector.
@@ -906,6 +1039,79 @@ pylith::problems::TimeDependent::poststep(PetscTS ts) {
 } // poststep
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for checking whether to repartition the mesh.
+PetscErrorCode
+pylith::problems::TimeDependent::resizeSetup(PetscTS ts,
+                                             PetscInt tindex,
+                                             PetscReal t,
+                                             PetscVec solutionVec,
+                                             PetscBool* resize,
+                                             void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "resizeSetup(ts="<<ts<<", tindex="<<tindex<<", t="<<t<<", solutionVec="<<solutionVec<<", resize="<<resize<<", context="<<context<<")" << pythia::journal::endl;
+
+    TimeDependent* problem = (TimeDependent*)context;assert(problem);
+    assert(resize);
+    *resize = PETSC_FALSE;
+    if (!problem->_needRebalance) {
+        PYLITH_METHOD_RETURN(0);
+    } // if
+
+    // PETSc checks whether to resize after the final time step, so skip repartitioning there.
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt maxSteps = 0;
+    PetscReal maxTime = 0.0;
+    err = TSGetMaxSteps(ts, &maxSteps);PYLITH_CHECK_ERROR(err);
+    err = TSGetMaxTime(ts, &maxTime);PYLITH_CHECK_ERROR(err);
+    if ((tindex >= maxSteps) || (t >= maxTime)) {
+        problem->_needRebalance = false;
+        PYLITH_METHOD_RETURN(0);
+    } // if
+
+    // We cannot migrate a multigrid hierarchy, so the mesh keeps its current distribution.
+    assert(problem->_integrationData);
+    const pylith::topology::Field* solution = problem->_integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(solution->getDM(), &dmCoarse);PYLITH_CHECK_ERROR(err);
+    if (dmCoarse) {
+        pythia::journal::info_t info(_TimeDependent::pyreComponent);
+        if (0 == solution->getMesh().getCommRank()) {
+            info << pythia::journal::at(__HERE__)
+                 << "Skipping repartitioning of mesh, because the solution has a multigrid hierarchy." << pythia::journal::endl;
+        } // if
+        problem->_needRebalance = false;
+        PYLITH_METHOD_RETURN(0);
+    } // if
+
+    *resize = PETSC_TRUE;
+
+    PYLITH_METHOD_RETURN(0);
+} // resizeSetup
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for repartitioning the mesh and migrating vectors of the time stepper.
+PetscErrorCode
+pylith::problems::TimeDependent::resizeTransfer(PetscTS ts,
+                                                PetscInt numVectors,
+                                                PetscVec vectorsPrev[],
+                                                PetscVec vectorsNew[],
+                                                void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "resizeTransfer(ts="<<ts<<", numVectors="<<numVectors<<", vectorsPrev="<<vectorsPrev<<", vectorsNew="<<vectorsNew<<", context="<<context<<")" << pythia::journal::endl;
+
+    TimeDependent* problem = (TimeDependent*)context;assert(problem);
+    problem->_rebalance(numVectors, vectorsPrev, vectorsNew);
+
+    PYLITH_METHOD_RETURN(0);
+} // resizeTransfer
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Check whether we need to reform the Jacobian.
 bool
@@ -955,6 +1161,103 @@ pylith::problems::TimeDependent::_setState(const PylithReal t) {
 } // _setState
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Begin updating local view of solution.
+//
+// Residual contributions from interior cells are computed between _setSolutionLocalBegin() and
+// _setSolutionLocalEnd(). This is correct only if:
+//
+//   1. Interior cells have no ghost points (leaves of the point SF) in their closure, so they do
+//      not use values received from other processes.
+//   2. The values at points owned by this process are in the local view when the scatter begins.
+//      Field::scatterVectorToLocalBegin() copies them from the global vector, because whether the
+//      on-process part of the scatter is done in PetscSFBcastBegin() depends on the PetscSF type.
+//   3. Interior cells have no constrained degrees of freedom in their closure, because the
+//      constraints read the local view of the solution and are set after the scatter completes.
+//   4. Nothing writes to the local view of the solution while the scatter is in progress.
+//
+// DSLabelAccess::splitGhostedCells() enforces 1 and 3.
+void
+pylith::problems::TimeDependent::_setSolutionLocalBegin(PetscVec solutionVec,
+                                                        PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setSolutionLocalBegin(solutionVec="<<solutionVec<<")");
+    _TimeDependent::Events::logger.eventBegin(_TimeDependent::Events::setSolutionLocal);
+    assert(_integrationData);
+
+    // Update PyLith view of the solution and its time derivative.
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    solution->scatterVectorToLocalBegin(solutionVec);
+
+    if (solutionDotVec) {
+        pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);assert(solutionDot);
+        solutionDot->scatterVectorToLocalBegin(solutionDotVec);
+    } // if
+
+    _TimeDependent::Events::logger.eventEnd(_TimeDependent::Events::setSolutionLocal);
+    PYLITH_METHOD_END;
+} // _setSolutionLocalBegin
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Finish updating local view of solution and set constrained values (Dirichlet BC).
+void
+pylith::problems::TimeDependent::_setSolutionLocalEnd(const PylithReal t,
+                                                      PetscVec solutionVec,
+                                                      PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setSolutionLocalEnd(t="<<t<<", solutionVec="<<solutionVec<<")");
+    _TimeDependent::Events::logger.eventBegin(_TimeDependent::Events::setSolutionLocal);
+    assert(_integrationData);
+
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    solution->scatterVectorToLocalEnd(solutionVec);
+
+    if (solutionDotVec) {
+        pylith::topology::Field* solutionDot = _integrationData->getField(pylith::feassemble::IntegrationData::solution_dot);assert(solutionDot);
+        solutionDot->scatterVectorToLocalEnd(solutionDotVec);
+    } // if
+
+    // Constraints read the local view of the solution, so set them after the scatter completes.
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->setSolution(_integrationData);
+    } // for
+
+    _TimeDependent::Events::logger.eventEnd(_TimeDependent::Events::setSolutionLocal);
+    PYLITH_METHOD_END;
+} // _setSolutionLocalEnd
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether any observer of the problem, integrators, or constraints will write output at time t.
+bool
+pylith::problems::TimeDependent::_observersWillWrite(const PylithReal t,
+                                                     const PylithInt tindex,
+                                                     const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    // Query all observers so that each trigger is evaluated once for this time step.
+    assert(_observers);
+    bool isWrite = _observers->willWrite(t, tindex, solution);
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        isWrite = _integrators[i]->observersWillWrite(t, tindex, solution) || isWrite;
+    } // for
+
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        assert(_constraints[i]);
+        isWrite = _constraints[i]->observersWillWrite(t, tindex, solution) || isWrite;
+    } // for
+
+    PYLITH_METHOD_RETURN(isWrite);
+} // _observersWillWrite
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Notify observers with solution corresponding to initial conditions.
 void
@@ -988,4 +1291,241 @@ pylith::problems::TimeDependent::_notifyObserversInitialSoln(void) {
 } // _notifyObserversInitialSoln
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check load balance using time spent in integrators since previous check.
+void
+pylith::problems::TimeDependent::_checkLoadBalance(const PylithInt tindex,
+                                                   MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_checkLoadBalance(tindex="<<tindex<<", comm)");
+
+    PylithReal integratorTime = 0.0;
+    for (size_t i = 0; i < _integratorTimes.size(); ++i) {
+        integratorTime += _integratorTimes[i];
+    } // for
+    PylithReal timeLocal = integratorTime - _integratorTimeCheck;
+    _integratorTimeCheck = integratorTime;
+
+    int commSize = 1;
+    PylithReal timeMax = 0.0, timeSum = 0.0;
+    PetscErrorCode err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&timeLocal, &timeMax, 1, MPIU_REAL, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&timeLocal, &timeSum, 1, MPIU_REAL, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    if (timeSum <= 0.0) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const double imbalance = timeMax * commSize / timeSum;
+    if (imbalance > _loadImbalanceThreshold) {
+        // Repartition before the next time step (see resizeSetup()).
+        _needRebalance = _mesh && (commSize > 1);
+        if (_needRebalance || (_maxLoadImbalance <= _loadImbalanceThreshold)) {
+            PYLITH_COMPONENT_INFO_ROOT("Load imbalance (" << imbalance << ") at time step " << tindex
+                                       << " exceeds threshold (" << _loadImbalanceThreshold << ").");
+        } // if
+    } // if
+    _maxLoadImbalance = std::max(_maxLoadImbalance, imbalance);
+
+    PYLITH_METHOD_END;
+} // _checkLoadBalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Repartition mesh and migrate fields to the new distribution of the mesh.
+void
+pylith::problems::TimeDependent::_rebalance(const PetscInt numVectors,
+                                            PetscVec vectorsPrev[],
+                                            PetscVec vectorsNew[]) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_rebalance(numVectors="<<numVectors<<", vectorsPrev="<<vectorsPrev<<", vectorsNew="<<vectorsNew<<")");
+    _TimeDependent::Events::logger.eventBegin(_TimeDependent::Events::rebalance);
+
+    assert(_mesh);
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+
+    // Weight cells by the time per cell spent in the integrators for each material and interface.
+    pylith::topology::PartitionCostModel costModel;
+    PylithReal costMin = 0.0;
+    std::vector<int> labelValues;
+    for (size_t i = 0; i < _materials.size(); ++i) {
+        assert(_materials[i]);
+        labelValues.push_back(_materials[i]->getLabelValue());
+    } // for
+    for (size_t i = 0; i < _interfaces.size(); ++i) {
+        assert(_interfaces[i]);
+        labelValues.push_back(_interfaces[i]->getCohesiveLabelValue());
+    } // for
+    for (size_t i = 0; i < labelValues.size(); ++i) {
+        const PylithInt numCells = pylith::topology::PartitionCostModel::getNumCells(*_mesh, labelValues[i]);
+        const PylithReal time = getIntegratorTime(labelValues[i]);
+        if ((numCells > 0) && (time > 0.0)) {
+            const PylithReal cost = time / numCells;
+            costModel.setCellCost(labelValues[i], cost);
+            costMin = (costMin > 0.0) ? std::min(costMin, cost) : cost;
+        } // if
+    } // for
+    costModel.setDefaultCost((costMin > 0.0) ? costMin : 1.0);
+    costModel.setWeights(_mesh);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscSF sfMigration = NULL;
+    pylith::faults::FaultCohesive** interfaces = (_interfaces.size() > 0) ? &_interfaces[0] : NULL;
+    pylith::topology::Distributor::redistribute(_mesh, &sfMigration, interfaces, int(_interfaces.size()),
+                                                _partitionerName.c_str());
+    if (!sfMigration) {
+        for (PetscInt i = 0; i < numVectors; ++i) {
+            err = VecDuplicate(vectorsPrev[i], &vectorsNew[i]);PYLITH_CHECK_ERROR(err);
+            err = VecCopy(vectorsPrev[i], vectorsNew[i]);PYLITH_CHECK_ERROR(err);
+        } // for
+        _needRebalance = false;
+        _TimeDependent::Events::logger.eventEnd(_TimeDependent::Events::rebalance);
+        PYLITH_METHOD_END;
+    } // if
+
+    // Keep the solution and the integrators (which hold the auxiliary fields with the state
+    // variables) for the previous distribution of the mesh until their values are migrated.
+    PetscDM dmSolnPrev = solution->getDM();
+    PetscVec solutionLocalPrev = solution->getLocalVector();
+    err = PetscObjectReference((PetscObject) dmSolnPrev);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectReference((PetscObject) solutionLocalPrev);PYLITH_CHECK_ERROR(err);
+    std::vector<pylith::feassemble::Integrator*> integratorsPrev = _integrators;
+    _integrators.clear();
+    for (size_t i = 0; i < _constraints.size(); ++i) {
+        delete _constraints[i];_constraints[i] = NULL;
+    } // for
+    _constraints.clear();
+
+    // Work fields share the layout of the solution, so we create them again after the solution.
+    _integrationData->removeField(pylith::feassemble::IntegrationData::solution_dot);
+    _integrationData->removeField(pylith::feassemble::IntegrationData::residual);
+    _integrationData->removeField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse);
+    _integrationData->removeField(pylith::feassemble::IntegrationData::dae_mass_weighting);
+
+    PetscMat jacobianMat = NULL, precondMat = NULL;
+    err = TSGetIJacobian(_ts, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    pylith::utils::MemoryRegistry::remove(jacobianMat);
+    pylith::utils::MemoryRegistry::remove(precondMat);
+
+    // Observers create their output subfields and meshes again when they next write output.
+    assert(_observers);
+    _observers->resetDistribution(sfMigration);
+    for (size_t i = 0; i < _materials.size(); ++i) {
+        if (_materials[i]->getObservers()) {
+            _materials[i]->getObservers()->resetDistribution(sfMigration);
+        } // if
+    } // for
+    for (size_t i = 0; i < _interfaces.size(); ++i) {
+        if (_interfaces[i]->getObservers()) {
+            _interfaces[i]->getObservers()->resetDistribution(sfMigration);
+        } // if
+    } // for
+    for (size_t i = 0; i < _bc.size(); ++i) {
+        if (_bc[i]->getObservers()) {
+            _bc[i]->getObservers()->resetDistribution(sfMigration);
+        } // if
+    } // for
+
+    // Set up the solution, integrators, and constraints for the redistributed mesh.
+    solution->setMesh(*_mesh);
+    _setupDiscretization();
+    pylith::topology::FieldOps::migrateLocalVector(solution->getLocalVector(), solution->getDM(),
+                                                   solutionLocalPrev, dmSolnPrev, sfMigration);
+
+    if (integratorsPrev.size() != _integrators.size()) {
+        PYLITH_COMPONENT_LOGICERROR("Number of integrators changed from "<<integratorsPrev.size()<<" to "
+                                    <<_integrators.size()<<" when repartitioning mesh.");
+    } // if
+    for (size_t i = 0; i < _integrators.size(); ++i) {
+        assert(_integrators[i]);
+        assert(integratorsPrev[i]);
+        const pylith::topology::Field* auxiliaryFieldPrev = integratorsPrev[i]->getAuxiliaryField();
+        const pylith::topology::Field* auxiliaryField = _integrators[i]->getAuxiliaryField();
+        if (auxiliaryField && auxiliaryFieldPrev) {
+            pylith::topology::FieldOps::migrateLocalVector(auxiliaryField->getLocalVector(), auxiliaryField->getDM(),
+                                                           auxiliaryFieldPrev->getLocalVector(), auxiliaryFieldPrev->getDM(),
+                                                           sfMigration);
+        } // if
+        delete integratorsPrev[i];integratorsPrev[i] = NULL;
+    } // for
+
+    _createWorkFields();
+
+    for (PetscInt i = 0; i < numVectors; ++i) {
+        err = DMCreateGlobalVector(solution->getDM(), &vectorsNew[i]);PYLITH_CHECK_ERROR(err);
+        pylith::topology::FieldOps::migrateGlobalVector(vectorsNew[i], solution->getDM(), vectorsPrev[i], dmSolnPrev, sfMigration);
+    } // for
+
+    // Solver data structures (Jacobian and preconditioner) are created again for the new layout.
+    err = TSSetDM(_ts, solution->getDM());PYLITH_CHECK_ERROR(err);
+    PetscSNES snes = NULL;
+    err = TSGetSNES(_ts, &snes);PYLITH_CHECK_ERROR(err);
+    err = SNESReset(snes);PYLITH_CHECK_ERROR(err);
+    _needNewLHSJacobian = true;
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, -HUGE_VAL);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_residual, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, -1.0);
+    _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_lumped_jacobian_inverse, -1.0);
+
+    // Measure the load balance of the new distribution from scratch.
+    _integratorTimes.assign(_integrators.size(), 0.0);
+    _integratorTimeCheck = 0.0;
+    _needRebalance = false;
+    ++_numRebalances;
+
+    pylith::utils::MemoryRegistry::add(_mesh, "mesh", "domain", pylith::utils::MemoryRegistry::dmBytes(_mesh->getDM()));
+    PYLITH_COMPONENT_INFO_ROOT("Repartitioned mesh using measured cost per cell (repartition " << _numRebalances << ").");
+
+    err = PetscSFDestroy(&sfMigration);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionLocalPrev);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmSolnPrev);PYLITH_CHECK_ERROR(err);
+
+    _TimeDependent::Events::logger.eventEnd(_TimeDependent::Events::rebalance);
+    PYLITH_METHOD_END;
+} // _rebalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create time derivative of solution, residual, and other work fields for integration.
+void
+pylith::problems::TimeDependent::_createWorkFields(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createWorkFields()");
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+
+    PYLITH_COMPONENT_DEBUG("Setting up time derivative of solution and residual fields.");
+    pylith::topology::Field* solutionDot = new pylith::topology::Field(*solution);assert(solutionDot);
+    solutionDot->setLabel("solutionDot");
+    _integrationData->setField(pylith::feassemble::IntegrationData::solution_dot, solutionDot);
+
+    // Initialize residual.
+    pylith::topology::Field* residual = new pylith::topology::Field(*solution);assert(residual);
+    residual->setLabel("residual");
+    _integrationData->setField(pylith::feassemble::IntegrationData::residual, residual);
+
+    switch (_formulation) {
+    case pylith::problems::Physics::QUASISTATIC:
+        break;
+    case pylith::problems::Physics::DYNAMIC_IMEX:
+        pylith::faults::FaultOps::createDAEMassWeighting(_integrationData);
+    case pylith::problems::Physics::DYNAMIC: {
+        PYLITH_COMPONENT_DEBUG("Setting up field for inverse of lumped LHS Jacobian.");
+        pylith::topology::Field* jacobianLHSLumpedInv = new pylith::topology::Field(*solution);assert(jacobianLHSLumpedInv);
+        jacobianLHSLumpedInv->setLabel("JacobianLHS_lumped_inverse");
+        jacobianLHSLumpedInv->createGlobalVector();
+        _integrationData->setField(pylith::feassemble::IntegrationData::lumped_jacobian_inverse, jacobianLHSLumpedInv);
+        break;
+    }
+    default: {
+        PYLITH_COMPONENT_LOGICERROR("Unknown time stepping formulation '" << _formulation << "'.");
+    } // default
+    } // switch
+
+    PYLITH_METHOD_END;
+} // _createWorkFields
+
+
 // End of file
@@ -12,6 +12,8 @@
 #include "pylith/problems/Problem.hh" // ISA Problem
 #include "pylith/testing/testingfwd.hh" // USES MMSTest
 
+#include <string> // HASA std::string
+
 class pylith::problems::TimeDependent : public pylith::problems::Problem {
     friend class TestTimeDependent; // unit testing
     friend class pylith::testing::MMSTest; // Testing with Method of Manufactured Solutions
@@ -92,6 +94,66 @@ public:
      */
     void setShouldNotifyIC(const bool value);
 
+    /** Set threshold for repartitioning the mesh due to load imbalance.
+     *
+     * The load imbalance is the ratio of the maximum to the average time spent in the integrators
+     * on each process since the previous check. A value of 0 disables monitoring the load balance.
+     * When the threshold is exceeded, the mesh is repartitioned using the measured cost per cell of
+     * each material and interface, if the mesh and partitioner have been set with setMesh() and
+     * setPartitioner().
+     *
+     * @param[in] value Threshold for load imbalance (0 or greater than or equal to 1).
+     */
+    void setLoadImbalanceThreshold(const double value);
+
+    /** Get threshold for repartitioning the mesh due to load imbalance.
+     *
+     * @returns Threshold for load imbalance.
+     */
+    double getLoadImbalanceThreshold(void) const;
+
+    /** Set number of time steps between checks of the load balance.
+     *
+     * @param[in] value Number of time steps.
+     */
+    void setLoadImbalanceInterval(const size_t value);
+
+    /** Get number of time steps between checks of the load balance.
+     *
+     * @returns Number of time steps.
+     */
+    size_t getLoadImbalanceInterval(void) const;
+
+    /** Get largest load imbalance measured during the simulation.
+     *
+     * @returns Ratio of maximum to average time spent in the integrators on each process.
+     */
+    double getMaxLoadImbalance(void) const;
+
+    /** Does the load imbalance exceed the threshold?
+     *
+     * @returns True if the load imbalance exceeded the threshold at least once, false otherwise.
+     */
+    bool exceededLoadImbalance(void) const;
+
+    /** Get number of times the mesh was repartitioned during the simulation.
+     *
+     * @returns Number of times the mesh was repartitioned.
+     */
+    size_t getNumRebalances(void) const;
+
+    /** Set finite-element mesh that is repartitioned when the load imbalance exceeds the threshold.
+     *
+     * @param[in] mesh Finite-element mesh.
+     */
+    void setMesh(pylith::topology::Mesh* mesh);
+
+    /** Set name of PETSc partitioner used to repartition the mesh.
+     *
+     * @param[in] value Name of PETSc partitioner.
+     */
+    void setPartitioner(const char* value);
+
     /** Set progress monitor.
      *
      * @param[in] monitor Progress monitor for time-dependent simulation.
@@ -254,6 +316,38 @@ public:
     static
     PetscErrorCode poststep(PetscTS ts);
 
+    /** Callback static method for checking whether to repartition the mesh.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] tindex Current time step.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec for solution.
+     * @param[out] resize True if the mesh should be repartitioned, false otherwise.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode resizeSetup(PetscTS ts,
+                               PetscInt tindex,
+                               PetscReal t,
+                               PetscVec solutionVec,
+                               PetscBool* resize,
+                               void* context);
+
+    /** Callback static method for repartitioning the mesh and migrating vectors of the time stepper.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] numVectors Number of vectors to migrate.
+     * @param[in] vectorsPrev Vectors for mesh before it is repartitioned.
+     * @param[out] vectorsNew Vectors for repartitioned mesh (created here, owned by PETSc).
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode resizeTransfer(PetscTS ts,
+                                  PetscInt numVectors,
+                                  PetscVec vectorsPrev[],
+                                  PetscVec vectorsNew[],
+                                  void* context);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -270,9 +364,68 @@ private:
      */
     void _setState(const PylithReal t);
 
+    /** Begin updating local view of solution.
+     *
+     * Values of the solution at ghost points and constrained values are not available until
+     * _setSolutionLocalEnd() is called. Values at points owned by this process are in the local
+     * view when this method returns, because Field::scatterVectorToLocalBegin() copies them
+     * explicitly instead of relying on the PetscSF implementation.
+     *
+     * @param[in] solutionVec PETSc Vec with current global view of solution.
+     * @param[in] solutionDotVec PETSc Vec with current global view of time derivative of the solution.
+     */
+    void _setSolutionLocalBegin(PetscVec solutionVec,
+                                PetscVec solutionDotVec);
+
+    /** Finish updating local view of solution and set constrained values (Dirichlet BC).
+     *
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec with current global view of solution.
+     * @param[in] solutionDotVec PETSc Vec with current global view of time derivative of the solution.
+     */
+    void _setSolutionLocalEnd(const PylithReal t,
+                              PetscVec solutionVec,
+                              PetscVec solutionDotVec);
+
     /// Notify observers with solution corresponding to initial conditions.
     void _notifyObserversInitialSoln(void);
 
+    /** Check whether any observer of the problem, integrators, or constraints will write output.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns True if at least one observer will write output at time t, false otherwise.
+     */
+    bool _observersWillWrite(const PylithReal t,
+                             const PylithInt tindex,
+                             const pylith::topology::Field& solution);
+
+    /** Check load balance using time spent in integrators since previous check.
+     *
+     * @param[in] tindex Current time step.
+     * @param[in] comm MPI communicator for mesh.
+     */
+    void _checkLoadBalance(const PylithInt tindex,
+                           MPI_Comm comm);
+
+    /** Repartition mesh and migrate fields to the new distribution of the mesh.
+     *
+     * Cells are weighted by the measured cost per cell of each material and interface. The
+     * solution and auxiliary fields (including state variables) are migrated to the repartitioned
+     * mesh; the integrators, constraints, and observers are set up again for the new mesh.
+     *
+     * @param[in] numVectors Number of vectors of time stepper to migrate.
+     * @param[in] vectorsPrev Vectors of time stepper for mesh before it is repartitioned.
+     * @param[out] vectorsNew Vectors of time stepper for repartitioned mesh.
+     */
+    void _rebalance(const PetscInt numVectors,
+                    PetscVec vectorsPrev[],
+                    PetscVec vectorsNew[]);
+
+    /// Create time derivative of solution, residual, and other work fields for integration.
+    void _createWorkFields(void);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -284,6 +437,15 @@ private:
     std::vector<pylith::problems::InitialCondition*> _ic; ///< Array of initial conditions.
     pylith::problems::ProgressMonitorTime* _monitor; ///< Monitor for simulation progress.
 
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh repartitioned when load is imbalanced.
+    std::string _partitionerName; ///< Name of PETSc partitioner for repartitioning mesh.
+    double _loadImbalanceThreshold; ///< Threshold for load imbalance (0 disables check).
+    size_t _loadImbalanceInterval; ///< Number of time steps between checks of load balance.
+    double _maxLoadImbalance; ///< Largest load imbalance measured.
+    PylithReal _integratorTimeCheck; ///< Total time spent in integrators at previous check.
+    size_t _numRebalances; ///< Number of times mesh was repartitioned.
+    bool _needRebalance; ///< True if mesh should be repartitioned before next time step.
+
     bool _needNewLHSJacobian; ///< True if need to recompute LHS Jacobian.
     bool _haveNewLHSJacobian; ///< True if LHS Jacobian was reformed.
     bool _shouldNotifyIC;
@@ -42,6 +42,8 @@ public:
              * @param[in] dmMesh PETSc DM for the current mesh.
              * @param[in] faults Array of fault interfaces.
              * @param[in] numFaults Number of fault interfaces.
+             * @param[out] sfMigration PETSc SF for migrating points to the overlap (NULL if not
+             *   needed or if there are no faults).
              *
              * @returns PETSc error code (0==success).
              */
@@ -49,7 +51,19 @@ public:
             PetscErrorCode distributeOverlap(PetscDM* dmOverlap,
                                              PetscDM dmMesh,
                                              pylith::faults::FaultCohesive* faults[],
-                                             const int numFaults);
+                                             const int numFaults,
+                                             PetscSF* sfMigration=NULL);
+
+            /** Set partitioner for mesh.
+             *
+             * @param[in] dmMesh PETSc DM for the mesh.
+             * @param[in] partitionerName Name of PETSc partitioner.
+             * @param[in] useVertexWeights Use vertex weights when partitioning (parmetis only).
+             */
+            static
+            void setPartitioner(PetscDM dmMesh,
+                                const char* partitionerName,
+                                const bool useVertexWeights);
 
         }; // _Distributor
     } // topology
@@ -87,14 +101,8 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
     } // if
 
     PetscErrorCode err = 0;
-    PetscPartitioner partitioner = 0;
     PetscDM dmOrig = origMesh.getDM();assert(dmOrig);
-    err = DMPlexGetPartitioner(dmOrig, &partitioner);PYLITH_CHECK_ERROR(err);
-    err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
-    if ((std::string(partitionerName) == std::string("parmetis")) && useEdgeWeighting) {
-        err = PetscOptionsSetValue(NULL, "-petscpartitioner_use_vertex_weights", "true");PYLITH_CHECK_ERROR(err);
-        err = PetscPartitionerSetFromOptions(partitioner);PYLITH_CHECK_ERROR(err);
-    } // if
+    _Distributor::setPartitioner(dmOrig, partitionerName, useEdgeWeighting);
 
     if (0 == commRank) {
         info << pythia::journal::at(__HERE__)
@@ -107,6 +115,7 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
     err = _Distributor::distributeOverlap(&dmNew, dmTmp, faults, numFaults);PYLITH_CHECK_ERROR(err);
     err = DMDestroy(&dmTmp);PYLITH_CHECK_ERROR(err);
     err = DMPlexDistributeSetDefault(dmNew, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMSetLocalSection(dmNew, NULL);PYLITH_CHECK_ERROR(err); // Discard partition weights, if any.
     err = DMPlexReorderCohesiveSupports(dmNew);PYLITH_CHECK_ERROR(err);
     err = DMViewFromOptions(dmNew, NULL, "-pylith_dist_dm_view");PYLITH_CHECK_ERROR(err);
     newMesh->setDM(dmNew);
@@ -115,6 +124,65 @@ pylith::topology::Distributor::distribute(pylith::topology::Mesh* const newMesh,
 } // distribute
 
 
+// ------------------------------------------------------------------------------------------------
+// Redistribute mesh among processors.
+void
+pylith::topology::Distributor::redistribute(pylith::topology::Mesh* const mesh,
+                                            PetscSF* sfMigration,
+                                            pylith::faults::FaultCohesive* faults[],
+                                            const int numFaults,
+                                            const char* partitionerName) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::info_t info("mesh_distributor");
+
+    assert(mesh);
+    assert(sfMigration);
+
+    const int commRank = mesh->getCommRank();
+    if (0 == commRank) {
+        info << pythia::journal::at(__HERE__)
+             << "Repartitioning mesh using PETSc '" << partitionerName << "' partitioner." << pythia::journal::endl;
+    } // if
+
+    PetscErrorCode err = 0;
+    PetscDM dmMesh = mesh->getDM();assert(dmMesh);
+    const bool useVertexWeights = true;
+    _Distributor::setPartitioner(dmMesh, partitionerName, useVertexWeights);
+
+    PetscSF sfDistribute = NULL, sfOverlap = NULL;
+    PetscDM dmTmp = NULL, dmNew = NULL;
+    const PetscInt overlap = 0;
+    err = DMPlexDistribute(dmMesh, overlap, &sfDistribute, &dmTmp);PYLITH_CHECK_ERROR(err);
+    if (!dmTmp) {
+        // Mesh is on a single process, so there is nothing to redistribute.
+        err = DMSetLocalSection(dmMesh, NULL);PYLITH_CHECK_ERROR(err); // Discard partition weights.
+        err = PetscSFDestroy(&sfDistribute);PYLITH_CHECK_ERROR(err);
+        *sfMigration = NULL;
+        PYLITH_METHOD_END;
+    } // if
+    err = _Distributor::distributeOverlap(&dmNew, dmTmp, faults, numFaults, &sfOverlap);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmTmp);PYLITH_CHECK_ERROR(err);
+    if (sfOverlap) {
+        err = PetscSFCompose(sfDistribute, sfOverlap, sfMigration);PYLITH_CHECK_ERROR(err);
+        err = PetscSFDestroy(&sfDistribute);PYLITH_CHECK_ERROR(err);
+        err = PetscSFDestroy(&sfOverlap);PYLITH_CHECK_ERROR(err);
+    } else {
+        *sfMigration = sfDistribute;
+    } // if/else
+    err = DMPlexDistributeSetDefault(dmNew, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = DMSetLocalSection(dmNew, NULL);PYLITH_CHECK_ERROR(err); // Discard partition weights.
+    err = DMPlexReorderCohesiveSupports(dmNew);PYLITH_CHECK_ERROR(err);
+    err = DMViewFromOptions(dmNew, NULL, "-pylith_dist_dm_view");PYLITH_CHECK_ERROR(err);
+
+    const char* name = NULL;
+    err = PetscObjectGetName((PetscObject)dmMesh, &name);PYLITH_CHECK_ERROR(err);
+    const std::string meshName(name);
+    mesh->setDM(dmNew, meshName.c_str());
+
+    PYLITH_METHOD_END;
+} // redistribute
+
+
 // ------------------------------------------------------------------------------------------------
 // Write partitioning info for distributed mesh.
 void
@@ -189,16 +257,44 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
 } // write
 
 
+// ------------------------------------------------------------------------------------------------
+// Set partitioner for mesh.
+void
+pylith::topology::_Distributor::setPartitioner(PetscDM dmMesh,
+                                               const char* partitionerName,
+                                               const bool useVertexWeights) {
+    PYLITH_METHOD_BEGIN;
+    assert(dmMesh);
+    assert(partitionerName);
+
+    PetscErrorCode err = 0;
+    PetscPartitioner partitioner = 0;
+    err = DMPlexGetPartitioner(dmMesh, &partitioner);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
+    if ((std::string(partitionerName) == std::string("parmetis")) && useVertexWeights) {
+        err = PetscOptionsSetValue(NULL, "-petscpartitioner_use_vertex_weights", "true");PYLITH_CHECK_ERROR(err);
+        err = PetscPartitionerSetFromOptions(partitioner);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setPartitioner
+
+
 // ------------------------------------------------------------------------------------------------
 // This is a copy of DMPlexDistributeOverlap()
 PetscErrorCode
 pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
                                                   PetscDM dmMesh,
                                                   pylith::faults::FaultCohesive* faults[],
-                                                  const int numFaults) {
+                                                  const int numFaults,
+                                                  PetscSF* sfMigration) {
     PYLITH_METHOD_BEGIN;
     assert(dmOverlap);
 
+    if (sfMigration) {
+        *sfMigration = NULL;
+    } // if
+
     MPI_Comm comm;
     PetscMPIInt size, rank;
     PetscSection rootSection, leafSection;
@@ -271,7 +367,11 @@ pylith::topology::_Distributor::distributeOverlap(PetscDM* dmOverlap,
     PetscCall(PetscSFDestroy(&sfPoint));
     /* Cleanup overlap partition */
     PetscCall(DMLabelDestroy(&lblOverlap));
-    PetscCall(PetscSFDestroy(&sfOverlap));
+    if (sfMigration) {
+        *sfMigration = sfOverlap;
+    } else {
+        PetscCall(PetscSFDestroy(&sfOverlap));
+    } // if/else
 
     PYLITH_METHOD_RETURN(0);
 } // distributeOverlap
@@ -13,6 +13,7 @@
 
 #include "pylith/meshio/meshiofwd.hh" // USES DataWriter
 #include "pylith/faults/faultsfwd.hh" // USES FaultCohesive
+#include "pylith/utils/petscfwd.h" // USES PetscSF
 
 // Distributor ----------------------------------------------------------
 /// Distribute mesh among processors.
@@ -45,6 +46,25 @@ public:
                     const char* partitionerName,
                     const bool useEdgeWeighting);
 
+    /** Redistribute mesh among processors.
+     *
+     * The mesh is partitioned using the weights attached to the cells of the mesh, if any, and
+     * replaced by the redistributed mesh.
+     *
+     * @param[inout] mesh Mesh to redistribute.
+     * @param[out] sfMigration PETSc SF from points of the current mesh (roots) to points of the
+     *   redistributed mesh (leaves); caller is responsible for destroying it.
+     * @param[in] faults Array of fault interfaces.
+     * @param[in] numFaults Number of fault interfaces.
+     * @param[in] partitionerName Name of PETSc partitioner to use in redistributing mesh.
+     */
+    static
+    void redistribute(pylith::topology::Mesh* const mesh,
+                      PetscSF* sfMigration,
+                      pylith::faults::FaultCohesive* faults[],
+                      const int numFaults,
+                      const char* partitionerName);
+
     /** Write partitioning info for distributed mesh.
      *
      * @param writer Data writer for partition information.
@@ -15,11 +15,14 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/VectorPool.hh" // USES VectorPool
 
 #include "pylith/topology/MeshOps.hh" // USES isCohesiveCell()
+#include "pylith/topology/SubdomainView.hh" // USES SubdomainView::getRegionLabelName()
 #include "pylith/faults/TopologyOps.hh" // USES getInterfacesLabel()
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
@@ -51,6 +54,34 @@ public:
             static
             void viewGlobalSection(const Field& field);
 
+            /** Register memory used by vectors and layout of field.
+             *
+             * @param[in] field Field with memory to register.
+             */
+            static
+            void registerMemory(const Field& field);
+
+            /** Check that layout of field is not shared with another field.
+             *
+             * @param[in] field Field to check.
+             * @param[in] method Name of method that changes layout.
+             */
+            static
+            void checkLayoutNotShared(const Field& field,
+                                      const char* method);
+
+            /** Create index set with indices in local vector of the values in the global vector
+             * on this process (points owned by this process without constrained DOF).
+             *
+             * @param[out] is Index set ordered like the values in the global vector.
+             * @param[in] field Field with layout.
+             * @param[in] vector Global PETSc vector with layout of field.
+             */
+            static
+            void createOwnedLocalIS(PetscIS* is,
+                                    const Field& field,
+                                    const PetscVec vector);
+
         }; // _Field
     }
 }
@@ -59,9 +90,12 @@ public:
 // Default constructor.
 pylith::topology::Field::Field(const pylith::topology::Mesh& mesh) :
     _mesh(NULL),
+    _vectorPool(NULL),
+    _hasSharedLayout(false),
     _localVec(NULL),
     _globalVec(NULL),
-    _outputVec(NULL) {
+    _outputVec(NULL),
+    _ownedLocalIS(NULL) {
     PYLITH_METHOD_BEGIN;
 
     GenericComponent::setName("field");
@@ -76,25 +110,42 @@ pylith::topology::Field::Field(const pylith::topology::Mesh& mesh) :
 // Constructor with field to use for layout.
 pylith::topology::Field::Field(const Field& src) :
     _mesh(NULL),
+    _vectorPool(NULL),
+    _hasSharedLayout(true),
     _localVec(NULL),
     _globalVec(NULL),
-    _outputVec(NULL) {
+    _outputVec(NULL),
+    _ownedLocalIS(NULL) {
     PYLITH_METHOD_BEGIN;
 
+    GenericComponent::setName("field");
+    _label = "unknown";
     _subfields = src._subfields;
 
     if (!src._mesh) {
         PYLITH_JOURNAL_LOGICERROR("Source field _mesh must be non-NULL.");
     } // if
-    _mesh = src._mesh->clone();
 
+    // Share DM (discretization and sections) of source field.
     PetscErrorCode err;
-    assert(_mesh);
-    err = DMCopyDisc(src._mesh->getDM(), _mesh->getDM());PYLITH_CHECK_ERROR(err);
+    PetscDM dm = src._mesh->getDM();assert(dm);
+    const char* name = NULL;
+    err = PetscObjectGetName((PetscObject) dm, &name);PYLITH_CHECK_ERROR(err);
+    const std::string dmName = name; // setDM() frees current name of DM before setting it.
+    err = PetscObjectReference((PetscObject) dm);PYLITH_CHECK_ERROR(err);
+    _mesh = new Mesh();assert(_mesh);
+    _mesh->setCoordSys(src._mesh->getCoordSys());
+    _mesh->setDM(dm, dmName.c_str());
+
+    if (!src._vectorPool) {
+        src._vectorPool = VectorPool::create(dm);
+    } // if
+    assert(src._vectorPool->getDM() == dm);
+    _vectorPool = VectorPool::addReference(src._vectorPool);
 
     assert(!_localVec);
-    err = DMCreateLocalVector(_mesh->getDM(), &_localVec);PYLITH_CHECK_ERROR(err);
-    err = VecSet(_localVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _localVec = _vectorPool->checkoutLocalVector();
+    _Field::registerMemory(*this);
 
     PYLITH_METHOD_END;
 } // constructor
@@ -113,12 +164,20 @@ void
 pylith::topology::Field::deallocate(void) {
     PYLITH_METHOD_BEGIN;
 
-    delete _mesh;_mesh = NULL;
+    pylith::utils::MemoryRegistry::remove(this);
+    if (_vectorPool && _hasSharedLayout) {
+        _vectorPool->returnLocalVector(&_localVec);
+        _vectorPool->returnGlobalVector(&_globalVec);
+    } // if
+    VectorPool::release(&_vectorPool);
 
     PetscErrorCode err;
     err = VecDestroy(&_localVec);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_outputVec);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_ownedLocalIS);PYLITH_CHECK_ERROR(err);
+
+    delete _mesh;_mesh = NULL;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -133,6 +192,35 @@ pylith::topology::Field::getMesh(void) const {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Replace mesh associated with field.
+void
+pylith::topology::Field::setMesh(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    _Field::checkLayoutNotShared(*this, "setMesh");
+
+    VectorPool::release(&_vectorPool);
+
+    PetscErrorCode err;
+    err = VecDestroy(&_localVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_outputVec);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_ownedLocalIS);PYLITH_CHECK_ERROR(err);
+
+    // Keep the Mesh object, because observers may hold references to it.
+    pylith::topology::Mesh* meshClone = mesh.clone();assert(meshClone);
+    PetscDM dm = meshClone->getDM();
+    err = PetscObjectReference((PetscObject) dm);PYLITH_CHECK_ERROR(err);
+    delete meshClone;meshClone = NULL;
+    _mesh->setCoordSys(mesh.getCoordSys());
+    _mesh->setDM(dm, _label.c_str());
+    pylith::utils::MemoryRegistry::remove(this);
+
+    PYLITH_METHOD_END;
+} // setMesh
+
+
 // ------------------------------------------------------------------------------------------------
 // Get PETSc DM associated with field.
 PetscDM
@@ -141,6 +229,14 @@ pylith::topology::Field::getDM(void) const {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Does field share its layout with a source field?
+bool
+pylith::topology::Field::hasSharedLayout(void) const {
+    return _hasSharedLayout;
+}
+
+
 // ------------------------------------------------------------------------------------------------
 // Get label for field.
 const char*
@@ -159,7 +255,7 @@ pylith::topology::Field::setLabel(const char* value) {
     PetscErrorCode err;
 
     _label = value;
-    if (_mesh->getDM()) {
+    if (_mesh->getDM() && !_hasSharedLayout) {
         err = PetscObjectSetName((PetscObject) _mesh->getDM(), value);PYLITH_CHECK_ERROR(err);
     } // of
     if (_localVec) {
@@ -171,6 +267,7 @@ pylith::topology::Field::setLabel(const char* value) {
     if (_outputVec) {
         err = PetscObjectSetName((PetscObject) _outputVec, value);PYLITH_CHECK_ERROR(err);
     } // if
+    _Field::registerMemory(*this);
 
     PYLITH_METHOD_END;
 } // setLabel
@@ -276,6 +373,7 @@ void
 pylith::topology::Field::createDiscretization(void) {
     PYLITH_METHOD_BEGIN;
     assert(_mesh);
+    _Field::checkLayoutNotShared(*this, "createDiscretization");
 
     PetscErrorCode err = DMCreateDS(_mesh->getDM());PYLITH_CHECK_ERROR(err);
 
@@ -283,12 +381,112 @@ pylith::topology::Field::createDiscretization(void) {
 } // createDiscretization
 
 
+// ------------------------------------------------------------------------------------------------
+// Create discretization on coarse levels of the mesh hierarchy.
+void
+pylith::topology::Field::createCoarseDiscretization(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    _Field::checkLayoutNotShared(*this, "createCoarseDiscretization");
+
+    PetscErrorCode err;
+    const PetscDM dmFine = _mesh->getDM();
+
+    // Coarse levels are shared with the mesh (and its other clones), so clone them before adding
+    // the discretization.
+    PetscDM dmLevel = dmFine;
+    PetscDM dmCoarseShared = NULL;
+    err = DMGetCoarseDM(dmFine, &dmCoarseShared);PYLITH_CHECK_ERROR(err);
+    while (dmCoarseShared) {
+        PetscDM dmCoarseClone = NULL;
+        err = DMClone(dmCoarseShared, &dmCoarseClone);PYLITH_CHECK_ERROR(err);
+        err = DMGetCoarseDM(dmCoarseShared, &dmCoarseShared);PYLITH_CHECK_ERROR(err);
+        err = DMSetCoarseDM(dmLevel, dmCoarseClone);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&dmCoarseClone);PYLITH_CHECK_ERROR(err); // Finer level holds reference.
+        err = DMGetCoarseDM(dmLevel, &dmLevel);PYLITH_CHECK_ERROR(err);
+    } // while
+
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(dmFine, &dmCoarse);PYLITH_CHECK_ERROR(err);
+
+    DMReorderDefaultFlag reorderDefault = DM_REORDER_DEFAULT_NOTSET;
+    MatOrderingType reorderType = NULL;
+    err = DMReorderSectionGetDefault(dmFine, &reorderDefault);PYLITH_CHECK_ERROR(err);
+    err = DMReorderSectionGetType(dmFine, &reorderType);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numDS = 0;
+    err = DMGetNumDS(dmFine, &numDS);PYLITH_CHECK_ERROR(err);
+    while (dmCoarse) {
+        for (subfields_type::const_iterator s_iter = _subfields.begin(); s_iter != _subfields.end(); ++s_iter) {
+            const SubfieldInfo& sinfo = s_iter->second;
+            PetscFE fe = FieldOps::createFE(sinfo.fe, dmCoarse, sinfo.description.numComponents);assert(fe);
+            err = PetscFESetName(fe, s_iter->first.c_str());PYLITH_CHECK_ERROR(err);
+            if (!sinfo.fe.isFaultOnly) {
+                err = DMSetField(dmCoarse, sinfo.index, NULL, (PetscObject)fe);PYLITH_CHECK_ERROR(err);
+                err = DMSetFieldAvoidTensor(dmCoarse, sinfo.index, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+            } else {
+                PetscDMLabel interfacesLabel = pylith::faults::TopologyOps::getInterfacesLabel(dmCoarse);
+                err = DMSetField(dmCoarse, sinfo.index, interfacesLabel, (PetscObject)fe);PYLITH_CHECK_ERROR(err);
+            } // if/else
+            err = PetscFEDestroy(&fe);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = DMCreateDS(dmCoarse);PYLITH_CHECK_ERROR(err);
+
+        // Copy essential boundary conditions, using labels of the coarse mesh. The coarse levels only need
+        // the constrained degrees of freedom; the boundary values are never evaluated on them.
+        PetscInt numDSCoarse = 0;
+        err = DMGetNumDS(dmCoarse, &numDSCoarse);PYLITH_CHECK_ERROR(err);
+        assert(numDS == numDSCoarse);
+        for (PetscInt iDS = 0; iDS < numDS; ++iDS) {
+            PetscDS dsFine = NULL, dsCoarse = NULL;
+            err = DMGetRegionNumDS(dmFine, iDS, NULL, NULL, &dsFine, NULL);PYLITH_CHECK_ERROR(err);
+            err = DMGetRegionNumDS(dmCoarse, iDS, NULL, NULL, &dsCoarse, NULL);PYLITH_CHECK_ERROR(err);
+
+            PetscInt numBoundaries = 0;
+            err = PetscDSGetNumBoundary(dsFine, &numBoundaries);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iBC = 0; iBC < numBoundaries; ++iBC) {
+                DMBoundaryConditionType bcType;
+                const char* bcName = NULL;
+                PetscDMLabel labelFine = NULL, labelCoarse = NULL;
+                PetscInt numValues = 0, field = 0, numComponents = 0;
+                const PetscInt* values = NULL;
+                const PetscInt* components = NULL;
+                void (*bcFn)(void) = NULL;
+                void (*bcFnDot)(void) = NULL;
+                void* context = NULL;
+                err = PetscDSGetBoundary(dsFine, iBC, NULL, &bcType, &bcName, &labelFine, &numValues, &values, &field,
+                                         &numComponents, &components, &bcFn, &bcFnDot, &context);PYLITH_CHECK_ERROR(err);
+                const char* labelName = NULL;
+                err = PetscObjectGetName((PetscObject)labelFine, &labelName);PYLITH_CHECK_ERROR(err);
+                err = DMGetLabel(dmCoarse, labelName, &labelCoarse);PYLITH_CHECK_ERROR(err);
+                if (!labelCoarse) {
+                    std::ostringstream msg;
+                    msg << "Could not find label '" << labelName << "' for boundary condition '" << bcName
+                        << "' in coarse mesh of field '" << getLabel() << "'.";
+                    throw std::runtime_error(msg.str());
+                } // if
+                err = PetscDSAddBoundary(dsCoarse, bcType, bcName, labelCoarse, numValues, values, field,
+                                         numComponents, components, bcFn, bcFnDot, context, NULL);PYLITH_CHECK_ERROR(err);
+            } // for
+        } // for
+
+        err = DMReorderSectionSetDefault(dmCoarse, reorderDefault);PYLITH_CHECK_ERROR(err);
+        err = DMReorderSectionSetType(dmCoarse, reorderType);PYLITH_CHECK_ERROR(err);
+
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    } // while
+
+    PYLITH_METHOD_END;
+} // createCoarseDiscretization
+
+
 // ------------------------------------------------------------------------------------------------
 // Allocate PETSc section.
 void
 pylith::topology::Field::allocate(void) {
     PYLITH_METHOD_BEGIN;
     assert(_mesh);
+    _Field::checkLayoutNotShared(*this, "allocate");
 
     PetscSection s = NULL;
     PetscErrorCode err;
@@ -303,11 +501,15 @@ pylith::topology::Field::allocate(void) {
     err = DMGetSection(dm, &s);PYLITH_CHECK_ERROR(err);assert(s); // Creates local section
     err = DMSetGlobalSection(dm, NULL);PYLITH_CHECK_ERROR(err); // Creates global section
     err = PetscSectionSetUp(s);PYLITH_CHECK_ERROR(err);
+    // Discard closure index for previous layout; VecVisitorMesh creates a new one when needed.
+    err = PetscSectionSetClosureIndex(s, (PetscObject) dm, NULL, NULL);PYLITH_CHECK_ERROR(err);
 
     err = VecDestroy(&_localVec);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_ownedLocalIS);PYLITH_CHECK_ERROR(err);
     err = DMCreateLocalVector(dm, &_localVec);PYLITH_CHECK_ERROR(err);
     err = PetscObjectSetName((PetscObject) _localVec,  _label.c_str());PYLITH_CHECK_ERROR(err);
     err = VecSet(_localVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _Field::registerMemory(*this);
 
     PYLITH_METHOD_END;
 } // allocate
@@ -398,10 +600,8 @@ pylith::topology::Field::scatterLocalToVector(const PetscVec vector,
     assert(_mesh);
     assert(vector);
 
-    PetscErrorCode err;
-    assert(_localVec);
-    err = DMLocalToGlobalBegin(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
+    scatterLocalToVectorBegin(vector, mode);
+    scatterLocalToVectorEnd(vector, mode);
 
     PYLITH_METHOD_END;
 } // scatterLocalToVector
@@ -417,8 +617,8 @@ pylith::topology::Field::scatterVectorToLocal(const PetscVec vector,
     assert(_mesh);
     assert(vector);
 
-    PetscErrorCode err;
     assert(_localVec);
+    PetscErrorCode err = PETSC_SUCCESS;
     err = DMGlobalToLocalBegin(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
     err = DMGlobalToLocalEnd(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
 
@@ -426,6 +626,80 @@ pylith::topology::Field::scatterVectorToLocal(const PetscVec vector,
 } // scatterVectorToLocal
 
 
+// ------------------------------------------------------------------------------------------------
+// Begin scatter of section information across processors to update the global view of the field.
+void
+pylith::topology::Field::scatterLocalToVectorBegin(const PetscVec vector,
+                                                   InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+
+    assert(_localVec);
+    PetscErrorCode err = DMLocalToGlobalBegin(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterLocalToVectorBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// End scatter of section information across processors to update the global view of the field.
+void
+pylith::topology::Field::scatterLocalToVectorEnd(const PetscVec vector,
+                                                 InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+
+    assert(_localVec);
+    PetscErrorCode err = DMLocalToGlobalEnd(_mesh->getDM(), _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterLocalToVectorEnd
+
+
+// ------------------------------------------------------------------------------------------------
+// Begin scatter of global information across processors to update the local view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalBegin(const PetscVec vector,
+                                                   InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+
+    assert(_localVec);
+    PetscErrorCode err = DMGlobalToLocalBegin(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+
+    // PetscSF implementations differ in whether the on-process part of the scatter is done in
+    // PetscSFBcastBegin() or PetscSFBcastEnd(), so copy the values owned by this process ourselves.
+    // The scatter writes the same values to these entries.
+    if (INSERT_VALUES == mode) {
+        if (!_ownedLocalIS) {
+            _Field::createOwnedLocalIS(&_ownedLocalIS, *this, vector);
+        } // if
+        err = VecISCopy(_localVec, _ownedLocalIS, SCATTER_FORWARD, vector);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// End scatter of global information across processors to update the local view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalEnd(const PetscVec vector,
+                                                 InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(vector);
+
+    assert(_localVec);
+    PetscErrorCode err = DMGlobalToLocalEnd(_mesh->getDM(), vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalEnd
+
+
 // ------------------------------------------------------------------------------------------------
 // Scatter section information across processors to update the
 // output view of the field.
@@ -516,6 +790,7 @@ void
 pylith::topology::Field::subfieldsSetup(void) {
     PYLITH_METHOD_BEGIN;
     assert(_mesh);
+    _Field::checkLayoutNotShared(*this, "subfieldsSetup");
 
     // Setup section now that we know the total number of sub-fields and components.
     PetscErrorCode err;
@@ -523,6 +798,10 @@ pylith::topology::Field::subfieldsSetup(void) {
     CellBasis cellBasis = pylith::topology::MeshOps::isSimplexMesh(*_mesh) ? SIMPLEX_BASIS : TENSOR_BASIS;
     const PetscDM dm = _mesh->getDM();
 
+    // Fields on the region mesh of a subdomain are defined only over the closure of the subdomain cells.
+    PetscDMLabel regionLabel = NULL;
+    err = DMGetLabel(dm, pylith::topology::SubdomainView::getRegionLabelName(), &regionLabel);PYLITH_CHECK_ERROR(err);
+
     bool quadOrderSet = false;
     int quadOrder = -999;
     for (subfields_type::iterator s_iter = _subfields.begin(); s_iter != _subfields.end(); ++s_iter) {
@@ -549,11 +828,11 @@ pylith::topology::Field::subfieldsSetup(void) {
         // :KLUDGE: We need PETSc DMPlex to support specifying subfields over labels and label values.
         // Once that is implemented, then we should switch to specifying subfields over labels and values.
         // For now we assume subfields are on:
-        //   + all degrees of freedom,
+        //   + all degrees of freedom (or the subdomain region, if the mesh has a region label),
         //   + everywhere but fault degrees of freedom, or
         //   + only fault degrees of freedom.
         if (!sinfo.fe.isFaultOnly) {
-            err = DMSetField(dm, sinfo.index, NULL, (PetscObject)fe);PYLITH_CHECK_ERROR(err);
+            err = DMSetField(dm, sinfo.index, regionLabel, (PetscObject)fe);PYLITH_CHECK_ERROR(err);
             err = DMSetFieldAvoidTensor(dm, sinfo.index, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
         } else {
             PetscDMLabel interfacesLabel = pylith::faults::TopologyOps::getInterfacesLabel(dm);
@@ -624,9 +903,18 @@ pylith::topology::Field::createGlobalVector(void) {
     PYLITH_METHOD_BEGIN;
     assert(_mesh);
 
-    PetscErrorCode err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
-    err = DMCreateGlobalVector(_mesh->getDM(), &_globalVec);PYLITH_CHECK_ERROR(err);assert(_globalVec);
+    PetscErrorCode err = PETSC_SUCCESS;
+    if (_hasSharedLayout) {
+        assert(_vectorPool);
+        _vectorPool->returnGlobalVector(&_globalVec);
+        _globalVec = _vectorPool->checkoutGlobalVector();
+    } else {
+        err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
+        err = DMCreateGlobalVector(_mesh->getDM(), &_globalVec);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    assert(_globalVec);
     err = PetscObjectSetName((PetscObject) _globalVec, getLabel());PYLITH_CHECK_ERROR(err);
+    _Field::registerMemory(*this);
 
     PYLITH_METHOD_END;
 }
@@ -654,11 +942,36 @@ pylith::topology::Field::createOutputVector(void) {
 
     err = DMCreateGlobalVector(dmOutput, &_outputVec);PYLITH_CHECK_ERROR(err);assert(_outputVec);
     err = PetscObjectSetName((PetscObject) _outputVec, getLabel());PYLITH_CHECK_ERROR(err);
+    _Field::registerMemory(*this);
 
     PYLITH_METHOD_END;
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Register memory used by vectors and layout of field.
+void
+pylith::topology::_Field::registerMemory(const Field& field) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!field.getLocalVector()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Fields sharing a layout only own their vectors.
+    size_t bytes = 0;
+    bytes += pylith::utils::MemoryRegistry::vectorBytes(field.getLocalVector());
+    bytes += pylith::utils::MemoryRegistry::vectorBytes(field.getGlobalVector());
+    bytes += pylith::utils::MemoryRegistry::vectorBytes(field.getOutputVector());
+    if (!field.hasSharedLayout()) {
+        bytes += pylith::utils::MemoryRegistry::sectionBytes(field.getLocalSection());
+    } // if
+    pylith::utils::MemoryRegistry::add(&field, "field", field.getLabel(), bytes);
+
+    PYLITH_METHOD_END;
+} // registerMemory
+
+
 // ------------------------------------------------------------------------------------------------
 // View field layout.
 void
@@ -891,4 +1204,80 @@ pylith::topology::_Field::viewGlobalSection(const Field& field) {
 } // _viewGlobalLayout
 
 
+// ------------------------------------------------------------------------------------------------
+// Check that layout of field is not shared with another field.
+void
+pylith::topology::_Field::checkLayoutNotShared(const Field& field,
+                                               const char* method) {
+    if (field.hasSharedLayout()) {
+        PYLITH_JOURNAL_LOGICERROR("Cannot call " << method << "() for field '" << field.getLabel()
+                                                 << "' with layout shared with another field.");
+    } // if
+} // checkLayoutNotShared
+
+
+// ------------------------------------------------------------------------------------------------
+// Create index set with indices in local vector of the values in the global vector on this process.
+void
+pylith::topology::_Field::createOwnedLocalIS(PetscIS* is,
+                                             const Field& field,
+                                             const PetscVec vector) {
+    PYLITH_METHOD_BEGIN;
+    assert(is);
+    assert(vector);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = field.getDM();assert(dm);
+    PetscSection localSection = NULL, globalSection = NULL;
+    err = DMGetLocalSection(dm, &localSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(dm, &globalSection);PYLITH_CHECK_ERROR(err);
+
+    PetscInt rStart = 0, rEnd = 0;
+    err = VecGetOwnershipRange(vector, &rStart, &rEnd);PYLITH_CHECK_ERROR(err);
+    PetscInt* indices = NULL;
+    err = PetscMalloc1(rEnd-rStart, &indices);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    PetscInt count = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt globalDof = 0, globalOff = 0;
+        err = PetscSectionGetDof(globalSection, point, &globalDof);PYLITH_CHECK_ERROR(err);
+        if (globalDof <= 0) { continue; } // Points not owned by this process have negative DOF.
+        err = PetscSectionGetOffset(globalSection, point, &globalOff);PYLITH_CHECK_ERROR(err);
+
+        PetscInt localDof = 0, localOff = 0, numConstrained = 0;
+        const PetscInt* constrainedIndices = NULL;
+        err = PetscSectionGetDof(localSection, point, &localDof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(localSection, point, &localOff);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetConstraintDof(localSection, point, &numConstrained);PYLITH_CHECK_ERROR(err);
+        if (numConstrained > 0) {
+            err = PetscSectionGetConstraintIndices(localSection, point, &constrainedIndices);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        // Global vector holds only unconstrained DOF.
+        PetscInt index = globalOff - rStart;
+        for (PetscInt iDof = 0, iConstrained = 0; iDof < localDof; ++iDof) {
+            if ((iConstrained < numConstrained) && (constrainedIndices[iConstrained] == iDof)) {
+                ++iConstrained;
+                continue;
+            } // if
+            assert(index >= 0 && index < rEnd-rStart);
+            indices[index++] = localOff + iDof;
+            ++count;
+        } // for
+    } // for
+    if (count != rEnd-rStart) {
+        err = PetscFree(indices);PYLITH_CHECK_ERROR(err);
+        PYLITH_JOURNAL_LOGICERROR("Number of values owned by this process in local vector of field '"
+                                  << field.getLabel() << "' (" << count << ") does not match size of global vector ("
+                                  << rEnd-rStart << ").");
+    } // if
+
+    err = ISCreateGeneral(PETSC_COMM_SELF, count, indices, PETSC_OWN_POINTER, is);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // createOwnedLocalIS
+
+
 // End of file
@@ -71,7 +71,11 @@ public:
 
     /** Constructor with field to use for layout.
      *
-     * @param[in] src Field to copy layout from.
+     * The new field shares the DM (discretization and sections) of the source field instead of
+     * cloning the mesh, and its vectors are checked out of the vector pool for the layout. The
+     * layout must not be changed (subfields, discretization, or allocation) while it is shared.
+     *
+     * @param[in] src Field to use for layout.
      *
      * @note Don't forget to call setLabel(), especially if reusing a field.
      */
@@ -89,12 +93,27 @@ public:
      */
     const pylith::topology::Mesh& getMesh(void) const;
 
+    /** Replace mesh associated with field, e.g., after redistributing the mesh.
+     *
+     * The subfields are retained, but the discretization, sections, and vectors are discarded. The
+     * field must be setup again with subfieldsSetup(), createDiscretization(), and allocate().
+     *
+     * @param[in] mesh Finite-element mesh for field (will be cloned).
+     */
+    void setMesh(const pylith::topology::Mesh& mesh);
+
     /** Get PETSc DM associated with field.
      *
      * @returns PETSc DM
      */
     PetscDM getDM(void) const;
 
+    /** Does field share its layout (DM and sections) with a source field?
+     *
+     * @returns True if field was created with the layout of another field.
+     */
+    bool hasSharedLayout(void) const;
+
     /** Get label for field.
      *
      * @returns Label for field.
@@ -163,6 +182,18 @@ public:
      */
     void createDiscretization(void);
 
+    /** Create discretization on coarse levels of the mesh hierarchy.
+     *
+     * The coarse meshes are shared among clones of a mesh, so the field first replaces them with its
+     * own clones. Each coarse mesh gets the same finite-element spaces as the field, with fault-only
+     * subfields restricted to the cohesive cells of the coarse mesh, and the essential boundary
+     * conditions of the field. These are the coarse spaces for geometric multigrid. Does nothing if
+     * the mesh does not have a hierarchy.
+     *
+     * @important Should be called after PetscDSAddBoundary() and before Field::allocate().
+     */
+    void createCoarseDiscretization(void);
+
     /// Allocate field and zero the local vector.
     void allocate(void);
 
@@ -266,6 +297,49 @@ public:
     void scatterVectorToLocal(const PetscVec vector,
                               InsertMode mode=INSERT_VALUES) const;
 
+    /** Begin scatter of section information across processors to update the
+     * global view of the field.
+     *
+     * Values in the global vector are not complete until scatterLocalToVectorEnd() is called.
+     *
+     * @param[out] vector PETSc vector to update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterLocalToVectorBegin(const PetscVec vector,
+                                   InsertMode mode=INSERT_VALUES) const;
+
+    /** End scatter of section information across processors to update the
+     * global view of the field.
+     *
+     * @param[out] vector PETSc vector to update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterLocalToVectorEnd(const PetscVec vector,
+                                 InsertMode mode=INSERT_VALUES) const;
+
+    /** Begin scatter of global information across processors to update the local
+     * view of the field.
+     *
+     * For INSERT_VALUES, values for points owned by this process are copied into the local
+     * vector after starting the scatter, so they are available after this call regardless of
+     * how the PetscSF implementation splits the scatter between its begin and end phases.
+     * Values for ghost points are not available until scatterVectorToLocalEnd() is called.
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalBegin(const PetscVec vector,
+                                   InsertMode mode=INSERT_VALUES) const;
+
+    /** End scatter of global information across processors to update the local
+     * view of the field.
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalEnd(const PetscVec vector,
+                                 InsertMode mode=INSERT_VALUES) const;
+
     /** Scatter section information across processors to update the
      * output view of the field.
      *
@@ -291,9 +365,12 @@ private:
     std::string _label; ///< Label for field.
 
     pylith::topology::Mesh* _mesh; ///< Mesh associated with field.
+    mutable pylith::topology::VectorPool* _vectorPool; ///< Pool of vectors for fields sharing layout.
+    bool _hasSharedLayout; ///< True if layout is shared with source field.
     PetscVec _localVec; ///< Local PETSc vector.
     PetscVec _globalVec; ///< Global PETSc vector.
     PetscVec _outputVec; ///< Global PETSc vector without constrained DOF for output.
+    mutable PetscIS _ownedLocalIS; ///< Indices in local vector of values in global vector on this process.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
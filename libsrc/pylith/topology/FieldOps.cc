@@ -296,6 +296,228 @@ pylith::topology::FieldOps::layoutsMatch(const pylith::topology::Field& fieldA,
 } // layoutsMatch
 
 
+// ------------------------------------------------------------------------------------------------
+// Create index set with the locations of subfields in a local vector.
+PetscIS
+pylith::topology::FieldOps::createSubfieldsIS(PetscSection section,
+                                              const PetscInt subfieldIndices[],
+                                              const PetscInt numSubfields,
+                                              PetscSection subfieldsSection) {
+    PYLITH_METHOD_BEGIN;
+    assert(section);
+    assert(subfieldsSection);
+    assert(!numSubfields || subfieldIndices);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numIndices = 0;
+    err = PetscSectionGetStorageSize(subfieldsSection, &numIndices);PYLITH_CHECK_ERROR(err);
+
+    // Location of each value is given by the section for the subfields, so the index set follows any permutation
+    // of the points in either section.
+    PetscInt* indices = NULL;
+    PetscInt numIndicesSet = 0;
+    err = PetscMalloc1(numIndices, &indices);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt subOffset = 0, subDof = 0;
+        err = PetscSectionGetDof(subfieldsSection, point, &subDof);PYLITH_CHECK_ERROR(err);
+        if (!subDof) { continue; }
+        err = PetscSectionGetOffset(subfieldsSection, point, &subOffset);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numSubfields; ++i) {
+            PetscInt numDof = 0, offset = 0;
+            err = PetscSectionGetFieldDof(section, point, subfieldIndices[i], &numDof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetFieldOffset(section, point, subfieldIndices[i], &offset);PYLITH_CHECK_ERROR(err);
+            if (subOffset + numDof > numIndices) {
+                err = PetscFree(indices);PYLITH_CHECK_ERROR(err);
+                throw std::logic_error("Layout of subfields does not match section for subfields.");
+            } // if
+            for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+                indices[subOffset++] = offset + iDof;
+            } // for
+            numIndicesSet += numDof;
+        } // for
+    } // for
+    if (numIndicesSet != numIndices) {
+        err = PetscFree(indices);PYLITH_CHECK_ERROR(err);
+        throw std::logic_error("Layout of subfields does not match section for subfields.");
+    } // if
+
+    PetscIS subfieldsIS = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, numIndices, indices, PETSC_OWN_POINTER, &subfieldsIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(subfieldsIS);
+} // createSubfieldsIS
+
+
+// ------------------------------------------------------------------------------------------------
+// Migrate values in local vector to redistributed mesh.
+void
+pylith::topology::FieldOps::migrateLocalVector(PetscVec localVectorNew,
+                                               PetscDM dmNew,
+                                               PetscVec localVectorPrev,
+                                               PetscDM dmPrev,
+                                               PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+    assert(localVectorNew);
+    assert(dmNew);
+    assert(localVectorPrev);
+    assert(dmPrev);
+    assert(sfMigration);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt numRoots = 0;
+    err = PetscSFGetGraph(sfMigration, &numRoots, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Layout of values over the points of the mesh before it was redistributed (roots).
+    PetscSection sectionPrev = NULL;
+    PetscIS subpointsPrevIS = NULL;
+    const PetscInt* subpointsPrev = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMGetLocalSection(dmPrev, &sectionPrev);PYLITH_CHECK_ERROR(err);assert(sectionPrev);
+    err = PetscSectionGetChart(sectionPrev, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetSubpointIS(dmPrev, &subpointsPrevIS);PYLITH_CHECK_ERROR(err);
+    if (subpointsPrevIS) {
+        err = ISGetIndices(subpointsPrevIS, &subpointsPrev);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscSection rootSection = NULL;
+    err = PetscSectionCreate(PETSC_COMM_SELF, &rootSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionSetChart(rootSection, 0, numRoots);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0;
+        err = PetscSectionGetDof(sectionPrev, point, &dof);PYLITH_CHECK_ERROR(err);
+        const PetscInt root = subpointsPrev ? subpointsPrev[point] : point;
+        if (dof > 0) {
+            assert(root >= 0 && root < numRoots);
+            err = PetscSectionSetDof(rootSection, root, dof);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+    err = PetscSectionSetUp(rootSection);PYLITH_CHECK_ERROR(err);
+
+    PetscInt rootSize = 0;
+    PetscVec rootVector = NULL;
+    PetscScalar* rootArray = NULL;
+    const PetscScalar* prevArray = NULL;
+    err = PetscSectionGetStorageSize(rootSection, &rootSize);PYLITH_CHECK_ERROR(err);
+    err = VecCreateSeq(PETSC_COMM_SELF, rootSize, &rootVector);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(rootVector, &rootArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(localVectorPrev, &prevArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, offPrev = 0, offRoot = 0;
+        err = PetscSectionGetDof(sectionPrev, point, &dof);PYLITH_CHECK_ERROR(err);
+        if (!dof) { continue; }
+        const PetscInt root = subpointsPrev ? subpointsPrev[point] : point;
+        err = PetscSectionGetOffset(sectionPrev, point, &offPrev);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(rootSection, root, &offRoot);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            rootArray[offRoot+iDof] = prevArray[offPrev+iDof];
+        } // for
+    } // for
+    err = VecRestoreArrayRead(localVectorPrev, &prevArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArray(rootVector, &rootArray);PYLITH_CHECK_ERROR(err);
+    if (subpointsPrevIS) {
+        err = ISRestoreIndices(subpointsPrevIS, &subpointsPrev);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Send values to the points of the redistributed mesh (leaves).
+    PetscSection leafSection = NULL;
+    PetscVec leafVector = NULL;
+    err = PetscSectionCreate(PETSC_COMM_SELF, &leafSection);PYLITH_CHECK_ERROR(err);
+    err = VecCreate(PETSC_COMM_SELF, &leafVector);PYLITH_CHECK_ERROR(err);
+    err = DMPlexDistributeField(dmPrev, sfMigration, rootSection, rootVector, leafSection, leafVector);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&rootSection);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&rootVector);PYLITH_CHECK_ERROR(err);
+
+    // Copy values into the layout of the new local vector.
+    PetscSection sectionNew = NULL;
+    PetscIS subpointsNewIS = NULL;
+    const PetscInt* subpointsNew = NULL;
+    PetscInt qStart = 0, qEnd = 0, lStart = 0, lEnd = 0;
+    err = DMGetLocalSection(dmNew, &sectionNew);PYLITH_CHECK_ERROR(err);assert(sectionNew);
+    err = PetscSectionGetChart(sectionNew, &qStart, &qEnd);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(leafSection, &lStart, &lEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetSubpointIS(dmNew, &subpointsNewIS);PYLITH_CHECK_ERROR(err);
+    if (subpointsNewIS) {
+        err = ISGetIndices(subpointsNewIS, &subpointsNew);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscInt numMismatched = 0;
+    const PetscScalar* leafArray = NULL;
+    PetscScalar* newArray = NULL;
+    err = VecGetArrayRead(leafVector, &leafArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(localVectorNew, &newArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = qStart; point < qEnd; ++point) {
+        PetscInt dof = 0, offNew = 0, leafDof = 0, offLeaf = 0;
+        err = PetscSectionGetDof(sectionNew, point, &dof);PYLITH_CHECK_ERROR(err);
+        if (!dof) { continue; }
+        const PetscInt leaf = subpointsNew ? subpointsNew[point] : point;
+        if ((leaf >= lStart) && (leaf < lEnd)) {
+            err = PetscSectionGetDof(leafSection, leaf, &leafDof);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (leafDof != dof) {
+            ++numMismatched;
+            continue;
+        } // if
+        err = PetscSectionGetOffset(sectionNew, point, &offNew);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(leafSection, leaf, &offLeaf);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            newArray[offNew+iDof] = leafArray[offLeaf+iDof];
+        } // for
+    } // for
+    err = VecRestoreArray(localVectorNew, &newArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(leafVector, &leafArray);PYLITH_CHECK_ERROR(err);
+    if (subpointsNewIS) {
+        err = ISRestoreIndices(subpointsNewIS, &subpointsNew);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscSectionDestroy(&leafSection);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&leafVector);PYLITH_CHECK_ERROR(err);
+
+    if (numMismatched > 0) {
+        std::ostringstream msg;
+        msg << "Layout of migrated values does not match layout of redistributed field at " << numMismatched << " points.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // migrateLocalVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Migrate values in global vector to redistributed mesh.
+void
+pylith::topology::FieldOps::migrateGlobalVector(PetscVec vectorNew,
+                                                PetscDM dmNew,
+                                                PetscVec vectorPrev,
+                                                PetscDM dmPrev,
+                                                PetscSF sfMigration) {
+    PYLITH_METHOD_BEGIN;
+    assert(vectorNew);
+    assert(dmNew);
+    assert(vectorPrev);
+    assert(dmPrev);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscVec localVectorPrev = NULL, localVectorNew = NULL;
+    err = DMGetLocalVector(dmPrev, &localVectorPrev);PYLITH_CHECK_ERROR(err);
+    err = VecSet(localVectorPrev, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmPrev, vectorPrev, INSERT_VALUES, localVectorPrev);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmPrev, vectorPrev, INSERT_VALUES, localVectorPrev);PYLITH_CHECK_ERROR(err);
+
+    err = DMGetLocalVector(dmNew, &localVectorNew);PYLITH_CHECK_ERROR(err);
+    err = VecSet(localVectorNew, 0.0);PYLITH_CHECK_ERROR(err);
+    migrateLocalVector(localVectorNew, dmNew, localVectorPrev, dmPrev, sfMigration);
+    err = DMLocalToGlobalBegin(dmNew, localVectorNew, INSERT_VALUES, vectorNew);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmNew, localVectorNew, INSERT_VALUES, vectorNew);PYLITH_CHECK_ERROR(err);
+
+    err = DMRestoreLocalVector(dmNew, &localVectorNew);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmPrev, &localVectorPrev);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // migrateGlobalVector
+
+
 // ------------------------------------------------------------------------------------------------
 // Create label for output.
 void
@@ -12,7 +12,8 @@
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 
 #include "pylith/topology/FieldBase.hh" // USES FieldBase::Discretization
-#include "pylith/utils/petscfwd.h" // USES PetscFE
+#include "pylith/utils/petscfwd.h" // USES PetscFE, PetscIS, PetscSF
+#include "pylith/utils/types.hh" // USES PetscSection
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 #include <map>
@@ -113,6 +114,62 @@ public:
     bool layoutsMatch(const pylith::topology::Field& fieldA,
                       const pylith::topology::Field& fieldB);
 
+    /** Create index set with the locations of subfields in a local vector.
+     *
+     * Entry i of the index set is the location in the local vector of the field of value i in a
+     * vector with the layout of `subfieldsSection`, such as the section of a subDM from
+     * DMCreateSubDM() or of a DM with a single subfield. The offsets come from the sections, so the
+     * index set is correct for any permutation of the points. Use the index set with VecISCopy() to
+     * gather/scatter the subfields from/to the local vector.
+     *
+     * @param[in] section Local section of field with subfields.
+     * @param[in] subfieldIndices Indices of subfields.
+     * @param[in] numSubfields Number of subfields.
+     * @param[in] subfieldsSection Local section with layout of vector holding the subfields.
+     * @returns Index set (caller is responsible for destroying it).
+     */
+    static
+    PetscIS createSubfieldsIS(PetscSection section,
+                              const PetscInt subfieldIndices[],
+                              const PetscInt numSubfields,
+                              PetscSection subfieldsSection);
+
+    /** Migrate values in local vector to redistributed mesh.
+     *
+     * The roots of the migration PetscSF are the points of the mesh before it was redistributed,
+     * and the leaves are the points of the redistributed mesh. The DMs may be for a submesh, such
+     * as the mesh for a material, boundary, or fault, in which case the points are mapped to the
+     * points of the mesh using the subpoint maps. Values are copied point by point, so the layout of
+     * the values at each point must be the same in both local vectors.
+     *
+     * @param[inout] localVectorNew Local vector for redistributed mesh.
+     * @param[in] dmNew PETSc DM with layout of `localVectorNew`.
+     * @param[in] localVectorPrev Local vector for mesh before it was redistributed.
+     * @param[in] dmPrev PETSc DM with layout of `localVectorPrev`.
+     * @param[in] sfMigration PETSc SF for migrating points of the mesh.
+     */
+    static
+    void migrateLocalVector(PetscVec localVectorNew,
+                            PetscDM dmNew,
+                            PetscVec localVectorPrev,
+                            PetscDM dmPrev,
+                            PetscSF sfMigration);
+
+    /** Migrate values in global vector to redistributed mesh.
+     *
+     * @param[inout] vectorNew Global vector for redistributed mesh.
+     * @param[in] dmNew PETSc DM with layout of `vectorNew`.
+     * @param[in] vectorPrev Global vector for mesh before it was redistributed.
+     * @param[in] dmPrev PETSc DM with layout of `vectorPrev`.
+     * @param[in] sfMigration PETSc SF for migrating points of the mesh.
+     */
+    static
+    void migrateGlobalVector(PetscVec vectorNew,
+                             PetscDM dmNew,
+                             PetscVec vectorPrev,
+                             PetscDM dmPrev,
+                             PetscSF sfMigration);
+
     /** Create label for output.
      *
      * @param[in] field Field to which output label is added.
@@ -21,6 +21,10 @@
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 
+#include <algorithm> // USES std::max()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
 namespace pylith {
     namespace topology {
         class _FieldQuery {
@@ -34,6 +38,117 @@ public:
             void findQueryIndices(FieldQuery::DBQueryContext* context,
                                   const pylith::string_vector& valuesForSubfield);
 
+            /** Query spatial database for values of subfield at point.
+             *
+             * Includes conversion, validation, and nondimensionalization of values.
+             *
+             * @param[in] context Query context.
+             * @param[in] dim Spatial dimension.
+             * @param[in] x Coordinates (nondimensioned) of point location for query.
+             * @param[in] nvalues Size of values array.
+             * @param[out] values Array of values to be returned.
+             * @returns Error message if query fails, empty string otherwise.
+             */
+            static
+            std::string queryPoint(FieldQuery::DBQueryContext* context,
+                                   const PylithInt dim,
+                                   const PylithReal x[],
+                                   const PylithInt nvalues,
+                                   PylithScalar* values);
+
+            /** Query spatial database for all database values at point.
+             *
+             * Values are returned in the query buffer of the context.
+             *
+             * @param[inout] context Query context.
+             * @param[in] dim Spatial dimension.
+             * @param[in] x Coordinates (nondimensioned) of point location for query.
+             * @param[in] description Description of subfields for error message.
+             * @returns Error message if query fails, empty string otherwise.
+             */
+            static
+            std::string queryDBValues(FieldQuery::DBQueryContext* context,
+                                      const PylithInt dim,
+                                      const PylithReal x[],
+                                      const std::string& description);
+
+            /** Convert, validate, and nondimensionalize database values in query buffer of context.
+             *
+             * @param[in] context Query context.
+             * @param[in] dim Spatial dimension.
+             * @param[in] x Coordinates (nondimensioned) of point location for query.
+             * @param[in] nvalues Size of values array.
+             * @param[out] values Array of values to be returned.
+             * @returns Error message if values are invalid, empty string otherwise.
+             */
+            static
+            std::string convertDBValues(FieldQuery::DBQueryContext* context,
+                                        const PylithInt dim,
+                                        const PylithReal x[],
+                                        const PylithInt nvalues,
+                                        PylithScalar* values);
+
+            /** Add point to batch of points for query.
+             *
+             * Signature matches FieldQuery::queryfn_type for use with DMProjectFunctionLocal().
+             */
+            static
+            PetscErrorCode collectPointFn(PylithInt dim,
+                                          PylithReal t,
+                                          const PylithReal x[],
+                                          PylithInt nvalues,
+                                          PylithScalar* values,
+                                          void* context);
+
+            /** Set values at point from values queried for batch of points.
+             *
+             * Signature matches FieldQuery::queryfn_type for use with DMProjectFunctionLocal().
+             */
+            static
+            PetscErrorCode setPointFn(PylithInt dim,
+                                      PylithReal t,
+                                      const PylithReal x[],
+                                      PylithInt nvalues,
+                                      PylithScalar* values,
+                                      void* context);
+
+            /** Query spatial databases for values at all points in batch.
+             *
+             * Subfields of the field that use the same spatial database share the query at each
+             * unique point, so the database is queried once per point for the union of the subfield
+             * values. Other fields (for example, auxiliary fields of other materials) use their own
+             * FieldQuery and do not share these queries.
+             *
+             * @param[inout] query Field query.
+             */
+            static
+            void queryBatch(FieldQuery* query);
+
+            /** Get key for point in batch.
+             *
+             * @param[in] dim Spatial dimension.
+             * @param[in] x Coordinates of point.
+             * @returns Key for point.
+             */
+            static
+            std::array<PylithReal, 3> pointKey(const PylithInt dim,
+                                               const PylithReal x[]);
+
+            /** Project values from spatial database into field using batched queries.
+             *
+             * The projection is done in two passes. The first pass gathers the unique points at
+             * which the subfield values are needed, the values are queried for all points at once,
+             * and the second pass sets the values in the local vector of the field.
+             *
+             * @param[inout] query Field query.
+             * @param[in] labelName Name of label (NULL for all points).
+             * @param[in] labelValue Value of label.
+             */
+            static
+            void projectBatched(FieldQuery* query,
+                                const char* labelName,
+                                const PylithInt labelValue);
+
             // Logging events
             class Events {
 public:
@@ -217,10 +332,7 @@ pylith::topology::FieldQuery::queryDB(void) {
     PYLITH_METHOD_BEGIN;
     _FieldQuery::Events::logger.eventBegin(_FieldQuery::Events::queryDB);
 
-    PetscErrorCode err = 0;
-    PetscReal dummyTime = 0.0;
-    err = DMProjectFunctionLocal(_field.getDM(), dummyTime, _functions, (void**)_contextPtrs, INSERT_ALL_VALUES,
-                                 _field.getLocalVector());PYLITH_CHECK_ERROR(err);
+    _FieldQuery::projectBatched(this, NULL, 0);
 
     _FieldQuery::Events::logger.eventEnd(_FieldQuery::Events::queryDB);
     PYLITH_METHOD_END;
@@ -235,22 +347,8 @@ pylith::topology::FieldQuery::queryDBLabel(const char* labelName,
     PYLITH_METHOD_BEGIN;
     _FieldQuery::Events::logger.eventBegin(_FieldQuery::Events::queryDBLabel);
 
-    PetscErrorCode err = 0;
-    PetscReal dummyTime = 0.0;
-
-    const Field::subfields_type& subfields = _field._subfields;
-    const size_t numSubfields = subfields.size();
-    pylith::int_array subfieldIndices(numSubfields);
-    size_t i = 0;
-    for (Field::subfields_type::const_iterator iter = subfields.begin(); iter != subfields.end(); ++iter, ++i) {
-        subfieldIndices[i] = iter->second.index;
-    } // for
-
-    PetscDMLabel dmLabel = NULL;
-    err = DMGetLabel(_field.getDM(), labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
-    err = DMProjectFunctionLabelLocal(_field.getDM(), dummyTime, dmLabel, 1, &labelValue,
-                                      numSubfields, &subfieldIndices[0], _functions, (void**)_contextPtrs,
-                                      INSERT_ALL_VALUES, _field.getLocalVector());PYLITH_CHECK_ERROR(err);
+    assert(labelName);
+    _FieldQuery::projectBatched(this, labelName, labelValue);
 
     _FieldQuery::Events::logger.eventEnd(_FieldQuery::Events::queryDBLabel);
     PYLITH_METHOD_END;
@@ -296,6 +394,105 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
         PYLITH_METHOD_RETURN(0);
     } // if
 
+    const std::string& errorMsg = _FieldQuery::queryPoint(queryctx, dim, x, nvalues, values);
+    if (errorMsg.length() > 0) {
+        PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, errorMsg.c_str());
+    } // if
+
+    PYLITH_METHOD_RETURN(0);
+} // queryDBPointFn
+
+
+// ----------------------------------------------------------------------
+const char*
+pylith::topology::FieldQuery::validatorPositive(const PylithReal value) {
+    return (value > 0.0) ? NULL : "Value must be positive.";
+} // validatorPositive
+
+
+// ----------------------------------------------------------------------
+const char*
+pylith::topology::FieldQuery::validatorNonnegative(const PylithReal value) {
+    return (value >= 0.0) ? NULL : "Value must be nonnegative.";
+} // validatorNonnegative
+
+
+// ----------------------------------------------------------------------
+// Find indices of spatial database values to use for subfield. Allocate buffer for query values.
+void
+pylith::topology::_FieldQuery::findQueryIndices(FieldQuery::DBQueryContext* context,
+                                                const pylith::string_vector& valuesForSubfield) {
+    assert(context);
+
+    const char** dbValues = NULL;
+    size_t numDBValues = 0;
+    context->db->getNamesDBValues(&dbValues, &numDBValues);
+
+    const size_t numValues = valuesForSubfield.size();
+    context->queryIndices.resize(numValues);
+    for (size_t iValue = 0; iValue < numValues; ++iValue) {
+        bool foundName = false;
+        for (size_t index = 0; index < numDBValues; ++index) {
+            if (0 == strcasecmp(dbValues[index], valuesForSubfield[iValue].c_str())) {
+                foundName = true;
+                context->queryIndices[iValue] = index;
+                break;
+            } // if
+        } // for
+        if (!foundName) {
+            std::ostringstream msg;
+            if (0 == numDBValues) {
+                delete dbValues;dbValues = NULL;
+                msg << "No values found in spatial database '"
+                    << context->db->getDescription() << "'. Did you forget to open the database?";
+                throw std::logic_error(msg.str());
+            } // if
+            msg << "Could not find value '" << valuesForSubfield[iValue] << "' in spatial database '"
+                << context->db->getDescription() << "'. Available values are:";
+            for (size_t iValueDB = 0; iValueDB < numDBValues; ++iValueDB) {
+                msg << "\n  " << dbValues[iValueDB];
+            } // for
+            msg << "\n";
+            delete dbValues;dbValues = NULL;
+            throw std::out_of_range(msg.str());
+        } // if
+    } // for
+    delete[] dbValues;dbValues = NULL;
+
+    context->queryValues.resize(numDBValues);
+} // findQueryIndices
+
+
+// ----------------------------------------------------------------------
+// Query spatial database for values of subfield at point.
+std::string
+pylith::topology::_FieldQuery::queryPoint(FieldQuery::DBQueryContext* queryctx,
+                                          const PylithInt dim,
+                                          const PylithReal x[],
+                                          const PylithInt nvalues,
+                                          PylithScalar* values) {
+    assert(queryctx);
+
+    const std::string& errorMsg = queryDBValues(queryctx, dim, x, queryctx->description);
+    if (errorMsg.length() > 0) {
+        return errorMsg;
+    } // if
+
+    return convertDBValues(queryctx, dim, x, nvalues, values);
+} // queryPoint
+
+
+// ----------------------------------------------------------------------
+// Query spatial database for all database values at point.
+std::string
+pylith::topology::_FieldQuery::queryDBValues(FieldQuery::DBQueryContext* queryctx,
+                                             const PylithInt dim,
+                                             const PylithReal x[],
+                                             const std::string& description) {
+    assert(queryctx);
+    assert(queryctx->db);
+    assert(x);
+
     // Dimensionalize query location coordinates.
     assert(queryctx->lengthScale > 0);
     double xDim[3];
@@ -308,14 +505,31 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
     const int err = queryctx->db->query(&queryctx->queryValues[0], queryctx->queryValues.size(), xDim, dim, queryctx->cs);
     if (err) {
         std::ostringstream msg;
-        msg << "Could not find values for " << queryctx->description << " at (";
+        msg << "Could not find values for " << description << " at (";
         for (int i = 0; i < dim; ++i) {
             msg << "  " << xDim[i];
         }
         msg << ") in spatial database '" << queryctx->db->getDescription() << "'.";
-        PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+        return msg.str();
     } // if
 
+    return std::string();
+} // queryDBValues
+
+
+// ----------------------------------------------------------------------
+// Convert, validate, and nondimensionalize database values in query buffer of context.
+std::string
+pylith::topology::_FieldQuery::convertDBValues(FieldQuery::DBQueryContext* queryctx,
+                                               const PylithInt dim,
+                                               const PylithReal x[],
+                                               const PylithInt nvalues,
+                                               PylithScalar* values) {
+    assert(queryctx);
+    assert(queryctx->db);
+    assert(x);
+    assert(values);
+
     // Convert database values to subfield values if converter function specified.
     if (queryctx->converter) {
         const std::string& invalidMsg = queryctx->converter(values, nvalues, queryctx->queryValues, queryctx->queryIndices);
@@ -323,11 +537,11 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
             std::ostringstream msg;
             msg << "Error converting spatial database values for " << queryctx->description << " at (";
             for (int i = 0; i < dim; ++i) {
-                msg << "  " << xDim[i];
+                msg << "  " << x[i] * queryctx->lengthScale;
             }
             msg << ") in spatial database '" << queryctx->db->getDescription() << "'. "
                 << invalidMsg;
-            PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+            return msg.str();
         }
     } else {
         for (PylithInt i = 0; i < nvalues; ++i) {
@@ -343,11 +557,11 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
                 std::ostringstream msg;
                 msg << "Found invalid value for " << queryctx->description << " (" << values[i] << ") at location (";
                 for (int i = 0; i < dim; ++i) {
-                    msg << "  " << xDim[i];
+                    msg << "  " << x[i] * queryctx->lengthScale;
                 }
                 msg << ") from spatial database '" << queryctx->db->getDescription() << "'. ";
                 msg << invalidMsg;
-                PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_LIB, msg.str().c_str());
+                return msg.str();
             } // if
         } // for
     } // if
@@ -358,68 +572,213 @@ pylith::topology::FieldQuery::queryDBPointFn(PylithInt dim,
         values[i] /= queryctx->valueScale;
     } // for
 
-    PYLITH_METHOD_RETURN(0);
-} // queryDBPointFn
+    return std::string();
+} // convertDBValues
 
 
 // ----------------------------------------------------------------------
-const char*
-pylith::topology::FieldQuery::validatorPositive(const PylithReal value) {
-    return (value > 0.0) ? NULL : "Value must be positive.";
-} // validatorPositive
+// Add point to batch of points for query.
+PetscErrorCode
+pylith::topology::_FieldQuery::collectPointFn(PylithInt dim,
+                                              PylithReal t,
+                                              const PylithReal x[],
+                                              PylithInt nvalues,
+                                              PylithScalar* values,
+                                              void* context) {
+    assert(x);
+    assert(values);
+    assert(context);
+
+    FieldQuery::DBQueryContext* queryctx = (FieldQuery::DBQueryContext*)context;
+    queryctx->dim = dim;
+    queryctx->numPointValues = nvalues;
+    const size_t index = queryctx->points.size();
+    queryctx->points.insert(std::make_pair(pointKey(dim, x), index));
+
+    for (PylithInt i = 0; i < nvalues; ++i) {
+        values[i] = 0.0;
+    } // for
+
+    return PETSC_SUCCESS;
+} // collectPointFn
 
 
 // ----------------------------------------------------------------------
-const char*
-pylith::topology::FieldQuery::validatorNonnegative(const PylithReal value) {
-    return (value >= 0.0) ? NULL : "Value must be nonnegative.";
-} // validatorNonnegative
+// Set values at point from values queried for batch of points.
+PetscErrorCode
+pylith::topology::_FieldQuery::setPointFn(PylithInt dim,
+                                          PylithReal t,
+                                          const PylithReal x[],
+                                          PylithInt nvalues,
+                                          PylithScalar* values,
+                                          void* context) {
+    assert(x);
+    assert(values);
+    assert(context);
+
+    FieldQuery::DBQueryContext* queryctx = (FieldQuery::DBQueryContext*)context;
+    const FieldQuery::point_map_type::const_iterator& iter = queryctx->points.find(pointKey(dim, x));
+    if ((iter == queryctx->points.end()) || (nvalues != queryctx->numPointValues)) {
+        PYLITH_ERROR_RETURN(PETSC_COMM_SELF, PETSC_ERR_PLIB, "Point not found in batch of points for spatial database query.");
+    } // if
+
+    const PylithScalar* pointValues = &queryctx->pointValues[iter->second*nvalues];
+    for (PylithInt i = 0; i < nvalues; ++i) {
+        values[i] = pointValues[i];
+    } // for
+
+    return PETSC_SUCCESS;
+} // setPointFn
 
 
 // ----------------------------------------------------------------------
-// Find indices of spatial database values to use for subfield. Allocate buffer for query values.
+// Query spatial databases for values at all points in batch.
 void
-pylith::topology::_FieldQuery::findQueryIndices(FieldQuery::DBQueryContext* context,
-                                                const pylith::string_vector& valuesForSubfield) {
-    assert(context);
+pylith::topology::_FieldQuery::queryBatch(FieldQuery* query) {
+    PYLITH_METHOD_BEGIN;
+    assert(query);
+
+    // Group subfields by spatial database.
+    typedef std::map<spatialdata::spatialdb::SpatialDB*, std::vector<FieldQuery::DBQueryContext*> > db_map_type;
+    db_map_type dbContexts;
+    const size_t numSubfields = query->_field.getSubfieldNames().size();
+    for (size_t i = 0; i < numSubfields; ++i) {
+        if (query->_functions[i]) {
+            FieldQuery::DBQueryContext* queryctx = &query->_contexts[i];
+            dbContexts[queryctx->db].push_back(queryctx);
+        } // if
+    } // for
 
-    const char** dbValues = NULL;
-    size_t numDBValues = 0;
-    context->db->getNamesDBValues(&dbValues, &numDBValues);
+    for (db_map_type::const_iterator dbIter = dbContexts.begin(); dbIter != dbContexts.end(); ++dbIter) {
+        const std::vector<FieldQuery::DBQueryContext*>& contexts = dbIter->second;
+        assert(contexts.size() > 0);
+
+        // Union of points over subfields using database.
+        FieldQuery::point_map_type points;
+        std::string description;
+        PylithInt dim = 0;
+        for (size_t iContext = 0; iContext < contexts.size(); ++iContext) {
+            const FieldQuery::point_map_type& contextPoints = contexts[iContext]->points;
+            for (FieldQuery::point_map_type::const_iterator iter = contextPoints.begin(); iter != contextPoints.end(); ++iter) {
+                const size_t index = points.size();
+                points.insert(std::make_pair(iter->first, index));
+            } // for
+            description += (iContext > 0 ? ", " : "") + contexts[iContext]->description;
+            dim = std::max(dim, contexts[iContext]->dim);
+        } // for
 
-    const size_t numValues = valuesForSubfield.size();
-    context->queryIndices.resize(numValues);
-    for (size_t iValue = 0; iValue < numValues; ++iValue) {
-        bool foundName = false;
-        for (size_t index = 0; index < numDBValues; ++index) {
-            if (0 == strcasecmp(dbValues[index], valuesForSubfield[iValue].c_str())) {
-                foundName = true;
-                context->queryIndices[iValue] = index;
-                break;
+        // Query database once per point for all database values.
+        FieldQuery::DBQueryContext* queryctx = contexts[0];
+        const size_t numDBValues = queryctx->queryValues.size();
+        std::vector<PylithScalar> dbValues(points.size()*numDBValues);
+        for (FieldQuery::point_map_type::const_iterator iter = points.begin(); iter != points.end(); ++iter) {
+            const std::string& errorMsg = queryDBValues(queryctx, dim, &iter->first[0], description);
+            if (errorMsg.length() > 0) {
+                throw std::runtime_error(errorMsg);
             } // if
+            for (size_t iValue = 0; iValue < numDBValues; ++iValue) {
+                dbValues[iter->second*numDBValues+iValue] = queryctx->queryValues[iValue];
+            } // for
         } // for
-        if (!foundName) {
-            std::ostringstream msg;
-            if (0 == numDBValues) {
-                delete dbValues;dbValues = NULL;
-                msg << "No values found in spatial database '"
-                    << context->db->getDescription() << "'. Did you forget to open the database?";
-                throw std::logic_error(msg.str());
-            } // if
-            msg << "Could not find value '" << valuesForSubfield[iValue] << "' in spatial database '"
-                << context->db->getDescription() << "'. Available values are:";
-            for (size_t iValueDB = 0; iValueDB < numDBValues; ++iValueDB) {
-                msg << "\n  " << dbValues[iValueDB];
+
+        // Compute values of each subfield from database values.
+        for (size_t iContext = 0; iContext < contexts.size(); ++iContext) {
+            FieldQuery::DBQueryContext* subfieldctx = contexts[iContext];
+            assert(numDBValues == subfieldctx->queryValues.size());
+            const PylithInt nvalues = subfieldctx->numPointValues;
+            subfieldctx->pointValues.resize(subfieldctx->points.size()*nvalues);
+            const FieldQuery::point_map_type& contextPoints = subfieldctx->points;
+            for (FieldQuery::point_map_type::const_iterator iter = contextPoints.begin(); iter != contextPoints.end(); ++iter) {
+                const size_t index = points[iter->first];
+                for (size_t iValue = 0; iValue < numDBValues; ++iValue) {
+                    subfieldctx->queryValues[iValue] = dbValues[index*numDBValues+iValue];
+                } // for
+                const std::string& errorMsg = convertDBValues(subfieldctx, subfieldctx->dim, &iter->first[0], nvalues,
+                                                              &subfieldctx->pointValues[iter->second*nvalues]);
+                if (errorMsg.length() > 0) {
+                    throw std::runtime_error(errorMsg);
+                } // if
             } // for
-            msg << "\n";
-            delete dbValues;dbValues = NULL;
-            throw std::out_of_range(msg.str());
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // queryBatch
+
+
+// ----------------------------------------------------------------------
+// Get key for point in batch.
+std::array<PylithReal, 3>
+pylith::topology::_FieldQuery::pointKey(const PylithInt dim,
+                                        const PylithReal x[]) {
+    assert(dim <= 3);
+    std::array<PylithReal, 3> key = { 0.0, 0.0, 0.0 };
+    for (PylithInt i = 0; i < dim; ++i) {
+        key[i] = x[i];
+    } // for
+    return key;
+} // pointKey
+
+
+// ----------------------------------------------------------------------
+// Project values from spatial database into field using batched queries.
+void
+pylith::topology::_FieldQuery::projectBatched(FieldQuery* query,
+                                              const char* labelName,
+                                              const PylithInt labelValue) {
+    PYLITH_METHOD_BEGIN;
+    assert(query);
+
+    const pylith::string_vector& subfieldNames = query->_field.getSubfieldNames();
+    const size_t numSubfields = subfieldNames.size();
+    if (!numSubfields || !query->_functions) {
+        PYLITH_METHOD_END;
+    } // if
+
+    std::vector<FieldQuery::queryfn_type> collectFunctions(numSubfields);
+    std::vector<FieldQuery::queryfn_type> setFunctions(numSubfields);
+    for (size_t i = 0; i < numSubfields; ++i) {
+        collectFunctions[i] = (query->_functions[i]) ? collectPointFn : NULL;
+        setFunctions[i] = (query->_functions[i]) ? setPointFn : NULL;
+    } // for
+
+    PetscErrorCode err = 0;
+    PetscDM dm = query->_field.getDM();
+    PetscReal dummyTime = 0.0;
+    PetscDMLabel dmLabel = NULL;
+    pylith::int_array subfieldIndices;
+    if (labelName) {
+        err = DMGetLabel(dm, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);assert(dmLabel);
+        subfieldIndices.resize(numSubfields);
+        for (size_t i = 0; i < numSubfields; ++i) {
+            subfieldIndices[i] = query->_field.getSubfieldInfo(subfieldNames[i].c_str()).index;
+        } // for
+    } // if
+
+    // Gather unique points, query values at points, and then set values in field.
+    for (int iPass = 0; iPass < 2; ++iPass) {
+        FieldQuery::queryfn_type* functions = (0 == iPass) ? &collectFunctions[0] : &setFunctions[0];
+        if (dmLabel) {
+            err = DMProjectFunctionLabelLocal(dm, dummyTime, dmLabel, 1, &labelValue,
+                                              numSubfields, &subfieldIndices[0], functions, (void**)query->_contextPtrs,
+                                              INSERT_ALL_VALUES, query->_field.getLocalVector());PYLITH_CHECK_ERROR(err);
+        } else {
+            err = DMProjectFunctionLocal(dm, dummyTime, functions, (void**)query->_contextPtrs, INSERT_ALL_VALUES,
+                                         query->_field.getLocalVector());PYLITH_CHECK_ERROR(err);
+        } // if/else
+
+        if (0 == iPass) {
+            queryBatch(query);
         } // if
     } // for
-    delete[] dbValues;dbValues = NULL;
 
-    context->queryValues.resize(numDBValues);
-} // findQueryIndices
+    for (size_t i = 0; i < numSubfields; ++i) {
+        query->_contexts[i].points.clear();
+        query->_contexts[i].pointValues.clear();
+    } // for
+
+    PYLITH_METHOD_END;
+} // projectBatched
 
 
 // End of file
@@ -19,6 +19,8 @@
 #include "spatialdata/geocoords/geocoordsfwd.hh" // USES CoordSys
 
 #include <map> // HOLDSA std::map
+#include <array> // USES std::array
+#include <vector> // HOLDSA std::vector
 #include <string> // HASA std::string
 
 namespace pylith {
@@ -172,6 +174,9 @@ private:
                                            PylithScalar*,
                                            void*);
 
+    /// Map from coordinates of query point to index of point in batch.
+    typedef std::map<std::array<PylithReal, 3>, size_t> point_map_type;
+
     /// Context for spatial database queries.
     struct DBQueryContext {
         spatialdata::spatialdb::SpatialDB* db; ///< Spatial database.
@@ -184,6 +189,11 @@ private:
         convertfn_type converter; ///< Function to convert values to subfield (optional).
         pylith::topology::FieldBase::validatorfn_type validator; ///< Function to validate values (optional).
 
+        point_map_type points; ///< Unique (nondimensional) coordinates of points in batch.
+        std::vector<PylithScalar> pointValues; ///< Subfield values at points in batch.
+        PylithInt numPointValues; ///< Number of subfield values at each point in batch.
+        PylithInt dim; ///< Spatial dimension of points in batch.
+
         DBQueryContext(void) :
             db(NULL),
             cs(NULL),
@@ -191,7 +201,9 @@ private:
             valueScale(1.0),
             description("unknown"),
             converter(NULL),
-            validator(NULL) {}
+            validator(NULL),
+            numPointValues(0),
+            dim(0) {}
 
 
     }; // DBQueryStruct
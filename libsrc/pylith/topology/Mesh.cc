@@ -17,6 +17,7 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 #include "pylith/utils/petscfwd.h" // USES PetscVec
 
 #include <stdexcept> // USES std::runtime_error
@@ -64,6 +65,7 @@ void
 pylith::topology::Mesh::deallocate(void) {
     PYLITH_METHOD_BEGIN;
 
+    pylith::utils::MemoryRegistry::remove(this);
     delete _coordSys;_coordSys = NULL;
     PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
 
@@ -87,6 +89,12 @@ pylith::topology::Mesh::clone(void) const {
         const char* name = NULL;
         err = PetscObjectGetName((PetscObject)this->_dm, &name);PYLITH_CHECK_ERROR(err);
         err = PetscObjectSetName((PetscObject)mesh->_dm,  name);PYLITH_CHECK_ERROR(err);
+
+        // Share coarse meshes in hierarchy (geometric multigrid). Fields that discretize the coarse
+        // levels clone them in Field::createCoarseDiscretization().
+        PetscDM dmCoarse = NULL;
+        err = DMGetCoarseDM(this->_dm, &dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMSetCoarseDM(mesh->_dm, dmCoarse);PYLITH_CHECK_ERROR(err);
     } // if
 
     PYLITH_METHOD_RETURN(mesh);
@@ -0,0 +1,184 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/topology/MeshCache.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
+#include <fstream> // USES std::ifstream
+#include <string> // USES std::string
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _MeshCache {
+public:
+
+            /** Broadcast hash from process 0.
+             *
+             * @param[in] hash Hash on process 0.
+             * @param[in] comm MPI communicator.
+             * @returns Hash from process 0.
+             */
+            static
+            std::string broadcastHash(const char* hash,
+                                      MPI_Comm comm);
+
+            static const char* hashAttribute; ///< Name of attribute with hash.
+        }; // _MeshCache
+    } // topology
+} // pylith
+
+const char* pylith::topology::_MeshCache::hashAttribute = "pylith_mesh_hash";
+
+// ------------------------------------------------------------------------------------------------
+// Broadcast hash from process 0.
+std::string
+pylith::topology::_MeshCache::broadcastHash(const char* hash,
+                                            MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMPIInt commRank = 0;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    std::string value = (!commRank && hash) ? hash : "";
+    int length = value.length();
+    err = MPI_Bcast(&length, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    value.resize(length);
+    if (length > 0) {
+        err = MPI_Bcast(&value[0], length, MPI_CHAR, 0, comm);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(value);
+} // broadcastHash
+
+
+// ----------------------------------------------------------------------
+// Check whether cache file exists and was created with the given hash.
+bool
+pylith::topology::MeshCache::isCurrent(const topology::Mesh& mesh,
+                                       const char* filename,
+                                       const char* hash) {
+    PYLITH_METHOD_BEGIN;
+    assert(filename);
+    assert(hash);
+
+    MPI_Comm comm = mesh.getComm();
+    const std::string& hashRoot = _MeshCache::broadcastHash(hash, comm);
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMPIInt commRank = 0;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    int exists = 0;
+    if (!commRank) {
+        std::ifstream fin(filename);
+        exists = fin.good() ? 1 : 0;
+    } // if
+    err = MPI_Bcast(&exists, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (!exists) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, filename, FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    PetscBool hasHash = PETSC_FALSE;
+    err = PetscViewerHDF5HasAttribute(viewer, "/", _MeshCache::hashAttribute, &hasHash);PYLITH_CHECK_ERROR(err);
+    bool isCurrent = false;
+    if (hasHash) {
+        char* cacheHash = NULL;
+        err = PetscViewerHDF5ReadAttribute(viewer, "/", _MeshCache::hashAttribute, PETSC_STRING, NULL, &cacheHash);PYLITH_CHECK_ERROR(err);
+        isCurrent = std::string(cacheHash) == hashRoot;
+        err = PetscFree(cacheHash);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(isCurrent);
+} // isCurrent
+
+
+// ----------------------------------------------------------------------
+// Write mesh to cache file.
+void
+pylith::topology::MeshCache::write(const topology::Mesh& mesh,
+                                   const char* filename,
+                                   const char* hash) {
+    PYLITH_METHOD_BEGIN;
+    assert(filename);
+    assert(hash);
+
+    const std::string& hashRoot = _MeshCache::broadcastHash(hash, mesh.getComm());
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscViewer viewer = NULL;
+    try {
+        err = PetscViewerHDF5Open(mesh.getComm(), filename, FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+        err = DMView(mesh.getDM(), viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+
+        // Write hash last, so an incomplete file is never considered current.
+        err = PetscViewerHDF5WriteAttribute(viewer, "/", _MeshCache::hashAttribute, PETSC_STRING, hashRoot.c_str());PYLITH_CHECK_ERROR(err);
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+    } catch (const std::exception& err) {
+        PetscViewerDestroy(&viewer);
+        std::ostringstream msg;
+        msg << "Error while writing mesh cache file '" << filename << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// ----------------------------------------------------------------------
+// Read mesh from cache file.
+void
+pylith::topology::MeshCache::read(topology::Mesh* mesh,
+                                  const char* filename) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+    assert(filename);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscViewer viewer = NULL;
+    PetscDM dmMesh = NULL;
+    try {
+        err = DMCreate(mesh->getComm(), &dmMesh);PYLITH_CHECK_ERROR(err);
+        err = DMSetType(dmMesh, DMPLEX);PYLITH_CHECK_ERROR(err);
+        // Name must match the name of the DM when the cache was written.
+        err = PetscObjectSetName((PetscObject) dmMesh, "domain");PYLITH_CHECK_ERROR(err);
+
+        err = PetscViewerHDF5Open(mesh->getComm(), filename, FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+        err = DMLoad(dmMesh, viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+        err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+        err = DMPlexDistributeSetDefault(dmMesh, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+        mesh->setDM(dmMesh);
+    } catch (const std::exception& err) {
+        PetscViewerDestroy(&viewer);
+        DMDestroy(&dmMesh);
+        std::ostringstream msg;
+        msg << "Error while reading mesh cache file '" << filename << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // read
+
+
+// End of file
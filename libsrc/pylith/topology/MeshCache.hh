@@ -0,0 +1,61 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+// MeshCache ------------------------------------------------------------
+/** Cache of mesh topology in an HDF5 file.
+ *
+ * The cache holds the mesh after reading, reordering, and inserting cohesive cells, including all
+ * labels (materials, boundaries, faults, interface patches). It is tagged with a hash of the input
+ * mesh and the parameters that affect the topology, so a cache is only used if it was created
+ * from the same input. The cache is written in the PETSc HDF5 format, which can be loaded on any
+ * number of processes; the loaded mesh is then distributed as usual.
+ */
+class pylith::topology::MeshCache { // MeshCache
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /** Check whether cache file exists and was created with the given hash.
+     *
+     * @param[in] mesh PyLith finite-element mesh (provides MPI communicator).
+     * @param[in] filename Name of cache file.
+     * @param[in] hash Hash of input mesh and topology parameters (only used on process 0).
+     * @returns True if cache can be used, false otherwise.
+     */
+    static
+    bool isCurrent(const topology::Mesh& mesh,
+                   const char* filename,
+                   const char* hash);
+
+    /** Write mesh to cache file.
+     *
+     * @param[in] mesh PyLith finite-element mesh.
+     * @param[in] filename Name of cache file.
+     * @param[in] hash Hash of input mesh and topology parameters (only used on process 0).
+     */
+    static
+    void write(const topology::Mesh& mesh,
+               const char* filename,
+               const char* hash);
+
+    /** Read mesh from cache file.
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[in] filename Name of cache file.
+     */
+    static
+    void read(topology::Mesh* mesh,
+              const char* filename);
+
+}; // MeshCache
+
+// End of file
@@ -16,6 +16,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/utils/array.hh" // USES int_array
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -134,7 +135,7 @@ pylith::topology::MeshOps::createSubdomainMesh(const pylith::topology::Mesh& mes
 
     PetscInt maxConeSizeLocal = 0, maxConeSize = 0;
     err = DMPlexGetMaxSizes(dmSubdomain, &maxConeSizeLocal, NULL);PYLITH_CHECK_ERROR(err);
-    err = MPI_Allreduce(&maxConeSizeLocal, &maxConeSize, 1, MPI_INT, MPI_MAX,
+    err = MPI_Allreduce(&maxConeSizeLocal, &maxConeSize, 1, MPIU_INT, MPI_MAX,
                         PetscObjectComm((PetscObject) dmSubdomain));PYLITH_CHECK_ERROR(err);
 
     if (maxConeSize <= 0) {
@@ -157,6 +158,7 @@ pylith::topology::MeshOps::createSubdomainMesh(const pylith::topology::Mesh& mes
     pylith::topology::Mesh* submesh = new pylith::topology::Mesh(true);assert(submesh);
     submesh->setCoordSys(mesh.getCoordSys());
     submesh->setDM(dmSubdomain);
+    pylith::utils::MemoryRegistry::add(submesh, "mesh", descriptiveLabel, pylith::utils::MemoryRegistry::dmBytes(dmSubdomain));
 
     _MeshOps::Events::logger.eventEnd(_MeshOps::Events::createSubdomainMesh);
     PYLITH_METHOD_RETURN(submesh);
@@ -211,7 +213,7 @@ pylith::topology::MeshOps::createLowerDimMesh(const pylith::topology::Mesh& mesh
 
     PetscInt maxConeSizeLocal = 0, maxConeSize = 0;
     err = DMPlexGetMaxSizes(dmSubmesh, &maxConeSizeLocal, NULL);PYLITH_CHECK_ERROR(err);
-    err = MPI_Allreduce(&maxConeSizeLocal, &maxConeSize, 1, MPI_INT, MPI_MAX,
+    err = MPI_Allreduce(&maxConeSizeLocal, &maxConeSize, 1, MPIU_INT, MPI_MAX,
                         PetscObjectComm((PetscObject) dmSubmesh));PYLITH_CHECK_ERROR(err);
 
     if (maxConeSize <= 0) {
@@ -236,6 +238,8 @@ pylith::topology::MeshOps::createLowerDimMesh(const pylith::topology::Mesh& mesh
     submesh->setCoordSys(mesh.getCoordSys());
     submesh->setDM(dmSubmesh);
 
+    pylith::utils::MemoryRegistry::add(submesh, "mesh", labelName, pylith::utils::MemoryRegistry::dmBytes(dmSubmesh));
+
     // Check topology
     MeshOps::checkTopology(*submesh);
 
@@ -517,7 +521,7 @@ pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mes
 
     // Create map with indices for each material
     const size_t numIds = labelValues.size();
-    std::map<int, int> materialIndex;
+    std::map<PylithInt, size_t> materialIndex;
     for (size_t i = 0; i < numIds; ++i) {
         materialIndex[labelValues[i]] = i;
     } // for
@@ -534,8 +538,8 @@ pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mes
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
     err = DMGetLabel(dmMesh, labelName, &materialsLabel);PYLITH_CHECK_ERROR(err);assert(materialsLabel);
 
-    int *matBegin = &labelValues[0];
-    int *matEnd = &labelValues[0] + labelValues.size();
+    PylithInt *matBegin = &labelValues[0];
+    PylithInt *matEnd = &labelValues[0] + labelValues.size();
     std::sort(matBegin, matEnd);
 
     for (PetscInt c = cStart; c < cEnd; ++c) {
@@ -548,7 +552,7 @@ pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mes
             // materials (including cohesive cells).
             continue;
         } // if
-        const int *result = std::find(matBegin, matEnd, matId);
+        const PylithInt *result = std::find(matBegin, matEnd, matId);
         if (result == matEnd) {
             std::ostringstream msg;
             msg << "Material label_value '" << matId << "' for cell '" << c
@@ -564,9 +568,9 @@ pylith::topology::MeshOps::checkMaterialLabels(const pylith::topology::Mesh& mes
     // Make sure each material has cells.
     int_array matCellCountsAll(matCellCounts.size());
     err = MPI_Allreduce(&matCellCounts[0], &matCellCountsAll[0],
-                        matCellCounts.size(), MPI_INT, MPI_SUM, mesh.getComm());PYLITH_CHECK_ERROR(err);
+                        matCellCounts.size(), MPIU_INT, MPI_SUM, mesh.getComm());PYLITH_CHECK_ERROR(err);
     for (size_t i = 0; i < numIds; ++i) {
-        const int matId = labelValues[i];
+        const PylithInt matId = labelValues[i];
         const size_t matIndex = materialIndex[matId];
         assert(0 <= matIndex && matIndex < numIds);
         if (matCellCountsAll[matIndex] <= 0) {
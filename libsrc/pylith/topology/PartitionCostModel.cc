@@ -0,0 +1,160 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/topology/PartitionCostModel.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::min(), std::max()
+#include <cmath> // USES floor()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::out_of_range
+
+// ------------------------------------------------------------------------------------------------
+const PylithInt pylith::topology::PartitionCostModel::_weightResolution = 10;
+const PylithInt pylith::topology::PartitionCostModel::_maxWeight = 1000;
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::topology::PartitionCostModel::PartitionCostModel(void) :
+    _defaultCost(1.0) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::topology::PartitionCostModel::~PartitionCostModel(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate data structures.
+void
+pylith::topology::PartitionCostModel::deallocate(void) {
+    _cellCosts.clear();
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Set relative cost of cells without a cost for their label value.
+void
+pylith::topology::PartitionCostModel::setDefaultCost(const PylithReal value) {
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Default relative cost of cells (" << value << ") must be positive.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _defaultCost = value;
+} // setDefaultCost
+
+
+// ------------------------------------------------------------------------------------------------
+// Get relative cost of cells without a cost for their label value.
+PylithReal
+pylith::topology::PartitionCostModel::getDefaultCost(void) const {
+    return _defaultCost;
+} // getDefaultCost
+
+
+// ------------------------------------------------------------------------------------------------
+// Set relative cost of cells with given label value.
+void
+pylith::topology::PartitionCostModel::setCellCost(const int labelValue,
+                                                  const PylithReal value) {
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Relative cost (" << value << ") of cells with label value " << labelValue << " must be positive.";
+        throw std::out_of_range(msg.str());
+    } // if
+    _cellCosts[labelValue] = value;
+} // setCellCost
+
+
+// ------------------------------------------------------------------------------------------------
+// Get relative cost of cells with given label value.
+PylithReal
+pylith::topology::PartitionCostModel::getCellCost(const int labelValue) const {
+    std::map<int, PylithReal>::const_iterator iter = _cellCosts.find(labelValue);
+    return (iter != _cellCosts.end()) ? iter->second : _defaultCost;
+} // getCellCost
+
+
+// ------------------------------------------------------------------------------------------------
+// Attach partition weights to cells of mesh.
+void
+pylith::topology::PartitionCostModel::setWeights(pylith::topology::Mesh* mesh) const {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmMesh = mesh->getDM();assert(dmMesh);
+    PetscDMLabel cellsLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &cellsLabel);PYLITH_CHECK_ERROR(err);
+    if (!cellsLabel) {
+        std::ostringstream msg;
+        msg << "Could not find label '" << pylith::topology::Mesh::cells_label_name << "' for partition weights.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    // Least expensive cell gets weight _weightResolution.
+    PylithReal minCost = _defaultCost;
+    for (std::map<int, PylithReal>::const_iterator iter = _cellCosts.begin(); iter != _cellCosts.end(); ++iter) {
+        minCost = std::min(minCost, iter->second);
+    } // for
+
+    PetscInt pStart = 0, pEnd = 0, cStart = 0, cEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscSection weightsSection = NULL;
+    err = PetscSectionCreate(mesh->getComm(), &weightsSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionSetChart(weightsSection, pStart, pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt labelValue = -1;
+        err = DMLabelGetValue(cellsLabel, cell, &labelValue);PYLITH_CHECK_ERROR(err);
+        const PylithReal cost = (labelValue >= 0) ? getCellCost(labelValue) : _defaultCost;
+        const PylithInt weight = PylithInt(floor(PylithReal(_weightResolution) * cost / minCost + 0.5));
+        err = PetscSectionSetDof(weightsSection, cell, std::max(PylithInt(1), std::min(weight, _maxWeight)));PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscSectionSetUp(weightsSection);PYLITH_CHECK_ERROR(err);
+    err = DMSetLocalSection(dmMesh, weightsSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&weightsSection);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setWeights
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of cells with given label value summed over all processes.
+PylithInt
+pylith::topology::PartitionCostModel::getNumCells(const pylith::topology::Mesh& mesh,
+                                                  const int labelValue) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscDMLabel cellsLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &cellsLabel);PYLITH_CHECK_ERROR(err);
+    PetscInt numCellsLocal = 0;
+    if (cellsLabel) {
+        err = DMLabelGetStratumSize(cellsLabel, labelValue, &numCellsLocal);PYLITH_CHECK_ERROR(err);
+    } // if
+    PetscInt numCells = 0;
+    err = MPI_Allreduce(&numCellsLocal, &numCells, 1, MPIU_INT, MPI_SUM, mesh.getComm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(numCells);
+} // getNumCells
+
+
+// End of file
@@ -0,0 +1,101 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+#include <map> // HASA std::map
+
+/** Cost model for weighting cells when partitioning the mesh.
+ *
+ * Each cell is assigned a relative cost based on its value of the label identifying materials and
+ * interfaces (cohesive cells). The costs are converted to integer weights and attached to the
+ * cells of the DM, so that PETSc partitioners using vertex weights balance the cost rather than
+ * the number of cells.
+ */
+class pylith::topology::PartitionCostModel { // PartitionCostModel
+    friend class TestPartitionCostModel; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    PartitionCostModel(void);
+
+    /// Destructor
+    ~PartitionCostModel(void);
+
+    /// Deallocate data structures.
+    void deallocate(void);
+
+    /** Set relative cost of cells without a cost for their label value.
+     *
+     * @param[in] value Relative cost (must be positive).
+     */
+    void setDefaultCost(const PylithReal value);
+
+    /** Get relative cost of cells without a cost for their label value.
+     *
+     * @returns Relative cost.
+     */
+    PylithReal getDefaultCost(void) const;
+
+    /** Set relative cost of cells with given label value.
+     *
+     * @param[in] labelValue Value of label identifying materials and interfaces.
+     * @param[in] value Relative cost (must be positive).
+     */
+    void setCellCost(const int labelValue,
+                     const PylithReal value);
+
+    /** Get relative cost of cells with given label value.
+     *
+     * @param[in] labelValue Value of label identifying materials and interfaces.
+     * @returns Relative cost.
+     */
+    PylithReal getCellCost(const int labelValue) const;
+
+    /** Attach partition weights to cells of mesh.
+     *
+     * The weights are stored as the number of degrees of freedom on the cells in the local
+     * section of the DM, which is what PETSc partitioners use for vertex weights.
+     *
+     * @param[inout] mesh Mesh to partition.
+     */
+    void setWeights(pylith::topology::Mesh* mesh) const;
+
+    /** Get number of cells with given label value summed over all processes.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] labelValue Value of label identifying materials and interfaces.
+     * @returns Number of cells.
+     */
+    static
+    PylithInt getNumCells(const pylith::topology::Mesh& mesh,
+                          const int labelValue);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    std::map<int, PylithReal> _cellCosts; ///< Relative cost of cells for label values.
+    PylithReal _defaultCost; ///< Relative cost of cells without a cost for their label value.
+
+    static const PylithInt _weightResolution; ///< Integer weight of least expensive cell.
+    static const PylithInt _maxWeight; ///< Maximum integer weight of a cell.
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    PartitionCostModel(const PartitionCostModel&); ///< Not implemented
+    const PartitionCostModel& operator=(const PartitionCostModel&); ///< Not implemented
+
+}; // PartitionCostModel
+
+// End of file
@@ -39,6 +39,13 @@ public:
                 static PylithInt refineCheckTopology;
             };
 
+            /** Remove points that are not cells from label identifying materials.
+             *
+             * @param[in] dm PETSc DM for refined mesh.
+             */
+            static
+            void fixCellLabel(PetscDM dm);
+
         }; // _RefineUniform
     } // topology
 } // pylith
@@ -61,7 +68,8 @@ pylith::topology::_RefineUniform::Events::init(void) {
 
 // ----------------------------------------------------------------------
 // Constructor
-pylith::topology::RefineUniform::RefineUniform(void) {
+pylith::topology::RefineUniform::RefineUniform(void) :
+    _keepHierarchy(false) {
     _RefineUniform::Events::init();
 }
 
@@ -80,6 +88,22 @@ pylith::topology::RefineUniform::deallocate(void) {
 }
 
 
+// ----------------------------------------------------------------------
+// Keep coarse meshes as a hierarchy attached to the refined mesh.
+void
+pylith::topology::RefineUniform::setKeepHierarchy(const bool value) {
+    _keepHierarchy = value;
+}
+
+
+// ----------------------------------------------------------------------
+// Are coarse meshes kept as a hierarchy attached to the refined mesh?
+bool
+pylith::topology::RefineUniform::getKeepHierarchy(void) const {
+    return _keepHierarchy;
+}
+
+
 // ----------------------------------------------------------------------
 // Refine mesh.
 void
@@ -110,30 +134,54 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     } // if
 
     // Refine, keeping original mesh intact.
+    PetscDM dmCur = dmOrig;
     PetscDM dmNew = NULL;
-    err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
-    err = DMRefine(dmOrig, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
-
-    for (int i = 1; i < levels; ++i) {
-        PetscDM dmCur = dmNew;dmNew = NULL;
+    for (int i = 0; i < levels; ++i) {
         err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
         err = DMRefine(dmCur, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
-
-        err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
+        err = DMPlexReorderCohesiveSupports(dmNew);PYLITH_CHECK_ERROR(err);
+        _RefineUniform::fixCellLabel(dmNew);
+
+        if (_keepHierarchy) {
+            // Fine mesh holds a reference to the coarse mesh.
+            err = DMPlexSetRegularRefinement(dmNew, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+            err = DMSetCoarseDM(dmNew, dmCur);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (dmCur != dmOrig) {
+            err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
+        } // if
+        dmCur = dmNew;
     } // for
-    err = DMPlexReorderCohesiveSupports(dmNew);PYLITH_CHECK_ERROR(err);
 
     newMesh->setDM(dmNew);
 
+    _RefineUniform::Events::logger.eventBegin(_RefineUniform::Events::refineCheckTopology);
+    // Check consistency
+    pylith::topology::MeshOps::checkTopology(*newMesh);
+    _RefineUniform::Events::logger.eventEnd(_RefineUniform::Events::refineCheckTopology);
+
+    // newMesh->view("REFINED_MESH", "::ascii_info_detail");
+
+    _RefineUniform::Events::logger.eventEnd(_RefineUniform::Events::refine);
+    PYLITH_METHOD_END;
+} // refine
+
+
+// ------------------------------------------------------------------------------------------------
+// Remove points that are not cells from label identifying materials.
+void
+pylith::topology::_RefineUniform::fixCellLabel(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
     _RefineUniform::Events::logger.eventBegin(_RefineUniform::Events::refineFixCellLabel);
-    // Remove all non-cells from cells label
+
+    PetscErrorCode err;
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
     PetscDMLabel matidLabel = NULL;
     PetscIS valuesIS = NULL;
     const PetscInt *values = NULL;
     PetscInt cStart, cEnd, labelNumValues;
-    err = DMPlexGetHeightStratum(dmNew, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
-    err = DMGetLabel(dmNew, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
     err = DMLabelGetNumValues(matidLabel, &labelNumValues);PYLITH_CHECK_ERROR(err);
     err = DMLabelGetValueIS(matidLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
     err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
@@ -156,18 +204,10 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     } // for
     err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
     err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
-    _RefineUniform::Events::logger.eventEnd(_RefineUniform::Events::refineFixCellLabel);
 
-    _RefineUniform::Events::logger.eventBegin(_RefineUniform::Events::refineCheckTopology);
-    // Check consistency
-    pylith::topology::MeshOps::checkTopology(*newMesh);
-    _RefineUniform::Events::logger.eventEnd(_RefineUniform::Events::refineCheckTopology);
-
-    // newMesh->view("REFINED_MESH", "::ascii_info_detail");
-
-    _RefineUniform::Events::logger.eventEnd(_RefineUniform::Events::refine);
+    _RefineUniform::Events::logger.eventEnd(_RefineUniform::Events::refineFixCellLabel);
     PYLITH_METHOD_END;
-} // refine
+} // fixCellLabel
 
 
 // End of file
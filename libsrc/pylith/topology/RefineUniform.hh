@@ -28,6 +28,20 @@ public:
     /// Deallocate data structures.
     void deallocate(void);
 
+    /** Keep coarse meshes as a hierarchy attached to the refined mesh.
+     *
+     * The hierarchy provides the coarse levels for geometric multigrid.
+     *
+     * @param[in] value True to keep coarse meshes, false otherwise.
+     */
+    void setKeepHierarchy(const bool value);
+
+    /** Are coarse meshes kept as a hierarchy attached to the refined mesh?
+     *
+     * @returns True if coarse meshes are kept, false otherwise.
+     */
+    bool getKeepHierarchy(void) const;
+
     /** Refine mesh.
      *
      * @param newMesh Refined mesh (result).
@@ -38,6 +52,11 @@ public:
                 const Mesh& mesh,
                 const int levels=1);
 
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    bool _keepHierarchy; ///< Keep coarse meshes as hierarchy attached to refined mesh.
+
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
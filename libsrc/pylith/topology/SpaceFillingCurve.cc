@@ -0,0 +1,236 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/topology/SpaceFillingCurve.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::isCohesiveCell()
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::sort()
+#include <vector> // USES std::vector
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _SpaceFillingCurve {
+public:
+
+            /// Sort key for cells.
+            struct CellKey {
+                PetscInt cell; ///< Original cell number.
+                PetscInt material; ///< Value of material label.
+                uint64_t index; ///< Index along space-filling curve.
+                bool isCohesive; ///< True if cohesive cell.
+
+                bool operator<(const CellKey& other) const {
+                    if (isCohesive != other.isCohesive) { return other.isCohesive; }
+                    if (material != other.material) { return material < other.material; }
+                    if (index != other.index) { return index < other.index; }
+                    return cell < other.cell;
+                } // operator<
+
+            }; // CellKey
+
+            static const int numBits; ///< Number of bits per coordinate in curve index.
+
+        }; // _SpaceFillingCurve
+        // 21 bits per coordinate fits the 3D index into 64 bits.
+        const int _SpaceFillingCurve::numBits = 21;
+    } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Reorder vertices, edges, faces, and cells in mesh.
+void
+pylith::topology::SpaceFillingCurve::reorder(topology::Mesh* mesh,
+                                             const CurveEnum curve) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+    PetscErrorCode err = 0;
+
+    PetscDM dmOrig = mesh->getDM();
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmOrig, &spaceDim);PYLITH_CHECK_ERROR(err);
+    assert(spaceDim >= 1 && spaceDim <= 3);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    Stratum cellsStratum(dmOrig, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    const PetscInt numCells = cellsStratum.size();
+
+    PetscDMLabel materialLabel = NULL;
+    const char* const labelName = pylith::topology::Mesh::cells_label_name;
+    err = DMGetLabel(dmOrig, labelName, &materialLabel);PYLITH_CHECK_ERROR(err);
+
+    // Compute cell centroids and bounding box.
+    std::vector<PylithReal> centroids(numCells*spaceDim, 0.0);
+    PylithReal coordsMin[3] = { PETSC_MAX_REAL, PETSC_MAX_REAL, PETSC_MAX_REAL };
+    PylithReal coordsMax[3] = { PETSC_MIN_REAL, PETSC_MIN_REAL, PETSC_MIN_REAL };
+    pylith::topology::CoordsVisitor coordsVisitor(dmOrig);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscScalar* coordsCell = NULL;
+        PetscInt coordsSize = 0;
+        coordsVisitor.getClosure(&coordsCell, &coordsSize, c);
+        const PetscInt numVertices = coordsSize / spaceDim;assert(numVertices > 0);
+        PylithReal* centroid = &centroids[(c-cStart)*spaceDim];
+        for (PetscInt iVertex = 0; iVertex < numVertices; ++iVertex) {
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                centroid[iDim] += PetscRealPart(coordsCell[iVertex*spaceDim+iDim]);
+            } // for
+        } // for
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            centroid[iDim] /= numVertices;
+            coordsMin[iDim] = std::min(coordsMin[iDim], centroid[iDim]);
+            coordsMax[iDim] = std::max(coordsMax[iDim], centroid[iDim]);
+        } // for
+        coordsVisitor.restoreClosure(&coordsCell, &coordsSize, c);
+    } // for
+
+    // Sort cells by material and then by index along curve. Cohesive cells remain at the end.
+    const PylithReal maxCoord = PylithReal((uint32_t(1) << _SpaceFillingCurve::numBits) - 1);
+    std::vector<_SpaceFillingCurve::CellKey> cellKeys(numCells);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        const PylithReal* centroid = &centroids[(c-cStart)*spaceDim];
+        uint32_t coordsInt[3] = { 0, 0, 0 };
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            const PylithReal range = coordsMax[iDim] - coordsMin[iDim];
+            coordsInt[iDim] = (range > 0.0) ? uint32_t((centroid[iDim] - coordsMin[iDim]) / range * maxCoord) : 0;
+        } // for
+
+        _SpaceFillingCurve::CellKey& key = cellKeys[c-cStart];
+        key.cell = c;
+        key.material = -1;
+        if (materialLabel) {
+            err = DMLabelGetValue(materialLabel, c, &key.material);PYLITH_CHECK_ERROR(err);
+        } // if
+        key.isCohesive = MeshOps::isCohesiveCell(dmOrig, c);
+        key.index = computeIndex(coordsInt, spaceDim, _SpaceFillingCurve::numBits, curve);
+    } // for
+    std::sort(cellKeys.begin(), cellKeys.end());
+
+    // Number cells in sorted order and the remaining points in the order they first appear in the
+    // closure of the sorted cells, keeping each depth stratum contiguous. Cohesive cells come last,
+    // so the hybrid points only in their closure remain at the end of each stratum.
+    PetscInt depth = 0;
+    err = DMPlexGetDepth(dmOrig, &depth);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> nextPoint(depth+1);
+    for (PetscInt iDepth = 0; iDepth <= depth; ++iDepth) {
+        PetscInt dStart = 0, dEnd = 0;
+        err = DMPlexGetDepthStratum(dmOrig, iDepth, &dStart, &dEnd);PYLITH_CHECK_ERROR(err);
+        nextPoint[iDepth] = dStart;
+    } // for
+
+    PetscInt* perm = NULL;
+    err = PetscMalloc1(pEnd-pStart, &perm);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        perm[p-pStart] = -1;
+    } // for
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        perm[cellKeys[iCell].cell-pStart] = cStart + iCell;
+    } // for
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dmOrig, cellKeys[iCell].cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            const PetscInt point = closure[2*iPoint];
+            if (perm[point-pStart] < 0) {
+                PetscInt pointDepth = 0;
+                err = DMPlexGetPointDepth(dmOrig, point, &pointDepth);PYLITH_CHECK_ERROR(err);
+                perm[point-pStart] = nextPoint[pointDepth]++;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmOrig, cellKeys[iCell].cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+    // Points not in the closure of any cell keep their relative order.
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        if (perm[p-pStart] < 0) {
+            PetscInt pointDepth = 0;
+            err = DMPlexGetPointDepth(dmOrig, p, &pointDepth);PYLITH_CHECK_ERROR(err);
+            perm[p-pStart] = nextPoint[pointDepth]++;
+        } // if
+    } // for
+
+    PetscIS permutation = NULL;
+    PetscDM dmNew = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, pEnd-pStart, perm, PETSC_OWN_POINTER, &permutation);PYLITH_CHECK_ERROR(err);
+    err = ISSetPermutation(permutation);PYLITH_CHECK_ERROR(err);
+    err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmNew);
+
+    PYLITH_METHOD_END;
+} // reorder
+
+
+// ----------------------------------------------------------------------
+// Compute index of point along space-filling curve.
+uint64_t
+pylith::topology::SpaceFillingCurve::computeIndex(uint32_t coords[],
+                                                  const int dim,
+                                                  const int numBits,
+                                                  const CurveEnum curve) {
+    assert(coords);
+    assert(dim >= 1 && dim <= 3);
+    assert(numBits > 0 && dim*numBits <= 64);
+
+    if (HILBERT == curve) {
+        // Transform coordinates into transposed Hilbert index (J. Skilling, Programming the Hilbert
+        // curve, AIP Conference Proceedings 707, 2004).
+        const uint32_t topBit = uint32_t(1) << (numBits-1);
+        for (uint32_t q = topBit; q > 1; q >>= 1) {
+            const uint32_t p = q - 1;
+            for (int i = 0; i < dim; ++i) {
+                if (coords[i] & q) {
+                    coords[0] ^= p;
+                } else {
+                    const uint32_t t = (coords[0] ^ coords[i]) & p;
+                    coords[0] ^= t;
+                    coords[i] ^= t;
+                } // if/else
+            } // for
+        } // for
+
+        // Gray encode.
+        for (int i = 1; i < dim; ++i) {
+            coords[i] ^= coords[i-1];
+        } // for
+        uint32_t t = 0;
+        for (uint32_t q = topBit; q > 1; q >>= 1) {
+            if (coords[dim-1] & q) {
+                t ^= q - 1;
+            } // if
+        } // for
+        for (int i = 0; i < dim; ++i) {
+            coords[i] ^= t;
+        } // for
+    } // if
+
+    // Interleave bits, most significant bit first.
+    uint64_t index = 0;
+    for (int iBit = numBits-1; iBit >= 0; --iBit) {
+        for (int i = 0; i < dim; ++i) {
+            index = (index << 1) | ((coords[i] >> iBit) & 1);
+        } // for
+    } // for
+
+    return index;
+} // computeIndex
+
+
+// End of file
@@ -0,0 +1,60 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+#include <cstdint> // USES uint64_t
+
+// SpaceFillingCurve ----------------------------------------------------
+/** Reorder mesh points following a space-filling curve through the cell centroids.
+ *
+ * Cells are sorted by material and then by the index of their centroid along the curve. Faces,
+ * edges, and vertices are numbered in the order they are first encountered in the closure of the
+ * reordered cells, so points adjacent in space are also adjacent in memory for every stratum.
+ */
+class pylith::topology::SpaceFillingCurve { // SpaceFillingCurve
+    // PUBLIC ENUM //////////////////////////////////////////////////////////
+public:
+
+    enum CurveEnum {
+        HILBERT=0, ///< Hilbert curve.
+        MORTON=1, ///< Morton (Z-order) curve.
+    }; // CurveEnum
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /** Reorder vertices, edges, faces, and cells of mesh using a space-filling curve.
+     *
+     * @param mesh PyLith finite-element mesh.
+     * @param curve Type of space-filling curve.
+     */
+    static
+    void reorder(topology::Mesh* mesh,
+                 const CurveEnum curve=HILBERT);
+
+    /** Compute index of point along space-filling curve.
+     *
+     * @param[in] coords Integer coordinates of point (modified in place for Hilbert curve).
+     * @param[in] dim Number of coordinates (1, 2, or 3).
+     * @param[in] numBits Number of bits per coordinate.
+     * @param[in] curve Type of space-filling curve.
+     * @returns Index along curve.
+     */
+    static
+    uint64_t computeIndex(uint32_t coords[],
+                          const int dim,
+                          const int numBits,
+                          const CurveEnum curve);
+
+}; // SpaceFillingCurve
+
+// End of file
@@ -0,0 +1,333 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/topology/SubdomainView.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::createSubdomainMesh()
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor::optimizeClosure()
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+
+#include <vector> // USES std::vector
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _SubdomainView {
+public:
+
+            class Events {
+public:
+
+                static
+                void init(void);
+
+                static pylith::utils::EventLogger logger;
+                static PylithInt createMesh;
+                static PylithInt createRegionMesh;
+                static bool isInitialized;
+            };
+
+        }; // _SubdomainView
+    } // topology
+} // pylith
+
+pylith::utils::EventLogger pylith::topology::_SubdomainView::Events::logger;
+PylithInt pylith::topology::_SubdomainView::Events::createMesh;
+PylithInt pylith::topology::_SubdomainView::Events::createRegionMesh;
+bool pylith::topology::_SubdomainView::Events::isInitialized = false;
+
+void
+pylith::topology::_SubdomainView::Events::init(void) {
+    if (isInitialized) {
+        return;
+    } // if
+
+    logger.setClassName("SubdomainView");
+    logger.initialize();
+    createMesh = logger.registerEvent("PL:SubdomainView:createMesh");
+    createRegionMesh = logger.registerEvent("PL:SubdomainView:createRegionMesh");
+
+    isInitialized = true;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::topology::SubdomainView::SubdomainView(const Mesh& mesh,
+                                               const char* labelName,
+                                               const int labelValue,
+                                               const char* descriptiveLabel) :
+    _parentDM(mesh.getDM()),
+    _coordSys(NULL),
+    _labelName(labelName),
+    _descriptiveLabel(descriptiveLabel),
+    _labelValue(labelValue),
+    _cellsIS(NULL),
+    _mesh(NULL),
+    _regionMesh(NULL) {
+    _SubdomainView::Events::init();
+
+    assert(_parentDM);
+    PetscErrorCode err = PetscObjectReference((PetscObject) _parentDM);PYLITH_CHECK_ERROR(err);
+    _coordSys = (mesh.getCoordSys()) ? mesh.getCoordSys()->clone() : NULL;
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::topology::SubdomainView::~SubdomainView(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::topology::SubdomainView::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = ISDestroy(&_cellsIS);PYLITH_CHECK_ERROR(err);
+    delete _mesh;_mesh = NULL;
+    delete _regionMesh;_regionMesh = NULL;
+    err = DMDestroy(&_parentDM);PYLITH_CHECK_ERROR(err);
+    delete _coordSys;_coordSys = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Get PETSc DM of parent mesh.
+PetscDM
+pylith::topology::SubdomainView::getParentDM(void) const {
+    return _parentDM;
+} // getParentDM
+
+
+// ------------------------------------------------------------------------------------------------
+// Get name of label defining subdomain.
+const char*
+pylith::topology::SubdomainView::getLabelName(void) const {
+    return _labelName.c_str();
+} // getLabelName
+
+
+// ------------------------------------------------------------------------------------------------
+// Get value of label defining subdomain.
+int
+pylith::topology::SubdomainView::getLabelValue(void) const {
+    return _labelValue;
+} // getLabelValue
+
+
+// ------------------------------------------------------------------------------------------------
+// Get cells of subdomain in parent DM.
+PetscIS
+pylith::topology::SubdomainView::getCellsIS(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_cellsIS) {
+        assert(_parentDM);
+        PetscDMLabel dmLabel = NULL;
+        PetscErrorCode err = DMGetLabel(_parentDM, _labelName.c_str(), &dmLabel);PYLITH_CHECK_ERROR(err);
+        if (!dmLabel) {
+            std::ostringstream msg;
+            msg << "Could not find group of points '" << _labelName << "' in PETSc DM mesh.";
+            throw std::runtime_error(msg.str());
+        } // if
+        err = DMLabelGetStratumIS(dmLabel, _labelValue, &_cellsIS);PYLITH_CHECK_ERROR(err);
+        if (!_cellsIS) {
+            err = ISCreateStride(PETSC_COMM_SELF, 0, 0, 1, &_cellsIS);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // if
+
+    PYLITH_METHOD_RETURN(_cellsIS);
+} // getCellsIS
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of cells in subdomain on this process.
+PetscInt
+pylith::topology::SubdomainView::getNumCells(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    PetscInt numCells = 0;
+    PetscErrorCode err = ISGetLocalSize(getCellsIS(), &numCells);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(numCells);
+} // getNumCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Get range of cells of subdomain in parent DM.
+void
+pylith::topology::SubdomainView::getCellRange(PetscInt* begin,
+                                              PetscInt* end) const {
+    PYLITH_METHOD_BEGIN;
+    assert(begin);
+    assert(end);
+
+    PetscInt minCell = 0, maxCell = -1;
+    if (getNumCells() > 0) {
+        PetscErrorCode err = ISGetMinMax(getCellsIS(), &minCell, &maxCell);PYLITH_CHECK_ERROR(err);
+    } // if
+    *begin = minCell;
+    *end = maxCell + 1;
+
+    PYLITH_METHOD_END;
+} // getCellRange
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether subdomain covers every cell of the parent mesh on all processes.
+bool
+pylith::topology::SubdomainView::isEntireDomain(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    Stratum cellsStratum(_parentDM, Stratum::HEIGHT, 0);
+    int isEntireLocal = getNumCells() == cellsStratum.size();
+    int isEntire = 0;
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    PetscErrorCode err = PetscObjectGetComm((PetscObject) _parentDM, &comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&isEntireLocal, &isEntire, 1, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(bool(isEntire));
+} // isEntireDomain
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether subdomain mesh has been created.
+bool
+pylith::topology::SubdomainView::hasMesh(void) const {
+    return _mesh != NULL;
+} // hasMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Get mesh for subdomain, creating it if necessary.
+const pylith::topology::Mesh&
+pylith::topology::SubdomainView::getMesh(void) const {
+    if (!_mesh) {
+        _createMesh();
+    } // if
+    assert(_mesh);
+    return *_mesh;
+} // getMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Get mesh for fields restricted to the subdomain, creating it if necessary.
+const pylith::topology::Mesh&
+pylith::topology::SubdomainView::getRegionMesh(void) const {
+    if (!_regionMesh) {
+        if (isEntireDomain()) {
+            return getMesh();
+        } // if
+        _createRegionMesh();
+    } // if
+    assert(_regionMesh);
+    return *_regionMesh;
+} // getRegionMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Get name of label marking the closure of the subdomain cells in the region mesh.
+const char*
+pylith::topology::SubdomainView::getRegionLabelName(void) {
+    return "subdomain region";
+} // getRegionLabelName
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh for subdomain.
+void
+pylith::topology::SubdomainView::_createMesh(void) const {
+    PYLITH_METHOD_BEGIN;
+    _SubdomainView::Events::logger.eventBegin(_SubdomainView::Events::createMesh);
+
+    PetscErrorCode err = 0;
+    delete _mesh;_mesh = NULL;
+    if (isEntireDomain()) {
+        // Clone shares topology, coordinates, and labels with the parent DM.
+        PetscDM dmClone = NULL;
+        err = DMClone(_parentDM, &dmClone);PYLITH_CHECK_ERROR(err);
+        _mesh = new pylith::topology::Mesh();assert(_mesh);
+        _mesh->setCoordSys(_coordSys);
+        _mesh->setDM(dmClone, _descriptiveLabel.c_str());
+    } else {
+        // Filter a clone holding only the labels needed by the subdomain mesh, instead of filtering
+        // every label (materials, boundaries, faults) of the parent mesh.
+        PetscDM dmTrimmed = NULL;
+        err = DMClone(_parentDM, &dmTrimmed);PYLITH_CHECK_ERROR(err);
+        PetscInt numLabels = 0;
+        err = DMGetNumLabels(dmTrimmed, &numLabels);PYLITH_CHECK_ERROR(err);
+        std::vector<std::string> removeNames;
+        for (PetscInt iLabel = 0; iLabel < numLabels; ++iLabel) {
+            const char* name = NULL;
+            err = DMGetLabelName(dmTrimmed, iLabel, &name);PYLITH_CHECK_ERROR(err);
+            const std::string labelName(name);
+            if ((labelName != _labelName) && (labelName != "depth") && (labelName != "celltype")) {
+                removeNames.push_back(labelName);
+            } // if
+        } // for
+        for (size_t i = 0; i < removeNames.size(); ++i) {
+            err = DMRemoveLabel(dmTrimmed, removeNames[i].c_str(), NULL);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        pylith::topology::Mesh meshTrimmed;
+        meshTrimmed.setCoordSys(_coordSys);
+        meshTrimmed.setDM(dmTrimmed);
+        _mesh = MeshOps::createSubdomainMesh(meshTrimmed, _labelName.c_str(), _labelValue, _descriptiveLabel.c_str());assert(_mesh);
+    } // if/else
+    pylith::topology::CoordsVisitor::optimizeClosure(_mesh->getDM());
+
+    _SubdomainView::Events::logger.eventEnd(_SubdomainView::Events::createMesh);
+    PYLITH_METHOD_END;
+} // _createMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Create region mesh for fields restricted to the subdomain.
+void
+pylith::topology::SubdomainView::_createRegionMesh(void) const {
+    PYLITH_METHOD_BEGIN;
+    _SubdomainView::Events::logger.eventBegin(_SubdomainView::Events::createRegionMesh);
+
+    // Clone shares topology, coordinates, and labels with the parent DM; only the region label is new.
+    PetscErrorCode err = 0;
+    PetscDM dmRegion = NULL;
+    err = DMClone(_parentDM, &dmRegion);PYLITH_CHECK_ERROR(err);
+    const char* regionLabelName = getRegionLabelName();
+    err = DMCreateLabel(dmRegion, regionLabelName);PYLITH_CHECK_ERROR(err);
+    PetscDMLabel regionLabel = NULL;
+    err = DMGetLabel(dmRegion, regionLabelName, &regionLabel);PYLITH_CHECK_ERROR(err);assert(regionLabel);
+    err = DMLabelSetStratumIS(regionLabel, 1, getCellsIS());PYLITH_CHECK_ERROR(err);
+    err = DMPlexLabelComplete(dmRegion, regionLabel);PYLITH_CHECK_ERROR(err);
+
+    delete _regionMesh;_regionMesh = new pylith::topology::Mesh();assert(_regionMesh);
+    _regionMesh->setCoordSys(_coordSys);
+    _regionMesh->setDM(dmRegion, _descriptiveLabel.c_str());
+
+    _SubdomainView::Events::logger.eventEnd(_SubdomainView::Events::createRegionMesh);
+    PYLITH_METHOD_END;
+} // _createRegionMesh
+
+
+// End of file
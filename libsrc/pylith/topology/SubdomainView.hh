@@ -0,0 +1,167 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
+
+#include "pylith/utils/petscfwd.h" // HASA PetscDM, PetscIS
+
+#include <string> // HASA std::string
+
+/** View of the cells in a parent mesh with a given label value.
+ *
+ * The view holds a reference to the parent DM and the cells of the subdomain as an index set and
+ * point range over the parent DM. Fields restricted to the subdomain (auxiliary, derived, and
+ * diagnostic fields of a material) use the region mesh from getRegionMesh(), a clone of the parent
+ * DM with a label marking the closure of the subdomain cells. It shares the topology, coordinates,
+ * and labels of the parent DM, so PETSc assembly over the label on the parent DM uses these fields
+ * directly.
+ *
+ * A standalone mesh of the subdomain is created by getMesh() only when it is requested, for example
+ * by observers writing output over the subdomain. If the label covers every cell of the parent
+ * mesh, the mesh shares the topology and coordinates of the parent DM. Otherwise it is filtered from
+ * a clone of the parent DM that holds only the label defining the subdomain, so the cost does not
+ * depend on the number of other labels (materials, boundaries, faults).
+ */
+class pylith::topology::SubdomainView {
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /** Constructor.
+     *
+     * The view holds a reference to the DM of the parent mesh, so it does not depend on the
+     * lifetime of the parent Mesh object.
+     *
+     * @param[in] mesh Parent mesh.
+     * @param[in] labelName Name of label defining subdomain.
+     * @param[in] labelValue Value of label defining subdomain.
+     * @param[in] descriptiveLabel Name for subdomain mesh.
+     */
+    SubdomainView(const Mesh& mesh,
+                  const char* labelName,
+                  const int labelValue,
+                  const char* descriptiveLabel);
+
+    /// Destructor
+    ~SubdomainView(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Get PETSc DM of parent mesh.
+     *
+     * @returns PETSc DM of parent mesh.
+     */
+    PetscDM getParentDM(void) const;
+
+    /** Get name of label defining subdomain.
+     *
+     * @returns Name of label.
+     */
+    const char* getLabelName(void) const;
+
+    /** Get value of label defining subdomain.
+     *
+     * @returns Label value.
+     */
+    int getLabelValue(void) const;
+
+    /** Get cells of subdomain in parent DM.
+     *
+     * @returns PETSc IS with cells (owned by view).
+     */
+    PetscIS getCellsIS(void) const;
+
+    /** Get number of cells in subdomain on this process.
+     *
+     * @returns Number of cells.
+     */
+    PetscInt getNumCells(void) const;
+
+    /** Get range of cells of subdomain in parent DM.
+     *
+     * @param[out] begin First cell in subdomain.
+     * @param[out] end One past the last cell in subdomain.
+     */
+    void getCellRange(PetscInt* begin,
+                      PetscInt* end) const;
+
+    /** Check whether subdomain covers every cell of the parent mesh on all processes.
+     *
+     * Collective.
+     *
+     * @returns True if subdomain includes every cell, false otherwise.
+     */
+    bool isEntireDomain(void) const;
+
+    /** Check whether subdomain mesh has been created.
+     *
+     * @returns True if subdomain mesh exists, false otherwise.
+     */
+    bool hasMesh(void) const;
+
+    /** Get mesh for subdomain, creating it if necessary.
+     *
+     * Collective the first time it is called.
+     *
+     * @returns Subdomain mesh.
+     */
+    const Mesh& getMesh(void) const;
+
+    /** Get mesh for fields restricted to the subdomain, creating it if necessary.
+     *
+     * If the subdomain covers the entire parent mesh, this is the mesh from getMesh(). Otherwise it
+     * is a clone of the parent DM with the region label marking the closure of the subdomain cells.
+     *
+     * Collective the first time it is called.
+     *
+     * @returns Mesh sharing the topology of the parent DM.
+     */
+    const Mesh& getRegionMesh(void) const;
+
+    /** Get name of label marking the closure of the subdomain cells in the region mesh.
+     *
+     * @returns Name of label.
+     */
+    static
+    const char* getRegionLabelName(void);
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /// Create mesh for subdomain.
+    void _createMesh(void) const;
+
+    /// Create region mesh for fields restricted to the subdomain.
+    void _createRegionMesh(void) const;
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    PetscDM _parentDM; ///< PETSc DM of parent mesh (holds reference).
+    spatialdata::geocoords::CoordSys* _coordSys; ///< Coordinate system of parent mesh.
+    std::string _labelName; ///< Name of label defining subdomain.
+    std::string _descriptiveLabel; ///< Name for subdomain mesh.
+    int _labelValue; ///< Value of label defining subdomain.
+    mutable PetscIS _cellsIS; ///< Cells of subdomain in parent DM.
+    mutable Mesh* _mesh; ///< Subdomain mesh (created on demand).
+    mutable Mesh* _regionMesh; ///< Clone of parent mesh with region label (created on demand).
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    SubdomainView(const SubdomainView&); ///< Not implemented
+    const SubdomainView& operator=(const SubdomainView&); ///< Not implemented
+
+}; // SubdomainView
+
+// End of file
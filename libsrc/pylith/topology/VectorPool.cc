@@ -0,0 +1,192 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/topology/VectorPool.hh" // implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+// Create pool for layout of DM.
+pylith::topology::VectorPool*
+pylith::topology::VectorPool::create(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+
+    VectorPool* pool = new VectorPool(dm);assert(pool);
+
+    PYLITH_METHOD_RETURN(pool);
+} // create
+
+
+// ------------------------------------------------------------------------------------------------
+// Add reference to pool.
+pylith::topology::VectorPool*
+pylith::topology::VectorPool::addReference(VectorPool* pool) {
+    assert(pool);
+    ++pool->_numReferences;
+    return pool;
+} // addReference
+
+
+// ------------------------------------------------------------------------------------------------
+// Release reference to pool, destroying it if it is the last reference.
+void
+pylith::topology::VectorPool::release(VectorPool** pool) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!pool || !*pool) {
+        PYLITH_METHOD_END;
+    } // if
+    assert((*pool)->_numReferences > 0);
+    if (0 == --(*pool)->_numReferences) {
+        delete *pool;
+    } // if
+    *pool = NULL;
+
+    PYLITH_METHOD_END;
+} // release
+
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::topology::VectorPool::VectorPool(PetscDM dm) :
+    _dm(dm),
+    _numCheckedOut(0),
+    _numReferences(1) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PetscObjectReference((PetscObject) _dm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::topology::VectorPool::~VectorPool(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Vectors checked out of the pool are owned by the fields until they are returned.
+    PetscErrorCode err = PETSC_SUCCESS;
+    for (size_t i = 0; i < _localVectors.size(); ++i) {
+        err = VecDestroy(&_localVectors[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _localVectors.clear();
+    for (size_t i = 0; i < _globalVectors.size(); ++i) {
+        err = VecDestroy(&_globalVectors[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _globalVectors.clear();
+    err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Get DM with layout for vectors in pool.
+PetscDM
+pylith::topology::VectorPool::getDM(void) const {
+    return _dm;
+} // getDM
+
+
+// ------------------------------------------------------------------------------------------------
+// Check out local vector from pool.
+PetscVec
+pylith::topology::VectorPool::checkoutLocalVector(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_dm);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscVec vector = NULL;
+    if (_localVectors.size() > 0) {
+        vector = _localVectors.back();
+        _localVectors.pop_back();
+    } else {
+        err = DMCreateLocalVector(_dm, &vector);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = VecSet(vector, 0.0);PYLITH_CHECK_ERROR(err);
+    ++_numCheckedOut;
+
+    PYLITH_METHOD_RETURN(vector);
+} // checkoutLocalVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Return local vector to pool.
+void
+pylith::topology::VectorPool::returnLocalVector(PetscVec* vector) {
+    assert(vector);
+
+    if (*vector) {
+        assert(_numCheckedOut > 0);
+        _localVectors.push_back(*vector);
+        --_numCheckedOut;
+        *vector = NULL;
+    } // if
+} // returnLocalVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Check out global vector from pool.
+PetscVec
+pylith::topology::VectorPool::checkoutGlobalVector(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_dm);
+
+    PetscVec vector = NULL;
+    if (_globalVectors.size() > 0) {
+        vector = _globalVectors.back();
+        _globalVectors.pop_back();
+    } else {
+        PetscErrorCode err = DMCreateGlobalVector(_dm, &vector);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    ++_numCheckedOut;
+
+    PYLITH_METHOD_RETURN(vector);
+} // checkoutGlobalVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Return global vector to pool.
+void
+pylith::topology::VectorPool::returnGlobalVector(PetscVec* vector) {
+    assert(vector);
+
+    if (*vector) {
+        assert(_numCheckedOut > 0);
+        _globalVectors.push_back(*vector);
+        --_numCheckedOut;
+        *vector = NULL;
+    } // if
+} // returnGlobalVector
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of vectors available in pool.
+size_t
+pylith::topology::VectorPool::getNumAvailable(void) const {
+    return _localVectors.size() + _globalVectors.size();
+} // getNumAvailable
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of vectors checked out of pool.
+size_t
+pylith::topology::VectorPool::getNumCheckedOut(void) const {
+    return _numCheckedOut;
+} // getNumCheckedOut
+
+
+// End of file
@@ -0,0 +1,127 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // HASA PetscDM, PetscVec
+
+#include <vector> // HASA std::vector
+
+/** Pool of PETSc vectors for fields that share a layout (DM and section).
+ *
+ * Fields created with the layout of another field share the DM of the source field instead of
+ * cloning the mesh and copying the discretization. Their vectors are checked out of the pool
+ * associated with the layout and returned to the pool when the field is deallocated, so that
+ * later fields with the same layout reuse the storage.
+ *
+ * The pool is reference counted. Each field using the pool holds a reference, and the vectors in
+ * the pool are destroyed when the last reference is released.
+ */
+class pylith::topology::VectorPool {
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /** Create pool for layout of DM.
+     *
+     * @param[in] dm PETSc DM with layout (local section) for vectors.
+     * @returns Pool with one reference.
+     */
+    static
+    VectorPool* create(PetscDM dm);
+
+    /** Add reference to pool.
+     *
+     * @param[in] pool Vector pool.
+     * @returns Vector pool.
+     */
+    static
+    VectorPool* addReference(VectorPool* pool);
+
+    /** Release reference to pool, destroying it if it is the last reference.
+     *
+     * @param[inout] pool Vector pool (set to NULL on return).
+     */
+    static
+    void release(VectorPool** pool);
+
+    /** Get DM with layout for vectors in pool.
+     *
+     * @returns PETSc DM.
+     */
+    PetscDM getDM(void) const;
+
+    /** Check out local vector from pool.
+     *
+     * @returns Local vector with all values set to zero.
+     */
+    PetscVec checkoutLocalVector(void);
+
+    /** Return local vector to pool.
+     *
+     * @param[inout] vector Local vector (set to NULL on return).
+     */
+    void returnLocalVector(PetscVec* vector);
+
+    /** Check out global vector from pool.
+     *
+     * @returns Global vector.
+     */
+    PetscVec checkoutGlobalVector(void);
+
+    /** Return global vector to pool.
+     *
+     * @param[inout] vector Global vector (set to NULL on return).
+     */
+    void returnGlobalVector(PetscVec* vector);
+
+    /** Get number of vectors available in pool.
+     *
+     * @returns Number of local and global vectors in pool.
+     */
+    size_t getNumAvailable(void) const;
+
+    /** Get number of vectors checked out of pool.
+     *
+     * @returns Number of local and global vectors checked out.
+     */
+    size_t getNumCheckedOut(void) const;
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Constructor.
+     *
+     * @param[in] dm PETSc DM with layout for vectors.
+     */
+    VectorPool(PetscDM dm);
+
+    /// Destructor.
+    ~VectorPool(void);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    PetscDM _dm; ///< PETSc DM with layout for vectors.
+    std::vector<PetscVec> _localVectors; ///< Local vectors available in pool.
+    std::vector<PetscVec> _globalVectors; ///< Global vectors available in pool.
+    size_t _numCheckedOut; ///< Number of vectors checked out of pool.
+    size_t _numReferences; ///< Number of references to pool.
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    VectorPool(const VectorPool&); ///< Not implemented
+    const VectorPool& operator=(const VectorPool&); ///< Not implemented
+
+}; // VectorPool
+
+// End of file
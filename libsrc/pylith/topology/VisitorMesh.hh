@@ -164,7 +164,7 @@ public:
 
     /** Optimize the closure operator by creating index for closures.
      *
-     * :TODO: Remove this method. Call static version when setting up fields.
+     * @note The index is created automatically on the first call to getClosure() or setClosure().
      */
     void optimizeClosure(void);
 
@@ -184,6 +184,17 @@ private:
     PetscSection _globalSection; ///< Cached PETSc global section.
     PetscScalar* _localArray; ///< Cached local array
     SectionEnum _selectedSection; ///< Current selected section.
+    mutable bool _hasClosureIndex; ///< True if local section has closure index for DM.
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Create closure index for local section if it does not already exist.
+     *
+     * The closure index is attached to the local section, so it is shared by all visitors and
+     * fields using the section and is discarded with the section when the layout changes.
+     */
+    void _setupClosureIndex(void) const;
 
     // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
@@ -19,9 +19,11 @@ namespace pylith {
         class SubmeshIS;
         class Stratum;
         class StratumIS;
+        class SubdomainView;
 
         class FieldBase;
         class Field;
+        class VectorPool;
         class VecVisitorMesh;
         class VecVisitorSubmesh;
 
@@ -34,8 +36,11 @@ namespace pylith {
         class MatVisitorSubmesh;
 
         class Distributor;
+        class MeshCache;
+        class PartitionCostModel;
         class RefineUniform;
         class ReverseCuthillMcKee;
+        class SpaceFillingCurve;
 
     } // topology
 } // pylith
@@ -12,6 +12,7 @@
 
 #include "pylith/utils/EventLogger.hh" // Implementation of class methods
 
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 
 #include <stdexcept> // USES std::runtime_error
@@ -131,4 +132,31 @@ pylith::utils::EventLogger::getStageId(const char* name) {
 } // getStageId
 
 
+// ----------------------------------------------------------------------
+// Log stage begin.
+void
+pylith::utils::EventLogger::stagePush(const int id) {
+    PetscLogStagePush(id);
+
+    // Track high-water mark of registered memory for stage.
+    const char* name = NULL;
+    for (map_event_type::const_iterator iter = _stages.begin(); iter != _stages.end(); ++iter) {
+        if (iter->second == id) {
+            name = iter->first.c_str();
+            break;
+        } // if
+    } // for
+    MemoryRegistry::pushStage(name);
+} // stagePush
+
+
+// ----------------------------------------------------------------------
+// Log stage end.
+void
+pylith::utils::EventLogger::stagePop(void) {
+    PetscLogStagePop();
+    MemoryRegistry::popStage();
+} // stagePop
+
+
 // End of file
@@ -0,0 +1,416 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/utils/MemoryRegistry.hh" // Implementation of class methods
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petscdmplex.h" // USES DMPlexGetChart()
+#include "petscmat.h" // USES MatGetInfo()
+
+#include <algorithm> // USES std::max(), std::min()
+#include <iomanip> // USES std::setw(), std::setprecision()
+#include <map> // USES std::map
+#include <sstream> // USES std::ostringstream, std::istringstream
+#include <vector> // USES std::vector
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _MemoryRegistry {
+public:
+
+            /// Registered object.
+            struct Entry {
+                std::string owner; ///< Name of owning component.
+                std::string category; ///< Category of memory.
+                std::string label; ///< Label of object.
+                size_t bytes; ///< Number of bytes.
+            };
+
+            /// State of registry.
+            struct Data {
+                std::map<const void*, Entry> entries; ///< Registered objects.
+                std::vector<std::string> owners; ///< Stack of owners.
+                std::vector<std::string> stages; ///< Stack of logging stages.
+                std::vector<std::string> stageOrder; ///< Logging stages in order of first use.
+                std::map<std::string, size_t> stageHighWater; ///< High-water mark for each stage.
+                size_t totalBytes; ///< Total number of bytes registered.
+
+                Data(void) :
+                    totalBytes(0) {}
+
+
+            };
+
+            /** Get state of registry.
+             *
+             * @returns State of registry.
+             */
+            static
+            Data& data(void) {
+                static Data registry;
+                return registry;
+            } // data
+
+            /// Update high-water mark for current stage.
+            static
+            void updateHighWater(void);
+
+            /** Convert bytes to MB.
+             *
+             * @param[in] bytes Number of bytes.
+             * @returns Number of MB.
+             */
+            static
+            double toMB(const size_t bytes) {
+                return double(bytes) / (1024.0*1024.0);
+            } // toMB
+
+            static const char* defaultOwner; ///< Owner when no component is current.
+            static const char* defaultStage; ///< Stage when no stage is current.
+        }; // _MemoryRegistry
+    } // utils
+} // pylith
+
+const char* pylith::utils::_MemoryRegistry::defaultOwner = "problem";
+const char* pylith::utils::_MemoryRegistry::defaultStage = "Main Stage";
+
+// ------------------------------------------------------------------------------------------------
+// Register memory owned by object.
+void
+pylith::utils::MemoryRegistry::add(const void* object,
+                                   const char* category,
+                                   const char* label,
+                                   const size_t bytes) {
+    assert(object);
+    _MemoryRegistry::Data& registry = _MemoryRegistry::data();
+
+    std::map<const void*, _MemoryRegistry::Entry>::iterator iter = registry.entries.find(object);
+    if (iter != registry.entries.end()) {
+        registry.totalBytes -= iter->second.bytes;
+    } else {
+        _MemoryRegistry::Entry entry;
+        entry.owner = registry.owners.size() > 0 ? registry.owners.back() : _MemoryRegistry::defaultOwner;
+        iter = registry.entries.insert(std::make_pair(object, entry)).first;
+    } // if/else
+    iter->second.category = category ? category : "";
+    iter->second.label = label ? label : "";
+    iter->second.bytes = bytes;
+    registry.totalBytes += bytes;
+
+    _MemoryRegistry::updateHighWater();
+} // add
+
+
+// ------------------------------------------------------------------------------------------------
+// Remove object from registry.
+void
+pylith::utils::MemoryRegistry::remove(const void* object) {
+    _MemoryRegistry::Data& registry = _MemoryRegistry::data();
+
+    std::map<const void*, _MemoryRegistry::Entry>::iterator iter = registry.entries.find(object);
+    if (iter != registry.entries.end()) {
+        registry.totalBytes -= iter->second.bytes;
+        registry.entries.erase(iter);
+    } // if
+} // remove
+
+
+// ------------------------------------------------------------------------------------------------
+// Set owner for objects registered until popOwner() is called.
+void
+pylith::utils::MemoryRegistry::pushOwner(const char* owner) {
+    _MemoryRegistry::data().owners.push_back(owner ? owner : _MemoryRegistry::defaultOwner);
+} // pushOwner
+
+
+// ------------------------------------------------------------------------------------------------
+// Restore previous owner.
+void
+pylith::utils::MemoryRegistry::popOwner(void) {
+    _MemoryRegistry::Data& registry = _MemoryRegistry::data();
+    if (registry.owners.size() > 0) {
+        registry.owners.pop_back();
+    } // if
+} // popOwner
+
+
+// ------------------------------------------------------------------------------------------------
+// Set current logging stage for high-water marks.
+void
+pylith::utils::MemoryRegistry::pushStage(const char* stage) {
+    _MemoryRegistry::data().stages.push_back(stage ? stage : _MemoryRegistry::defaultStage);
+    _MemoryRegistry::updateHighWater();
+} // pushStage
+
+
+// ------------------------------------------------------------------------------------------------
+// Restore previous logging stage.
+void
+pylith::utils::MemoryRegistry::popStage(void) {
+    _MemoryRegistry::Data& registry = _MemoryRegistry::data();
+    if (registry.stages.size() > 0) {
+        registry.stages.pop_back();
+    } // if
+    _MemoryRegistry::updateHighWater();
+} // popStage
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of bytes currently registered on this process.
+size_t
+pylith::utils::MemoryRegistry::getLocalBytes(void) {
+    return _MemoryRegistry::data().totalBytes;
+} // getLocalBytes
+
+
+// ------------------------------------------------------------------------------------------------
+// Create report of memory usage by component, process, and logging stage.
+std::string
+pylith::utils::MemoryRegistry::report(MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    const _MemoryRegistry::Data& registry = _MemoryRegistry::data();
+
+    // Serialize local totals for each owner and category, and high-water mark for each stage.
+    typedef std::map<std::pair<std::string, std::string>, size_t> component_map;
+    component_map componentsLocal;
+    for (std::map<const void*, _MemoryRegistry::Entry>::const_iterator iter = registry.entries.begin(); iter != registry.entries.end(); ++iter) {
+        componentsLocal[std::make_pair(iter->second.owner, iter->second.category)] += iter->second.bytes;
+    } // for
+    std::ostringstream bufferLocal;
+    for (component_map::const_iterator iter = componentsLocal.begin(); iter != componentsLocal.end(); ++iter) {
+        bufferLocal << "C\t" << iter->first.first << "\t" << iter->first.second << "\t" << iter->second << "\n";
+    } // for
+    for (size_t i = 0; i < registry.stageOrder.size(); ++i) {
+        const std::string& stage = registry.stageOrder[i];
+        bufferLocal << "S\t" << stage << "\t" << registry.stageHighWater.find(stage)->second << "\n";
+    } // for
+    const std::string& strLocal = bufferLocal.str();
+
+    // Gather to process 0.
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMPIInt commRank = 0, commSize = 0;
+    err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    int sizeLocal = strLocal.length();
+    unsigned long long totalLocal = registry.totalBytes;
+    std::vector<int> sizes(commRank ? 0 : commSize);
+    std::vector<unsigned long long> totals(commRank ? 0 : commSize);
+    err = MPI_Gather(&sizeLocal, 1, MPI_INT, commRank ? NULL : &sizes[0], 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Gather(&totalLocal, 1, MPI_UNSIGNED_LONG_LONG, commRank ? NULL : &totals[0], 1, MPI_UNSIGNED_LONG_LONG, 0, comm);PYLITH_CHECK_ERROR(err);
+    std::vector<int> offsets(commRank ? 0 : commSize, 0);
+    std::string strGlobal;
+    if (!commRank) {
+        for (int i = 1; i < commSize; ++i) {
+            offsets[i] = offsets[i-1] + sizes[i-1];
+        } // for
+        strGlobal.resize(offsets[commSize-1] + sizes[commSize-1]);
+    } // if
+    err = MPI_Gatherv(strLocal.c_str(), sizeLocal, MPI_CHAR,
+                      commRank ? NULL : &strGlobal[0], commRank ? NULL : &sizes[0], commRank ? NULL : &offsets[0], MPI_CHAR,
+                      0, comm);PYLITH_CHECK_ERROR(err);
+    if (commRank) {
+        PYLITH_METHOD_RETURN(std::string());
+    } // if
+
+    // Aggregate over processes.
+    component_map componentsTotal;
+    component_map componentsMax;
+    std::vector<std::string> stageOrder;
+    std::map<std::string, size_t> stageMax;
+    std::istringstream sin(strGlobal);
+    std::string line;
+    while (std::getline(sin, line)) {
+        std::istringstream sline(line);
+        std::string type;
+        std::getline(sline, type, '\t');
+        if (type == "C") {
+            std::string owner, category;
+            size_t bytes = 0;
+            std::getline(sline, owner, '\t');
+            std::getline(sline, category, '\t');
+            sline >> bytes;
+            const std::pair<std::string, std::string> key(owner, category);
+            componentsTotal[key] += bytes;
+            componentsMax[key] = std::max(componentsMax[key], bytes);
+        } else if (type == "S") {
+            std::string stage;
+            size_t bytes = 0;
+            std::getline(sline, stage, '\t');
+            sline >> bytes;
+            if (!stageMax.count(stage)) {
+                stageOrder.push_back(stage);
+            } // if
+            stageMax[stage] = std::max(stageMax[stage], bytes);
+        } // if/else
+    } // while
+
+    std::ostringstream msg;
+    msg << std::fixed << std::setprecision(2);
+    msg << "Registered memory by component (MB), total over processes and maximum on a process:\n";
+    msg << "  " << std::left << std::setw(32) << "component" << std::setw(12) << "category"
+        << std::right << std::setw(14) << "total" << std::setw(14) << "max" << "\n";
+    size_t total = 0;
+    for (component_map::const_iterator iter = componentsTotal.begin(); iter != componentsTotal.end(); ++iter) {
+        msg << "  " << std::left << std::setw(32) << iter->first.first << std::setw(12) << iter->first.second
+            << std::right << std::setw(14) << _MemoryRegistry::toMB(iter->second)
+            << std::setw(14) << _MemoryRegistry::toMB(componentsMax[iter->first]) << "\n";
+        total += iter->second;
+    } // for
+    msg << "  " << std::left << std::setw(44) << "total" << std::right << std::setw(14) << _MemoryRegistry::toMB(total) << "\n";
+
+    unsigned long long totalMin = totals[0];
+    unsigned long long totalMax = totals[0];
+    for (int i = 0; i < commSize; ++i) {
+        totalMin = std::min(totalMin, totals[i]);
+        totalMax = std::max(totalMax, totals[i]);
+    } // for
+    msg << "Registered memory by process (MB): min=" << _MemoryRegistry::toMB(totalMin)
+        << ", max=" << _MemoryRegistry::toMB(totalMax) << ", mean=" << _MemoryRegistry::toMB(total / commSize) << "\n";
+    for (int i = 0; i < commSize; ++i) {
+        msg << "  [" << i << "] " << _MemoryRegistry::toMB(totals[i]) << "\n";
+    } // for
+
+    msg << "High-water mark of registered memory by stage (MB), maximum on a process:\n";
+    for (size_t i = 0; i < stageOrder.size(); ++i) {
+        msg << "  " << std::left << std::setw(32) << stageOrder[i] << std::right << std::setw(14)
+            << _MemoryRegistry::toMB(stageMax[stageOrder[i]]) << "\n";
+    } // for
+
+    PYLITH_METHOD_RETURN(msg.str());
+} // report
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of bytes in values of vector on this process.
+size_t
+pylith::utils::MemoryRegistry::vectorBytes(PetscVec vector) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscInt size = 0;
+    if (vector) {
+        PetscErrorCode err = VecGetLocalSize(vector, &size);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(size_t(size)*sizeof(PetscScalar));
+} // vectorBytes
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of bytes in nonzero values and indices of matrix on this process.
+size_t
+pylith::utils::MemoryRegistry::matrixBytes(PetscMat matrix) {
+    PYLITH_METHOD_BEGIN;
+
+    size_t bytes = 0;
+    if (matrix) {
+        PetscErrorCode err = PETSC_SUCCESS;
+        MatInfo info;
+        PetscInt numRows = 0;
+        err = MatGetInfo(matrix, MAT_LOCAL, &info);PYLITH_CHECK_ERROR(err);
+        err = MatGetLocalSize(matrix, &numRows, NULL);PYLITH_CHECK_ERROR(err);
+        bytes = size_t(info.nz_allocated)*(sizeof(PetscScalar)+sizeof(PetscInt)) + size_t(numRows+1)*sizeof(PetscInt);
+    } // if
+
+    PYLITH_METHOD_RETURN(bytes);
+} // matrixBytes
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of bytes in layout of section on this process.
+size_t
+pylith::utils::MemoryRegistry::sectionBytes(PetscSection section) {
+    PYLITH_METHOD_BEGIN;
+
+    size_t bytes = 0;
+    if (section) {
+        PetscErrorCode err = PETSC_SUCCESS;
+        PetscInt pStart = 0, pEnd = 0, numFields = 0;
+        err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetNumFields(section, &numFields);PYLITH_CHECK_ERROR(err);
+        // Dof and offset for section and each field.
+        bytes = size_t(pEnd-pStart)*size_t(1+numFields)*2*sizeof(PetscInt);
+    } // if
+
+    PYLITH_METHOD_RETURN(bytes);
+} // sectionBytes
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of bytes in topology, coordinates, and labels of DMPlex on this process.
+size_t
+pylith::utils::MemoryRegistry::dmBytes(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+
+    size_t bytes = 0;
+    if (dm) {
+        PetscErrorCode err = PETSC_SUCCESS;
+        PetscInt pStart = 0, pEnd = 0, numCones = 0;
+        err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt coneSize = 0;
+            err = DMPlexGetConeSize(dm, point, &coneSize);PYLITH_CHECK_ERROR(err);
+            numCones += coneSize;
+        } // for
+        // Cones, cone orientations, and supports plus cone and support sections.
+        bytes += size_t(numCones)*3*sizeof(PetscInt) + size_t(pEnd-pStart)*4*sizeof(PetscInt);
+
+        PetscVec coordinates = NULL;
+        err = DMGetCoordinatesLocal(dm, &coordinates);PYLITH_CHECK_ERROR(err);
+        bytes += vectorBytes(coordinates);
+
+        PetscInt numLabels = 0;
+        err = DMGetNumLabels(dm, &numLabels);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iLabel = 0; iLabel < numLabels; ++iLabel) {
+            PetscDMLabel label = NULL;
+            PetscIS valuesIS = NULL;
+            PetscInt numValues = 0;
+            const PetscInt* values = NULL;
+            err = DMGetLabelByNum(dm, iLabel, &label);PYLITH_CHECK_ERROR(err);
+            err = DMLabelGetValueIS(label, &valuesIS);PYLITH_CHECK_ERROR(err);
+            err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+                PetscInt stratumSize = 0;
+                err = DMLabelGetStratumSize(label, values[iValue], &stratumSize);PYLITH_CHECK_ERROR(err);
+                bytes += size_t(stratumSize)*sizeof(PetscInt);
+            } // for
+            err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // if
+
+    PYLITH_METHOD_RETURN(bytes);
+} // dmBytes
+
+
+// ------------------------------------------------------------------------------------------------
+// Update high-water mark for current stage.
+void
+pylith::utils::_MemoryRegistry::updateHighWater(void) {
+    Data& registry = data();
+    const std::string& stage = registry.stages.size() > 0 ? registry.stages.back() : defaultStage;
+    std::map<std::string, size_t>::iterator iter = registry.stageHighWater.find(stage);
+    if (iter == registry.stageHighWater.end()) {
+        registry.stageOrder.push_back(stage);
+        registry.stageHighWater[stage] = registry.totalBytes;
+    } else {
+        iter->second = std::max(iter->second, registry.totalBytes);
+    } // if/else
+} // updateHighWater
+
+
+// End of file
@@ -0,0 +1,163 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/utils/utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat, PetscDM
+#include "pylith/utils/types.hh" // USES PetscSection
+
+#include <string> // USES std::string
+#include <cstddef> // USES size_t
+#include <mpi.h> // USES MPI_Comm
+
+// MemoryRegistry -------------------------------------------------------
+/** @brief Registry of memory used by PyLith objects.
+ *
+ * Objects holding large PETSc data structures (fields, meshes, matrices, and output buffers)
+ * register the number of bytes they own along with a category and a label. Each entry is tagged
+ * with the owning component (material, boundary condition, fault, or observer) that is current
+ * when the object is first registered; objects created outside a component belong to the problem.
+ * The registry tracks the high-water mark of the registered memory for each logging stage and
+ * creates a report with the breakdown by component and by process.
+ *
+ * The sizes are estimates of the storage in the PETSc objects (values, indices, and layouts); they
+ * do not include the overhead of the memory allocator or PETSc bookkeeping.
+ */
+class pylith::utils::MemoryRegistry {
+    friend class TestMemoryRegistry; // unit testing
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+    /** Register memory owned by object.
+     *
+     * If the object is already registered, the category, label, and size are updated while the
+     * owner remains the same.
+     *
+     * @param[in] object Object owning memory (key in registry).
+     * @param[in] category Category of memory (e.g., field, mesh, matrix, output).
+     * @param[in] label Label of object.
+     * @param[in] bytes Number of bytes owned by object.
+     */
+    static
+    void add(const void* object,
+             const char* category,
+             const char* label,
+             const size_t bytes);
+
+    /** Remove object from registry.
+     *
+     * @param[in] object Object owning memory (key in registry).
+     */
+    static
+    void remove(const void* object);
+
+    /** Set owner for objects registered until popOwner() is called.
+     *
+     * @param[in] owner Name of owning component.
+     */
+    static
+    void pushOwner(const char* owner);
+
+    /// Restore previous owner.
+    static
+    void popOwner(void);
+
+    /** Set current logging stage for high-water marks.
+     *
+     * @param[in] stage Name of logging stage.
+     */
+    static
+    void pushStage(const char* stage);
+
+    /// Restore previous logging stage.
+    static
+    void popStage(void);
+
+    /** Get number of bytes currently registered on this process.
+     *
+     * @returns Number of bytes.
+     */
+    static
+    size_t getLocalBytes(void);
+
+    /** Create report of memory usage by component, process, and logging stage.
+     *
+     * Collective over communicator.
+     *
+     * @param[in] comm MPI communicator.
+     * @returns Report on process 0, empty string on other processes.
+     */
+    static
+    std::string report(MPI_Comm comm=PETSC_COMM_WORLD);
+
+    /** Get number of bytes in values of vector on this process.
+     *
+     * @param[in] vector PETSc vector.
+     * @returns Number of bytes.
+     */
+    static
+    size_t vectorBytes(PetscVec vector);
+
+    /** Get number of bytes in nonzero values and indices of matrix on this process.
+     *
+     * @param[in] matrix PETSc matrix.
+     * @returns Number of bytes.
+     */
+    static
+    size_t matrixBytes(PetscMat matrix);
+
+    /** Get number of bytes in layout of section on this process.
+     *
+     * @param[in] section PETSc section.
+     * @returns Number of bytes.
+     */
+    static
+    size_t sectionBytes(PetscSection section);
+
+    /** Get number of bytes in topology, coordinates, and labels of DMPlex on this process.
+     *
+     * @param[in] dm PETSc DM.
+     * @returns Number of bytes.
+     */
+    static
+    size_t dmBytes(PetscDM dm);
+
+    /** RAII helper to set owner for the lifetime of the scope.
+     */
+    class OwnerScope {
+public:
+
+        /** Constructor.
+         *
+         * @param[in] owner Name of owning component.
+         */
+        OwnerScope(const char* owner) {
+            MemoryRegistry::pushOwner(owner);
+        }
+
+
+        /// Destructor.
+        ~OwnerScope(void) {
+            MemoryRegistry::popOwner();
+        }
+
+
+private:
+
+        OwnerScope(const OwnerScope&); ///< Not implemented
+        const OwnerScope& operator=(const OwnerScope&); ///< Not implemented
+
+    }; // OwnerScope
+
+}; // MemoryRegistry
+
+// End of file
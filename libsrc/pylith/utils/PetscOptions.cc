@@ -21,6 +21,8 @@
 #include "pylith/utils/mpi.hh" // USES isRoot()
 
 #include <cassert>
+#include <sstream> // USES std::ostringstream
+#include <vector> // USES std::vector
 
 namespace pylith {
     namespace utils {
@@ -49,6 +51,25 @@ public:
             static
             bool hasFault(const pylith::topology::Field& solution);
 
+            /** Get number of levels in mesh hierarchy.
+             *
+             * @param[in] solution Solution field for problem.
+             * @returns Number of levels including the finest mesh (1 if no hierarchy).
+             */
+            static
+            int getNumMeshLevels(const pylith::topology::Field& solution);
+
+            /** Use geometric multigrid with Galerkin coarse operators instead of algebraic multigrid.
+             *
+             * @param[in] options PETSc options.
+             * @param[in] numLevels Number of levels in mesh hierarchy.
+             * @param[in] hasFault True if problem has a fault, false otherwise.
+             */
+            static
+            void addGeometricMultigrid(PetscOptions* options,
+                                       const int numLevels,
+                                       const bool hasFault);
+
             /** Add debugging options.
              *
              * @param[in] options PETSc options.
@@ -115,6 +136,11 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
         const bool isParallel = flags & PARALLEL || _PetscOptions::isParallel(solution);
         const bool hasFault = _PetscOptions::hasFault(solution);
         options = material->getSolverDefaults(isParallel, hasFault);
+
+        const int numLevels = _PetscOptions::getNumMeshLevels(solution);
+        if (options && (numLevels > 1)) {
+            _PetscOptions::addGeometricMultigrid(options, numLevels, hasFault);
+        } // if
     } // if
     if (!options) {
         options = new PetscOptions();
@@ -288,6 +314,60 @@ pylith::utils::_PetscOptions::hasFault(const pylith::topology::Field& solution)
 } // hasFault
 
 
+// ------------------------------------------------------------------------------------------------
+// Get number of levels in mesh hierarchy.
+int
+pylith::utils::_PetscOptions::getNumMeshLevels(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    int numLevels = 1;
+    PetscDM dm = solution.getMesh().getDM();
+    PetscErrorCode err = DMGetCoarseDM(dm, &dm);PYLITH_CHECK_ERROR(err);
+    for (; dm; ++numLevels) {
+        err = DMGetCoarseDM(dm, &dm);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_RETURN(numLevels);
+} // getNumMeshLevels
+
+
+// ------------------------------------------------------------------------------------------------
+// Use geometric multigrid with Galerkin coarse operators instead of algebraic multigrid.
+void
+pylith::utils::_PetscOptions::addGeometricMultigrid(PetscOptions* options,
+                                                    const int numLevels,
+                                                    const bool hasFault) {
+    PYLITH_METHOD_BEGIN;
+    assert(options);
+
+    std::ostringstream levels;
+    levels << numLevels;
+
+    // Replace algebraic multigrid preconditioners, keeping the prefix (e.g., fieldsplit block).
+    const std::string pcType("pc_type");
+    std::vector<std::string> prefixes;
+    for (PetscOptions::options_t::const_iterator iter = options->_options.begin(); iter != options->_options.end(); ++iter) {
+        const std::string& name = iter->first;
+        if ((("gamg" == iter->second) || ("ml" == iter->second)) && (name.size() >= pcType.size()) &&
+            (0 == name.compare(name.size()-pcType.size(), pcType.size(), pcType))) {
+            prefixes.push_back(name.substr(0, name.size()-pcType.size()));
+        } // if
+    } // for
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+        const std::string& prefix = prefixes[i];
+        options->add((prefix + "pc_type").c_str(), "mg");
+        options->add((prefix + "pc_mg_levels").c_str(), levels.str().c_str());
+        // Operators on coarse levels from interpolation (the integrators only know the finest mesh).
+        options->add((prefix + "pc_mg_galerkin").c_str(), "both");
+        if (hasFault) {
+            options->add((prefix + "mg_levels_pc_type").c_str(), "vpbjacobi");
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // addGeometricMultigrid
+
+
 // ------------------------------------------------------------------------------------------------
 // Add debugging options.
 void
@@ -45,6 +45,9 @@ typedef struct _p_DMLabel* PetscDMLabel;
 /// forward declaration for PETSc IS
 typedef struct _p_IS* PetscIS;
 
+/// forward declaration for PETSc SF
+typedef struct _p_PetscSF* PetscSF;
+
 /// forward declaration for PETSc ISLocalToGlobalMapping
 typedef struct _p_ISLocalToGlobalMapping* PetscISLocalToGlobalMapping;
 
@@ -15,6 +15,7 @@ namespace pylith {
         class PetscDefaults;
 
         class EventLogger;
+        class MemoryRegistry;
         class GenericComponent;
         class PyreComponent;
 
@@ -41,6 +41,18 @@ public:
              */
             void filename(const char* filename);
 
+            /** Set number of processes per aggregator for writing external datasets.
+             *
+             * @param[in] value Number of processes per aggregator (0 for no aggregation).
+             */
+            void setRanksPerAggregator(const int value);
+
+            /** Get number of processes per aggregator for writing external datasets.
+             *
+             * @returns Number of processes per aggregator.
+             */
+            int getRanksPerAggregator(void) const;
+
             /** Generate filename for HDF5 file.
              *
              * Appends _info if only writing parameters.
@@ -0,0 +1,93 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/**
+ * @file modulesrc/meshio/DataWriterHDF5Stations.i
+ *
+ * @brief Python interface to C++ DataWriterHDF5Stations object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::DataWriterHDF5Stations: public DataWriterHDF5 {
+            // PUBLIC METHODS /////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            DataWriterHDF5Stations(void);
+
+            /// Destructor
+            ~DataWriterHDF5Stations(void);
+
+            /** Make copy of this object.
+             *
+             * @returns Copy of this.
+             */
+            DataWriter* clone(void) const;
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set number of time steps accumulated in memory before writing.
+             *
+             * @param[in] value Number of time steps in buffer.
+             */
+            void setBufferSize(const int value);
+
+            /** Get number of time steps accumulated in memory before writing.
+             *
+             * @returns Number of time steps in buffer.
+             */
+            int getBufferSize(void) const;
+
+            /** Open output file.
+             *
+             * @param mesh Finite-element mesh.
+             * @param isInfo True if only writing info values.
+             */
+            void open(const pylith::topology::Mesh& mesh,
+                      const bool isInfo);
+
+            /// Close output files.
+            void close(void);
+
+            /** Prepare for data at a new time step.
+             *
+             * @param[in] t Time stamp for new data
+             * @param[in] mesh PETSc mesh object
+             */
+            void openTimeStep(const PylithScalar t,
+                              const pylith::topology::Mesh& mesh);
+
+            /// Write buffered data if the buffer is full.
+            void closeTimeStep(void);
+
+            /** Write field over vertices to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 1.
+             */
+            void writeVertexField(const PylithScalar t,
+                                  const pylith::meshio::OutputSubfield& subfield);
+
+            /** Write field over cells to file.
+             *
+             * @param[in] t Time associated with field.
+             * @param[in] subfield Subfield with basis order 0.
+             */
+            void writeCellField(const PylithScalar t,
+                                const pylith::meshio::OutputSubfield& subfield);
+
+        }; // DataWriterHDF5Stations
+
+    } // meshio
+} // pylith
+
+// End of file
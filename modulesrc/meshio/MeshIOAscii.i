@@ -42,6 +42,18 @@ public:
              */
             const char* getFilename(void) const;
 
+            /** Set flag on whether to use the fast reader.
+             *
+             * @param flag True to use the fast reader, false to use the default reader.
+             */
+            void setUseFastRead(const bool flag);
+
+            /** Set number of threads used by the fast reader.
+             *
+             * @param value Number of threads (0 means use the number of hardware threads).
+             */
+            void setNumReadThreads(const int value);
+
             // PROTECTED METHODS //////////////////////////////////////////////
 protected:
 
@@ -48,6 +48,12 @@ public:
              */
             void setUseNodesetNames(const bool flag);
 
+            /** Set flag on whether to read the mesh in parallel.
+             *
+             * @param flag True to read mesh in parallel.
+             */
+            void setUseParallelRead(const bool flag);
+
             // PROTECTED METHODS ////////////////////////////////////////////////////
 protected:
 
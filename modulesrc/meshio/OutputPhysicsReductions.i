@@ -0,0 +1,85 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/**
+ * @file modulesrc/meshio/OutputPhysicsReductions.i
+ *
+ * @brief Python interface to C++ OutputPhysicsReductions object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class OutputPhysicsReductions: public pylith::meshio::OutputPhysics {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            OutputPhysicsReductions(void);
+
+            /// Destructor
+            virtual ~OutputPhysicsReductions(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set names of reductions to compute.
+             *
+             * @param[in] names Array of names of reductions.
+             * @param[in] numNames Length of array.
+             */
+            %apply(const char* const* string_list, const int list_len) {
+                (const char* names[],
+                 const int numNames)
+            };
+            void setReductions(const char* names[],
+                               const int numNames);
+
+            %clear(const char* names[], const int numNames);
+
+            /** Set threshold for computing time at which threshold is reached.
+             *
+             * @param[in] value Threshold (dimensioned) for absolute value of subfield components.
+             */
+            void setThreshold(const PylithReal value);
+
+            /** Set name of subfield used for time at which threshold is reached.
+             *
+             * @param[in] value Name of subfield.
+             */
+            void setThresholdSubfield(const char* value);
+
+            /** Verify configuration.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /// Write reduced fields to output.
+            void writeReductions(void);
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Update reductions with subfields at time step.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             */
+            void _writeDataStep(const PylithReal t,
+                                const PylithInt tindex,
+                                const pylith::topology::Field& solution);
+
+        }; // OutputPhysicsReductions
+
+    } // meshio
+} // pylith
+
+// End of file
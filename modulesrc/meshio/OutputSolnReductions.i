@@ -0,0 +1,97 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/**
+ * @file modulesrc/meshio/OutputSolnReductions.i
+ *
+ * @brief Python interface to C++ OutputSolnReductions object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class OutputSolnReductions: public pylith::meshio::OutputSoln {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor.
+            OutputSolnReductions(void);
+
+            /// Destructor
+            virtual ~OutputSolnReductions(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set names of reductions to compute.
+             *
+             * @param[in] names Array of names of reductions.
+             * @param[in] numNames Length of array.
+             */
+            %apply(const char* const* string_list, const int list_len) {
+                (const char* names[],
+                 const int numNames)
+            };
+            void setReductions(const char* names[],
+                               const int numNames);
+
+            %clear(const char* names[], const int numNames);
+
+            /** Set threshold for computing time at which threshold is reached.
+             *
+             * @param[in] value Threshold (dimensioned) for absolute value of subfield components.
+             */
+            void setThreshold(const PylithReal value);
+
+            /** Set name of subfield used for time at which threshold is reached.
+             *
+             * @param[in] value Name of subfield.
+             */
+            void setThresholdSubfield(const char* value);
+
+            /** Verify observer is compatible with solution.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Receive update from subject.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             * @param[in] notification Type of notification.
+             */
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution,
+                        const pylith::problems::Observer::NotificationType notification);
+
+            /// Write reduced fields to output.
+            void writeReductions(void);
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Update reductions with solution at time step.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @param[in] solution Solution at time t.
+             */
+            void _writeSolnStep(const PylithReal t,
+                                const PylithInt tindex,
+                                const pylith::topology::Field& solution);
+
+        }; // OutputSolnReductions
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -0,0 +1,91 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/**
+ * @file modulesrc/meshio/OutputTriggerChange.i
+ *
+ * @brief Python interface to C++ OutputTriggerChange object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class pylith::meshio::OutputTriggerChange: public pylith::meshio::OutputTrigger {
+            // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            OutputTriggerChange(void);
+
+            /// Destructor
+            ~OutputTriggerChange(void);
+
+            /** Set name of solution subfield used to detect changes.
+             *
+             * @param[in] value Name of subfield ("all" for all subfields).
+             */
+            void setSubfield(const char* value);
+
+            /** Get name of solution subfield used to detect changes.
+             *
+             * @returns Name of subfield.
+             */
+            const char* getSubfield(void) const;
+
+            /** Set relative tolerance for change in solution.
+             *
+             * @param[in] value Relative tolerance.
+             */
+            void setRelativeTolerance(const double value);
+
+            /** Get relative tolerance for change in solution.
+             *
+             * @returns Relative tolerance.
+             */
+            double getRelativeTolerance(void) const;
+
+            /** Set absolute tolerance for change in solution.
+             *
+             * @param[in] value Absolute tolerance (dimensioned).
+             */
+            void setAbsoluteTolerance(const double value);
+
+            /** Get absolute tolerance for change in solution.
+             *
+             * @returns Absolute tolerance (dimensioned).
+             */
+            double getAbsoluteTolerance(void) const;
+
+            /** Set maximum elapsed time between writes.
+             *
+             * @param[in] value Maximum elapsed (dimensional) time between writes (0 for no limit).
+             */
+            void setMaxTimeSkip(const double value);
+
+            /** Get maximum elapsed time between writes.
+             *
+             * @returns Maximum elapsed (dimensional) time between writes.
+             */
+            double getMaxTimeSkip(void) const;
+
+            /** Check whether we want to write output at time t.
+             *
+             * @param[in] t Time of proposed write.
+             * @param[in] tindex Inxex of current time step.
+             * @returns True if output should be written at time t, false otherwise.
+             */
+            bool shouldWrite(const PylithReal t,
+                             const PylithInt tindex);
+
+        }; // OutputTriggerChange
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -20,6 +20,7 @@
 #endif
 
 #include "pylith/meshio/OutputTrigger.hh"
+#include "pylith/meshio/OutputTriggerChange.hh"
 #include "pylith/meshio/OutputTriggerStep.hh"
 #include "pylith/meshio/OutputTriggerTime.hh"
 #include "pylith/meshio/DataWriter.hh"
@@ -27,13 +28,16 @@
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
+#include "pylith/meshio/DataWriterHDF5Stations.hh"
 #endif
 #include "pylith/meshio/OutputObserver.hh"
 #include "pylith/meshio/OutputSoln.hh"
 #include "pylith/meshio/OutputSolnDomain.hh"
 #include "pylith/meshio/OutputSolnBoundary.hh"
 #include "pylith/meshio/OutputSolnPoints.hh"
+#include "pylith/meshio/OutputSolnReductions.hh"
 #include "pylith/meshio/OutputPhysics.hh"
+#include "pylith/meshio/OutputPhysicsReductions.hh"
 
 #include "pylith/utils/arrayfwd.hh"
 %}
@@ -73,6 +77,7 @@ import_array();
 #endif
 
 %include "OutputTrigger.i"
+%include "OutputTriggerChange.i"
 %include "OutputTriggerStep.i"
 %include "OutputTriggerTime.i"
 %include "DataWriter.i"
@@ -80,13 +85,16 @@ import_array();
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
+%include "DataWriterHDF5Stations.i"
 #endif
 %include "OutputObserver.i"
 %include "OutputSoln.i"
 %include "OutputSolnDomain.i"
 %include "OutputSolnBoundary.i"
 %include "OutputSolnPoints.i"
+%include "OutputSolnReductions.i"
 %include "OutputPhysics.i"
+%include "OutputPhysicsReductions.i"
 
 
 // End of file
@@ -81,12 +81,32 @@ public:
              */
             void setFormulation(const FormulationEnum value);
 
+            /** Set flag for caching cell geometry at quadrature points.
+             *
+             * @param[in] value True to reuse cell geometry across integrations, false to compute it on the fly.
+             */
+            void setCacheCellGeometry(const bool value);
+
+            /** Get flag for caching cell geometry at quadrature points.
+             *
+             * @returns True if cell geometry is reused across integrations, false otherwise.
+             */
+            bool getCacheCellGeometry(void) const;
+
             /** Set spatial database for populating auxiliary field.
              *
              * @param[in] value Spatial database with iniital values for auxiliary field.
              */
             void setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB* const value);
 
+            /** Set cache for auxiliary field values from spatial databases.
+             *
+             * @param[in] directory Directory for cache files (empty string disables cache).
+             * @param[in] signature Signature of spatial databases used to populate the auxiliary field.
+             */
+            void setAuxiliaryFieldCache(const char* directory,
+                                        const char* signature);
+
             /** Set discretization information for auxiliary subfield.
              *
              * @param[in] subfieldName Name of auxiliary subfield.
@@ -138,6 +138,14 @@ public:
             virtual
             void initialize(void);
 
+            /** Get time spent in integrators for cells with given value of the label identifying
+             * materials and interfaces.
+             *
+             * @param[in] labelValue Value of label identifying materials and interfaces.
+             * @returns Elapsed time in seconds.
+             */
+            PylithReal getIntegratorTime(const int labelValue) const;
+
         }; // Problem
 
     } // problems
@@ -93,6 +93,60 @@ public:
              */
             void setShouldNotifyIC(const bool value);
 
+            /** Set threshold for repartitioning the mesh due to load imbalance.
+             *
+             * @param[in] value Threshold for load imbalance (0 or greater than or equal to 1).
+             */
+            void setLoadImbalanceThreshold(const double value);
+
+            /** Get threshold for repartitioning the mesh due to load imbalance.
+             *
+             * @returns Threshold for load imbalance.
+             */
+            double getLoadImbalanceThreshold(void) const;
+
+            /** Set number of time steps between checks of the load balance.
+             *
+             * @param[in] value Number of time steps.
+             */
+            void setLoadImbalanceInterval(const size_t value);
+
+            /** Get number of time steps between checks of the load balance.
+             *
+             * @returns Number of time steps.
+             */
+            size_t getLoadImbalanceInterval(void) const;
+
+            /** Get largest load imbalance measured during the simulation.
+             *
+             * @returns Ratio of maximum to average time spent in the integrators on each process.
+             */
+            double getMaxLoadImbalance(void) const;
+
+            /** Does the load imbalance exceed the threshold?
+             *
+             * @returns True if the load imbalance exceeded the threshold at least once, false otherwise.
+             */
+            bool exceededLoadImbalance(void) const;
+
+            /** Get number of times the mesh was repartitioned during the simulation.
+             *
+             * @returns Number of times the mesh was repartitioned.
+             */
+            size_t getNumRebalances(void) const;
+
+            /** Set finite-element mesh that is repartitioned when the load imbalance exceeds the threshold.
+             *
+             * @param[in] mesh Finite-element mesh.
+             */
+            void setMesh(pylith::topology::Mesh* mesh);
+
+            /** Set name of PETSc partitioner used to repartition the mesh.
+             *
+             * @param[in] value Name of PETSc partitioner.
+             */
+            void setPartitioner(const char* value);
+
             /** Set progress monitor.
              *
              * @param[in] monitor Progress monitor for time-dependent simulation.
@@ -0,0 +1,62 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/**
+ * @file modulesrc/topology/MeshCache.i
+ *
+ * @brief Python interface to C++ PyLith MeshCache object.
+ */
+
+namespace pylith {
+    namespace topology {
+        // MeshCache --------------------------------------------------------
+        class MeshCache
+        { // MeshCache
+          // PUBLIC METHODS /////////////////////////////////////////////////
+public:
+
+            /** Check whether cache file exists and was created with the given hash.
+             *
+             * @param[in] mesh PyLith finite-element mesh (provides MPI communicator).
+             * @param[in] filename Name of cache file.
+             * @param[in] hash Hash of input mesh and topology parameters (only used on process 0).
+             * @returns True if cache can be used, false otherwise.
+             */
+            static
+            bool isCurrent(const pylith::topology::Mesh& mesh,
+                           const char* filename,
+                           const char* hash);
+
+            /** Write mesh to cache file.
+             *
+             * @param[in] mesh PyLith finite-element mesh.
+             * @param[in] filename Name of cache file.
+             * @param[in] hash Hash of input mesh and topology parameters (only used on process 0).
+             */
+            static
+            void write(const pylith::topology::Mesh& mesh,
+                       const char* filename,
+                       const char* hash);
+
+            /** Read mesh from cache file.
+             *
+             * @param[inout] mesh PyLith finite-element mesh.
+             * @param[in] filename Name of cache file.
+             */
+            static
+            void read(pylith::topology::Mesh* mesh,
+                      const char* filename);
+
+        }; // MeshCache
+
+    } // topology
+} // pylith
+
+// End of file
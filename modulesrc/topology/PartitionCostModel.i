@@ -0,0 +1,81 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/**
+ * @file modulesrc/topology/PartitionCostModel.i
+ *
+ * @brief Python interface to C++ PartitionCostModel object.
+ */
+
+namespace pylith {
+    namespace topology {
+        class PartitionCostModel
+        { // PartitionCostModel
+          // PUBLIC MEMBERS /////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            PartitionCostModel(void);
+
+            /// Destructor
+            ~PartitionCostModel(void);
+
+            /// Deallocate data structures.
+            void deallocate(void);
+
+            /** Set relative cost of cells without a cost for their label value.
+             *
+             * @param[in] value Relative cost (must be positive).
+             */
+            void setDefaultCost(const PylithReal value);
+
+            /** Get relative cost of cells without a cost for their label value.
+             *
+             * @returns Relative cost.
+             */
+            PylithReal getDefaultCost(void) const;
+
+            /** Set relative cost of cells with given label value.
+             *
+             * @param[in] labelValue Value of label identifying materials and interfaces.
+             * @param[in] value Relative cost (must be positive).
+             */
+            void setCellCost(const int labelValue,
+                             const PylithReal value);
+
+            /** Get relative cost of cells with given label value.
+             *
+             * @param[in] labelValue Value of label identifying materials and interfaces.
+             * @returns Relative cost.
+             */
+            PylithReal getCellCost(const int labelValue) const;
+
+            /** Attach partition weights to cells of mesh.
+             *
+             * @param[inout] mesh Mesh to partition.
+             */
+            void setWeights(pylith::topology::Mesh* mesh) const;
+
+            /** Get number of cells with given label value summed over all processes.
+             *
+             * @param[in] mesh Finite-element mesh.
+             * @param[in] labelValue Value of label identifying materials and interfaces.
+             * @returns Number of cells.
+             */
+            static
+            PylithInt getNumCells(const pylith::topology::Mesh& mesh,
+                                  const int labelValue);
+
+        }; // PartitionCostModel
+
+    } // topology
+} // pylith
+
+// End of file
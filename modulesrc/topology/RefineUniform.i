@@ -28,6 +28,18 @@ public:
             /// Destructor
             ~RefineUniform(void);
 
+            /** Keep coarse meshes as a hierarchy attached to the refined mesh.
+             *
+             * @param[in] value True to keep coarse meshes, false otherwise.
+             */
+            void setKeepHierarchy(const bool value);
+
+            /** Are coarse meshes kept as a hierarchy attached to the refined mesh?
+             *
+             * @returns True if coarse meshes are kept, false otherwise.
+             */
+            bool getKeepHierarchy(void) const;
+
             /** Refine mesh.
              *
              * @param newMesh Refined mesh (result).
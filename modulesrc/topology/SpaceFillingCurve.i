@@ -0,0 +1,48 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/**
+ * @file modulesrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Python interface to C++ PyLith SpaceFillingCurve object.
+ */
+
+namespace pylith {
+    namespace topology {
+        // SpaceFillingCurve ------------------------------------------------
+        class SpaceFillingCurve
+        { // SpaceFillingCurve
+          // PUBLIC ENUM ////////////////////////////////////////////////////
+public:
+
+            enum CurveEnum {
+                HILBERT=0,
+                MORTON=1,
+            }; // CurveEnum
+
+            // PUBLIC METHODS /////////////////////////////////////////////////
+public:
+
+            /** Reorder vertices, edges, faces, and cells of mesh using a
+             * space-filling curve.
+             *
+             * @param mesh PyLith finite-element mesh.
+             * @param curve Type of space-filling curve.
+             */
+            static
+            void reorder(topology::Mesh* mesh,
+                         const CurveEnum curve=HILBERT);
+
+        }; // SpaceFillingCurve
+
+    } // topology
+} // pylith
+
+// End of file
@@ -19,6 +19,9 @@
 #include "pylith/topology/Distributor.hh"
 #include "pylith/topology/RefineUniform.hh"
 #include "pylith/topology/ReverseCuthillMcKee.hh"
+#include "pylith/topology/SpaceFillingCurve.hh"
+#include "pylith/topology/MeshCache.hh"
+#include "pylith/topology/PartitionCostModel.hh"
 %}
 
 %include "exception.i"
@@ -52,6 +55,9 @@ import_array();
 %include "Distributor.i"
 %include "RefineUniform.i"
 %include "ReverseCuthillMcKee.i"
+%include "SpaceFillingCurve.i"
+%include "MeshCache.i"
+%include "PartitionCostModel.i"
 
 // End of file
 
@@ -0,0 +1,45 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information. 
+// =================================================================================================
+
+/**
+ * @file modulesrc/utils/MemoryRegistry.i
+ *
+ * @brief Python interface to C++ MemoryRegistry object.
+ */
+
+namespace pylith {
+    namespace utils {
+        class MemoryRegistry
+        { // MemoryRegistry
+          // PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public:
+
+            /** Get number of bytes currently registered on this process.
+             *
+             * @returns Number of bytes.
+             */
+            static
+            size_t getLocalBytes(void);
+
+            /** Create report of memory usage by component, process, and logging stage.
+             *
+             * Collective over PETSC_COMM_WORLD.
+             *
+             * @returns Report on process 0, empty string on other processes.
+             */
+            static
+            std::string report(void);
+
+        }; // MemoryRegistry
+
+    } // utils
+} // pylith
+
+// End of file
@@ -13,6 +13,7 @@
 // Header files for module C++ code
 %{
 #include "pylith/utils/EventLogger.hh"
+#include "pylith/utils/MemoryRegistry.hh"
 #include "pylith/utils/PyreComponent.hh"
 #include "pylith/utils/PetscOptions.hh"
 #include "pylith/utils/PylithVersion.hh"
@@ -34,6 +35,7 @@
   } // try/catch
  } // exception
 
+%include "std_string.i"
 %include "typemaps.i"
 %include "../include/scalartypemaps.i"
 
@@ -49,6 +51,7 @@ import_array();
 // Interfaces
 %include "pylith_general.i"
 %include "EventLogger.i"
+%include "MemoryRegistry.i"
 %include "PyreComponent.i"
 %include "PetscOptions.i"
 %include "PylithVersion.i"
@@ -0,0 +1,127 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+/* Micro-benchmark of closure get/restore throughput with and without a closure index.
+ *
+ * Creates a box mesh with a vector field discretized with a Lagrange basis, then times
+ * DMPlexVecGetClosure()/DMPlexVecRestoreClosure() over all cells, first using the transitive
+ * closure (no index) and then after DMPlexCreateClosureIndex(), as done by VecVisitorMesh.
+ *
+ * Build (from this directory, with PETSC_DIR and PETSC_ARCH set):
+ *
+ *   mpicxx -O2 -o benchmark_closure benchmark_closure.cc -I$PETSC_DIR/include \
+ *     -I$PETSC_DIR/$PETSC_ARCH/include -L$PETSC_DIR/$PETSC_ARCH/lib -lpetsc
+ *
+ * Run:
+ *
+ *   ./benchmark_closure -dm_plex_dim 3 -dm_plex_simplex 1 -dm_plex_box_faces 16,16,16 -order 2 -repeat 10
+ */
+
+#include <petscdmplex.h>
+#include <petscfe.h>
+
+#include <iostream> // USES std::cout
+
+// ------------------------------------------------------------------------------------------------
+// Get/restore closure for all cells, returning closures per second.
+static
+PetscErrorCode
+timeClosure(PetscDM dm,
+            PetscSection section,
+            PetscVec vec,
+            const PetscInt numRepeat,
+            PetscReal* rate,
+            PetscScalar* checksum) {
+    PetscFunctionBeginUser;
+
+    PetscInt cStart = 0, cEnd = 0;
+    PetscCall(DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd));
+
+    *checksum = 0.0;
+    PetscLogDouble tStart = 0.0, tEnd = 0.0;
+    PetscCall(PetscTime(&tStart));
+    for (PetscInt iRepeat = 0; iRepeat < numRepeat; ++iRepeat) {
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscScalar* values = NULL;
+            PetscInt size = 0;
+            PetscCall(DMPlexVecGetClosure(dm, section, vec, cell, &size, &values));
+            *checksum += values[size-1];
+            PetscCall(DMPlexVecRestoreClosure(dm, section, vec, cell, &size, &values));
+        } // for
+    } // for
+    PetscCall(PetscTime(&tEnd));
+    *rate = PetscReal(numRepeat * (cEnd - cStart)) / (tEnd - tStart);
+
+    PetscFunctionReturn(PETSC_SUCCESS);
+} // timeClosure
+
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char** argv) {
+    PetscCall(PetscInitialize(&argc, &argv, NULL, NULL));
+
+    PetscInt order = 2;
+    PetscInt numRepeat = 10;
+    PetscCall(PetscOptionsGetInt(NULL, NULL, "-order", &order, NULL));
+    PetscCall(PetscOptionsGetInt(NULL, NULL, "-repeat", &numRepeat, NULL));
+
+    PetscDM dm = NULL;
+    PetscCall(DMCreate(PETSC_COMM_WORLD, &dm));
+    PetscCall(DMSetType(dm, DMPLEX));
+    PetscCall(DMSetFromOptions(dm));
+
+    PetscInt dim = 0;
+    PetscBool isSimplex = PETSC_FALSE;
+    PetscCall(DMGetDimension(dm, &dim));
+    PetscCall(DMPlexIsSimplex(dm, &isSimplex));
+
+    PetscFE fe = NULL;
+    PetscCall(PetscFECreateLagrange(PETSC_COMM_SELF, dim, dim, isSimplex, order, PETSC_DETERMINE, &fe));
+    PetscCall(DMSetField(dm, 0, NULL, (PetscObject)fe));
+    PetscCall(PetscFEDestroy(&fe));
+    PetscCall(DMCreateDS(dm));
+
+    PetscSection section = NULL;
+    PetscVec vec = NULL;
+    PetscCall(DMGetLocalSection(dm, &section));
+    PetscCall(DMCreateLocalVector(dm, &vec));
+    PetscCall(VecSet(vec, 1.0));
+
+    PetscReal rateNoIndex = 0.0, rateIndex = 0.0;
+    PetscScalar checksumNoIndex = 0.0, checksumIndex = 0.0;
+    PetscCall(timeClosure(dm, section, vec, numRepeat, &rateNoIndex, &checksumNoIndex));
+
+    PetscLogDouble tStart = 0.0, tEnd = 0.0;
+    PetscCall(PetscTime(&tStart));
+    PetscCall(DMPlexCreateClosureIndex(dm, section));
+    PetscCall(PetscTime(&tEnd));
+    PetscCall(timeClosure(dm, section, vec, numRepeat, &rateIndex, &checksumIndex));
+
+    PetscMPIInt rank = 0;
+    PetscCallMPI(MPI_Comm_rank(PETSC_COMM_WORLD, &rank));
+    if (!rank) {
+        std::cout << "Closure get/restore throughput (closures/s)\n"
+                  << "  without closure index: " << rateNoIndex << "\n"
+                  << "  with closure index:    " << rateIndex << "\n"
+                  << "  speedup:               " << rateIndex / rateNoIndex << "\n"
+                  << "  time to create index:  " << tEnd - tStart << " s\n"
+                  << "  checksums match:       " << (checksumNoIndex == checksumIndex ? "yes" : "no") << std::endl;
+    } // if
+
+    PetscCall(VecDestroy(&vec));
+    PetscCall(DMDestroy(&dm));
+    PetscCall(PetscFinalize());
+    return 0;
+} // main
+
+
+// End of file
@@ -0,0 +1,123 @@
+#!/usr/bin/env nemesis
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information.
+# =================================================================================================
+"""Compare residual/Jacobian assembly and MatMult times for different mesh orderings.
+
+Runs the full-scale test problems with no reordering, reverse Cuthill-McKee reordering, and
+space-filling curve reordering and reports the times from the PETSc log summary.
+
+Usage (from the top-level source directory after building PyLith):
+
+    playpen/reordering/benchmark_reordering.py --orderings=none,rcm,hilbert,morton --nprocs=1
+"""
+
+import argparse
+import importlib
+import os
+import subprocess
+import sys
+
+# Full-scale test problems (directory, parameter files, module with spatial database generator).
+CASES = {
+    "axialdisp_hex": ("tests/fullscale/linearelasticity/nofaults-3d", ["axialdisp.cfg", "axialdisp_hex.cfg"], "axialdisp_gendb"),
+    "axialdisp_tet": ("tests/fullscale/linearelasticity/nofaults-3d", ["axialdisp.cfg", "axialdisp_tet.cfg"], "axialdisp_gendb"),
+    "twoblocks_hex": ("tests/fullscale/linearelasticity/faults-3d", ["twoblocks.cfg", "twoblocks_hex.cfg"], None),
+    "twoblocks_tet": ("tests/fullscale/linearelasticity/faults-3d", ["twoblocks.cfg", "twoblocks_tet.cfg"], None),
+}
+
+ORDERINGS = {
+    "none": ["--mesh_generator.reorder_mesh=False"],
+    "rcm": ["--mesh_generator.reorder_mesh=True", "--mesh_generator.reorder_type=rcm"],
+    "hilbert": ["--mesh_generator.reorder_mesh=True", "--mesh_generator.reorder_type=hilbert"],
+    "morton": ["--mesh_generator.reorder_mesh=True", "--mesh_generator.reorder_type=morton"],
+}
+
+EVENTS = {
+    "residual": "PL:TimeDependent:computeLHSResidual",
+    "jacobian": "PL:TimeDependent:computeLHSJacobian",
+    "matmult": "MatMult",
+}
+
+
+def parse_log(filename):
+    """Get maximum time over processes for events in PETSc log summary."""
+    times = {}
+    with open(filename, "r") as fin:
+        for line in fin:
+            fields = line.split()
+            if len(fields) < 4:
+                continue
+            for key, event in EVENTS.items():
+                if fields[0] == event:
+                    times[key] = times.get(key, 0.0) + float(fields[3])
+    return times
+
+
+def run_case(name, orderings, nprocs, refine):
+    """Run case with each ordering and return times."""
+    directory, cfgfiles, gendb = CASES[name]
+    cwd = os.getcwd()
+    os.chdir(directory)
+    try:
+        if gendb:
+            sys.path.insert(0, os.getcwd())
+            importlib.import_module(gendb).GenerateDB().run()
+            sys.path.pop(0)
+
+        results = {}
+        for ordering in orderings:
+            logfile = f"output/benchmark_{name}_{ordering}.log"
+            cmd = ["pylith"] + cfgfiles + ORDERINGS[ordering] + [
+                f"--nodes={nprocs}",
+                f"--problem.defaults.name=benchmark_{name}_{ordering}",
+                f"--petsc.log_view=:{logfile}",
+            ]
+            if refine > 0:
+                cmd += ["--mesh_generator.refiner=pylith.topology.RefineUniform",
+                        f"--mesh_generator.refiner.levels={refine}"]
+            print(" ".join(cmd))
+            subprocess.run(cmd, check=True)
+            results[ordering] = parse_log(logfile)
+    finally:
+        os.chdir(cwd)
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--cases", action="store", dest="cases", default=",".join(CASES.keys()),
+                        help="Comma separated list of cases.")
+    parser.add_argument("--orderings", action="store", dest="orderings", default="none,rcm,hilbert",
+                        help="Comma separated list of orderings (none, rcm, hilbert, morton).")
+    parser.add_argument("--nprocs", action="store", type=int, dest="nprocs", default=1,
+                        help="Number of processes.")
+    parser.add_argument("--refine", action="store", type=int, dest="refine", default=0,
+                        help="Number of levels of uniform refinement to increase problem size.")
+    args = parser.parse_args()
+
+    orderings = args.orderings.split(",")
+    for ordering in orderings:
+        if not ordering in ORDERINGS:
+            parser.error(f"Unknown ordering '{ordering}'.")
+
+    for name in args.cases.split(","):
+        results = run_case(name, orderings, args.nprocs, args.refine)
+        print(f"\n{name} (time in seconds, max over processes)")
+        print(f"{'ordering':10s}" + "".join(f"{key:>12s}" for key in EVENTS))
+        for ordering in orderings:
+            times = results[ordering]
+            print(f"{ordering:10s}" + "".join(f"{times.get(key, float('nan')):12.4g}" for key in EVENTS))
+
+
+if __name__ == "__main__":
+    main()
+
+
+# End of file
@@ -32,6 +32,9 @@ class PyLithApp(PetscApplication):
     initializeOnly = pythia.pyre.inventory.bool("initialize_only", default=False)
     initializeOnly.meta['tip'] = "Stop simulation after initializing problem."
 
+    memoryReport = pythia.pyre.inventory.bool("memory_report", default=False)
+    memoryReport.meta['tip'] = "Print report of registered memory after initialization and at end of run."
+
     from pylith.utils.SimulationMetadata import SimulationMetadata
     metadata = pythia.pyre.inventory.facility(
         "metadata", family="simulation_metadata", factory=SimulationMetadata)
@@ -104,6 +107,7 @@ class PyLithApp(PetscApplication):
         self._debug.log(resourceUsageString())
 
         self._eventLogger.stagePop()
+        self._reportMemory("Memory after initialization")
 
         # If initializing only, stop before running problem
         if self.initializeOnly:
@@ -114,6 +118,7 @@ class PyLithApp(PetscApplication):
         self.problem.run(self)
         self._debug.log(resourceUsageString())
         self._eventLogger.stagePop()
+        self._reportMemory("Memory at end of run")
 
         # Cleanup
         self._eventLogger.stagePush("Finalize")
@@ -234,6 +239,19 @@ class PyLithApp(PetscApplication):
         PetscApplication._configure(self)
         return
 
+    def _reportMemory(self, title):
+        """Print report of registered memory if requested.
+        """
+        if not self.memoryReport:
+            return
+
+        from pylith.utils.utils import MemoryRegistry
+        report = MemoryRegistry.report()
+
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log(f"{title}\n{report}")
+
     def _setupLogging(self):
         """Setup event logging.
         """
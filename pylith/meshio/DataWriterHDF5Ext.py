@@ -16,12 +16,16 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
     """
     Writer of solution, auxiliary, and derived subfields to an HDF5 file with datasets stored in external binary files.
 
+    With `ranks_per_aggregator` greater than zero, groups of processes send their values to an aggregator process
+    (the first process in each group) and only the aggregators write to the external binary files.
+
     Implements `DataWriter`.
     """
     DOC_CONFIG = {
         "cfg": """
             [data_writer]
             filename = domain_solution.h5
+            ranks_per_aggregator = 16
         """
     }
 
@@ -30,6 +34,9 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
     filename = pythia.pyre.inventory.str("filename", default="")
     filename.meta['tip'] = "Name of HDF5 file."
 
+    ranksPerAggregator = pythia.pyre.inventory.int("ranks_per_aggregator", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    ranksPerAggregator.meta['tip'] = "Number of processes per aggregator writing external datasets (0 for all processes writing)."
+
     def __init__(self, name="datawriterhdf5"):
         """Constructor.
         """
@@ -39,6 +46,7 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
         """Initialize writer.
         """
         DataWriter.preinitialize(self)
+        ModuleDataWriterHDF5Ext.setRanksPerAggregator(self, self.ranksPerAggregator)
 
     def setFilename(self, outputDir, simName, label):
         """Set filename from default options and inventory. If filename is given in inventory, use it,
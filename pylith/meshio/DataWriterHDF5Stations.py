@@ -0,0 +1,75 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+from .DataWriter import DataWriter
+from .meshio import DataWriterHDF5Stations as ModuleDataWriterHDF5Stations
+
+
+class DataWriterHDF5Stations(DataWriter, ModuleDataWriterHDF5Stations):
+    """
+    Writer of solution subfields at stations to an HDF5 file with the time series for each station stored contiguously.
+
+    Values are accumulated in memory for `buffer_size` time steps and then written in a single collective write.
+    The datasets are in the `station_fields` group with dimensions [number of stations, number of time steps, number of components].
+    Because this layout is designed for reading time series rather than visualization, no Xdmf file is generated.
+
+    Implements `DataWriter`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [observer.writer]
+            filename = stations.h5
+            buffer_size = 200
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    filename = pythia.pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Name of HDF5 file."
+
+    bufferSize = pythia.pyre.inventory.int("buffer_size", default=100, validator=pythia.pyre.inventory.greater(0))
+    bufferSize.meta['tip'] = "Number of time steps accumulated in memory before writing to the file."
+
+    def __init__(self, name="datawriterhdf5stations"):
+        """Constructor.
+        """
+        DataWriter.__init__(self, name)
+        ModuleDataWriterHDF5Stations.__init__(self)
+
+    def preinitialize(self):
+        """Initialize writer.
+        """
+        DataWriter.preinitialize(self)
+        ModuleDataWriterHDF5Stations.setBufferSize(self, self.bufferSize)
+
+    def setFilename(self, outputDir, simName, label):
+        """Set filename from default options and inventory. If filename is given in inventory, use it,
+        otherwise create filename from default options.
+        """
+        filename = self.filename or DataWriter.mkfilename(outputDir, simName, label, "h5")
+        self.mkpath(filename)
+        ModuleDataWriterHDF5Stations.filename(self, filename)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object."""
+        ModuleDataWriterHDF5Stations.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def data_writer():
+    """Factory associated with DataWriter.
+    """
+    return DataWriterHDF5Stations()
+
+
+# End of file
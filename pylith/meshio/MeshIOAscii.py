@@ -34,6 +34,9 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
     The coordinate system associated with the mesh must be a Cartesian coordinate system, such as a generic Cartesian coordinate system or a geographic projection.
     :::
 
+    With `fast_read` enabled, the file is mapped into memory and the blocks of coordinates, cells, material identifiers, and group indices are parsed using multiple threads.
+    The resulting mesh is identical to the one from the default reader.
+
     Implements `MeshIOObj`.
     """
     DOC_CONFIG = {
@@ -49,6 +52,12 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
     filename = pythia.pyre.inventory.str("filename", default="", validator=validateFilename)
     filename.meta['tip'] = "Name of mesh file"
 
+    useFastRead = pythia.pyre.inventory.bool("fast_read", default=False)
+    useFastRead.meta['tip'] = "Use memory-mapped file and multithreaded parsing to read mesh."
+
+    numReadThreads = pythia.pyre.inventory.int("num_read_threads", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    numReadThreads.meta['tip'] = "Number of threads for fast reader (0 means use number of hardware threads)."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
     coordsys.meta['tip'] = "Coordinate system associated with mesh."
@@ -62,6 +71,8 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
         """Do minimal initialization."""
         MeshIOObj.preinitialize(self)
         ModuleMeshIOAscii.setFilename(self, self.filename)
+        ModuleMeshIOAscii.setUseFastRead(self, self.useFastRead)
+        ModuleMeshIOAscii.setNumReadThreads(self, self.numReadThreads)
 
     def _configure(self):
         """Set members based using inventory.
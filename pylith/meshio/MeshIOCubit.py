@@ -38,6 +38,9 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
     The coordinate system associated with the mesh must be a Cartesian coordinate system, such as a generic Cartesian coordinate system or a geographic projection.
     :::
 
+    With `parallel_read` enabled, each process reads a contiguous block of the cells, vertices, and node sets, so no process holds the entire mesh.
+    The mesh is then repartitioned by the mesh distributor.
+
     Implements `MeshIOObj`.
     """
     DOC_CONFIG = {
@@ -57,6 +60,9 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
     useNames = pythia.pyre.inventory.bool("use_nodeset_names", default=True)
     useNames.meta['tip'] = "Use nodeset names instead of ids."
 
+    useParallelRead = pythia.pyre.inventory.bool("parallel_read", default=False)
+    useParallelRead.meta['tip'] = "Read blocks of the mesh on every process instead of reading the entire mesh on process 0."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
     coordsys.meta['tip'] = "Coordinate system associated with mesh."
@@ -71,6 +77,7 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
         MeshIOObj.preinitialize(self)
         ModuleMeshIOCubit.setFilename(self, self.filename)
         ModuleMeshIOCubit.setUseNodesetNames(self, self.useNames)
+        ModuleMeshIOCubit.setUseParallelRead(self, self.useParallelRead)
 
     def _configure(self):
         """Set members based using inventory.
@@ -54,6 +54,11 @@ class OutputObserver(PetscComponent, ModuleOutputObserver):
         self.writer.preinitialize()
         ModuleOutputObserver.setWriter(self, self.writer)
 
+    def finalize(self):
+        """Complete output after running problem.
+        """
+        pass
+
     def _configure(self):
         """Set members based using inventory.
         """
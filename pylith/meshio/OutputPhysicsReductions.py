@@ -0,0 +1,90 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+from .OutputPhysics import OutputPhysics
+from .OutputSolnReductions import validateReductions
+from .meshio import OutputPhysicsReductions as ModuleOutputPhysicsReductions
+
+
+class OutputPhysicsReductions(OutputPhysics, ModuleOutputPhysicsReductions):
+    """
+    Output of reductions over time of subfields over the domain of a physics object (material or boundary condition).
+
+    The reductions are updated in memory at every time step selected by the output trigger, and only the reduced fields are written at the end of the simulation.
+    Reductions are available for the solution, auxiliary (for example, state variables), and derived subfields included in `data_fields`.
+    Each reduction is computed independently for each component of a subfield.
+    See [`OutputSolnReductions`](OutputSolnReductions.md) for the available reductions.
+
+    :::{tip}
+    Most output information can be configured at the problem level using the [`ProblemDefaults` Component](../problems/ProblemDefaults.md).
+    :::
+
+    Implements `OutputObserver`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [observer]
+            data_fields = [cauchy_stress, viscous_strain]
+            reductions = [peak, threshold_time]
+
+            # Time at which the absolute value of a stress component reaches 1.0 MPa.
+            threshold_subfield = cauchy_stress
+            threshold = 1.0e+6
+
+            # Write output to HDF5 file with name `elastic_reductions.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = elastic_reductions.h5
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    reductions = pythia.pyre.inventory.list("reductions", default=["peak", "final"], validator=validateReductions)
+    reductions.meta['tip'] = "Reductions to compute ('peak', 'rms', 'threshold_time', 'final')."
+
+    threshold = pythia.pyre.inventory.float("threshold", default=0.0, validator=pythia.pyre.inventory.greaterEqual(0.0))
+    threshold.meta['tip'] = "Threshold (SI units of subfield) for time at which threshold is reached."
+
+    thresholdSubfield = pythia.pyre.inventory.str("threshold_subfield", default="")
+    thresholdSubfield.meta['tip'] = "Name of subfield for time at which threshold is reached."
+
+    def __init__(self, name="outputphysicsreductions"):
+        """Constructor.
+        """
+        OutputPhysics.__init__(self, name)
+
+    def preinitialize(self, problem, identifier):
+        """Do mimimal initialization.
+        """
+        OutputPhysics.preinitialize(self, problem, identifier)
+        ModuleOutputPhysicsReductions.setReductions(self, self.reductions)
+        ModuleOutputPhysicsReductions.setThreshold(self, self.threshold)
+        ModuleOutputPhysicsReductions.setThresholdSubfield(self, self.thresholdSubfield)
+
+    def finalize(self):
+        """Write reduced fields.
+        """
+        ModuleOutputPhysicsReductions.writeReductions(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputPhysicsReductions.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with OutputPhysicsReductions.
+    """
+    return OutputPhysicsReductions()
+
+
+# End of file
@@ -0,0 +1,112 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+from .OutputSoln import OutputSoln
+from .meshio import OutputSolnReductions as ModuleOutputSolnReductions
+
+
+def validateReductions(value):
+    """Validate list of reductions.
+    """
+    known = ["peak", "rms", "threshold_time", "final"]
+    if 0 == len(value):
+        raise ValueError("List of reductions must contain at least one reduction.")
+    for name in value:
+        if not name in known:
+            raise ValueError(f"Unknown reduction '{name}'. Known reductions are {known}.")
+    return value
+
+
+class OutputSolnReductions(OutputSoln, ModuleOutputSolnReductions):
+    """
+    Output of reductions over time of solution subfields over the simulation domain.
+
+    The reductions are updated in memory at every time step selected by the output trigger, and only the reduced fields are written at the end of the simulation.
+    Each reduction is computed independently for each component of a subfield.
+
+    - **peak** Maximum absolute value (output as `SUBFIELD_peak`).
+    - **rms** Root-mean-square value over the time steps (output as `SUBFIELD_rms`).
+    - **threshold_time** First time at which the absolute value of subfield `threshold_subfield` is greater than or equal to `threshold` (output as `SUBFIELD_threshold_time`, NaN if the threshold is not reached).
+    - **final** Value at the last time step (output as `SUBFIELD`).
+
+    :::{tip}
+    Most output information can be configured at the problem level using the [`ProblemDefaults` Component](../problems/ProblemDefaults.md).
+    :::
+
+    Implements `OutputSoln`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [observer]
+            data_fields = [velocity]
+            reductions = [peak, rms, threshold_time]
+
+            # Time at which the absolute value of a velocity component reaches 0.1 m/s.
+            threshold_subfield = velocity
+            threshold = 0.1
+
+            # Write output to HDF5 file with name `domain_reductions.h5`.
+            writer = pylith.meshio.DataWriterHDF5
+            writer.filename = domain_reductions.h5
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    reductions = pythia.pyre.inventory.list("reductions", default=["peak", "final"], validator=validateReductions)
+    reductions.meta['tip'] = "Reductions to compute ('peak', 'rms', 'threshold_time', 'final')."
+
+    threshold = pythia.pyre.inventory.float("threshold", default=0.0, validator=pythia.pyre.inventory.greaterEqual(0.0))
+    threshold.meta['tip'] = "Threshold (SI units of subfield) for time at which threshold is reached."
+
+    thresholdSubfield = pythia.pyre.inventory.str("threshold_subfield", default="")
+    thresholdSubfield.meta['tip'] = "Name of subfield for time at which threshold is reached."
+
+    def __init__(self, name="outputsolnreductions"):
+        """Constructor.
+        """
+        OutputSoln.__init__(self, name)
+
+    def preinitialize(self, problem):
+        """Do mimimal initialization.
+        """
+        OutputSoln.preinitialize(self, problem)
+        ModuleOutputSolnReductions.setReductions(self, self.reductions)
+        ModuleOutputSolnReductions.setThreshold(self, self.threshold)
+        ModuleOutputSolnReductions.setThresholdSubfield(self, self.thresholdSubfield)
+
+        identifier = self.aliases[-1]
+        self.writer.setFilename(problem.defaults.outputDir, problem.defaults.simName, identifier)
+
+    def finalize(self):
+        """Write reduced fields.
+        """
+        ModuleOutputSolnReductions.writeReductions(self)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        OutputSoln._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleOutputSolnReductions.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def observer():
+    """Factory associated with OutputSolnReductions.
+    """
+    return OutputSolnReductions()
+
+
+# End of file
@@ -0,0 +1,77 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+from .OutputTrigger import OutputTrigger
+from .meshio import OutputTriggerChange as ModuleOutputTriggerChange
+
+
+class OutputTriggerChange(OutputTrigger, ModuleOutputTriggerChange):
+    """
+    Define how often output is written in terms of the change in the solution since the previous write.
+
+    Output is written when the maximum absolute change in the subfield values exceeds `absolute_tolerance` + `relative_tolerance` * (maximum absolute value at the previous write) or when the elapsed time since the previous write reaches `max_elapsed_time`.
+
+    Implements `OutputTrigger`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [output_trigger]
+            subfield = displacement
+            relative_tolerance = 0.01
+            absolute_tolerance = 1.0e-4
+            max_elapsed_time = 10.0*year
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    subfield = pythia.pyre.inventory.str("subfield", default="all")
+    subfield.meta['tip'] = "Name of solution subfield used to detect changes ('all' for all subfields)."
+
+    relativeTolerance = pythia.pyre.inventory.float("relative_tolerance", default=0.01, validator=pythia.pyre.inventory.greaterEqual(0.0))
+    relativeTolerance.meta['tip'] = "Relative tolerance for change in solution."
+
+    absoluteTolerance = pythia.pyre.inventory.float("absolute_tolerance", default=0.0, validator=pythia.pyre.inventory.greaterEqual(0.0))
+    absoluteTolerance.meta['tip'] = "Absolute tolerance (SI units of subfield) for change in solution."
+
+    from pythia.pyre.units.time import s
+    maxTimeSkip = pythia.pyre.inventory.dimensional("max_elapsed_time", default=0.0*s)
+    maxTimeSkip.meta['tip'] = "Maximum elapsed time between writes (0 for no limit)."
+
+    def __init__(self, name="outputtriggerchange"):
+        """Constructor.
+        """
+        OutputTrigger.__init__(self, name)
+
+    def preinitialize(self):
+        """Setup output trigger.
+        """
+        ModuleOutputTriggerChange.__init__(self)
+        ModuleOutputTriggerChange.setIdentifier(self, self.aliases[-1])
+        ModuleOutputTriggerChange.setSubfield(self, self.subfield)
+        ModuleOutputTriggerChange.setRelativeTolerance(self, self.relativeTolerance)
+        ModuleOutputTriggerChange.setAbsoluteTolerance(self, self.absoluteTolerance)
+        ModuleOutputTriggerChange.setMaxTimeSkip(self, self.maxTimeSkip.value)
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        OutputTrigger._configure(self)
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+
+def output_trigger():
+    """Factory associated with OutputTriggerChange.
+    """
+    return OutputTriggerChange()
+
+
+# End of file
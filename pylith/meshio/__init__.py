@@ -19,13 +19,17 @@ __all__ = [
     "DataWriterVTK",
     "DataWriterHDF5Ext",
     "DataWriterHDF5",
+    "DataWriterHDF5Stations",
     "OutputObserver",
     "OutputPhysics",
+    "OutputPhysicsReductions",
     "OutputSoln",
     "OutputSolnBoundary",
     "OutputSolnDomain",
     "OutputSolnPoints",
+    "OutputSolnReductions",
     "OutputTrigger",
+    "OutputTriggerChange",
     "OutputTriggerStep",
     "OutputTriggerTime",
     "PointsList",
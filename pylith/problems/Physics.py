@@ -62,9 +62,15 @@ class Physics(PetscComponent, ModulePhysics):
         identifier = self.aliases[-1]
         ModulePhysics.setIdentifier(self, identifier)
         ModulePhysics.setNormalizer(self, problem.normalizer)
+        ModulePhysics.setCacheCellGeometry(self, problem.defaults.cacheCellGeometry)
 
         if not isinstance(self.auxiliaryFieldDB, NullComponent):
             ModulePhysics.setAuxiliaryFieldDB(self, self.auxiliaryFieldDB)
+            cacheDir = problem.defaults.auxiliaryCacheDir
+            if cacheDir:
+                import os
+                os.makedirs(cacheDir, exist_ok=True)
+                ModulePhysics.setAuxiliaryFieldCache(self, cacheDir, self._getAuxiliaryCacheSignature(problem))
 
         for subfield in self.auxiliarySubfields.components():
             fieldName = subfield.aliases[-1]
@@ -92,6 +98,37 @@ class Physics(PetscComponent, ModulePhysics):
             observer.preinitialize(problem, identifier)
             ModulePhysics.registerObserver(self, observer)
 
+    def _getAuxiliaryCacheSignature(self, problem):
+        """Compute signature of spatial databases used to populate the auxiliary field.
+
+        The signature covers the parameters of the auxiliary field and gravity field databases and the
+        size and modification time of any files they read. The C++ cache adds the mesh, partition, and
+        discretization to the signature when computing the key for the cache.
+        """
+        import hashlib
+        import os
+
+        def addComponent(params, obj):
+            params.append(f"{obj.name}:{obj.__class__.__name__}")
+            facilityNames = obj.inventory.facilityNames()
+            for name in sorted(obj.inventory.propertyNames()):
+                if name in facilityNames or name.startswith("help") or name == "typos":
+                    continue
+                value = obj.inventory.getTraitDescriptor(name).value
+                params.append(f"{name}={value}")
+                if name == "filename" and value and os.path.isfile(value):
+                    stat = os.stat(value)
+                    params.append(f"{value}:size={stat.st_size}:mtime={stat.st_mtime_ns}")
+            for name in sorted(facilityNames):
+                if name != "weaver":
+                    addComponent(params, obj.inventory.getTraitDescriptor(name).value)
+
+        params = [self.__class__.__name__, self.aliases[-1]]
+        addComponent(params, self.auxiliaryFieldDB)
+        if not isinstance(problem.gravityField, NullComponent):
+            addComponent(params, problem.gravityField)
+        return hashlib.sha256("\n".join(params).encode("utf-8")).hexdigest()
+
     def _createModuleObj(self):
         """Call constructor for module object for access to C++ object.
         """
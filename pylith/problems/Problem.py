@@ -107,6 +107,8 @@ class Problem(PetscComponent, ModuleProblem):
         """
         PetscComponent.__init__(self, name, facility="problem")
         self.mesh = None
+        self.partitionCostModel = None
+        self.partitioner = None
 
     def preinitialize(self, mesh):
         """Do minimal initialization.
@@ -198,6 +200,15 @@ class Problem(PetscComponent, ModuleProblem):
         if mpi_is_root():
             self._info.log("Finalizing problem.")
 
+        if self.partitionCostModel and self.partitionCostModel.calibrate:
+            self.partitionCostModel.writeCalibration(self)
+
+        for observer in self.observers.components():
+            observer.finalize()
+        for physics in self.materials.components() + self.bc.components() + self.interfaces.components():
+            for observer in physics.observers.components():
+                observer.finalize()
+
     def checkpoint(self):
         """Save problem state for restart.
         """
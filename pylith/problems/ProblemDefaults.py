@@ -47,6 +47,12 @@ class ProblemDefaults(Component):
     outputBasisOrder = pythia.pyre.inventory.int("output_basis_order", default=1, validator=pythia.pyre.inventory.choice([0,1]))
     outputBasisOrder.meta['tip'] = "Default basis order for output."
 
+    auxiliaryCacheDir = pythia.pyre.inventory.str("auxiliary_cache_directory", default="")
+    auxiliaryCacheDir.meta['tip'] = "Directory for caching auxiliary fields evaluated from spatial databases (empty for no cache); stale cache files are not removed."
+
+    cacheCellGeometry = pythia.pyre.inventory.bool("cache_cell_geometry", default=True)
+    cacheCellGeometry.meta['tip'] = "Keep cell geometry at quadrature points across residual and Jacobian evaluations (turn off to compute it on the fly and reduce memory use)."
+
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
     def __init__(self, name="problem_defaults"):
@@ -89,6 +89,13 @@ class TimeDependent(Problem, ModuleTimeDependent):
     shouldNotifyIC = pythia.pyre.inventory.bool("notify_observers_ic", default=False)
     shouldNotifyIC.meta["tip"] = "Notify observers of solution with initial conditions."
 
+    loadImbalanceThreshold = pythia.pyre.inventory.float("load_imbalance_threshold", default=0.0,
+                                                         validator=pythia.pyre.inventory.greaterEqual(0.0))
+    loadImbalanceThreshold.meta['tip'] = "Ratio of maximum to average integrator time over processes that triggers repartitioning the mesh (0 disables monitoring)."
+
+    loadImbalanceInterval = pythia.pyre.inventory.int("load_imbalance_interval", default=10, validator=pythia.pyre.inventory.greater(0))
+    loadImbalanceInterval.meta['tip'] = "Number of time steps between checks of the load balance."
+
     from .ProgressMonitorTime import ProgressMonitorTime
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorTime)
@@ -115,6 +122,11 @@ class TimeDependent(Problem, ModuleTimeDependent):
         ModuleTimeDependent.setInitialTimeStep(self, self.dtInitial.value)
         ModuleTimeDependent.setMaxTimeSteps(self, self.maxTimeSteps)
         ModuleTimeDependent.setShouldNotifyIC(self, self.shouldNotifyIC)
+        ModuleTimeDependent.setLoadImbalanceThreshold(self, self.loadImbalanceThreshold)
+        ModuleTimeDependent.setLoadImbalanceInterval(self, self.loadImbalanceInterval)
+        ModuleTimeDependent.setMesh(self, mesh)
+        if self.partitioner:
+            ModuleTimeDependent.setPartitioner(self, self.partitioner)
 
         # Preinitialize initial conditions.
         for ic in self.ic.components():
@@ -133,6 +145,22 @@ class TimeDependent(Problem, ModuleTimeDependent):
 
         ModuleTimeDependent.solve(self)
 
+    def finalize(self):
+        """Cleanup after running problem.
+        """
+        if ModuleTimeDependent.exceededLoadImbalance(self):
+            imbalance = ModuleTimeDependent.getMaxLoadImbalance(self)
+            from pylith.mpi.Communicator import mpi_is_root
+            if mpi_is_root():
+                numRebalances = ModuleTimeDependent.getNumRebalances(self)
+                self._info.log(f"Maximum load imbalance ({imbalance:.2f}) exceeded threshold ({self.loadImbalanceThreshold:.2f}); "
+                               f"mesh was repartitioned {numRebalances} time(s).")
+            if self.partitionCostModel and not self.partitionCostModel.calibrate:
+                # Write measured costs for repartitioning in subsequent runs.
+                self.partitionCostModel.writeCalibration(self)
+
+        Problem.finalize(self)
+
     def _configure(self):
         """Set members based using inventory.
         """
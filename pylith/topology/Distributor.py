@@ -32,6 +32,13 @@ class Distributor(PetscComponent, ModuleDistributor):
     useEdgeWeighting = pythia.pyre.inventory.bool("use_edge_weighting", default=True)
     useEdgeWeighting.meta["tip"] = "Use edge weighting (parmetis only)."
 
+    useCostModel = pythia.pyre.inventory.bool("use_cost_model", default=False)
+    useCostModel.meta['tip'] = "Weight cells by relative cost of materials and faults (parmetis only)."
+
+    from .PartitionCostModel import PartitionCostModel
+    costModel = pythia.pyre.inventory.facility("cost_model", factory=PartitionCostModel, family="partition_cost_model")
+    costModel.meta['tip'] = "Cost model for weighting cells when partitioning."
+
     writePartition = pythia.pyre.inventory.bool("write_partition", default=False)
     writePartition.meta['tip'] = "Write partition information to file."
 
@@ -47,6 +54,8 @@ class Distributor(PetscComponent, ModuleDistributor):
     def preinitialize(self):
         """Do minimal initialization."""
         ModuleDistributor.__init__(self)
+        if self.useCostModel:
+            self.costModel.preinitialize()
 
     def distribute(self, mesh, problem):
         """Distribute a Mesh
@@ -57,7 +66,12 @@ class Distributor(PetscComponent, ModuleDistributor):
 
         from pylith.topology.Mesh import Mesh
         newMesh = Mesh(mesh.getDimension())
-        ModuleDistributor.distribute(newMesh, mesh, problem.interfaces.components(), self.partitioner, self.useEdgeWeighting)
+        if self.useCostModel:
+            self.costModel.setWeights(mesh, problem)
+            problem.partitionCostModel = self.costModel
+        useVertexWeights = self.useEdgeWeighting or self.useCostModel
+        problem.partitioner = self.partitioner
+        ModuleDistributor.distribute(newMesh, mesh, problem.interfaces.components(), self.partitioner, useVertexWeights)
 
         mesh.cleanup()
 
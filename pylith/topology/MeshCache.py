@@ -0,0 +1,76 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+from .topology import MeshCache as ModuleMeshCache
+
+
+class MeshCache(ModuleMeshCache):
+    """
+    Interface to cache of mesh topology (after reading, reordering, and inserting cohesive cells) in an HDF5 file.
+    """
+
+    def __init__(self, filename):
+        """Constructor.
+        """
+        self.filename = filename
+
+    def computeHash(self, reader, reorderType, interfaces, problem):
+        """Compute hash of input mesh and parameters affecting the mesh topology.
+
+        `reorderType` is the name of the reordering algorithm or None if the mesh is not reordered.
+
+        The hash is only computed on process 0, which avoids reading the input mesh file on every process.
+        """
+        from pylith.mpi.Communicator import mpi_is_root
+        if not mpi_is_root():
+            return ""
+
+        import hashlib
+        h = hashlib.sha256()
+        params = [reader.__class__.__name__, f"reorder={reorderType}"]
+        for name in ["useNames", "useParallelRead", "prefix"]:
+            if hasattr(reader, name):
+                params.append(f"{name}={getattr(reader, name)}")
+        for material in problem.materials.components():
+            params.append(f"material={material.labelName}:{material.labelValue}")
+        if not interfaces is None:
+            for interface in interfaces:
+                params.append(f"fault={interface.labelName}:{interface.labelValue}:{interface.edgeName}:{interface.edgeValue}")
+        h.update("\n".join(params).encode("utf-8"))
+
+        filename = getattr(reader, "filename", "")
+        if filename:
+            with open(filename, "rb") as fin:
+                for chunk in iter(lambda: fin.read(2**24), b""):
+                    h.update(chunk)
+        return h.hexdigest()
+
+    def read(self, coordsys, hash):
+        """Read mesh from cache if the cache is current.
+
+        @returns Mesh if cache is current, otherwise None.
+        """
+        from pylith.mpi.Communicator import petsc_comm_world
+        from .Mesh import Mesh
+        mesh = Mesh(dim=coordsys.getSpaceDim(), comm=petsc_comm_world())
+        mesh.setCoordSys(coordsys)
+        if not ModuleMeshCache.isCurrent(mesh, self.filename, hash):
+            mesh.cleanup()
+            return None
+        ModuleMeshCache.read(mesh, self.filename)
+        return mesh
+
+    def write(self, mesh, hash):
+        """Write mesh to cache.
+        """
+        ModuleMeshCache.write(mesh, self.filename, hash)
+
+
+# End of file
@@ -38,8 +38,11 @@ class MeshGenerator(PetscComponent):
         """
         PetscComponent._configure(self)
 
-    def _adjustTopology(self, mesh, interfaces, problem):
+    def _adjustTopology(self, mesh, interfaces, problem, adjust=True):
         """Adjust topology for interface implementation.
+
+        If `adjust` is False, the mesh already contains the cohesive cells (for example, when it is loaded
+        from a mesh cache), so we only setup the interfaces.
         """
         logEvent = f"{self._loggingPrefix}adjTopo"
         self._eventLogger.eventBegin(logEvent)
@@ -52,11 +55,12 @@ class MeshGenerator(PetscComponent):
                 labelValue = material.labelValue
                 cohesiveLabelValue = max(cohesiveLabelValue, labelValue+1)
             for interface in interfaces:
-                if mpi_is_root():
+                if mpi_is_root() and adjust:
                     self._info.log("Adjusting topology for fault '%s'." % interface.labelName)
                 interface.preinitialize(problem)
                 interface.setCohesiveLabelValue(cohesiveLabelValue)
-                interface.adjustTopology(mesh)
+                if adjust:
+                    interface.adjustTopology(mesh)
                 cohesiveLabelValue += 1
 
         self._eventLogger.eventEnd(logEvent)
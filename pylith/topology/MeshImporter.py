@@ -21,7 +21,9 @@ class MeshImporter(MeshGenerator):
         "cfg": """
             [pylithapp.meshimporter]
             reorder_mesh = True
+            reorder_type = hilbert
             check_topology = True
+            cache_filename = output/mesh_cache.h5
             reader = pylith.meshio.MeshIOCubit
             refiner = pylith.topology.RefineUniform
         """
@@ -30,11 +32,18 @@ class MeshImporter(MeshGenerator):
     import pythia.pyre.inventory
 
     reorderMesh = pythia.pyre.inventory.bool("reorder_mesh", default=True)
-    reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
+    reorderMesh.meta['tip'] = "Reorder mesh cells and vertices to improve memory locality."
+
+    reorderType = pythia.pyre.inventory.str("reorder_type", default="rcm",
+                                            validator=pythia.pyre.inventory.choice(["rcm", "hilbert", "morton"]))
+    reorderType.meta['tip'] = "Algorithm for reordering mesh ('rcm'=reverse Cuthill-McKee, 'hilbert'=Hilbert space-filling curve, 'morton'=Morton space-filling curve)."
 
     checkTopology = pythia.pyre.inventory.bool("check_topology", default=True)
     checkTopology.meta['tip'] = "Check topology of imported mesh."
 
+    cacheFilename = pythia.pyre.inventory.str("cache_filename", default="")
+    cacheFilename.meta['tip'] = "Name of HDF5 file for caching mesh topology after reading, reordering, and inserting cohesive cells (default is no cache)."
+
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
     reader.meta['tip'] = "Reader for mesh files."
@@ -73,26 +82,48 @@ class MeshImporter(MeshGenerator):
         logEvent = f"{self._loggingPrefix}create"
         self._eventLogger.eventBegin(logEvent)
 
-        # Read mesh
-        mesh = self.reader.read(self.checkTopology)
-
-        # Reorder mesh
-        if self.reorderMesh:
-            logEvent2 = f"{self._loggingPrefix}reorder"
-            self._eventLogger.eventBegin(logEvent2)
+        # Load mesh from cache if it is current
+        mesh = None
+        if self.cacheFilename:
+            from pylith.topology.MeshCache import MeshCache
+            cache = MeshCache(self.cacheFilename)
+            cacheHash = cache.computeHash(self.reader, self.reorderType if self.reorderMesh else None, faults, problem)
+            mesh = cache.read(self.reader.coordsys, cacheHash)
+            if isRoot and mesh:
+                self._info.log(f"Loaded mesh topology from cache '{self.cacheFilename}'.")
+
+        if mesh:
+            self._adjustTopology(mesh, faults, problem, adjust=False)
+        else:
+            # Read mesh
+            mesh = self.reader.read(self.checkTopology)
+
+            # Reorder mesh
+            if self.reorderMesh:
+                logEvent2 = f"{self._loggingPrefix}reorder"
+                self._eventLogger.eventBegin(logEvent2)
+                self._debug.log(resourceUsageString())
+                if isRoot:
+                    self._info.log(f"Reordering cells and vertices using '{self.reorderType}'.")
+                if self.reorderType == "rcm":
+                    from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+                    ordering = ReverseCuthillMcKee()
+                else:
+                    from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+                    ordering = SpaceFillingCurve(self.reorderType)
+                ordering.reorder(mesh)
+                self._eventLogger.eventEnd(logEvent2)
+
+            # Adjust topology
             self._debug.log(resourceUsageString())
             if isRoot:
-                self._info.log("Reordering cells and vertices.")
-            from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-            ordering = ReverseCuthillMcKee()
-            ordering.reorder(mesh)
-            self._eventLogger.eventEnd(logEvent2)
-
-        # Adjust topology
-        self._debug.log(resourceUsageString())
-        if isRoot:
-            self._info.log("Adjusting topology.")
-        self._adjustTopology(mesh, faults, problem)
+                self._info.log("Adjusting topology.")
+            self._adjustTopology(mesh, faults, problem)
+
+            if self.cacheFilename:
+                if isRoot:
+                    self._info.log(f"Writing mesh topology to cache '{self.cacheFilename}'.")
+                cache.write(mesh, cacheHash)
 
         # Distribute mesh
         from pylith.mpi.Communicator import mpi_comm_world
@@ -0,0 +1,191 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information.
+# =================================================================================================
+
+from pylith.utils.PetscComponent import PetscComponent
+from .topology import PartitionCostModel as ModulePartitionCostModel
+
+
+# Relative cost of the pointwise functions for each type of bulk physics.
+PHYSICS_COST = {
+    "Elasticity": 1.0,
+    "IncompressibleElasticity": 1.5,
+    "Poroelasticity": 2.0,
+}
+
+# Relative cost of the pointwise functions for each bulk rheology.
+RHEOLOGY_COST = {
+    "IsotropicLinearElasticity": 1.0,
+    "IsotropicLinearIncompElasticity": 1.0,
+    "IsotropicLinearPoroelasticity": 1.0,
+    "IsotropicLinearMaxwell": 1.5,
+    "IsotropicLinearGenMaxwell": 2.5,
+    "IsotropicPowerLaw": 4.0,
+}
+
+
+def validatePositive(value):
+    """Validate relative cost is positive.
+    """
+    if value <= 0.0:
+        raise ValueError(f"Relative cost ({value}) must be positive.")
+    return value
+
+
+class PartitionCostModel(PetscComponent, ModulePartitionCostModel):
+    """
+    Cost model for weighting cells when partitioning the mesh.
+
+    The relative cost of the cells in each material and fault is estimated from the type of bulk
+    physics, the bulk rheology, and the basis order of the solution subfields. Alternatively, the
+    relative costs can be read from a JSON file, such as the one written in calibration mode.
+
+    In calibration mode, the time spent in each integrator is recorded during the simulation and the
+    measured cost per cell is written to `calibration_filename` when the problem is finalized.
+    The calibration file can be used as the `weights_filename` in subsequent simulations.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.mesh_generator.distributor]
+            use_cost_model = True
+
+            [pylithapp.mesh_generator.distributor.cost_model]
+            weights_filename = partition_costs.json
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    weightsFilename = pythia.pyre.inventory.str("weights_filename", default="")
+    weightsFilename.meta['tip'] = "Name of JSON file with relative cost of cells for label values (overrides estimated costs)."
+
+    cohesiveCost = pythia.pyre.inventory.float("cohesive_cost", default=2.0, validator=validatePositive)
+    cohesiveCost.meta['tip'] = "Relative cost of cohesive cells compared to bulk cells with the same number of basis functions."
+
+    calibrate = pythia.pyre.inventory.bool("calibrate", default=False)
+    calibrate.meta['tip'] = "Measure time spent in each integrator and write relative costs to file."
+
+    calibrationFilename = pythia.pyre.inventory.str("calibration_filename", default="partition_costs.json")
+    calibrationFilename.meta['tip'] = "Name of JSON file for relative costs measured in calibration mode."
+
+    def __init__(self, name="partitioncostmodel"):
+        """Constructor.
+        """
+        PetscComponent.__init__(self, name, facility="partition_cost_model")
+
+    def preinitialize(self):
+        """Do minimal initialization."""
+        self._createModuleObj()
+
+    def setWeights(self, mesh, problem):
+        """Attach partition weights to the cells of the mesh.
+        """
+        costs = self._estimateCosts(mesh, problem)
+        if self.weightsFilename:
+            costs.update(self._readCosts(self.weightsFilename))
+
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            lines = [f"    {labelValue}: {cost:.3g}" for labelValue, cost in sorted(costs.items())]
+            self._info.log("Relative cost of cells for partitioning (material-id: cost)\n" + "\n".join(lines))
+
+        for labelValue, cost in costs.items():
+            ModulePartitionCostModel.setCellCost(self, labelValue, cost)
+        ModulePartitionCostModel.setWeights(self, mesh)
+
+    def writeCalibration(self, problem):
+        """Write relative cost per cell measured from time spent in each integrator.
+        """
+        labelValues = [material.labelValue for material in problem.materials.components()]
+        if problem.interfaces is not None:
+            labelValues += [interface.getCohesiveLabelValue() for interface in problem.interfaces.components()]
+
+        costs = {}
+        for labelValue in labelValues:
+            numCells = ModulePartitionCostModel.getNumCells(problem.mesh(), labelValue)
+            time = problem.getIntegratorTime(labelValue)
+            if numCells > 0 and time > 0.0:
+                costs[labelValue] = time / numCells
+        if len(costs) > 0:
+            costMin = min(costs.values())
+            costs = {labelValue: cost / costMin for labelValue, cost in costs.items()}
+
+        from pylith.mpi.Communicator import mpi_is_root
+        if mpi_is_root():
+            self._info.log(f"Writing measured partition costs to '{self.calibrationFilename}'.")
+            import json
+            with open(self.calibrationFilename, "w") as fout:
+                data = {
+                    "label": "material-id",
+                    "costs": {str(labelValue): cost for labelValue, cost in sorted(costs.items())},
+                }
+                json.dump(data, fout, indent=4)
+
+    def _estimateCosts(self, mesh, problem):
+        """Estimate relative cost of cells in each material and fault.
+        """
+        from pylith.problems.SubfieldLagrangeFault import SubfieldLagrangeFault
+
+        dim = mesh.getDimension()
+        costDomain = 0.0
+        costFault = 0.0
+        for subfield in problem.solution.subfields.components():
+            if isinstance(subfield, SubfieldLagrangeFault):
+                costFault += (subfield.basisOrder + 1)**(dim - 1)
+            else:
+                costDomain += (subfield.basisOrder + 1)**dim
+                # Cohesive cells integrate over both sides of the fault.
+                costFault += 2 * (subfield.basisOrder + 1)**(dim - 1)
+
+        costs = {}
+        for material in problem.materials.components():
+            physics = PHYSICS_COST.get(material.__class__.__name__, 1.0)
+            rheology = getattr(material, "rheology", None)
+            rheologyCost = RHEOLOGY_COST.get(rheology.__class__.__name__, 1.0) if rheology else 1.0
+            costs[material.labelValue] = physics * rheologyCost * costDomain
+        if problem.interfaces is not None:
+            for interface in problem.interfaces.components():
+                costs[interface.getCohesiveLabelValue()] = self.cohesiveCost * costFault
+        return costs
+
+    def _readCosts(self, filename):
+        """Read relative cost of cells from JSON file.
+        """
+        import json
+        try:
+            with open(filename, "r") as fin:
+                data = json.load(fin)
+        except IOError as err:
+            raise IOError(f"Could not read partition costs from '{filename}'.") from err
+
+        label = data.get("label", "material-id")
+        if label != "material-id":
+            raise ValueError(f"Partition costs in '{filename}' use label '{label}'. Only 'material-id' is supported.")
+        return {int(labelValue): float(cost) for labelValue, cost in data["costs"].items()}
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        PetscComponent._configure(self)
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModulePartitionCostModel.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def partition_cost_model():
+    """Factory associated with PartitionCostModel.
+    """
+    return PartitionCostModel()
+
+
+# End of file
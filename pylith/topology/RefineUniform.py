@@ -21,8 +21,10 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
     DOC_CONFIG = {
         "cfg": """
             # Refine mesh twice to reduce size of cell edges by a factor of 4.
+            # Use the mesh hierarchy for geometric multigrid.
             [pylithapp.mesh_generator.refiner]
             levels = 2
+            keep_hierarchy = True
         """
     }
 
@@ -31,6 +33,9 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
     levels = pythia.pyre.inventory.int("levels", default=1, validator=pythia.pyre.inventory.greaterEqual(1))
     levels.meta['tip'] = "Number of refinement levels."
 
+    keepHierarchy = pythia.pyre.inventory.bool("keep_hierarchy", default=False)
+    keepHierarchy.meta['tip'] = "Keep coarse meshes and use geometric multigrid instead of algebraic multigrid."
+
     def __init__(self, name="refineuniform"):
         """Constructor.
         """
@@ -56,6 +61,7 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
         from .Mesh import Mesh
         newMesh = Mesh()
         newMesh.setCoordSys(mesh.getCoordSys())
+        ModuleRefineUniform.setKeepHierarchy(self, self.keepHierarchy)
         ModuleRefineUniform.refine(self, newMesh, mesh, self.levels)
         mesh.cleanup()
 
@@ -0,0 +1,38 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+from .topology import SpaceFillingCurve as ModuleSpaceFillingCurve
+
+
+class SpaceFillingCurve(ModuleSpaceFillingCurve):
+    """
+    Reordering of mesh cells, faces, edges, and vertices following a Hilbert or Morton
+    space-filling curve through the cell centroids.
+    """
+
+    CURVES = {
+        "hilbert": ModuleSpaceFillingCurve.HILBERT,
+        "morton": ModuleSpaceFillingCurve.MORTON,
+    }
+
+    def __init__(self, curve="hilbert"):
+        """Constructor.
+        """
+        if not curve in self.CURVES:
+            raise ValueError(f"Unknown space-filling curve '{curve}'. Known curves are {', '.join(self.CURVES.keys())}.")
+        self.curve = curve
+
+    def reorder(self, mesh):
+        """Reorder mesh points.
+        """
+        ModuleSpaceFillingCurve.reorder(mesh, self.CURVES[self.curve])
+
+
+# End of file
@@ -21,6 +21,9 @@ __all__ = [
     "MeshRefiner",
     "RefineUniform",
     "ReverseCuthillMcKee",
+    "SpaceFillingCurve",
+    "MeshCache",
+    "PartitionCostModel",
     "Subfield",
 ]
 
@@ -14,6 +14,8 @@
 
 #include "pylith/feassemble/AuxiliaryFactory.hh" // Test subject
 
+#include "pylith/feassemble/AuxiliaryCache.hh" // USES AuxiliaryCache
+
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/topology/Field.hh" // USES Field
@@ -28,6 +30,7 @@
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 #include "catch2/matchers/catch_matchers_exception.hpp"
 
+#include <cstdio> // USES std::remove()
 #include <stdexcept>
 
 namespace pylith {
@@ -58,6 +61,9 @@ public:
     /// Test setValuesFromDB().
     void testSetValuesFromDB(void);
 
+    /// Test setCache() with setValuesFromDB().
+    void testCache(void);
+
 private:
 
     pylith::feassemble::AuxiliaryFactory* _factory; ///< Test subject.
@@ -305,6 +311,78 @@ pylith::feassemble::TestAuxiliaryFactory::testSetValuesFromDB(void) {
 } // testSetValuesFromDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Test setCache() with setValuesFromDB().
+void
+pylith::feassemble::TestAuxiliaryFactory::testCache(void) {
+    const int spaceDim = 2;
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(10.0);
+    normalizer.setDensityScale(2.0);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+
+    pylith::topology::Field::Description description;
+    description.label = "density";
+    description.alias = "density";
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = "density";
+    description.scale = normalizer.getDensityScale();
+    const pylith::topology::Field::Discretization discretization(1, 2);
+
+    spatialdata::spatialdb::UserFunctionDB auxiliaryDB;
+    auxiliaryDB.addValue("density", TestAuxiliaryFactory::density, TestAuxiliaryFactory::density_units());
+    auxiliaryDB.setCoordSys(cs);
+
+    // Database without density; querying it would fail, so values must come from the cache.
+    spatialdata::spatialdb::UserFunctionDB emptyDB;
+    emptyDB.setCoordSys(cs);
+
+    pylith::topology::Mesh mesh;
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri.mesh");
+    iohandler.read(&mesh);
+    mesh.setCoordSys(&cs);
+    pylith::topology::MeshOps::nondimensionalize(&mesh, normalizer);
+
+    pylith::topology::Field fieldQuery(mesh);
+    pylith::topology::Field fieldCache(mesh);
+    spatialdata::spatialdb::UserFunctionDB* dbs[2] = { &auxiliaryDB, &emptyDB };
+    pylith::topology::Field* fields[2] = { &fieldQuery, &fieldCache };
+    std::string key;
+    for (int i = 0; i < 2; ++i) {
+        AuxiliaryFactory factory;
+        factory.setQueryDB(dbs[i]);
+        factory.setCache(".", "test_auxiliary_cache", "signature");
+        factory.initialize(fields[i], normalizer, spaceDim);
+        fields[i]->subfieldAdd(description, discretization);
+        factory.setSubfieldQuery("density");
+        fields[i]->subfieldsSetup();
+        fields[i]->createDiscretization();
+        fields[i]->allocate();
+
+        assert(factory._cache);
+        const std::string& fieldKey = factory._cache->computeKey(*fields[i], normalizer);
+        if (i > 0) {
+            CHECK(key == fieldKey);
+        } // if
+        key = fieldKey;
+
+        factory.setValuesFromDB();
+    } // for
+
+    PetscBool isEqual = PETSC_FALSE;
+    PetscErrorCode err = VecEqual(fieldQuery.getLocalVector(), fieldCache.getLocalVector(), &isEqual);assert(!err);
+    CHECK(isEqual);
+
+    AuxiliaryCache cache(".", "test_auxiliary_cache", "signature");
+    std::remove(cache.getFilename(fieldQuery, key).c_str());
+} // testCache
+
+
 // ------------------------------------------------------------------------------------------------
 TEST_CASE("TestAuxiliaryFactory::testQueryDB", "[TestAuxiliaryFactory]") {
     pylith::feassemble::TestAuxiliaryFactory().testQueryDB();
@@ -318,5 +396,8 @@ TEST_CASE("TestAuxiliaryFactory::testInitialize", "[TestAuxiliaryFactory]") {
 TEST_CASE("TestAuxiliaryFactory::testSetValuesFromDB", "[TestAuxiliaryFactory]") {
     pylith::feassemble::TestAuxiliaryFactory().testSetValuesFromDB();
 }
+TEST_CASE("TestAuxiliaryFactory::testCache", "[TestAuxiliaryFactory]") {
+    pylith::feassemble::TestAuxiliaryFactory().testCache();
+}
 
 // End of file
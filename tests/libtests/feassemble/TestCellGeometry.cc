@@ -0,0 +1,411 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
+
+#include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <petscis.h> // USES PetscIS
+#include <petscdmfield.h> // USES DMFieldCreateDefaultQuadrature()
+
+extern "C" PetscErrorCode DMPlexComputeResidual_Internal(PetscDM dm,
+                                                         PetscFormKey key,
+                                                         PetscIS cellIS,
+                                                         PetscReal time,
+                                                         PetscVec locX,
+                                                         PetscVec locX_t,
+                                                         PetscReal t,
+                                                         PetscVec locF,
+                                                         void *user);
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace feassemble {
+        class TestCellGeometry;
+
+        class _TestCellGeometry {
+public:
+
+            /** Create mesh with four triangles and material label on cells.
+             *
+             * @param[out] mesh Finite-element mesh.
+             */
+            static
+            void createMesh(pylith::topology::Mesh* mesh);
+
+            /// Residual kernel f0 = u*u.
+            static
+            void f0(const PylithInt dim,
+                    const PylithInt numS,
+                    const PylithInt numA,
+                    const PylithInt sOff[],
+                    const PylithInt sOff_x[],
+                    const PylithScalar s[],
+                    const PylithScalar s_t[],
+                    const PylithScalar s_x[],
+                    const PylithInt aOff[],
+                    const PylithInt aOff_x[],
+                    const PylithScalar a[],
+                    const PylithScalar a_t[],
+                    const PylithScalar a_x[],
+                    const PylithReal t,
+                    const PylithScalar x[],
+                    const PylithInt numConstants,
+                    const PylithScalar constants[],
+                    PylithScalar f0[]);
+
+            /// Residual kernel f1 = x*grad(u).
+            static
+            void f1(const PylithInt dim,
+                    const PylithInt numS,
+                    const PylithInt numA,
+                    const PylithInt sOff[],
+                    const PylithInt sOff_x[],
+                    const PylithScalar s[],
+                    const PylithScalar s_t[],
+                    const PylithScalar s_x[],
+                    const PylithInt aOff[],
+                    const PylithInt aOff_x[],
+                    const PylithScalar a[],
+                    const PylithScalar a_t[],
+                    const PylithScalar a_x[],
+                    const PylithReal t,
+                    const PylithScalar x[],
+                    const PylithInt numConstants,
+                    const PylithScalar constants[],
+                    PylithScalar f1[]);
+
+            static const char* materialLabel; ///< Name of label for cells.
+            static const PetscInt materialValue; ///< Label value for cells.
+
+        }; // _TestCellGeometry
+    } // feassemble
+} // pylith
+
+class pylith::feassemble::TestCellGeometry {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test getCellsIS().
+    static
+    void testGetCellsIS(void);
+
+    /// Test create().
+    static
+    void testCreate(void);
+
+    /// Test residual with cached geometry matches residual with geometry computed on the fly.
+    static
+    void testCacheGeometry(void);
+
+}; // class TestCellGeometry
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestCellGeometry::testGetCellsIS", "[TestCellGeometry]") {
+    pylith::feassemble::TestCellGeometry::testGetCellsIS();
+}
+TEST_CASE("TestCellGeometry::testCreate", "[TestCellGeometry]") {
+    pylith::feassemble::TestCellGeometry::testCreate();
+}
+TEST_CASE("TestCellGeometry::testCacheGeometry", "[TestCellGeometry]") {
+    pylith::feassemble::TestCellGeometry::testCacheGeometry();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test getCellsIS().
+void
+pylith::feassemble::TestCellGeometry::testGetCellsIS(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    const PetscInt numCells = 5;
+    PetscIS cellsIS = NULL;
+    err = ISCreateStride(PETSC_COMM_SELF, numCells, 2, 1, &cellsIS);PYLITH_CHECK_ERROR(err);
+
+    // Cached geometry: assembly uses the IS of cells (geometry kept with IS).
+    PetscIS assemblyIS = CellGeometry::getCellsIS(cellsIS, true);
+    CHECK(cellsIS == assemblyIS);
+    err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+
+    // Geometry computed on the fly: assembly uses a copy of the IS of cells.
+    assemblyIS = CellGeometry::getCellsIS(cellsIS, false);
+    REQUIRE(assemblyIS);
+    CHECK(cellsIS != assemblyIS);
+    PetscBool isEqual = PETSC_FALSE;
+    err = ISEqual(cellsIS, assemblyIS, &isEqual);PYLITH_CHECK_ERROR(err);
+    CHECK(isEqual);
+    err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+
+    // No cells.
+    CHECK(!CellGeometry::getCellsIS(NULL, true));
+    CHECK(!CellGeometry::getCellsIS(NULL, false));
+
+    err = ISDestroy(&cellsIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testGetCellsIS
+
+
+// ------------------------------------------------------------------------------------------------
+// Test create().
+void
+pylith::feassemble::TestCellGeometry::testCreate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _TestCellGeometry::createMesh(&mesh);
+
+    pylith::topology::Field::Description description;
+    description.label = "pressure";
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = "pressure";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    pylith::topology::Field field(mesh);
+    field.setLabel("solution");
+    field.subfieldAdd(description, pylith::topology::Field::Discretization(1, 1));
+    field.subfieldsSetup();
+    field.createDiscretization();
+
+    DSLabelAccess dsLabel(field.getDM(), _TestCellGeometry::materialLabel, _TestCellGeometry::materialValue);
+    REQUIRE(dsLabel.cellsIS());
+
+    // Triangles with linear coordinates are affine, so the geometry uses the default quadrature of
+    // the coordinate field. Geometry has coordinates, Jacobian, inverse of Jacobian, and determinant
+    // of Jacobian at each point.
+    PetscErrorCode err = PETSC_SUCCESS;
+    DMField coordField = NULL;
+    PetscQuadrature quadrature = NULL;
+    err = DMGetCoordinateField(dsLabel.dm(), &coordField);PYLITH_CHECK_ERROR(err);
+    err = DMFieldCreateDefaultQuadrature(coordField, dsLabel.cellsIS(), &quadrature);PYLITH_CHECK_ERROR(err);
+    REQUIRE(quadrature);
+    PetscInt numQuadPts = 0;
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
+
+    const size_t spaceDim = 2;
+    const size_t numBytesE = size_t(dsLabel.numCells()) * size_t(numQuadPts) *
+                             (spaceDim + 2*spaceDim*spaceDim + 1) * sizeof(PetscReal);
+    CHECK(numBytesE == CellGeometry::create(dsLabel.dm(), dsLabel.ds(), dsLabel.cellsIS()));
+
+    // Geometry kept with the IS is reused.
+    CHECK(numBytesE == CellGeometry::create(dsLabel.dm(), dsLabel.ds(), dsLabel.cellsIS()));
+
+    // No cells.
+    CHECK(0 == CellGeometry::create(dsLabel.dm(), dsLabel.ds(), NULL));
+
+    PYLITH_METHOD_END;
+} // testCreate
+
+
+// ------------------------------------------------------------------------------------------------
+// Test residual with cached geometry matches residual with geometry computed on the fly.
+void
+pylith::feassemble::TestCellGeometry::testCacheGeometry(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _TestCellGeometry::createMesh(&mesh);
+
+    pylith::topology::Field::Description description;
+    description.label = "pressure";
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = "pressure";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    pylith::topology::Field solution(mesh);
+    solution.setLabel("solution");
+    solution.subfieldAdd(description, pylith::topology::Field::Discretization(2, 2));
+    solution.subfieldsSetup();
+    solution.createDiscretization();
+    solution.allocate();
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    DSLabelAccess dsLabel(solution.getDM(), _TestCellGeometry::materialLabel, _TestCellGeometry::materialValue);
+    err = PetscWeakFormAddResidual(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), 0, 0,
+                                   _TestCellGeometry::f0, _TestCellGeometry::f1);PYLITH_CHECK_ERROR(err);
+
+    // Distinct value for every degree of freedom.
+    PetscVec solutionVec = solution.getLocalVector();
+    PetscInt size = 0;
+    err = VecGetLocalSize(solutionVec, &size);PYLITH_CHECK_ERROR(err);
+    PetscScalar* solutionArray = NULL;
+    err = VecGetArray(solutionVec, &solutionArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < size; ++i) {
+        solutionArray[i] = 1.0 + 0.1*i;
+    } // for
+    err = VecRestoreArray(solutionVec, &solutionArray);PYLITH_CHECK_ERROR(err);
+
+    PetscFormKey key;
+    key.label = dsLabel.label();
+    key.value = dsLabel.value();
+    key.field = 0;
+    key.part = 0;
+
+    const size_t numCases = 2;
+    const bool cacheGeometry[numCases] = { true, false };
+    PetscVec residualVec[numCases] = { NULL, NULL };
+    CellGeometry::create(dsLabel.dm(), dsLabel.ds(), dsLabel.cellsIS());
+    for (size_t iCase = 0; iCase < numCases; ++iCase) {
+        err = DMCreateLocalVector(dsLabel.dm(), &residualVec[iCase]);PYLITH_CHECK_ERROR(err);
+        err = VecSet(residualVec[iCase], 0.0);PYLITH_CHECK_ERROR(err);
+
+        // Evaluate twice to reuse the geometry kept with the IS of cells.
+        PetscIS assemblyIS = CellGeometry::getCellsIS(dsLabel.cellsIS(), cacheGeometry[iCase]);
+        err = DMPlexComputeResidual_Internal(dsLabel.dm(), key, assemblyIS, PETSC_MIN_REAL, solutionVec, NULL, 0.0,
+                                             residualVec[iCase], NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+        err = VecSet(residualVec[iCase], 0.0);PYLITH_CHECK_ERROR(err);
+        assemblyIS = CellGeometry::getCellsIS(dsLabel.cellsIS(), cacheGeometry[iCase]);
+        err = DMPlexComputeResidual_Internal(dsLabel.dm(), key, assemblyIS, PETSC_MIN_REAL, solutionVec, NULL, 0.0,
+                                             residualVec[iCase], NULL);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&assemblyIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    const PetscScalar* residualCached = NULL;
+    const PetscScalar* residualOnFly = NULL;
+    err = VecGetArrayRead(residualVec[0], &residualCached);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(residualVec[1], &residualOnFly);PYLITH_CHECK_ERROR(err);
+    PylithReal residualNorm = 0.0;
+    for (PetscInt i = 0; i < size; ++i) {
+        INFO("Residual index " << i);
+        CHECK(residualCached[i] == residualOnFly[i]);
+        residualNorm += PetscAbsScalar(residualCached[i]);
+    } // for
+    CHECK(residualNorm > 0.0);
+    err = VecRestoreArrayRead(residualVec[1], &residualOnFly);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(residualVec[0], &residualCached);PYLITH_CHECK_ERROR(err);
+
+    for (size_t iCase = 0; iCase < numCases; ++iCase) {
+        err = VecDestroy(&residualVec[iCase]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testCacheGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+const char* pylith::feassemble::_TestCellGeometry::materialLabel = "material-id";
+const PetscInt pylith::feassemble::_TestCellGeometry::materialValue = 1;
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh with four triangles and material label on cells.
+void
+pylith::feassemble::_TestCellGeometry::createMesh(pylith::topology::Mesh* mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 5;
+    const int numCells = 4;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        2.0, 0.0,
+        2.0, 1.0,
+        0.0, 1.5,
+        0.8, 0.6,
+    };
+    const PylithInt cellsValues[numCells*numCorners] = {
+        0, 1, 4,
+        1, 2, 4,
+        2, 3, 4,
+        3, 0, 4,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    pylith::meshio::MeshBuilder::buildMesh(mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    mesh->setCoordSys(&cs);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = mesh->getDM();
+    err = DMCreateLabel(dm, materialLabel);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = 0; cell < numCells; ++cell) {
+        err = DMSetLabelValue(dm, materialLabel, cell, materialValue);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // createMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Residual kernel f0 = u*u.
+void
+pylith::feassemble::_TestCellGeometry::f0(const PylithInt dim,
+                                          const PylithInt numS,
+                                          const PylithInt numA,
+                                          const PylithInt sOff[],
+                                          const PylithInt sOff_x[],
+                                          const PylithScalar s[],
+                                          const PylithScalar s_t[],
+                                          const PylithScalar s_x[],
+                                          const PylithInt aOff[],
+                                          const PylithInt aOff_x[],
+                                          const PylithScalar a[],
+                                          const PylithScalar a_t[],
+                                          const PylithScalar a_x[],
+                                          const PylithReal t,
+                                          const PylithScalar x[],
+                                          const PylithInt numConstants,
+                                          const PylithScalar constants[],
+                                          PylithScalar f0[]) {
+    f0[0] += s[sOff[0]] * s[sOff[0]];
+} // f0
+
+
+// ------------------------------------------------------------------------------------------------
+// Residual kernel f1 = x*grad(u).
+void
+pylith::feassemble::_TestCellGeometry::f1(const PylithInt dim,
+                                          const PylithInt numS,
+                                          const PylithInt numA,
+                                          const PylithInt sOff[],
+                                          const PylithInt sOff_x[],
+                                          const PylithScalar s[],
+                                          const PylithScalar s_t[],
+                                          const PylithScalar s_x[],
+                                          const PylithInt aOff[],
+                                          const PylithInt aOff_x[],
+                                          const PylithScalar a[],
+                                          const PylithScalar a_t[],
+                                          const PylithScalar a_x[],
+                                          const PylithReal t,
+                                          const PylithScalar x[],
+                                          const PylithInt numConstants,
+                                          const PylithScalar constants[],
+                                          PylithScalar f1[]) {
+    for (PylithInt i = 0; i < dim; ++i) {
+        f1[i] += x[i] * s_x[sOff_x[0]+i];
+    } // for
+} // f1
+
+
+// End of file
@@ -0,0 +1,578 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <petscdmplex.h> // USES DMPlexCreateFromCellListPetsc()
+#include <petscds.h> // USES PetscDSAddBoundary()
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <set> // USES std::set
+
+extern "C" PetscErrorCode DMPlexComputeResidual_Internal(PetscDM dm,
+                                                         PetscFormKey key,
+                                                         PetscIS cellIS,
+                                                         PetscReal time,
+                                                         PetscVec locX,
+                                                         PetscVec locX_t,
+                                                         PetscReal t,
+                                                         PetscVec locF,
+                                                         void *user);
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace feassemble {
+        class TestDSLabelAccess;
+
+        class _TestDSLabelAccess {
+public:
+
+            /** Create mesh of unit square with material label on cells and boundary label on
+             * vertices at x=0, distributed if there is more than one process.
+             *
+             * @param[out] mesh Finite-element mesh.
+             */
+            static
+            void createMesh(pylith::topology::Mesh* mesh);
+
+            /** Create solution field with a scalar subfield constrained on the boundary.
+             *
+             * @param[out] field Solution field.
+             */
+            static
+            void createField(pylith::topology::Field* field);
+
+            /** Set constrained values in local vector.
+             *
+             * @param[inout] localVec Local vector.
+             * @param[in] dm PETSc DM for vector.
+             * @param[in] value Constrained value.
+             */
+            static
+            void setConstrainedValues(PetscVec localVec,
+                                      PetscDM dm,
+                                      const PylithScalar value);
+
+            /** Check whether closure of cell has ghost points or constrained degrees of freedom.
+             *
+             * @param[in] dm PETSc DM for solution.
+             * @param[in] cell Cell.
+             * @returns True if closure has ghost points or constrained degrees of freedom.
+             */
+            static
+            bool hasDeferredPoint(PetscDM dm,
+                                  const PetscInt cell);
+
+            /// Residual kernel f0 = u*u.
+            static
+            void f0(const PylithInt dim,
+                    const PylithInt numS,
+                    const PylithInt numA,
+                    const PylithInt sOff[],
+                    const PylithInt sOff_x[],
+                    const PylithScalar s[],
+                    const PylithScalar s_t[],
+                    const PylithScalar s_x[],
+                    const PylithInt aOff[],
+                    const PylithInt aOff_x[],
+                    const PylithScalar a[],
+                    const PylithScalar a_t[],
+                    const PylithScalar a_x[],
+                    const PylithReal t,
+                    const PylithScalar x[],
+                    const PylithInt numConstants,
+                    const PylithScalar constants[],
+                    PylithScalar f0[]);
+
+            /// Residual kernel f1 = grad(u).
+            static
+            void f1(const PylithInt dim,
+                    const PylithInt numS,
+                    const PylithInt numA,
+                    const PylithInt sOff[],
+                    const PylithInt sOff_x[],
+                    const PylithScalar s[],
+                    const PylithScalar s_t[],
+                    const PylithScalar s_x[],
+                    const PylithInt aOff[],
+                    const PylithInt aOff_x[],
+                    const PylithScalar a[],
+                    const PylithScalar a_t[],
+                    const PylithScalar a_x[],
+                    const PylithReal t,
+                    const PylithScalar x[],
+                    const PylithInt numConstants,
+                    const PylithScalar constants[],
+                    PylithScalar f1[]);
+
+            /// Boundary value (not used to set values in these tests).
+            static
+            PetscErrorCode zero(PetscInt dim,
+                                PetscReal t,
+                                const PetscReal x[],
+                                PetscInt numComponents,
+                                PetscScalar* values,
+                                void* context);
+
+            static const char* materialLabel; ///< Name of label for cells.
+            static const PetscInt materialValue; ///< Label value for cells.
+            static const char* boundaryLabel; ///< Name of label for constrained vertices.
+            static const PetscInt boundaryValue; ///< Label value for constrained vertices.
+
+        }; // _TestDSLabelAccess
+    } // feassemble
+} // pylith
+
+class pylith::feassemble::TestDSLabelAccess {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Test splitGhostedCells().
+     *
+     * Run with more than one process to check cells with ghost points.
+     */
+    static
+    void testSplitGhostedCells(void);
+
+    /** Test residual computed over interior cells while scattering the solution and then over
+     * ghosted cells matches the residual over all cells after scattering the solution.
+     */
+    static
+    void testSplitResidual(void);
+
+}; // class TestDSLabelAccess
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestDSLabelAccess::testSplitGhostedCells", "[TestDSLabelAccess]") {
+    pylith::feassemble::TestDSLabelAccess::testSplitGhostedCells();
+}
+TEST_CASE("TestDSLabelAccess::testSplitResidual", "[TestDSLabelAccess]") {
+    pylith::feassemble::TestDSLabelAccess::testSplitResidual();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test splitGhostedCells().
+void
+pylith::feassemble::TestDSLabelAccess::testSplitGhostedCells(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _TestDSLabelAccess::createMesh(&mesh);
+    pylith::topology::Field solution(mesh);
+    _TestDSLabelAccess::createField(&solution);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = solution.getDM();
+    DSLabelAccess dsLabel(dm, _TestDSLabelAccess::materialLabel, _TestDSLabelAccess::materialValue);
+    dsLabel.removeOverlap();
+    CHECK(!dsLabel.hasSplitCells());
+    CHECK(!dsLabel.interiorCellsIS());
+    CHECK(!dsLabel.ghostedCellsIS());
+
+    dsLabel.splitGhostedCells();
+    CHECK(dsLabel.hasSplitCells());
+    REQUIRE(dsLabel.numCells() == dsLabel.numInteriorCells() + dsLabel.numGhostedCells());
+
+    // Every cell is in exactly one subset.
+    std::set<PetscInt> cells;
+    const PetscInt* indices = NULL;
+    if (dsLabel.numCells() > 0) {
+        err = ISGetIndices(dsLabel.cellsIS(), &indices);PYLITH_CHECK_ERROR(err);
+        cells.insert(indices, indices+dsLabel.numCells());
+        err = ISRestoreIndices(dsLabel.cellsIS(), &indices);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    std::set<PetscInt> splitCells;
+    if (dsLabel.numInteriorCells() > 0) {
+        err = ISGetIndices(dsLabel.interiorCellsIS(), &indices);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < dsLabel.numInteriorCells(); ++i) {
+            INFO("Interior cell " << indices[i]);
+            CHECK(!_TestDSLabelAccess::hasDeferredPoint(dm, indices[i]));
+            splitCells.insert(indices[i]);
+        } // for
+        err = ISRestoreIndices(dsLabel.interiorCellsIS(), &indices);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (dsLabel.numGhostedCells() > 0) {
+        err = ISGetIndices(dsLabel.ghostedCellsIS(), &indices);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < dsLabel.numGhostedCells(); ++i) {
+            INFO("Ghosted cell " << indices[i]);
+            CHECK(_TestDSLabelAccess::hasDeferredPoint(dm, indices[i]));
+            splitCells.insert(indices[i]);
+        } // for
+        err = ISRestoreIndices(dsLabel.ghostedCellsIS(), &indices);PYLITH_CHECK_ERROR(err);
+    } // if
+    CHECK(cells == splitCells);
+
+    // Cells adjacent to the constrained boundary are ghosted cells, so there are ghosted cells
+    // even without ghost points.
+    PetscInt numGhostedCells = dsLabel.numGhostedCells();
+    PetscInt numGhostedCellsGlobal = 0;
+    err = MPI_Allreduce(&numGhostedCells, &numGhostedCellsGlobal, 1, MPIU_INT, MPI_SUM, mesh.getComm());PYLITH_CHECK_ERROR(err);
+    CHECK(numGhostedCellsGlobal > 0);
+
+    PYLITH_METHOD_END;
+} // testSplitGhostedCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Test residual over interior and ghosted cells matches residual over all cells.
+void
+pylith::feassemble::TestDSLabelAccess::testSplitResidual(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    _TestDSLabelAccess::createMesh(&mesh);
+    pylith::topology::Field solution(mesh);
+    _TestDSLabelAccess::createField(&solution);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = solution.getDM();
+    DSLabelAccess dsLabel(dm, _TestDSLabelAccess::materialLabel, _TestDSLabelAccess::materialValue);
+    dsLabel.removeOverlap();
+    dsLabel.splitGhostedCells();
+    if (dsLabel.weakForm()) {
+        err = PetscWeakFormAddResidual(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), 0, 0,
+                                       _TestDSLabelAccess::f0, _TestDSLabelAccess::f1);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Global solution with distinct value for every degree of freedom.
+    PetscVec solutionVec = NULL;
+    err = DMCreateGlobalVector(dm, &solutionVec);PYLITH_CHECK_ERROR(err);
+    PetscInt iStart = 0, iEnd = 0;
+    err = VecGetOwnershipRange(solutionVec, &iStart, &iEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = iStart; i < iEnd; ++i) {
+        const PetscScalar value = 1.0 + 0.1*i;
+        err = VecSetValue(solutionVec, i, value, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecAssemblyBegin(solutionVec);PYLITH_CHECK_ERROR(err);
+    err = VecAssemblyEnd(solutionVec);PYLITH_CHECK_ERROR(err);
+
+    PetscFormKey key;
+    key.label = dsLabel.label();
+    key.value = dsLabel.value();
+    key.field = 0;
+    key.part = 0;
+
+    const PylithScalar staleValue = -5.0;
+    const PylithScalar constrainedValue = 2.0;
+    PetscVec residualAll = NULL, residualSplit = NULL;
+    err = DMCreateLocalVector(dm, &residualAll);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLocalVector(dm, &residualSplit);PYLITH_CHECK_ERROR(err);
+    err = VecSet(residualAll, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecSet(residualSplit, 0.0);PYLITH_CHECK_ERROR(err);
+
+    // Residual over all cells after scattering the solution and setting constrained values.
+    err = VecSet(solution.getLocalVector(), staleValue);PYLITH_CHECK_ERROR(err);
+    solution.scatterVectorToLocal(solutionVec);
+    _TestDSLabelAccess::setConstrainedValues(solution.getLocalVector(), dm, constrainedValue);
+    if (dsLabel.numCells() > 0) {
+        err = DMPlexComputeResidual_Internal(dm, key, dsLabel.cellsIS(), PETSC_MIN_REAL, solution.getLocalVector(),
+                                             NULL, 0.0, residualAll, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Residual over interior cells while scattering the solution, followed by ghosted cells after
+    // the scatter completes and the constrained values are set (as in TimeDependent).
+    err = VecSet(solution.getLocalVector(), staleValue);PYLITH_CHECK_ERROR(err);
+    solution.scatterVectorToLocalBegin(solutionVec);
+    if (dsLabel.numInteriorCells() > 0) {
+        err = DMPlexComputeResidual_Internal(dm, key, dsLabel.interiorCellsIS(), PETSC_MIN_REAL, solution.getLocalVector(),
+                                             NULL, 0.0, residualSplit, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+    solution.scatterVectorToLocalEnd(solutionVec);
+    _TestDSLabelAccess::setConstrainedValues(solution.getLocalVector(), dm, constrainedValue);
+    if (dsLabel.numGhostedCells() > 0) {
+        err = DMPlexComputeResidual_Internal(dm, key, dsLabel.ghostedCellsIS(), PETSC_MIN_REAL, solution.getLocalVector(),
+                                             NULL, 0.0, residualSplit, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscInt size = 0, sizeSplit = 0;
+    err = VecGetLocalSize(residualAll, &size);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(residualSplit, &sizeSplit);PYLITH_CHECK_ERROR(err);
+    REQUIRE(size == sizeSplit);
+
+    const PetscScalar* valuesAll = NULL;
+    const PetscScalar* valuesSplit = NULL;
+    err = VecGetArrayRead(residualAll, &valuesAll);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(residualSplit, &valuesSplit);PYLITH_CHECK_ERROR(err);
+    const PylithReal tolerance = 1.0e-10;
+    for (PetscInt i = 0; i < size; ++i) {
+        INFO("Residual index " << i);
+        CHECK_THAT(valuesSplit[i], Catch::Matchers::WithinAbs(valuesAll[i], tolerance));
+    } // for
+    err = VecRestoreArrayRead(residualSplit, &valuesSplit);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(residualAll, &valuesAll);PYLITH_CHECK_ERROR(err);
+
+    err = VecDestroy(&residualSplit);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&residualAll);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testSplitResidual
+
+
+// ------------------------------------------------------------------------------------------------
+const char* pylith::feassemble::_TestDSLabelAccess::materialLabel = "material-id";
+const PetscInt pylith::feassemble::_TestDSLabelAccess::materialValue = 1;
+const char* pylith::feassemble::_TestDSLabelAccess::boundaryLabel = "boundary_xneg";
+const PetscInt pylith::feassemble::_TestDSLabelAccess::boundaryValue = 1;
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh with material and boundary labels.
+void
+pylith::feassemble::_TestDSLabelAccess::createMesh(pylith::topology::Mesh* mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+
+    // Square divided into 3x3 squares, each with two triangles; cells are all on process 0 before
+    // distributing the mesh.
+    const PetscInt cellDim = 2;
+    const PetscInt numCorners = 3;
+    const PetscInt numVerticesAll = 16;
+    const PetscInt numCellsAll = 18;
+    PetscInt cellsAll[numCellsAll*numCorners];
+    PetscReal coordinatesAll[numVerticesAll*cellDim];
+    for (PetscInt j = 0, iCell = 0; j < 3; ++j) {
+        for (PetscInt i = 0; i < 3; ++i) {
+            const PetscInt v0 = 4*j + i;
+            const PetscInt v1 = v0 + 1;
+            const PetscInt v2 = v0 + 5;
+            const PetscInt v3 = v0 + 4;
+            cellsAll[3*iCell+0] = v0;cellsAll[3*iCell+1] = v1;cellsAll[3*iCell+2] = v2;++iCell;
+            cellsAll[3*iCell+0] = v0;cellsAll[3*iCell+1] = v2;cellsAll[3*iCell+2] = v3;++iCell;
+        } // for
+    } // for
+    for (PetscInt j = 0; j < 4; ++j) {
+        for (PetscInt i = 0; i < 4; ++i) {
+            coordinatesAll[2*(4*j+i)+0] = i;
+            coordinatesAll[2*(4*j+i)+1] = j;
+        } // for
+    } // for
+
+    pylith::topology::Mesh meshSerial;
+    const bool isRoot = 0 == meshSerial.getCommRank();
+    PetscDM dmSerial = NULL;
+    err = DMPlexCreateFromCellListPetsc(meshSerial.getComm(), cellDim, isRoot ? numCellsAll : 0,
+                                        isRoot ? numVerticesAll : 0, numCorners, PETSC_TRUE, cellsAll,
+                                        cellDim, coordinatesAll, &dmSerial);PYLITH_CHECK_ERROR(err);
+
+    // Cells come before vertices in the DMPlex numbering.
+    err = DMCreateLabel(dmSerial, materialLabel);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLabel(dmSerial, boundaryLabel);PYLITH_CHECK_ERROR(err);
+    if (isRoot) {
+        for (PetscInt cell = 0; cell < numCellsAll; ++cell) {
+            err = DMSetLabelValue(dmSerial, materialLabel, cell, materialValue);PYLITH_CHECK_ERROR(err);
+        } // for
+        for (PetscInt j = 0; j < 4; ++j) {
+            err = DMSetLabelValue(dmSerial, boundaryLabel, numCellsAll + 4*j, boundaryValue);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // if
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(cellDim);
+    if (meshSerial.getCommSize() > 1) {
+        meshSerial.setDM(dmSerial);
+        meshSerial.setCoordSys(&cs);
+        pylith::topology::Distributor::distribute(mesh, meshSerial, NULL, 0, "simple", false);
+    } else {
+        mesh->setDM(dmSerial);
+        mesh->setCoordSys(&cs);
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // createMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Create solution field with scalar subfield constrained on the boundary.
+void
+pylith::feassemble::_TestDSLabelAccess::createField(pylith::topology::Field* field) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    pylith::topology::Field::Description description;
+    description.label = "pressure";
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = "pressure";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    field->setLabel("solution");
+    field->subfieldAdd(description, pylith::topology::Field::Discretization(1, 1));
+    field->subfieldsSetup();
+    field->createDiscretization();
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = field->getDM();
+    PetscDS ds = NULL;
+    PetscDMLabel label = NULL;
+    err = DMGetDS(dm, &ds);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, boundaryLabel, &label);PYLITH_CHECK_ERROR(err);
+    err = PetscDSAddBoundary(ds, DM_BC_ESSENTIAL, boundaryLabel, label, 1, &boundaryValue, 0, 0, NULL,
+                             (void (*)(void)) zero, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    field->allocate();
+
+    PYLITH_METHOD_END;
+} // createField
+
+
+// ------------------------------------------------------------------------------------------------
+// Set constrained values in local vector.
+void
+pylith::feassemble::_TestDSLabelAccess::setConstrainedValues(PetscVec localVec,
+                                                             PetscDM dm,
+                                                             const PylithScalar value) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dm, &section);PYLITH_CHECK_ERROR(err);
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    PetscScalar* array = NULL;
+    err = VecGetArray(localVec, &array);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt numConstrained = 0, offset = 0;
+        const PetscInt* constrainedIndices = NULL;
+        err = PetscSectionGetConstraintDof(section, point, &numConstrained);PYLITH_CHECK_ERROR(err);
+        if (!numConstrained) { continue; }
+        err = PetscSectionGetOffset(section, point, &offset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetConstraintIndices(section, point, &constrainedIndices);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numConstrained; ++i) {
+            array[offset+constrainedIndices[i]] = value;
+        } // for
+    } // for
+    err = VecRestoreArray(localVec, &array);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setConstrainedValues
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether closure of cell has ghost points or constrained degrees of freedom.
+bool
+pylith::feassemble::_TestDSLabelAccess::hasDeferredPoint(PetscDM dm,
+                                                         const PetscInt cell) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscSF sf = NULL;
+    const PetscInt* leaves = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    std::set<PetscInt> ghostPoints;
+    for (PetscInt iLeaf = 0; numRoots >= 0 && iLeaf < numLeaves; ++iLeaf) {
+        ghostPoints.insert(leaves ? leaves[iLeaf] : iLeaf);
+    } // for
+
+    PetscSection section = NULL;
+    err = DMGetLocalSection(dm, &section);PYLITH_CHECK_ERROR(err);
+
+    bool hasDeferred = false;
+    PetscInt closureSize = 0;
+    PetscInt* closure = NULL;
+    err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+        const PetscInt point = closure[2*iPoint];
+        PetscInt numConstrained = 0;
+        err = PetscSectionGetConstraintDof(section, point, &numConstrained);PYLITH_CHECK_ERROR(err);
+        hasDeferred = hasDeferred || ghostPoints.count(point) || (numConstrained > 0);
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(hasDeferred);
+} // hasDeferredPoint
+
+
+// ------------------------------------------------------------------------------------------------
+// Residual kernel f0 = u*u.
+void
+pylith::feassemble::_TestDSLabelAccess::f0(const PylithInt dim,
+                                           const PylithInt numS,
+                                           const PylithInt numA,
+                                           const PylithInt sOff[],
+                                           const PylithInt sOff_x[],
+                                           const PylithScalar s[],
+                                           const PylithScalar s_t[],
+                                           const PylithScalar s_x[],
+                                           const PylithInt aOff[],
+                                           const PylithInt aOff_x[],
+                                           const PylithScalar a[],
+                                           const PylithScalar a_t[],
+                                           const PylithScalar a_x[],
+                                           const PylithReal t,
+                                           const PylithScalar x[],
+                                           const PylithInt numConstants,
+                                           const PylithScalar constants[],
+                                           PylithScalar f0[]) {
+    f0[0] += s[sOff[0]] * s[sOff[0]];
+} // f0
+
+
+// ------------------------------------------------------------------------------------------------
+// Residual kernel f1 = grad(u).
+void
+pylith::feassemble::_TestDSLabelAccess::f1(const PylithInt dim,
+                                           const PylithInt numS,
+                                           const PylithInt numA,
+                                           const PylithInt sOff[],
+                                           const PylithInt sOff_x[],
+                                           const PylithScalar s[],
+                                           const PylithScalar s_t[],
+                                           const PylithScalar s_x[],
+                                           const PylithInt aOff[],
+                                           const PylithInt aOff_x[],
+                                           const PylithScalar a[],
+                                           const PylithScalar a_t[],
+                                           const PylithScalar a_x[],
+                                           const PylithReal t,
+                                           const PylithScalar x[],
+                                           const PylithInt numConstants,
+                                           const PylithScalar constants[],
+                                           PylithScalar f1[]) {
+    for (PylithInt i = 0; i < dim; ++i) {
+        f1[i] += s_x[sOff_x[0]+i];
+    } // for
+} // f1
+
+
+// ------------------------------------------------------------------------------------------------
+// Boundary value.
+PetscErrorCode
+pylith::feassemble::_TestDSLabelAccess::zero(PetscInt dim,
+                                             PetscReal t,
+                                             const PetscReal x[],
+                                             PetscInt numComponents,
+                                             PetscScalar* values,
+                                             void* context) {
+    for (PetscInt i = 0; i < numComponents; ++i) {
+        values[i] = 0.0;
+    } // for
+    return PETSC_SUCCESS;
+} // zero
+
+
+// End of file
@@ -0,0 +1,195 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/feassemble/UpdateStateVars.hh" // USES UpdateStateVars
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <petscdmplex.h> // USES DMPlexCreateFromCellListPetsc()
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace feassemble {
+        class TestUpdateStateVars;
+    }
+}
+
+class pylith::feassemble::TestUpdateStateVars {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Test prepare() and restore() with values at shared points that differ among processes.
+     *
+     * Run with more than one process to check the values at shared points.
+     */
+    static
+    void testSharedPoints(void);
+
+}; // class TestUpdateStateVars
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestUpdateStateVars::testSharedPoints", "[TestUpdateStateVars]") {
+    pylith::feassemble::TestUpdateStateVars::testSharedPoints();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test prepare() and restore() with values at shared points that differ among processes.
+void
+pylith::feassemble::TestUpdateStateVars::testSharedPoints(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+
+    // Square divided into 2x2 squares, each with two triangles; cells are all on process 0 before
+    // distributing the mesh.
+    const PetscInt cellDim = 2;
+    const PetscInt numCorners = 3;
+    const PetscInt numVerticesAll = 9;
+    const PetscInt numCellsAll = 8;
+    const PetscInt cellsAll[numCellsAll*numCorners] = {
+        0, 1, 4,
+        0, 4, 3,
+        1, 2, 5,
+        1, 5, 4,
+        3, 4, 7,
+        3, 7, 6,
+        4, 5, 8,
+        4, 8, 7,
+    };
+    const PetscReal coordinatesAll[numVerticesAll*cellDim] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        2.0, 0.0,
+        0.0, 1.0,
+        1.0, 1.0,
+        2.0, 1.0,
+        0.0, 2.0,
+        1.0, 2.0,
+        2.0, 2.0,
+    };
+
+    pylith::topology::Mesh meshSerial;
+    const bool isRoot = 0 == meshSerial.getCommRank();
+    PetscDM dmSerial = NULL;
+    err = DMPlexCreateFromCellListPetsc(meshSerial.getComm(), cellDim, isRoot ? numCellsAll : 0,
+                                        isRoot ? numVerticesAll : 0, numCorners, PETSC_TRUE, cellsAll,
+                                        cellDim, coordinatesAll, &dmSerial);PYLITH_CHECK_ERROR(err);
+    meshSerial.setDM(dmSerial);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(cellDim);
+    meshSerial.setCoordSys(&cs);
+
+    pylith::topology::Mesh mesh;
+    pylith::topology::Distributor::distribute(&mesh, meshSerial, NULL, 0, "simple", false);
+
+    // Auxiliary field with a subfield that is not a state variable and a state variable subfield.
+    pylith::topology::Field::Description descriptionParameter;
+    descriptionParameter.label = "parameter";
+    descriptionParameter.vectorFieldType = pylith::topology::Field::SCALAR;
+    descriptionParameter.numComponents = 1;
+    descriptionParameter.componentNames.resize(1);
+    descriptionParameter.componentNames[0] = "parameter";
+    descriptionParameter.scale = 1.0;
+    descriptionParameter.validator = NULL;
+
+    pylith::topology::Field::Description descriptionState;
+    descriptionState.label = "state";
+    descriptionState.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionState.numComponents = 2;
+    descriptionState.componentNames.resize(2);
+    descriptionState.componentNames[0] = "state_x";
+    descriptionState.componentNames[1] = "state_y";
+    descriptionState.scale = 1.0;
+    descriptionState.validator = NULL;
+    descriptionState.hasHistory = true;
+
+    const pylith::topology::Field::Discretization discretization(1, 1);
+    pylith::topology::Field auxiliaryField(mesh);
+    auxiliaryField.setLabel("auxiliary field");
+    auxiliaryField.subfieldAdd(descriptionParameter, discretization);
+    auxiliaryField.subfieldAdd(descriptionState, discretization);
+    auxiliaryField.subfieldsSetup();
+    auxiliaryField.createDiscretization();
+    auxiliaryField.allocate();
+
+    const PylithReal parameterValue = 5.0;
+    err = VecSet(auxiliaryField.getLocalVector(), parameterValue);PYLITH_CHECK_ERROR(err);
+
+    UpdateStateVars updateState;
+    updateState.initialize(auxiliaryField);
+    updateState.prepare(&auxiliaryField);
+
+    // Mimic state variables computed independently on each process, so values at shared points
+    // differ among processes.
+    const PylithReal stateValue = 1.0 + mesh.getCommRank();
+    err = VecSet(updateState.stateVarsLocalVector(), stateValue);PYLITH_CHECK_ERROR(err);
+    updateState.restore(&auxiliaryField);
+
+    // Values at points owned by this process are the ones computed by this process, and values at
+    // shared points agree with the value on the owning process.
+    PetscDM auxiliaryDM = auxiliaryField.getDM();
+    PetscSection globalSection = NULL;
+    err = DMGetGlobalSection(auxiliaryDM, &globalSection);PYLITH_CHECK_ERROR(err);
+
+    PetscVec globalVec = NULL, localVecOwner = NULL;
+    err = DMCreateGlobalVector(auxiliaryDM, &globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMCreateLocalVector(auxiliaryDM, &localVecOwner);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobal(auxiliaryDM, auxiliaryField.getLocalVector(), INSERT_VALUES, globalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocal(auxiliaryDM, globalVec, INSERT_VALUES, localVecOwner);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt iParameter = auxiliaryField.getSubfieldInfo("parameter").index;
+    const PetscInt iState = auxiliaryField.getSubfieldInfo("state").index;
+    pylith::topology::VecVisitorMesh auxiliaryVisitor(auxiliaryField);
+    const PetscScalar* auxiliaryArray = auxiliaryVisitor.localArray();
+    const PetscScalar* ownerArray = NULL;
+    err = VecGetArrayRead(localVecOwner, &ownerArray);PYLITH_CHECK_ERROR(err);
+
+    const PylithReal tolerance = 1.0e-6;
+    pylith::topology::Stratum verticesStratum(auxiliaryDM, pylith::topology::Stratum::DEPTH, 0);
+    for (PetscInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+        PetscInt globalOffset = 0;
+        err = PetscSectionGetOffset(globalSection, vertex, &globalOffset);PYLITH_CHECK_ERROR(err);
+        const bool isOwned = globalOffset >= 0;
+
+        const PetscInt offParameter = auxiliaryVisitor.sectionSubfieldOffset(iParameter, vertex);
+        CHECK_THAT(auxiliaryArray[offParameter], Catch::Matchers::WithinAbs(parameterValue, tolerance));
+
+        const PetscInt offState = auxiliaryVisitor.sectionSubfieldOffset(iState, vertex);
+        const PetscInt dofState = auxiliaryVisitor.sectionSubfieldDof(iState, vertex);
+        REQUIRE(2 == dofState);
+        for (PetscInt iDof = 0; iDof < dofState; ++iDof) {
+            CHECK_THAT(auxiliaryArray[offState+iDof], Catch::Matchers::WithinAbs(ownerArray[offState+iDof], tolerance));
+            if (isOwned) {
+                CHECK_THAT(auxiliaryArray[offState+iDof], Catch::Matchers::WithinAbs(stateValue, tolerance));
+            } // if
+        } // for
+    } // for
+    err = VecRestoreArrayRead(localVecOwner, &ownerArray);PYLITH_CHECK_ERROR(err);
+
+    err = VecDestroy(&localVecOwner);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&globalVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testSharedPoints
+
+
+// End of file
@@ -0,0 +1,4 @@
+#!/bin/bash
+#
+# Run unit tests that check values at points shared among processes.
+exec ${MPIEXEC:-mpiexec} -n 2 ./libtest_feassemble_mpi "$@"
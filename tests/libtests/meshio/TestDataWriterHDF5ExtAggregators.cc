@@ -0,0 +1,286 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/DataWriterHDF5Ext.hh" // USES DataWriterHDF5Ext
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <fstream> // USES std::ifstream
+#include <iterator> // USES std::istreambuf_iterator
+#include <limits> // USES std::numeric_limits
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::out_of_range, std::runtime_error
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterHDF5ExtAggregators;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestDataWriterHDF5ExtAggregators {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setRanksPerAggregator() and getRanksPerAggregator().
+    static
+    void testAccessors(void);
+
+    /// Test external datasets written through aggregators match those written without aggregators.
+    static
+    void testWriteAggregated(void);
+
+    /// Test _getAggregatedLayout() with counts near and above the maximum MPI count.
+    static
+    void testAggregatedLayout(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Write time steps of field at points.
+     *
+     * @param[in] filename Name of HDF5 file.
+     * @param[in] ranksPerAggregator Number of processes per aggregator.
+     * @param[in] pointMesh Mesh with points.
+     * @param[inout] field Field at points.
+     * @param[in] numSteps Number of time steps.
+     */
+    static
+    void _writeSteps(const char* filename,
+                     const int ranksPerAggregator,
+                     const pylith::topology::Mesh& pointMesh,
+                     pylith::topology::Field* field,
+                     const int numSteps);
+
+    /** Read contents of file.
+     *
+     * @param[in] filename Name of file.
+     * @returns Contents of file.
+     */
+    static
+    std::string _readFile(const char* filename);
+
+}; // TestDataWriterHDF5ExtAggregators
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestDataWriterHDF5ExtAggregators::testAccessors", "[TestDataWriterHDF5ExtAggregators][testAccessors]") {
+    pylith::meshio::TestDataWriterHDF5ExtAggregators::testAccessors();
+}
+TEST_CASE("TestDataWriterHDF5ExtAggregators::testWriteAggregated", "[TestDataWriterHDF5ExtAggregators][testWriteAggregated]") {
+    pylith::meshio::TestDataWriterHDF5ExtAggregators::testWriteAggregated();
+}
+TEST_CASE("TestDataWriterHDF5ExtAggregators::testAggregatedLayout", "[TestDataWriterHDF5ExtAggregators][testAggregatedLayout]") {
+    pylith::meshio::TestDataWriterHDF5ExtAggregators::testAggregatedLayout();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setRanksPerAggregator() and getRanksPerAggregator().
+void
+pylith::meshio::TestDataWriterHDF5ExtAggregators::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterHDF5Ext writer;
+    CHECK(0 == writer.getRanksPerAggregator());
+
+    writer.setRanksPerAggregator(4);
+    CHECK(4 == writer.getRanksPerAggregator());
+
+    CHECK_THROWS_AS(writer.setRanksPerAggregator(-1), std::out_of_range);
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test external datasets written through aggregators match those written without aggregators.
+void
+pylith::meshio::TestDataWriterHDF5ExtAggregators::testWriteAggregated(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMPIInt commRank = 0, commSize = 0;
+    err = MPI_Comm_rank(PETSC_COMM_WORLD, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(PETSC_COMM_WORLD, &commSize);PYLITH_CHECK_ERROR(err);
+
+    // Different number of points on each process, so the groups gather slabs of different sizes.
+    const int spaceDim = 2;
+    const int numPointsLocal = 2 + commRank;
+    pylith::scalar_array points(numPointsLocal*spaceDim);
+    for (int iPoint = 0; iPoint < numPointsLocal; ++iPoint) {
+        points[iPoint*spaceDim+0] = 1.0*commRank;
+        points[iPoint*spaceDim+1] = 0.5*iPoint;
+    } // for
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    const PylithReal lengthScale = 1.0;
+    pylith::topology::Mesh* pointMesh = pylith::topology::MeshOps::createFromPoints(&points[0], numPointsLocal, &cs,
+                                                                                     lengthScale, PETSC_COMM_WORLD);
+    assert(pointMesh);
+
+    pylith::topology::Field::Description description;
+    description.label = "displacement";
+    description.vectorFieldType = pylith::topology::Field::VECTOR;
+    description.numComponents = 2;
+    description.componentNames.resize(2);
+    description.componentNames[0] = "displacement_x";
+    description.componentNames[1] = "displacement_y";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    pylith::topology::Field field(*pointMesh);
+    field.setLabel("solution");
+    field.subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, spaceDim));
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    const int numSteps = 3;
+    _writeSteps("hdf5ext_aggregators_none.h5", 0, *pointMesh, &field, numSteps);
+    const std::string& valuesE = _readFile("hdf5ext_aggregators_none_displacement.dat");
+    CHECK(valuesE.size() > 0);
+
+    // One process per aggregator and groups with more than one process (and a last group with
+    // fewer processes when the number of processes is odd).
+    const int numCases = 3;
+    const int ranksPerAggregator[numCases] = { 1, 2, commSize };
+    for (int iCase = 0; iCase < numCases; ++iCase) {
+        INFO("ranksPerAggregator: " << ranksPerAggregator[iCase]);
+        std::ostringstream filename;
+        filename << "hdf5ext_aggregators_" << ranksPerAggregator[iCase] << ".h5";
+        _writeSteps(filename.str().c_str(), ranksPerAggregator[iCase], *pointMesh, &field, numSteps);
+
+        std::ostringstream datasetFilename;
+        datasetFilename << "hdf5ext_aggregators_" << ranksPerAggregator[iCase] << "_displacement.dat";
+        const std::string& values = _readFile(datasetFilename.str().c_str());
+        CHECK(valuesE == values);
+    } // for
+
+    delete pointMesh;pointMesh = NULL;
+
+    PYLITH_METHOD_END;
+} // testWriteAggregated
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _getAggregatedLayout() with counts near and above the maximum MPI count.
+void
+pylith::meshio::TestDataWriterHDF5ExtAggregators::testAggregatedLayout(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const PetscInt intMax = PetscInt(std::numeric_limits<int>::max());
+    std::vector<int> counts;
+    std::vector<int> offsets;
+
+    { // Groups with sizes that fit; last offset is just below the maximum MPI count.
+        const PetscInt numValuesE[3] = { 5, intMax - 8, 3 };
+        const int offsetsE[3] = { 0, 5, int(intMax - 3) };
+        const std::vector<PetscInt> numValuesGroup(numValuesE, numValuesE+3);
+        CHECK(intMax == DataWriterHDF5Ext::_getAggregatedLayout(&counts, &offsets, numValuesGroup));
+        REQUIRE(size_t(3) == counts.size());
+        REQUIRE(size_t(3) == offsets.size());
+        for (size_t i = 0; i < 3; ++i) {
+            CHECK(numValuesE[i] == PetscInt(counts[i]));
+            CHECK(offsetsE[i] == offsets[i]);
+        } // for
+    } // fit
+
+    { // Total over 2^31 from counts that each fit in int (sum overflows 32-bit PetscInt).
+        const PetscInt numValuesE[3] = { PetscInt(1) << 30, PetscInt(1) << 30, 10 };
+        const std::vector<PetscInt> numValuesGroup(numValuesE, numValuesE+3);
+        CHECK_THROWS_AS(DataWriterHDF5Ext::_getAggregatedLayout(&counts, &offsets, numValuesGroup), std::runtime_error);
+    } // total too large
+
+#if defined(PETSC_USE_64BIT_INDICES)
+    { // Single process with more than 2^31 values.
+        const std::vector<PetscInt> numValuesGroup(1, (PetscInt(1) << 31) + 1);
+        CHECK_THROWS_AS(DataWriterHDF5Ext::_getAggregatedLayout(&counts, &offsets, numValuesGroup), std::runtime_error);
+    } // count too large
+#endif
+
+    PYLITH_METHOD_END;
+} // testAggregatedLayout
+
+
+// ------------------------------------------------------------------------------------------------
+// Write time steps of field at points.
+void
+pylith::meshio::TestDataWriterHDF5ExtAggregators::_writeSteps(const char* filename,
+                                                              const int ranksPerAggregator,
+                                                              const pylith::topology::Mesh& pointMesh,
+                                                              pylith::topology::Field* field,
+                                                              const int numSteps) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    const PetscInt subfieldIndex = field->getSubfieldInfo("displacement").index;
+    OutputSubfield* subfield = OutputSubfield::create(*field, pointMesh, "displacement");assert(subfield);
+
+    DataWriterHDF5Ext writer;
+    writer.filename(filename);
+    writer.setRanksPerAggregator(ranksPerAggregator);
+
+    const int commRank = pointMesh.getCommRank();
+    const bool isInfo = false;
+    writer.open(pointMesh, isInfo);
+    for (int iStep = 0; iStep < numSteps; ++iStep) {
+        pylith::topology::Stratum verticesStratum(pointMesh.getDM(), pylith::topology::Stratum::DEPTH, 0);
+        pylith::topology::VecVisitorMesh fieldVisitor(*field);
+        PetscScalar* fieldArray = fieldVisitor.localArray();
+        for (PetscInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+            const PetscInt off = fieldVisitor.sectionSubfieldOffset(subfieldIndex, vertex);
+            const PetscInt dof = fieldVisitor.sectionSubfieldDof(subfieldIndex, vertex);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                fieldArray[off+iDof] = 1000.0*iStep + 100.0*commRank + 10.0*(vertex - verticesStratum.begin()) + iDof;
+            } // for
+        } // for
+        subfield->extractSubfield(*field, subfieldIndex);
+
+        const PylithReal t = 0.5 * iStep;
+        writer.openTimeStep(t, pointMesh);
+        writer.writeVertexField(t, *subfield);
+        writer.closeTimeStep();
+    } // for
+    writer.close();
+
+    delete subfield;subfield = NULL;
+
+    PetscErrorCode err = MPI_Barrier(pointMesh.getComm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _writeSteps
+
+
+// ------------------------------------------------------------------------------------------------
+// Read contents of file.
+std::string
+pylith::meshio::TestDataWriterHDF5ExtAggregators::_readFile(const char* filename) {
+    std::ifstream fin(filename, std::ios::binary);
+    REQUIRE(fin.is_open());
+    return std::string(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+} // _readFile
+
+
+// End of file
@@ -0,0 +1,271 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/DataWriterHDF5Stations.hh" // USES DataWriterHDF5Stations
+
+#include "pylith/meshio/DataWriterHDF5.hh" // USES DataWriterHDF5
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::out_of_range
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestDataWriterHDF5Stations;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestDataWriterHDF5Stations {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setBufferSize() and getBufferSize().
+    static
+    void testAccessors(void);
+
+    /// Test buffered station-major output against the time-step-major output of DataWriterHDF5.
+    static
+    void testWriteBuffered(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Write time steps of field at points.
+     *
+     * @param[inout] writer Data writer.
+     * @param[in] pointMesh Mesh with points.
+     * @param[inout] field Field at points.
+     * @param[in] numSteps Number of time steps.
+     */
+    static
+    void _writeSteps(DataWriter* writer,
+                     const pylith::topology::Mesh& pointMesh,
+                     pylith::topology::Field* field,
+                     const int numSteps);
+
+    /** Value of field at station and time step.
+     *
+     * @param[in] iStep Index of time step.
+     * @param[in] iStation Index of station.
+     * @param[in] iComponent Index of component.
+     * @returns Value of field.
+     */
+    static
+    PylithScalar _value(const int iStep,
+                        const int iStation,
+                        const int iComponent);
+
+}; // TestDataWriterHDF5Stations
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestDataWriterHDF5Stations::testAccessors", "[TestDataWriterHDF5Stations][testAccessors]") {
+    pylith::meshio::TestDataWriterHDF5Stations::testAccessors();
+}
+TEST_CASE("TestDataWriterHDF5Stations::testWriteBuffered", "[TestDataWriterHDF5Stations][testWriteBuffered]") {
+    pylith::meshio::TestDataWriterHDF5Stations::testWriteBuffered();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setBufferSize() and getBufferSize().
+void
+pylith::meshio::TestDataWriterHDF5Stations::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    DataWriterHDF5Stations writer;
+    CHECK(100 == writer.getBufferSize());
+
+    writer.setBufferSize(4);
+    CHECK(4 == writer.getBufferSize());
+
+    CHECK_THROWS_AS(writer.setBufferSize(0), std::out_of_range);
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test buffered station-major output against the time-step-major output of DataWriterHDF5.
+void
+pylith::meshio::TestDataWriterHDF5Stations::testWriteBuffered(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int spaceDim = 2;
+    const int numStations = 3;
+    const PylithReal points[numStations*spaceDim] = {
+        0.0, 0.0,
+        1.0, 0.5,
+        -2.0, 3.0,
+    };
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    const PylithReal lengthScale = 1.0;
+    pylith::topology::Mesh* pointMesh = pylith::topology::MeshOps::createFromPoints(points, numStations, &cs, lengthScale,
+                                                                                     PETSC_COMM_WORLD);
+    assert(pointMesh);
+
+    pylith::topology::Field::Description description;
+    description.label = "displacement";
+    description.vectorFieldType = pylith::topology::Field::VECTOR;
+    description.numComponents = 2;
+    description.componentNames.resize(2);
+    description.componentNames[0] = "displacement_x";
+    description.componentNames[1] = "displacement_y";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    pylith::topology::Field field(*pointMesh);
+    field.setLabel("solution");
+    field.subfieldAdd(description, pylith::topology::Field::Discretization(1, 1, spaceDim));
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    // Number of time steps is not a multiple of the buffer size, so close() flushes a partial buffer.
+    const int numSteps = 5;
+    const int bufferSize = 2;
+
+    DataWriterHDF5 writerReference;
+    writerReference.filename("stations_reference.h5");
+    _writeSteps(&writerReference, *pointMesh, &field, numSteps);
+
+    DataWriterHDF5Stations writerStations;
+    writerStations.filename("stations_buffered.h5");
+    writerStations.setBufferSize(bufferSize);
+    _writeSteps(&writerStations, *pointMesh, &field, numSteps);
+
+    HDF5 h5Reference("stations_reference.h5", H5F_ACC_RDONLY);
+    HDF5 h5Stations("stations_buffered.h5", H5F_ACC_RDONLY);
+
+    int ndims = 0;
+    hsize_t* dims = NULL;
+    h5Stations.getDatasetDims(&dims, &ndims, "/station_fields", "displacement");
+    REQUIRE(3 == ndims);
+    CHECK(hsize_t(numStations) == dims[0]);
+    CHECK(hsize_t(numSteps) == dims[1]);
+    CHECK(hsize_t(2) == dims[2]);
+    delete[] dims;dims = NULL;
+
+    h5Reference.getDatasetDims(&dims, &ndims, "/vertex_fields", "displacement");
+    REQUIRE(3 == ndims);
+    REQUIRE(hsize_t(numSteps) == dims[0]);
+    REQUIRE(hsize_t(numStations) == dims[1]);
+    delete[] dims;dims = NULL;
+
+    // Read values for each time step from reference file and each station from station file.
+    const int numComponents = 2;
+    pylith::scalar_array valuesReference(numSteps*numStations*numComponents);
+    double* values = NULL;
+    for (int iStep = 0; iStep < numSteps; ++iStep) {
+        h5Reference.readDatasetChunk("/vertex_fields", "displacement", (char**)&values, &dims, &ndims, iStep, H5T_NATIVE_DOUBLE);
+        for (int i = 0; i < numStations*numComponents; ++i) {
+            valuesReference[iStep*numStations*numComponents+i] = values[i];
+        } // for
+        delete[] values;values = NULL;
+    } // for
+
+    const PylithReal tolerance = 1.0e-12;
+    for (int iStation = 0; iStation < numStations; ++iStation) {
+        h5Stations.readDatasetChunk("/station_fields", "displacement", (char**)&values, &dims, &ndims, iStation, H5T_NATIVE_DOUBLE);
+        for (int iStep = 0; iStep < numSteps; ++iStep) {
+            for (int iComponent = 0; iComponent < numComponents; ++iComponent) {
+                INFO("station: " << iStation << ", step: " << iStep << ", component: " << iComponent);
+                const PylithScalar valueE = valuesReference[(iStep*numStations+iStation)*numComponents+iComponent];
+                CHECK_THAT(values[iStep*numComponents+iComponent], Catch::Matchers::WithinAbs(valueE, tolerance));
+                CHECK_THAT(valueE, Catch::Matchers::WithinAbs(_value(iStep, iStation, iComponent), tolerance));
+            } // for
+        } // for
+        delete[] values;values = NULL;
+    } // for
+
+    // Time stamps.
+    for (int iStep = 0; iStep < numSteps; ++iStep) {
+        h5Stations.readDatasetChunk("/", "time", (char**)&values, &dims, &ndims, iStep, H5T_NATIVE_DOUBLE);
+        CHECK_THAT(values[0], Catch::Matchers::WithinAbs(0.5*iStep, tolerance));
+        delete[] values;values = NULL;
+    } // for
+    delete[] dims;dims = NULL;
+
+    h5Reference.close();
+    h5Stations.close();
+    delete pointMesh;pointMesh = NULL;
+
+    PYLITH_METHOD_END;
+} // testWriteBuffered
+
+
+// ------------------------------------------------------------------------------------------------
+// Write time steps of field at points.
+void
+pylith::meshio::TestDataWriterHDF5Stations::_writeSteps(DataWriter* writer,
+                                                        const pylith::topology::Mesh& pointMesh,
+                                                        pylith::topology::Field* field,
+                                                        const int numSteps) {
+    PYLITH_METHOD_BEGIN;
+    assert(writer);
+    assert(field);
+
+    const PetscInt subfieldIndex = field->getSubfieldInfo("displacement").index;
+    OutputSubfield* subfield = OutputSubfield::create(*field, pointMesh, "displacement");assert(subfield);
+
+    const bool isInfo = false;
+    writer->open(pointMesh, isInfo);
+    for (int iStep = 0; iStep < numSteps; ++iStep) {
+        pylith::topology::Stratum verticesStratum(pointMesh.getDM(), pylith::topology::Stratum::DEPTH, 0);
+        pylith::topology::VecVisitorMesh fieldVisitor(*field);
+        PetscScalar* fieldArray = fieldVisitor.localArray();
+        for (PetscInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+            const PetscInt off = fieldVisitor.sectionSubfieldOffset(subfieldIndex, vertex);
+            const PetscInt dof = fieldVisitor.sectionSubfieldDof(subfieldIndex, vertex);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                fieldArray[off+iDof] = _value(iStep, vertex - verticesStratum.begin(), iDof);
+            } // for
+        } // for
+        subfield->extractSubfield(*field, subfieldIndex);
+
+        const PylithReal t = 0.5 * iStep;
+        writer->openTimeStep(t, pointMesh);
+        writer->writeVertexField(t, *subfield);
+        writer->closeTimeStep();
+    } // for
+    writer->close();
+
+    delete subfield;subfield = NULL;
+
+    PYLITH_METHOD_END;
+} // _writeSteps
+
+
+// ------------------------------------------------------------------------------------------------
+// Value of field at station and time step.
+PylithScalar
+pylith::meshio::TestDataWriterHDF5Stations::_value(const int iStep,
+                                                   const int iStation,
+                                                   const int iComponent) {
+    return 1.0 + 10.0*iStep + iStation + 0.1*iComponent;
+} // _value
+
+
+// End of file
@@ -18,9 +18,20 @@
 #include "pylith/utils/array.hh" // USES int_array, scalar_array, string_vector
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
+#include "petsc.h" // USES PETSC_USE_64BIT_INDICES
+
+// :KLUDGE: Prevent NetCDF from definining MPI types
+#define MPI_INCLUDED
+#include <netcdf.h> // USES netcdf
+
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestExodusII::testGetVarIntLarge", "[TestExodusII]") {
+    pylith::meshio::TestExodusII().testGetVarIntLarge();
+}
+
 // ------------------------------------------------------------------------------------------------
 // Test constructor
 void
@@ -131,7 +142,7 @@ pylith::meshio::TestExodusII::testGetVarDouble(void) {
                                       0.0, -1.0, 1.0, 0.0 };
 
     const int ndims = 2;
-    int dims[2];
+    PylithInt dims[2];
     dims[0] = 2;
     dims[1] = 4;
     const int size = dims[0]*dims[1];
@@ -158,13 +169,13 @@ pylith::meshio::TestExodusII::testGetVarDouble(void) {
 
 
 // ------------------------------------------------------------------------------------------------
-// Test getVar(int*).
+// Test getVar(PylithInt*).
 void
 pylith::meshio::TestExodusII::testGetVarInt(void) {
     const int connectE[3] = { 3, 2, 4 };
 
     const int ndims = 2;
-    int dims[2];
+    PylithInt dims[2];
     dims[0] = 1;
     dims[1] = 3;
     const int size = dims[0]*dims[1];
@@ -189,6 +200,52 @@ pylith::meshio::TestExodusII::testGetVarInt(void) {
 } // testGetVarDouble
 
 
+// ------------------------------------------------------------------------------------------------
+// Test getVar(PylithInt*) with values larger than 2^31.
+void
+pylith::meshio::TestExodusII::testGetVarIntLarge(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Write file with 64-bit integer variable (CDF5 format supports NC_INT64).
+    const char* filename = "exodusii_int64.exo";
+    const int numValues = 4;
+    const long long valuesE[numValues] = { 1, (1LL << 31) + 3, (1LL << 32) + 5, 1LL << 40 };
+    int ncid = -1, dimId = -1, varId = -1;
+    REQUIRE(NC_NOERR == nc_create(filename, NC_CLOBBER | NC_64BIT_DATA, &ncid));
+    REQUIRE(NC_NOERR == nc_def_dim(ncid, "num_values", numValues, &dimId));
+    REQUIRE(NC_NOERR == nc_def_var(ncid, "values", NC_INT64, 1, &dimId, &varId));
+    REQUIRE(NC_NOERR == nc_enddef(ncid));
+    REQUIRE(NC_NOERR == nc_put_var_longlong(ncid, varId, valuesE));
+    REQUIRE(NC_NOERR == nc_close(ncid));
+
+    const int ndims = 1;
+    const PylithInt dims[ndims] = { numValues };
+    int_array values(numValues);
+    const size_t start[ndims] = { 1 };
+    const size_t count[ndims] = { 2 };
+    int_array slab(count[0]);
+
+    ExodusII exofile(filename);
+#if defined(PETSC_USE_64BIT_INDICES)
+    exofile.getVar(&values[0], dims, ndims, "values");
+    for (int i = 0; i < numValues; ++i) {
+        CHECK(valuesE[i] == values[i]);
+    } // for
+
+    exofile.getVar(&slab[0], start, count, ndims, "values");
+    for (size_t i = 0; i < count[0]; ++i) {
+        CHECK(valuesE[start[0]+i] == slab[i]);
+    } // for
+#else
+    // Values do not fit in 32-bit PylithInt.
+    CHECK_THROWS_AS(exofile.getVar(&values[0], dims, ndims, "values"), std::runtime_error);
+    CHECK_THROWS_AS(exofile.getVar(&slab[0], start, count, ndims, "values"), std::runtime_error);
+#endif
+
+    PYLITH_METHOD_END;
+} // testGetVarIntLarge
+
+
 // ------------------------------------------------------------------------------------------------
 // Test getVar(string_vector).
 void
@@ -46,6 +46,9 @@ public:
     /// Test getVar(int*)
     void testGetVarInt(void);
 
+    /// Test getVar(PylithInt*) with values larger than 2^31.
+    void testGetVarIntLarge(void);
+
     /// Test getVar(string_vector)
     void testGetVarString(void);
 
@@ -0,0 +1,302 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <set> // USES std::set
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestMeshBuilder;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestMeshBuilder {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setGroup() with vertex group against checking vertices in closure of each point.
+    static
+    void testSetGroupVertex(void);
+
+    /// Test setGroupParallel() against checking vertices in closure of each point.
+    static
+    void testSetGroupParallel(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Check points in vertex group label.
+     *
+     * A point other than a cell is in the group if and only if all vertices in its closure are in
+     * the group.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] name Name of group.
+     * @param[in] vertexIndices Global index of each local vertex.
+     * @param[in] groupVertices Global indices of vertices in group.
+     * @returns Number of points in group.
+     */
+    static
+    PetscInt _checkGroup(const pylith::topology::Mesh& mesh,
+                         const char* name,
+                         const pylith::int_array& vertexIndices,
+                         const std::set<PylithInt>& groupVertices);
+
+}; // TestMeshBuilder
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestMeshBuilder::testSetGroupVertex", "[TestMeshBuilder][testSetGroupVertex]") {
+    pylith::meshio::TestMeshBuilder::testSetGroupVertex();
+}
+TEST_CASE("TestMeshBuilder::testSetGroupParallel", "[TestMeshBuilder][testSetGroupParallel]") {
+    pylith::meshio::TestMeshBuilder::testSetGroupParallel();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setGroup() with vertex group against checking vertices in closure of each point.
+void
+pylith::meshio::TestMeshBuilder::testSetGroupVertex(void) {
+    PYLITH_METHOD_BEGIN;
+
+    { // Four triangles; group with two edges.
+        const int spaceDim = 2;
+        const int numVertices = 5;
+        const int numCells = 4;
+        const int numCorners = 3;
+        const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+            -1.0, 0.0,
+            0.0, -1.0,
+            0.0, 0.0,
+            0.0, 1.0,
+            1.0, 0.0,
+        };
+        const PylithInt cellsValues[numCells*numCorners] = {
+            0, 1, 2,
+            2, 3, 0,
+            2, 1, 4,
+            2, 4, 3,
+        };
+        scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+        int_array cells(cellsValues, numCells*numCorners);
+
+        pylith::topology::Mesh mesh;
+        MeshBuilder::buildMesh(&mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, spaceDim);
+
+        const int numGroupVertices = 3;
+        const PylithInt groupValues[numGroupVertices] = { 1, 2, 3 };
+        int_array groupVertices(groupValues, numGroupVertices);
+        MeshBuilder::setGroup(&mesh, "fault", MeshBuilder::VERTEX, groupVertices);
+
+        int_array vertexIndices(numVertices);
+        for (int i = 0; i < numVertices; ++i) {
+            vertexIndices[i] = i;
+        } // for
+        const std::set<PylithInt> groupSet(groupValues, groupValues+numGroupVertices);
+        CHECK(5 == _checkGroup(mesh, "fault", vertexIndices, groupSet));
+    } // Four triangles
+
+    { // Two tetrahedra; group with one face and three edges.
+        const int spaceDim = 3;
+        const int numVertices = 5;
+        const int numCells = 2;
+        const int numCorners = 4;
+        const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+            0.0, 0.0, 0.0,
+            1.0, 0.0, 0.0,
+            0.0, 1.0, 0.0,
+            0.0, 0.0, 1.0,
+            1.0, 1.0, 1.0,
+        };
+        const PylithInt cellsValues[numCells*numCorners] = {
+            0, 1, 2, 3,
+            1, 2, 3, 4,
+        };
+        scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+        int_array cells(cellsValues, numCells*numCorners);
+
+        pylith::topology::Mesh mesh;
+        MeshBuilder::buildMesh(&mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, spaceDim);
+
+        // Mark the group in two calls; points already in the group are kept.
+        const int numGroupVertices = 3;
+        const PylithInt groupValues[numGroupVertices] = { 1, 2, 3 };
+        int_array groupVerticesA(groupValues, 2);
+        MeshBuilder::setGroup(&mesh, "fault", MeshBuilder::VERTEX, groupVerticesA);
+        int_array groupVerticesB(groupValues+2, 1);
+        MeshBuilder::setGroup(&mesh, "fault", MeshBuilder::VERTEX, groupVerticesB);
+
+        int_array vertexIndices(numVertices);
+        for (int i = 0; i < numVertices; ++i) {
+            vertexIndices[i] = i;
+        } // for
+        const std::set<PylithInt> groupSet(groupValues, groupValues+numGroupVertices);
+        CHECK(7 == _checkGroup(mesh, "fault", vertexIndices, groupSet));
+    } // Two tetrahedra
+
+    PYLITH_METHOD_END;
+} // testSetGroupVertex
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setGroupParallel() against checking vertices in closure of each point.
+void
+pylith::meshio::TestMeshBuilder::testSetGroupParallel(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Hexahedral mesh with 2x1x2 cells.
+    const int spaceDim = 3;
+    const int numVertices = 18;
+    const int numCells = 4;
+    const int numCorners = 8;
+    const PylithInt cellsValues[numCells*numCorners] = {
+        0, 1, 4, 3, 6, 7, 10, 9,
+        1, 2, 5, 4, 7, 8, 11, 10,
+        6, 7, 10, 9, 12, 13, 16, 15,
+        7, 8, 11, 10, 13, 14, 17, 16,
+    };
+
+    pylith::topology::Mesh mesh;
+    PetscErrorCode err = PETSC_SUCCESS;
+    const int commRank = mesh.getCommRank();
+    PetscMPIInt commSize = 0;
+    err = MPI_Comm_size(mesh.getComm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+    // Contiguous blocks of cells and vertices on each process.
+    const PylithInt cellsBegin = (commRank*numCells) / commSize;
+    const PylithInt cellsEnd = ((commRank+1)*numCells) / commSize;
+    const PylithInt verticesBegin = (commRank*numVertices) / commSize;
+    const PylithInt verticesEnd = ((commRank+1)*numVertices) / commSize;
+    const PylithInt numCellsLocal = cellsEnd - cellsBegin;
+    const PylithInt numVerticesLocal = verticesEnd - verticesBegin;
+
+    int_array cells(numCellsLocal*numCorners);
+    for (PylithInt i = 0; i < numCellsLocal*numCorners; ++i) {
+        cells[i] = cellsValues[cellsBegin*numCorners+i];
+    } // for
+    scalar_array coordinates(numVerticesLocal*spaceDim);
+    for (PylithInt iVertex = 0; iVertex < numVerticesLocal; ++iVertex) {
+        const PylithInt vertex = verticesBegin + iVertex;
+        coordinates[iVertex*spaceDim+0] = vertex % 3;
+        coordinates[iVertex*spaceDim+1] = (vertex / 3) % 2;
+        coordinates[iVertex*spaceDim+2] = vertex / 6;
+    } // for
+
+    PetscSF vertexSF = NULL;
+    MeshBuilder::buildMeshParallel(&mesh, &vertexSF, &coordinates, numVerticesLocal, numVertices, spaceDim,
+                                   cells, numCellsLocal, numCorners, spaceDim);
+
+    // Vertices on the x=1 plane and one vertex on the x=0 plane. Each process provides a different
+    // subset of the group.
+    const int numGroupVertices = 7;
+    const PylithInt groupValues[numGroupVertices] = { 1, 4, 7, 10, 13, 16, 0 };
+    size_t numGroupVerticesLocal = 0;
+    for (int i = commRank; i < numGroupVertices; i += commSize) {
+        ++numGroupVerticesLocal;
+    } // for
+    int_array groupVertices(numGroupVerticesLocal);
+    for (int i = commRank, index = 0; i < numGroupVertices; i += commSize) {
+        groupVertices[index++] = groupValues[i];
+    } // for
+    MeshBuilder::setGroupParallel(&mesh, "fault", vertexSF, groupVertices);
+
+    // Global index of each local vertex from the blocks of vertices on each process.
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leafIndices = NULL;
+    err = PetscSFGetGraph(vertexSF, &numRoots, &numLeaves, &leafIndices, NULL);PYLITH_CHECK_ERROR(err);
+    REQUIRE(numRoots == numVerticesLocal);
+    int_array rootIndices(numRoots);
+    for (PetscInt i = 0; i < numRoots; ++i) {
+        rootIndices[i] = verticesBegin + i;
+    } // for
+    pylith::topology::Stratum verticesStratum(mesh.getDM(), pylith::topology::Stratum::DEPTH, 0);
+    int_array vertexIndices(-1, verticesStratum.size());
+    PylithInt* rootIndicesArray = rootIndices.size() ? &rootIndices[0] : NULL;
+    PylithInt* vertexIndicesArray = vertexIndices.size() ? &vertexIndices[0] : NULL;
+    err = PetscSFBcastBegin(vertexSF, MPIU_INT, rootIndicesArray, vertexIndicesArray, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(vertexSF, MPIU_INT, rootIndicesArray, vertexIndicesArray, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&vertexSF);PYLITH_CHECK_ERROR(err);
+
+    const std::set<PylithInt> groupSet(groupValues, groupValues+numGroupVertices);
+    const PetscInt numPointsLocal = _checkGroup(mesh, "fault", vertexIndices, groupSet);
+
+    // Six vertices, seven edges, and two faces on the x=1 plane plus one vertex on the x=0 plane and
+    // the edge connecting it to the x=1 plane.
+    if (1 == commSize) {
+        CHECK(17 == numPointsLocal);
+    } // if
+
+    PYLITH_METHOD_END;
+} // testSetGroupParallel
+
+
+// ------------------------------------------------------------------------------------------------
+// Check points in vertex group label.
+PetscInt
+pylith::meshio::TestMeshBuilder::_checkGroup(const pylith::topology::Mesh& mesh,
+                                             const char* name,
+                                             const pylith::int_array& vertexIndices,
+                                             const std::set<PylithInt>& groupVertices) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscErrorCode err = PETSC_SUCCESS;
+    DMLabel label = NULL;
+    err = DMGetLabel(dmMesh, name, &label);PYLITH_CHECK_ERROR(err);
+    REQUIRE(label);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    pylith::topology::Stratum cellsStratum(dmMesh, pylith::topology::Stratum::HEIGHT, 0);
+    pylith::topology::Stratum verticesStratum(dmMesh, pylith::topology::Stratum::DEPTH, 0);
+    REQUIRE(size_t(verticesStratum.size()) == vertexIndices.size());
+
+    PetscInt numPointsGroup = 0;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        if ((point >= cellsStratum.begin()) && (point < cellsStratum.end())) { continue; }
+
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        bool inGroupE = true;
+        err = DMPlexGetTransitiveClosure(dmMesh, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt c = 0; c < closureSize*2; c += 2) {
+            const PetscInt vertex = closure[c];
+            if ((vertex < verticesStratum.begin()) || (vertex >= verticesStratum.end())) { continue; }
+            const PylithInt vertexIndex = vertexIndices[vertex-verticesStratum.begin()];
+            if (!groupVertices.count(vertexIndex)) {
+                inGroupE = false;
+                break;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+        PetscInt value = -1;
+        err = DMLabelGetValue(label, point, &value);PYLITH_CHECK_ERROR(err);
+        INFO("point: " << point);
+        CHECK(inGroupE == (1 == value));
+        numPointsGroup += (1 == value) ? 1 : 0;
+    } // for
+
+    PYLITH_METHOD_RETURN(numPointsGroup);
+} // _checkGroup
+
+
+// End of file
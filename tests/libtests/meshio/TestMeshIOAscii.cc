@@ -22,6 +22,9 @@
 
 #include <strings.h> // USES strcasecmp()
 #include <cassert> // USES assert()
+#include <cstring> // USES strlen()
+#include <limits> // USES std::numeric_limits
+#include <sstream> // USES std::ostringstream
 
 // ----------------------------------------------------------------------
 // Constructor.
@@ -54,6 +57,52 @@ pylith::meshio::TestMeshIOAscii::testFilename(void) {
 } // testFilename
 
 
+// ----------------------------------------------------------------------
+// Test _parseInt() used by fast reader for counts.
+void
+pylith::meshio::TestMeshIOAscii::testParseInt(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PylithInt value = 0;
+    const char* token = "12345";
+    CHECK(MeshIOAscii::_parseInt(token, token+strlen(token), &value));
+    CHECK(PylithInt(12345) == value);
+
+    token = "-42";
+    CHECK(MeshIOAscii::_parseInt(token, token+strlen(token), &value));
+    CHECK(PylithInt(-42) == value);
+
+    // Largest value is parsed exactly; one more does not fit and is rejected instead of wrapping.
+    const PylithInt maxValue = std::numeric_limits<PylithInt>::max();
+    std::ostringstream maxToken;
+    maxToken << maxValue;
+    const std::string& maxString = maxToken.str();
+    CHECK(MeshIOAscii::_parseInt(maxString.c_str(), maxString.c_str()+maxString.length(), &value));
+    CHECK(maxValue == value);
+
+    std::ostringstream overflowToken;
+    overflowToken << maxValue << "0";
+    const std::string& overflowString = overflowToken.str();
+    CHECK(!MeshIOAscii::_parseInt(overflowString.c_str(), overflowString.c_str()+overflowString.length(), &value));
+
+    // Counts above 2^31 are not truncated to int with 64-bit indices.
+    token = "4294967298";
+    if (sizeof(PylithInt) > sizeof(int)) {
+        CHECK(MeshIOAscii::_parseInt(token, token+strlen(token), &value));
+        CHECK(PylithInt(4294967298LL) == value);
+    } else {
+        CHECK(!MeshIOAscii::_parseInt(token, token+strlen(token), &value));
+    } // if/else
+
+    token = "12a";
+    CHECK(!MeshIOAscii::_parseInt(token, token+strlen(token), &value));
+    token = "-";
+    CHECK(!MeshIOAscii::_parseInt(token, token+strlen(token), &value));
+
+    PYLITH_METHOD_END;
+} // testParseInt
+
+
 // ----------------------------------------------------------------------
 // Test write() and read().
 void
@@ -97,6 +146,27 @@ pylith::meshio::TestMeshIOAscii::testRead(void) {
 } // testRead
 
 
+// ----------------------------------------------------------------------
+// Test read() with fast reader.
+void
+pylith::meshio::TestMeshIOAscii::testReadFast(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_io);
+
+    // Read mesh
+    delete _mesh;_mesh = new pylith::topology::Mesh;
+    _io->setFilename(_data->filename.c_str());
+    _io->setUseFastRead(true);
+    _io->setNumReadThreads(2);
+    _io->read(_mesh);
+
+    // Make sure mesh matches data
+    _checkVals();
+
+    PYLITH_METHOD_END;
+} // testReadFast
+
+
 // ----------------------------------------------------------------------
 // Test read() with error.
 void
@@ -31,12 +31,18 @@ public:
     /// Test filename()
     void testFilename(void);
 
+    /// Test _parseInt() used by fast reader for counts.
+    void testParseInt(void);
+
     /// Test write() and read().
     void testWriteRead(void);
 
     /// Test read().
     void testRead(void);
 
+    /// Test read() with fast reader.
+    void testReadFast(void);
+
     /// Test read() with known errors.
     void testReadError(void);
 
@@ -45,6 +45,9 @@ public:
 TEST_CASE("TestMeshIOAscii::Quad2D::testFilename", "[TestMeshIOAscii][testFilename]") {
     pylith::meshio::TestMeshIOAscii(pylith::meshio::TestMeshIOAscii_Cases::Quad2D()).testFilename();
 }
+TEST_CASE("TestMeshIOAscii::Quad2D::testParseInt", "[TestMeshIOAscii][testParseInt]") {
+    pylith::meshio::TestMeshIOAscii(pylith::meshio::TestMeshIOAscii_Cases::Quad2D()).testParseInt();
+}
 
 TEST_CASE("TestMeshIOAscii::Quad2D::testWriteRead", "[TestMeshIOAscii][testWriteRead]") {
     pylith::meshio::TestMeshIOAscii(pylith::meshio::TestMeshIOAscii_Cases::Quad2D()).testWriteRead();
@@ -63,6 +66,13 @@ TEST_CASE("TestMeshIOAscii::Hex3D_Index1::testRead", "[TestMeshIOAscii][testRead
     pylith::meshio::TestMeshIOAscii(pylith::meshio::TestMeshIOAscii_Cases::Hex3D_Index1()).testRead();
 }
 
+TEST_CASE("TestMeshIOAscii::Quad2D_Comments::testReadFast", "[TestMeshIOAscii][testReadFast]") {
+    pylith::meshio::TestMeshIOAscii(pylith::meshio::TestMeshIOAscii_Cases::Quad2D_Comments()).testReadFast();
+}
+TEST_CASE("TestMeshIOAscii::Hex3D_Index1::testReadFast", "[TestMeshIOAscii][testReadFast]") {
+    pylith::meshio::TestMeshIOAscii(pylith::meshio::TestMeshIOAscii_Cases::Hex3D_Index1()).testReadFast();
+}
+
 TEST_CASE("TestMeshIOAscii::Tri_OrphanVertex::testReadError", "[TestMeshIOAscii][testReadError]") {
     pylith::meshio::TestMeshIOAscii(pylith::meshio::TestMeshIOAscii_Cases::Tri_OrphanVertex()).testReadError();
 }
@@ -15,6 +15,9 @@
 #include "pylith/meshio/MeshIOCubit.hh"
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/array.hh" // USES int_array
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES JournalingComponent
@@ -22,6 +25,8 @@
 #include "catch2/catch_test_macros.hpp"
 
 #include <strings.h> // USES strcasecmp()
+#include <algorithm> // USES std::sort(), std::equal(), std::find()
+#include <cmath> // USES fabs()
 #include <cassert> // USES assert()
 
 // ----------------------------------------------------------------------
@@ -82,4 +87,187 @@ pylith::meshio::TestMeshIOCubit::testRead(void) {
 } // testRead
 
 
+// ----------------------------------------------------------------------
+// Test read() with parallel read.
+void
+pylith::meshio::TestMeshIOCubit::testReadParallel(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_io);
+    assert(_data);
+
+    _io->setFilename(_data->filename.c_str());
+    _io->setUseNodesetNames(true);
+    _io->setUseParallelRead(true);
+
+    // Read mesh
+    delete _mesh;_mesh = new topology::Mesh;assert(_mesh);
+    _io->read(_mesh);
+
+    pythia::journal::debug_t debug("TestMeshIOCubit");
+    if (debug.state()) {
+        _mesh->view();
+    } // if
+
+    // Make sure mesh matches data
+    int commSize = 1;
+    MPI_Comm_size(_mesh->getComm(), &commSize);
+    if (commSize > 1) {
+        _checkValsParallel();
+    } else {
+        _checkVals();
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // testReadParallel
+
+
+// ----------------------------------------------------------------------
+// Check values in mesh read in parallel against data.
+void
+pylith::meshio::TestMeshIOCubit::_checkValsParallel(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_data);
+
+    CHECK(_data->cellDim == _mesh->getDimension());
+    const int spaceDim = _data->spaceDim;
+    const int numCorners = _data->numCorners;
+    const MPI_Comm comm = _mesh->getComm();
+
+    PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
+    PetscErrorCode err = PETSC_SUCCESS;
+
+    // Points that are leaves of the point SF are owned by another process.
+    PylithInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    int_array isOwned(1, pEnd-pStart);
+    PetscSF pointSF = NULL;
+    PylithInt numRoots = 0, numLeaves = 0;
+    const PylithInt* leaves = NULL;
+    err = DMGetPointSF(dmMesh, &pointSF);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    for (PylithInt i = 0; i < numLeaves; ++i) {
+        isOwned[(leaves ? leaves[i] : i) - pStart] = 0;
+    } // for
+
+    // Match vertices to data by coordinates.
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PylithInt vStart = verticesStratum.begin();
+    const PylithInt vEnd = verticesStratum.end();
+    int_array vertexIndex(-1, verticesStratum.size());
+
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    const PylithScalar tolerance = 1.0e-06;
+    PylithInt numVerticesOwned = 0;
+    for (PylithInt v = vStart; v < vEnd; ++v) {
+        const PylithInt off = coordsVisitor.sectionOffset(v);
+        REQUIRE(spaceDim == coordsVisitor.sectionDof(v));
+        for (PylithInt iVertex = 0; iVertex < _data->numVertices; ++iVertex) {
+            bool isMatch = true;
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                const PylithScalar valueE = _data->vertices[iVertex*spaceDim+iDim];
+                isMatch = isMatch && fabs(coordsArray[off+iDim] - valueE) <= std::max(tolerance, fabs(valueE)*tolerance);
+            } // for
+            if (isMatch) {
+                vertexIndex[v-vStart] = iVertex;
+                break;
+            } // if
+        } // for
+        INFO("Checking vertex " << v);
+        REQUIRE(vertexIndex[v-vStart] >= 0);
+        numVerticesOwned += isOwned[v-pStart];
+    } // for
+    PylithInt numVerticesGlobal = 0;
+    err = MPI_Allreduce(&numVerticesOwned, &numVerticesGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    CHECK(_data->numVertices == numVerticesGlobal);
+
+    // Match cells to data by vertices and check materials.
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PylithInt cStart = cellsStratum.begin();
+    const PylithInt cEnd = cellsStratum.end();
+    int_array cellVertices(numCorners), cellVerticesE(numCorners);
+    PylithInt numCellsOwned = 0;
+    for (PylithInt c = cStart; c < cEnd; ++c) {
+        PylithInt* closure = NULL;
+        PylithInt closureSize = 0, numCellCorners = 0;
+        err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PylithInt p = 0; p < closureSize*2; p += 2) {
+            const PylithInt point = closure[p];
+            if ((point >= vStart) && (point < vEnd)) {
+                REQUIRE(numCellCorners < numCorners);
+                cellVertices[numCellCorners++] = vertexIndex[point-vStart];
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        REQUIRE(numCorners == numCellCorners);
+        std::sort(&cellVertices[0], &cellVertices[0]+numCorners);
+
+        PylithInt cellIndex = -1;
+        for (PylithInt iCell = 0; iCell < _data->numCells; ++iCell) {
+            for (int iCorner = 0; iCorner < numCorners; ++iCorner) {
+                cellVerticesE[iCorner] = _data->cells[iCell*numCorners+iCorner];
+            } // for
+            std::sort(&cellVerticesE[0], &cellVerticesE[0]+numCorners);
+            if (std::equal(&cellVertices[0], &cellVertices[0]+numCorners, &cellVerticesE[0])) {
+                cellIndex = iCell;
+                break;
+            } // if
+        } // for
+        INFO("Checking cell " << c);
+        REQUIRE(cellIndex >= 0);
+
+        PylithInt matId = 0;
+        err = DMGetLabelValue(dmMesh, pylith::topology::Mesh::cells_label_name, c, &matId);PYLITH_CHECK_ERROR(err);
+        CHECK(_data->materialIds[cellIndex] == matId);
+        numCellsOwned += isOwned[c-pStart];
+    } // for
+    PylithInt numCellsGlobal = 0;
+    err = MPI_Allreduce(&numCellsOwned, &numCellsGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    CHECK(_data->numCells == numCellsGlobal);
+
+    // Check groups (Cubit node sets are vertex groups).
+    PylithInt numGroups = 0;
+    err = DMGetNumLabels(dmMesh, &numGroups);PYLITH_CHECK_ERROR(err);
+    numGroups -= 3; // Remove depth, celltype and material labels.
+    REQUIRE(_data->numGroups == numGroups);
+    for (PylithInt iGroup = 0, index = 0; iGroup < numGroups; index += _data->groupSizes[iGroup++]) {
+        const char* groupName = _data->groupNames[iGroup];
+        INFO("Checking " << groupName);
+        REQUIRE(std::string("vertex") == std::string(_data->groupTypes[iGroup]));
+
+        PetscBool hasLabel = PETSC_FALSE;
+        err = DMHasLabel(dmMesh, groupName, &hasLabel);PYLITH_CHECK_ERROR(err);
+        REQUIRE(hasLabel);
+
+        const PylithInt labelValue = _data->groupTags ? _data->groupTags[iGroup] : 1;
+        PylithInt numPoints = 0;
+        err = DMGetStratumSize(dmMesh, groupName, labelValue, &numPoints);PYLITH_CHECK_ERROR(err);
+        PylithInt numVerticesGroupOwned = 0;
+        if (numPoints > 0) {
+            PetscIS pointIS = NULL;
+            const PylithInt* points = NULL;
+            err = DMGetStratumIS(dmMesh, groupName, labelValue, &pointIS);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+            for (PylithInt p = 0; p < numPoints; ++p) {
+                if ((points[p] < vStart) || (points[p] >= vEnd)) {
+                    continue;
+                } // if
+                const PylithInt* groupE = &_data->groups[index];
+                const PylithInt* groupEEnd = groupE + _data->groupSizes[iGroup];
+                CHECK(std::find(groupE, groupEEnd, vertexIndex[points[p]-vStart]) != groupEEnd);
+                numVerticesGroupOwned += isOwned[points[p]-pStart];
+            } // for
+            err = ISRestoreIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&pointIS);PYLITH_CHECK_ERROR(err);
+        } // if
+        PylithInt numVerticesGroupGlobal = 0;
+        err = MPI_Allreduce(&numVerticesGroupOwned, &numVerticesGroupGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+        CHECK(_data->groupSizes[iGroup] == numVerticesGroupGlobal);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _checkValsParallel
+
+
 // End of file
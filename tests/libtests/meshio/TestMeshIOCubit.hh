@@ -34,9 +34,24 @@ public:
     /// Test read().
     void testRead(void);
 
+    /** Test read() with parallel read.
+     *
+     * libtest_meshio runs this with one process as a smoke test; libtest_meshio_mpi.sh runs it
+     * with two processes.
+     */
+    void testReadParallel(void);
+
     // PROTECTED METHODS ////////////////////////////////////////////////
 protected:
 
+    /** Check values in mesh read in parallel against data.
+     *
+     * Local numbering of vertices and cells differs from the data when the mesh is read with more
+     * than one process, so vertices and cells are matched by coordinates and global counts are
+     * compared.
+     */
+    void _checkValsParallel(void);
+
     MeshIOCubit* _io; ///< Test subject.
 
 }; // class TestMeshIOCubit
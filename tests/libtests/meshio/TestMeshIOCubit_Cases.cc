@@ -54,6 +54,9 @@ TEST_CASE("TestMeshIOCubit::Tri_v12::testRead", "[TestMeshIOCubit][Tri][v12][tes
 TEST_CASE("TestMeshIOCubit::Tri::testRead", "[TestMeshIOCubit][Tri][v13][testRead]") {
     pylith::meshio::TestMeshIOCubit(pylith::meshio::TestMeshIOCubit_Cases::Tri_v13()).testRead();
 }
+TEST_CASE("TestMeshIOCubit::Tri::testReadParallel", "[TestMeshIOCubit][Tri][v13][testReadParallel]") {
+    pylith::meshio::TestMeshIOCubit(pylith::meshio::TestMeshIOCubit_Cases::Tri_v13()).testReadParallel();
+}
 
 TEST_CASE("TestMeshIOCubit::Quad_v12::testRead", "[TestMeshIOCubit][Quad][v12][testRead]") {
     pylith::meshio::TestMeshIOCubit(pylith::meshio::TestMeshIOCubit_Cases::Quad_v12()).testRead();
@@ -75,6 +78,9 @@ TEST_CASE("TestMeshIOCubit::Hex_v12::testRead", "[TestMeshIOCubit][Hex][v12][tes
 TEST_CASE("TestMeshIOCubit::Hex::testRead", "[TestMeshIOCubit][Hex][v13][testRead]") {
     pylith::meshio::TestMeshIOCubit(pylith::meshio::TestMeshIOCubit_Cases::Hex_v13()).testRead();
 }
+TEST_CASE("TestMeshIOCubit::Hex::testReadParallel", "[TestMeshIOCubit][Hex][v13][testReadParallel]") {
+    pylith::meshio::TestMeshIOCubit(pylith::meshio::TestMeshIOCubit_Cases::Hex_v13()).testReadParallel();
+}
 
 // ------------------------------------------------------------------------------------------------
 pylith::meshio::TestMeshIO_Data*
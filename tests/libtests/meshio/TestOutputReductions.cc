@@ -0,0 +1,308 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputReductions.hh" // USES OutputReductions
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cmath> // USES sqrt(), std::isnan()
+#include <limits> // USES std::numeric_limits
+#include <stdexcept> // USES std::runtime_error, std::out_of_range
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputReductions;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestOutputReductions {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setReductions() and setThreshold().
+    static
+    void testAccessors(void);
+
+    /// Test update() and getReducedSubfields().
+    static
+    void testReductions(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Set values of subfield at all vertices to amplitude*(1+i), where i is the index of the
+     * degree of freedom in the subfield.
+     *
+     * @param[inout] field Field with subfield.
+     * @param[in] name Name of subfield.
+     * @param[in] amplitude Amplitude of values.
+     */
+    static
+    void _setSubfield(pylith::topology::Field* field,
+                      const char* name,
+                      const PylithReal amplitude);
+
+    /** Check values of reduced subfield.
+     *
+     * @param[in] subfield Reduced subfield.
+     * @param[in] label Expected label of subfield.
+     * @param[in] valuesE Expected values as a function of the index of the degree of freedom.
+     */
+    static
+    void _checkSubfield(const OutputSubfield* subfield,
+                        const char* label,
+                        const scalar_array& valuesE);
+
+}; // TestOutputReductions
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputReductions::testAccessors", "[TestOutputReductions][testAccessors]") {
+    pylith::meshio::TestOutputReductions::testAccessors();
+}
+TEST_CASE("TestOutputReductions::testReductions", "[TestOutputReductions][testReductions]") {
+    pylith::meshio::TestOutputReductions::testReductions();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setReductions() and setThreshold().
+void
+pylith::meshio::TestOutputReductions::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    OutputReductions reductions;
+    CHECK(reductions._usePeak);
+    CHECK(!reductions._useRMS);
+    CHECK(!reductions.useThresholdTime());
+    CHECK(reductions.useFinal());
+
+    const char* names[3] = { "rms", "threshold_time", "final" };
+    reductions.setReductions(names, 3);
+    CHECK(!reductions._usePeak);
+    CHECK(reductions._useRMS);
+    CHECK(reductions.useThresholdTime());
+    CHECK(reductions.useFinal());
+
+    const char* namesBad[2] = { "peak", "average" };
+    CHECK_THROWS_AS(reductions.setReductions(namesBad, 2), std::runtime_error);
+
+    reductions.setThreshold(2.0);
+    CHECK(2.0 == reductions._threshold);
+    CHECK_THROWS_AS(reductions.setThreshold(-1.0), std::out_of_range);
+
+    reductions.setThresholdSubfield("velocity");
+    CHECK(std::string("velocity") == reductions.getThresholdSubfield());
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test update() and getReducedSubfields().
+void
+pylith::meshio::TestOutputReductions::testReductions(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Mesh with two triangles.
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 2;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        0.0, 1.0,
+        1.0, 1.0,
+    };
+    const int cellsValues[numCells*numCorners] = {
+        0, 1, 2,
+        1, 3, 2,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    pylith::topology::Mesh mesh;
+    MeshBuilder::buildMesh(&mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    mesh.setCoordSys(&cs);
+
+    pylith::topology::Field::Description descriptionVector;
+    descriptionVector.label = "displacement";
+    descriptionVector.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionVector.numComponents = 2;
+    descriptionVector.componentNames.resize(2);
+    descriptionVector.componentNames[0] = "displacement_x";
+    descriptionVector.componentNames[1] = "displacement_y";
+    descriptionVector.scale = 1.0;
+    descriptionVector.validator = NULL;
+
+    pylith::topology::Field::Description descriptionScalar;
+    descriptionScalar.label = "pressure";
+    descriptionScalar.vectorFieldType = pylith::topology::Field::SCALAR;
+    descriptionScalar.numComponents = 1;
+    descriptionScalar.componentNames.resize(1);
+    descriptionScalar.componentNames[0] = "pressure";
+    descriptionScalar.scale = 1.0;
+    descriptionScalar.validator = NULL;
+
+    const pylith::topology::Field::Discretization discretization(1, 1);
+    pylith::topology::Field field(mesh);
+    field.setLabel("solution");
+    field.subfieldAdd(descriptionVector, discretization);
+    field.subfieldAdd(descriptionScalar, discretization);
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    OutputSubfield* displacement = OutputSubfield::create(field, mesh, "displacement");assert(displacement);
+    OutputSubfield* pressure = OutputSubfield::create(field, mesh, "pressure");assert(pressure);
+    const PetscInt displacementIndex = field.getSubfieldInfo("displacement").index;
+    const PetscInt pressureIndex = field.getSubfieldInfo("pressure").index;
+
+    OutputReductions reductions;
+    const char* names[3] = { "peak", "rms", "threshold_time" };
+    reductions.setReductions(names, 3);
+    reductions.setThreshold(5.0);
+    reductions.setThresholdSubfield("displacement");
+
+    // Values are amplitude*(1+i) for degree of freedom i.
+    const size_t numSteps = 3;
+    const PylithReal dt = 0.1;
+    const PylithReal amplitudeDisplacement[numSteps] = { 1.0, -3.0, 2.0 };
+    const PylithReal amplitudePressure[numSteps] = { 0.5, 0.25, -1.0 };
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        _setSubfield(&field, "displacement", amplitudeDisplacement[iStep]);
+        _setSubfield(&field, "pressure", amplitudePressure[iStep]);
+        displacement->extractSubfield(field, displacementIndex);
+        pressure->extractSubfield(field, pressureIndex);
+
+        reductions.update(*displacement, iStep*dt);
+        reductions.update(*pressure, iStep*dt);
+        reductions.finishStep();
+    } // for
+    CHECK(numSteps == reductions.getNumSamples());
+    CHECK(reductions.getReducedSubfields("velocity").empty());
+
+    // Displacement: peak, rms, and threshold time.
+    const size_t numDisplacement = numVertices*2;
+    scalar_array peakE(numDisplacement);
+    scalar_array rmsE(numDisplacement);
+    scalar_array thresholdTimeE(numDisplacement);
+    for (size_t i = 0; i < numDisplacement; ++i) {
+        peakE[i] = 3.0*(1+i);
+        rmsE[i] = sqrt((1.0+9.0+4.0)/3.0)*(1+i);
+        // Threshold of 5.0 is reached at step 0 for 1+i >= 5, at step 1 for 3*(1+i) >= 5, and never for i=0.
+        thresholdTimeE[i] = (i >= 4) ? 0.0 : (i >= 1) ? dt : std::numeric_limits<PylithReal>::quiet_NaN();
+    } // for
+    std::vector<OutputSubfield*> subfields = reductions.getReducedSubfields("displacement");
+    REQUIRE(3 == subfields.size());
+    _checkSubfield(subfields[0], "displacement_peak", peakE);
+    _checkSubfield(subfields[1], "displacement_rms", rmsE);
+    _checkSubfield(subfields[2], "displacement_threshold_time", thresholdTimeE);
+
+    // Pressure: peak and rms, no threshold time because it is not the threshold subfield.
+    const size_t numPressure = numVertices;
+    peakE.resize(numPressure);
+    rmsE.resize(numPressure);
+    for (size_t i = 0; i < numPressure; ++i) {
+        peakE[i] = 1.0*(1+i);
+        rmsE[i] = sqrt((0.25+0.0625+1.0)/3.0)*(1+i);
+    } // for
+    subfields = reductions.getReducedSubfields("pressure");
+    REQUIRE(2 == subfields.size());
+    _checkSubfield(subfields[0], "pressure_peak", peakE);
+    _checkSubfield(subfields[1], "pressure_rms", rmsE);
+
+    delete displacement;displacement = NULL;
+    delete pressure;pressure = NULL;
+
+    PYLITH_METHOD_END;
+} // testReductions
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values of subfield at all vertices.
+void
+pylith::meshio::TestOutputReductions::_setSubfield(pylith::topology::Field* field,
+                                                   const char* name,
+                                                   const PylithReal amplitude) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    const PetscInt subfieldIndex = field->getSubfieldInfo(name).index;
+    pylith::topology::Stratum verticesStratum(field->getMesh().getDM(), pylith::topology::Stratum::DEPTH, 0);
+    pylith::topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    PetscInt index = 0;
+    for (PetscInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+        const PetscInt off = fieldVisitor.sectionSubfieldOffset(subfieldIndex, vertex);
+        const PetscInt dof = fieldVisitor.sectionSubfieldDof(subfieldIndex, vertex);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            fieldArray[off+iDof] = amplitude * (1 + index++);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setSubfield
+
+
+// ------------------------------------------------------------------------------------------------
+// Check values of reduced subfield.
+void
+pylith::meshio::TestOutputReductions::_checkSubfield(const OutputSubfield* subfield,
+                                                     const char* label,
+                                                     const scalar_array& valuesE) {
+    PYLITH_METHOD_BEGIN;
+    assert(subfield);
+
+    INFO("Subfield: " << label);
+    CHECK(std::string(label) == subfield->getDescription().label);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt numValues = 0;
+    err = VecGetLocalSize(subfield->getVector(), &numValues);PYLITH_CHECK_ERROR(err);
+    REQUIRE(size_t(numValues) == valuesE.size());
+
+    const PylithReal tolerance = 1.0e-6;
+    const PetscScalar* valuesArray = NULL;
+    err = VecGetArrayRead(subfield->getVector(), &valuesArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numValues; ++i) {
+        if (std::isnan(valuesE[i])) {
+            CHECK(std::isnan(valuesArray[i]));
+        } else {
+            CHECK_THAT(valuesArray[i], Catch::Matchers::WithinAbs(valuesE[i], tolerance));
+        } // if/else
+    } // for
+    err = VecRestoreArrayRead(subfield->getVector(), &valuesArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _checkSubfield
+
+
+// End of file
@@ -0,0 +1,121 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputSoln.hh" // USES OutputSoln
+
+#include "pylith/meshio/OutputTriggerStep.hh" // USES OutputTriggerStep
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputSoln;
+        class _TestOutputSoln;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestOutputSoln {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test willWrite() followed by update() does not change how often output is written.
+    static
+    void testWillWriteCadence(void);
+
+}; // TestOutputSoln
+
+// ------------------------------------------------------------------------------------------------
+/// OutputSoln that records the time steps written instead of writing them.
+class pylith::meshio::_TestOutputSoln : public pylith::meshio::OutputSoln {
+public:
+
+    std::vector<PylithInt> stepsWritten; ///< Time steps written.
+
+protected:
+
+    /** Record time step instead of writing it.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     */
+    void _writeSolnStep(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution) override {
+        stepsWritten.push_back(tindex);
+    } // _writeSolnStep
+
+}; // _TestOutputSoln
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputSoln::testWillWriteCadence", "[TestOutputSoln][testWillWriteCadence]") {
+    pylith::meshio::TestOutputSoln::testWillWriteCadence();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test willWrite() followed by update() does not change how often output is written.
+void
+pylith::meshio::TestOutputSoln::testWillWriteCadence(void) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::topology::Mesh mesh;
+    pylith::topology::Field solution(mesh);
+
+    const int numStepsSkip = 1;
+    const PylithInt numSteps = 7;
+    const PylithReal dt = 0.1;
+
+    // Only update().
+    OutputTriggerStep triggerUpdate;
+    triggerUpdate.setNumStepsSkip(numStepsSkip);
+    _TestOutputSoln outputUpdate;
+    outputUpdate.setTrigger(&triggerUpdate);
+    for (PylithInt tindex = 0; tindex < numSteps; ++tindex) {
+        outputUpdate.update(tindex*dt, tindex, solution, pylith::problems::Observer::SOLUTION);
+    } // for
+
+    // willWrite() (called more than once, as when several containers ask) followed by update().
+    OutputTriggerStep triggerWillWrite;
+    triggerWillWrite.setNumStepsSkip(numStepsSkip);
+    _TestOutputSoln outputWillWrite;
+    outputWillWrite.setTrigger(&triggerWillWrite);
+    for (PylithInt tindex = 0; tindex < numSteps; ++tindex) {
+        const PylithReal t = tindex*dt;
+        const bool willWrite = outputWillWrite.willWrite(t, tindex, solution);
+        CHECK(willWrite == outputWillWrite.willWrite(t, tindex, solution));
+
+        const size_t numWritten = outputWillWrite.stepsWritten.size();
+        outputWillWrite.update(t, tindex, solution, pylith::problems::Observer::SOLUTION);
+        CHECK(willWrite == (outputWillWrite.stepsWritten.size() > numWritten));
+    } // for
+
+    const PylithInt stepsWrittenE[4] = { 0, 2, 4, 6 };
+    const size_t numWrittenE = 4;
+    REQUIRE(numWrittenE == outputUpdate.stepsWritten.size());
+    REQUIRE(numWrittenE == outputWillWrite.stepsWritten.size());
+    for (size_t i = 0; i < numWrittenE; ++i) {
+        CHECK(stepsWrittenE[i] == outputUpdate.stepsWritten[i]);
+        CHECK(stepsWrittenE[i] == outputWillWrite.stepsWritten[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testWillWriteCadence
+
+
+// End of file
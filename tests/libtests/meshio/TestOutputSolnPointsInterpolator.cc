@@ -0,0 +1,214 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputSolnPoints.hh" // USES OutputSolnPoints
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <string> // USES std::string
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputSolnPointsInterpolator;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestOutputSolnPointsInterpolator {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test interpolation matrix against evaluating a linear field point by point.
+    static
+    void testInterpolate(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Evaluate linear field (nondimensional) at a point.
+     *
+     * @param[out] values Array of values [displacement_x, displacement_y, pressure].
+     * @param[in] x x coordinate of point.
+     * @param[in] y y coordinate of point.
+     */
+    static
+    void _linearField(PylithScalar values[3],
+                      const PylithReal x,
+                      const PylithReal y);
+
+}; // TestOutputSolnPointsInterpolator
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputSolnPointsInterpolator::testInterpolate", "[TestOutputSolnPointsInterpolator][testInterpolate]") {
+    pylith::meshio::TestOutputSolnPointsInterpolator::testInterpolate();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test interpolation matrix against evaluating a linear field point by point.
+void
+pylith::meshio::TestOutputSolnPointsInterpolator::testInterpolate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Mesh with two triangles.
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 2;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        0.0, 1.0,
+        1.0, 1.0,
+    };
+    const int cellsValues[numCells*numCorners] = {
+        0, 1, 2,
+        1, 3, 2,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    pylith::topology::Mesh mesh;
+    MeshBuilder::buildMesh(&mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    mesh.setCoordSys(&cs);
+
+    // Solution with vector and scalar subfields with scales that differ from 1.
+    pylith::topology::Field::Description descriptionVector;
+    descriptionVector.label = "displacement";
+    descriptionVector.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionVector.numComponents = 2;
+    descriptionVector.componentNames.resize(2);
+    descriptionVector.componentNames[0] = "displacement_x";
+    descriptionVector.componentNames[1] = "displacement_y";
+    descriptionVector.scale = 2.0;
+    descriptionVector.validator = NULL;
+
+    pylith::topology::Field::Description descriptionScalar;
+    descriptionScalar.label = "pressure";
+    descriptionScalar.vectorFieldType = pylith::topology::Field::SCALAR;
+    descriptionScalar.numComponents = 1;
+    descriptionScalar.componentNames.resize(1);
+    descriptionScalar.componentNames[0] = "pressure";
+    descriptionScalar.scale = 0.5;
+    descriptionScalar.validator = NULL;
+
+    const pylith::topology::Field::Discretization discretization(1, 1);
+    pylith::topology::Field solution(mesh);
+    solution.setLabel("solution");
+    solution.subfieldAdd(descriptionVector, discretization);
+    solution.subfieldAdd(descriptionScalar, discretization);
+    solution.subfieldsSetup();
+    solution.createDiscretization();
+    solution.allocate();
+
+    // Linear field is reproduced exactly by the interpolation.
+    pylith::topology::Stratum verticesStratum(mesh.getDM(), pylith::topology::Stratum::DEPTH, 0);
+    pylith::topology::VecVisitorMesh solutionVisitor(solution);
+    PetscScalar* solutionArray = solutionVisitor.localArray();
+    const PetscInt displacementIndex = solution.getSubfieldInfo("displacement").index;
+    const PetscInt pressureIndex = solution.getSubfieldInfo("pressure").index;
+    for (PetscInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+        const PetscInt iVertex = vertex - verticesStratum.begin();
+        PylithScalar values[3];
+        _linearField(values, coordinatesValues[iVertex*spaceDim+0], coordinatesValues[iVertex*spaceDim+1]);
+
+        const PetscInt offDisp = solutionVisitor.sectionSubfieldOffset(displacementIndex, vertex);
+        solutionArray[offDisp+0] = values[0];
+        solutionArray[offDisp+1] = values[1];
+        const PetscInt offPres = solutionVisitor.sectionSubfieldOffset(pressureIndex, vertex);
+        solutionArray[offPres] = values[2];
+    } // for
+
+    const int numPoints = 3;
+    const PylithReal pointCoords[numPoints*spaceDim] = {
+        0.25, 0.25,
+        0.75, 0.5,
+        0.6, 0.6,
+    };
+    const char* pointNames[numPoints] = { "A", "B", "C" };
+
+    OutputSolnPoints output;
+    output.setPoints(pointCoords, numPoints, spaceDim, pointNames, numPoints);
+    output._setupInterpolator(solution);
+    REQUIRE(size_t(numPoints) == output._pointNames.size());
+    output._interpolateField(solution);
+
+    const size_t numSubfields = 2;
+    const char* subfieldNames[numSubfields] = { "displacement", "pressure" };
+    const int numComponents[numSubfields] = { 2, 1 };
+    const int componentOffsets[numSubfields] = { 0, 2 };
+    const PylithReal scales[numSubfields] = { 2.0, 0.5 };
+    const PylithReal tolerance = 1.0e-6;
+    for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+        INFO("Subfield: " << subfieldNames[iSubfield]);
+        OutputSubfield* subfield = output._getSubfield(*output._pointSoln, *output._pointMesh, subfieldNames[iSubfield]);
+        assert(subfield);
+        output._extractSubfield(subfield, iSubfield);
+
+        PetscErrorCode err = PETSC_SUCCESS;
+        PetscInt subfieldSize = 0;
+        err = VecGetLocalSize(subfield->getVector(), &subfieldSize);PYLITH_CHECK_ERROR(err);
+        REQUIRE(numPoints*numComponents[iSubfield] == subfieldSize);
+
+        const PetscScalar* subfieldArray = NULL;
+        err = VecGetArrayRead(subfield->getVector(), &subfieldArray);PYLITH_CHECK_ERROR(err);
+        for (int iPoint = 0; iPoint < numPoints; ++iPoint) {
+            // Local points may be in a different order than the input points.
+            const std::string& name = output._pointNames[iPoint];
+            int iPointE = 0;
+            for (; iPointE < numPoints; ++iPointE) {
+                if (name == pointNames[iPointE]) { break; }
+            } // for
+            REQUIRE(iPointE < numPoints);
+
+            PylithScalar valuesE[3];
+            _linearField(valuesE, pointCoords[iPointE*spaceDim+0], pointCoords[iPointE*spaceDim+1]);
+            for (int iComponent = 0; iComponent < numComponents[iSubfield]; ++iComponent) {
+                const PylithReal valueE = scales[iSubfield] * valuesE[componentOffsets[iSubfield]+iComponent];
+                CHECK_THAT(subfieldArray[iPoint*numComponents[iSubfield]+iComponent], Catch::Matchers::WithinAbs(valueE, tolerance));
+            } // for
+        } // for
+        err = VecRestoreArrayRead(subfield->getVector(), &subfieldArray);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testInterpolate
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate linear field (nondimensional) at a point.
+void
+pylith::meshio::TestOutputSolnPointsInterpolator::_linearField(PylithScalar values[3],
+                                                                const PylithReal x,
+                                                                const PylithReal y) {
+    values[0] = 1.0 + 2.0*x + 3.0*y;
+    values[1] = -1.0 + 0.5*x - y;
+    values[2] = 4.0 - x + 2.0*y;
+} // _linearField
+
+
+// End of file
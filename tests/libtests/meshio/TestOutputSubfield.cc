@@ -0,0 +1,171 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputSubfield;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestOutputSubfield {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test extractSubfield() against extracting the subfield point by point.
+    static
+    void testExtractSubfield(void);
+
+}; // TestOutputSubfield
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputSubfield::testExtractSubfield", "[TestOutputSubfield][testExtractSubfield]") {
+    pylith::meshio::TestOutputSubfield::testExtractSubfield();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test extractSubfield() against extracting the subfield point by point.
+void
+pylith::meshio::TestOutputSubfield::testExtractSubfield(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Mesh with two triangles.
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 2;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        0.0, 1.0,
+        1.0, 1.0,
+    };
+    const int cellsValues[numCells*numCorners] = {
+        0, 1, 2,
+        1, 3, 2,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    pylith::topology::Mesh mesh;
+    MeshBuilder::buildMesh(&mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    mesh.setCoordSys(&cs);
+
+    // Field with vector and scalar subfields with scales that differ from 1.
+    pylith::topology::Field::Description descriptionVector;
+    descriptionVector.label = "displacement";
+    descriptionVector.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionVector.numComponents = 2;
+    descriptionVector.componentNames.resize(2);
+    descriptionVector.componentNames[0] = "displacement_x";
+    descriptionVector.componentNames[1] = "displacement_y";
+    descriptionVector.scale = 2.0;
+    descriptionVector.validator = NULL;
+
+    pylith::topology::Field::Description descriptionScalar;
+    descriptionScalar.label = "pressure";
+    descriptionScalar.vectorFieldType = pylith::topology::Field::SCALAR;
+    descriptionScalar.numComponents = 1;
+    descriptionScalar.componentNames.resize(1);
+    descriptionScalar.componentNames[0] = "pressure";
+    descriptionScalar.scale = 0.5;
+    descriptionScalar.validator = NULL;
+
+    const pylith::topology::Field::Discretization discretization(1, 1);
+    pylith::topology::Field field(mesh);
+    field.setLabel("solution");
+    field.subfieldAdd(descriptionVector, discretization);
+    field.subfieldAdd(descriptionScalar, discretization);
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    // Distinct value for every degree of freedom.
+    pylith::topology::Stratum verticesStratum(mesh.getDM(), pylith::topology::Stratum::DEPTH, 0);
+    pylith::topology::VecVisitorMesh fieldVisitor(field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+        const PetscInt off = fieldVisitor.sectionOffset(vertex);
+        const PetscInt dof = fieldVisitor.sectionDof(vertex);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            fieldArray[off+iDof] = 1.0 + vertex + 0.1*iDof;
+        } // for
+    } // for
+
+    const size_t numSubfields = 2;
+    const char* subfieldNames[numSubfields] = { "displacement", "pressure" };
+    const PylithReal tolerance = 1.0e-6;
+    for (size_t iSubfield = 0; iSubfield < numSubfields; ++iSubfield) {
+        INFO("Subfield: " << subfieldNames[iSubfield]);
+        const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(subfieldNames[iSubfield]);
+        OutputSubfield* subfield = OutputSubfield::create(field, mesh, subfieldNames[iSubfield]);assert(subfield);
+
+        // Extract subfield point by point.
+        PetscErrorCode err = PETSC_SUCCESS;
+        PetscSection subfieldSection = NULL;
+        PetscInt pStart = 0, pEnd = 0, storageSize = 0;
+        err = PetscSectionGetField(field.getLocalSection(), info.index, &subfieldSection);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetChart(subfieldSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetStorageSize(subfieldSection, &storageSize);PYLITH_CHECK_ERROR(err);
+        scalar_array valuesE(storageSize);
+        for (PetscInt point = pStart, index = 0; point < pEnd; ++point) {
+            const PetscInt off = fieldVisitor.sectionSubfieldOffset(info.index, point);
+            const PetscInt dof = fieldVisitor.sectionSubfieldDof(info.index, point);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                valuesE[index++] = fieldArray[off+iDof] * info.description.scale;
+            } // for
+        } // for
+
+        // Second extraction reuses the index set.
+        for (int iExtract = 0; iExtract < 2; ++iExtract) {
+            subfield->extractSubfield(field, info.index);
+
+            PetscVec subfieldVector = subfield->getVector();
+            PetscInt subfieldSize = 0;
+            err = VecGetLocalSize(subfieldVector, &subfieldSize);PYLITH_CHECK_ERROR(err);
+            REQUIRE(storageSize == subfieldSize);
+
+            const PetscScalar* subfieldArray = NULL;
+            err = VecGetArrayRead(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+            for (PetscInt i = 0; i < subfieldSize; ++i) {
+                CHECK_THAT(subfieldArray[i], Catch::Matchers::WithinAbs(valuesE[i], tolerance));
+            } // for
+            err = VecRestoreArrayRead(subfieldVector, &subfieldArray);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        delete subfield;subfield = NULL;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testExtractSubfield
+
+
+// End of file
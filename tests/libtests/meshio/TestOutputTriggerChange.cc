@@ -0,0 +1,299 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/meshio/OutputTriggerChange.hh" // USES OutputTriggerChange
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestOutputTriggerChange;
+    } // meshio
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::meshio::TestOutputTriggerChange : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setters and getters.
+    static
+    void testAccessors(void);
+
+    /// Test shouldWrite() without solution.
+    static
+    void testShouldWrite(void);
+
+    /// Test shouldWrite() with solution.
+    static
+    void testShouldWriteSolution(void);
+
+    /// Test _isWriteNeeded().
+    static
+    void testIsWriteNeeded(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Set values of subfield at all vertices.
+     *
+     * @param[inout] field Field with subfield.
+     * @param[in] subfieldName Name of subfield.
+     * @param[in] value Nondimensional value for all components of subfield.
+     */
+    static
+    void _setSubfield(pylith::topology::Field* field,
+                      const char* subfieldName,
+                      const PylithReal value);
+
+}; // TestOutputTriggerChange
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestOutputTriggerChange::testAccessors", "[TestOutputTriggerChange][testAccessors]") {
+    pylith::meshio::TestOutputTriggerChange::testAccessors();
+}
+TEST_CASE("TestOutputTriggerChange::testShouldWrite", "[TestOutputTriggerChange][testShouldWrite]") {
+    pylith::meshio::TestOutputTriggerChange::testShouldWrite();
+}
+TEST_CASE("TestOutputTriggerChange::testShouldWriteSolution", "[TestOutputTriggerChange][testShouldWriteSolution]") {
+    pylith::meshio::TestOutputTriggerChange::testShouldWriteSolution();
+}
+TEST_CASE("TestOutputTriggerChange::testIsWriteNeeded", "[TestOutputTriggerChange][testIsWriteNeeded]") {
+    pylith::meshio::TestOutputTriggerChange::testIsWriteNeeded();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setters and getters.
+void
+pylith::meshio::TestOutputTriggerChange::testAccessors(void) {
+    const double tolerance = 1.0e-6;
+
+    OutputTriggerChange trigger;
+
+    // Defaults
+    CHECK(std::string("all") == std::string(trigger.getSubfield()));
+    CHECK_THAT(trigger.getRelativeTolerance(), Catch::Matchers::WithinAbs(0.01, tolerance));
+    CHECK_THAT(trigger.getAbsoluteTolerance(), Catch::Matchers::WithinAbs(0.0, tolerance));
+    CHECK_THAT(trigger.getMaxTimeSkip(), Catch::Matchers::WithinAbs(0.0, tolerance));
+
+    trigger.setSubfield("displacement");
+    CHECK(std::string("displacement") == std::string(trigger.getSubfield()));
+
+    trigger.setRelativeTolerance(0.2);
+    CHECK_THAT(trigger.getRelativeTolerance(), Catch::Matchers::WithinAbs(0.2, tolerance));
+    CHECK_THROWS_AS(trigger.setRelativeTolerance(-1.0), std::out_of_range);
+
+    trigger.setAbsoluteTolerance(0.3);
+    CHECK_THAT(trigger.getAbsoluteTolerance(), Catch::Matchers::WithinAbs(0.3, tolerance));
+    CHECK_THROWS_AS(trigger.setAbsoluteTolerance(-1.0), std::out_of_range);
+
+    trigger.setMaxTimeSkip(1.5);
+    CHECK_THAT(trigger.getMaxTimeSkip(), Catch::Matchers::WithinAbs(1.5, tolerance));
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test shouldWrite() without solution.
+void
+pylith::meshio::TestOutputTriggerChange::testShouldWrite(void) {
+    OutputTriggerChange trigger;
+
+    const PylithReal dt = 0.1;
+    PylithReal t = 0.0;
+    PylithInt tindex = 0;
+
+    // Always write first time step; without solution no change is detected.
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt;
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt;
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt;
+
+    trigger.setMaxTimeSkip(0.2999);
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt;
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt;
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt;
+    CHECK(true == trigger.shouldWrite(t, tindex++));t += dt;
+    CHECK(false == trigger.shouldWrite(t, tindex++));t += dt;
+} // testShouldWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Test shouldWrite() with solution.
+void
+pylith::meshio::TestOutputTriggerChange::testShouldWriteSolution(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Mesh with two triangles.
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 2;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        0.0, 1.0,
+        1.0, 1.0,
+    };
+    const int cellsValues[numCells*numCorners] = {
+        0, 1, 2,
+        1, 3, 2,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    pylith::topology::Mesh mesh;
+    MeshBuilder::buildMesh(&mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    mesh.setCoordSys(&cs);
+
+    // Solution with vector and scalar subfields; displacement scale differs from 1.
+    pylith::topology::Field::Description descriptionVector;
+    descriptionVector.label = "displacement";
+    descriptionVector.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionVector.numComponents = 2;
+    descriptionVector.componentNames.resize(2);
+    descriptionVector.componentNames[0] = "displacement_x";
+    descriptionVector.componentNames[1] = "displacement_y";
+    descriptionVector.scale = 2.0;
+    descriptionVector.validator = NULL;
+
+    pylith::topology::Field::Description descriptionScalar;
+    descriptionScalar.label = "pressure";
+    descriptionScalar.vectorFieldType = pylith::topology::Field::SCALAR;
+    descriptionScalar.numComponents = 1;
+    descriptionScalar.componentNames.resize(1);
+    descriptionScalar.componentNames[0] = "pressure";
+    descriptionScalar.scale = 1.0;
+    descriptionScalar.validator = NULL;
+
+    const pylith::topology::Field::Discretization discretization(1, 1);
+    pylith::topology::Field solution(mesh);
+    solution.setLabel("solution");
+    solution.subfieldAdd(descriptionVector, discretization);
+    solution.subfieldAdd(descriptionScalar, discretization);
+    solution.subfieldsSetup();
+    solution.createDiscretization();
+    solution.allocate();
+
+    // Threshold for displacement is 0.5 + 0.1 * (maximum absolute value at previous write).
+    OutputTriggerChange trigger;
+    trigger.setSubfield("displacement");
+    trigger.setRelativeTolerance(0.1);
+    trigger.setAbsoluteTolerance(0.5);
+
+    OutputTriggerChange triggerAll;
+    triggerAll.setRelativeTolerance(0.1);
+    triggerAll.setAbsoluteTolerance(0.5);
+
+    const PylithReal dt = 0.1;
+    PylithReal t = 0.0;
+    PylithInt tindex = 0;
+
+    // Always write first time step; dimensioned displacement is 2.0 and pressure is 0.
+    _setSubfield(&solution, "displacement", 1.0);
+    _setSubfield(&solution, "pressure", 0.0);
+    CHECK(true == trigger.shouldWrite(t, tindex, solution));
+    CHECK(true == triggerAll.shouldWrite(t, tindex, solution));
+    t += dt;++tindex;
+
+    // Change of 0.4 is below threshold of 0.5 + 0.1*2.0 = 0.7.
+    _setSubfield(&solution, "displacement", 1.2);
+    CHECK(false == trigger.shouldWrite(t, tindex, solution));
+    CHECK(false == triggerAll.shouldWrite(t, tindex, solution));
+    t += dt;++tindex;
+
+    // Change of 0.8 since previous write is above threshold of 0.7 (changes accumulate).
+    _setSubfield(&solution, "displacement", 1.4);
+    CHECK(true == trigger.shouldWrite(t, tindex, solution));
+    CHECK(true == triggerAll.shouldWrite(t, tindex, solution));
+    t += dt;++tindex;
+
+    // Change in pressure is above threshold of 0.5 + 0.1*2.8 = 0.78 but only triggers output when
+    // all subfields are used.
+    _setSubfield(&solution, "pressure", 1.0);
+    CHECK(false == trigger.shouldWrite(t, tindex, solution));
+    CHECK(true == triggerAll.shouldWrite(t, tindex, solution));
+    t += dt;++tindex;
+
+    // No change.
+    CHECK(false == trigger.shouldWrite(t, tindex, solution));
+    CHECK(false == triggerAll.shouldWrite(t, tindex, solution));
+
+    PYLITH_METHOD_END;
+} // testShouldWriteSolution
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _isWriteNeeded().
+void
+pylith::meshio::TestOutputTriggerChange::testIsWriteNeeded(void) {
+    OutputTriggerChange trigger;
+    trigger.setRelativeTolerance(0.1);
+    trigger.setAbsoluteTolerance(0.5);
+
+    // First write.
+    CHECK(true == trigger._isWriteNeeded(0.0, 0.0, 0.0));
+    trigger._hasWrote = true;
+    trigger._timeNondimWrote = 0.0;
+
+    // Threshold is 0.5 + 0.1*10.0 = 1.5.
+    CHECK(false == trigger._isWriteNeeded(1.0, 1.4, 10.0));
+    CHECK(true == trigger._isWriteNeeded(1.0, 1.6, 10.0));
+
+    // Maximum elapsed time.
+    trigger.setMaxTimeSkip(2.0);
+    CHECK(false == trigger._isWriteNeeded(1.0, 0.0, 10.0));
+    CHECK(true == trigger._isWriteNeeded(2.0, 0.0, 10.0));
+} // testIsWriteNeeded
+
+
+// ------------------------------------------------------------------------------------------------
+// Set values of subfield at all vertices.
+void
+pylith::meshio::TestOutputTriggerChange::_setSubfield(pylith::topology::Field* field,
+                                                      const char* subfieldName,
+                                                      const PylithReal value) {
+    PYLITH_METHOD_BEGIN;
+    assert(field);
+
+    const PetscInt subfieldIndex = field->getSubfieldInfo(subfieldName).index;
+    pylith::topology::Stratum verticesStratum(field->getDM(), pylith::topology::Stratum::DEPTH, 0);
+    pylith::topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+        const PetscInt off = fieldVisitor.sectionSubfieldOffset(subfieldIndex, vertex);
+        const PetscInt dof = fieldVisitor.sectionSubfieldDof(subfieldIndex, vertex);
+        for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+            fieldArray[off+iDof] = value;
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setSubfield
+
+
+// End of file
@@ -0,0 +1,4 @@
+#!/bin/bash
+#
+# Run unit tests for writing external datasets through aggregators in parallel.
+exec ${MPIEXEC:-mpiexec} -n 3 ./libtest_hdf5_mpi "[TestDataWriterHDF5ExtAggregators]" "$@"
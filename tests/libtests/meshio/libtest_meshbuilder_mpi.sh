@@ -0,0 +1,4 @@
+#!/bin/bash
+#
+# Run unit tests for building vertex groups on distributed meshes.
+exec ${MPIEXEC:-mpiexec} -n 2 ./libtest_meshio "[testSetGroupParallel]" "$@"
@@ -0,0 +1,4 @@
+#!/bin/bash
+#
+# Run unit tests for reading meshes in parallel.
+exec ${MPIEXEC:-mpiexec} -n 2 ./libtest_meshio_mpi "[testReadParallel]" "$@"
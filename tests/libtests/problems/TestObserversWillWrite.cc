@@ -0,0 +1,112 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+/** C++ unit testing of willWrite() for ObserversSoln and ObserversPhysics.
+ *
+ * Both containers combine the decisions of their observers the same way, so the same test is
+ * applied to each of them.
+ */
+
+#include <portinfo>
+
+#include "tests/src/ObserverSolnStub.hh" // USES ObserverSolnStub
+#include "tests/src/ObserverPhysicsStub.hh" // USES ObserverPhysicsStub
+#include "tests/src/StubMethodTracker.hh" // USES StubMethodTracker
+#include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <string> // USES std::string
+
+namespace pylith {
+    namespace problems {
+        class TestObserversWillWrite;
+    } // problems
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::problems::TestObserversWillWrite {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Test willWrite() with no observers and a mix of observers that will and will not write.
+     *
+     * @param[in] stubName Full namespace name of observer stub.
+     */
+    template<typename Observers, typename ObserverStub>
+    static
+    void testWillWrite(const char* stubName);
+
+}; // class TestObserversWillWrite
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestObserversWillWrite::ObserversSoln", "[TestObserversWillWrite]") {
+    pylith::problems::TestObserversWillWrite::testWillWrite<pylith::problems::ObserversSoln, pylith::problems::ObserverSolnStub>(
+        "pylith::problems::ObserverSolnStub");
+}
+TEST_CASE("TestObserversWillWrite::ObserversPhysics", "[TestObserversWillWrite]") {
+    pylith::problems::TestObserversWillWrite::testWillWrite<pylith::problems::ObserversPhysics, pylith::problems::ObserverPhysicsStub>(
+        "pylith::problems::ObserverPhysicsStub");
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test willWrite() with no observers and a mix of observers that will and will not write.
+template<typename Observers, typename ObserverStub>
+void
+pylith::problems::TestObserversWillWrite::testWillWrite(const char* stubName) {
+    const std::string methodName = std::string(stubName) + "::willWrite";
+    pylith::testing::StubMethodTracker tracker;
+
+    const PylithReal t = 1.0;
+    const PylithInt tindex = 1;
+    pylith::topology::Mesh mesh;
+    pylith::topology::Field solution(mesh);
+
+    Observers observers;
+    ObserverStub observerA;
+    ObserverStub observerB;
+
+    // No observers.
+    CHECK(!observers.willWrite(t, tindex, solution));
+
+    observers.registerObserver(&observerA);
+    observers.registerObserver(&observerB);
+
+    // All observers will write.
+    tracker.clear();
+    CHECK(observers.willWrite(t, tindex, solution));
+    CHECK(size_t(2) == tracker.getMethodCount(methodName.c_str()));
+
+    // Mix of observers; every observer is asked, so each one can record its decision for update().
+    observerA.setWillWrite(false);
+    tracker.clear();
+    CHECK(observers.willWrite(t, tindex, solution));
+    CHECK(size_t(2) == tracker.getMethodCount(methodName.c_str()));
+
+    observerA.setWillWrite(true);
+    observerB.setWillWrite(false);
+    tracker.clear();
+    CHECK(observers.willWrite(t, tindex, solution));
+    CHECK(size_t(2) == tracker.getMethodCount(methodName.c_str()));
+
+    // No observers will write.
+    observerA.setWillWrite(false);
+    tracker.clear();
+    CHECK(!observers.willWrite(t, tindex, solution));
+    CHECK(size_t(2) == tracker.getMethodCount(methodName.c_str()));
+
+    observers.removeObserver(&observerA);
+    observers.removeObserver(&observerB);
+} // testWillWrite
+
+
+// End of file
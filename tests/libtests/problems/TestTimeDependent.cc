@@ -0,0 +1,140 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+/** C++ unit testing for monitoring load imbalance and triggering repartitioning in TimeDependent.
+ */
+
+#include <portinfo>
+
+#include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::out_of_range
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestTimeDependent;
+    } // problems
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::problems::TestTimeDependent {
+public:
+
+    /// Test get/setLoadImbalanceThreshold() and get/setLoadImbalanceInterval().
+    static
+    void testLoadImbalanceAccessors(void);
+
+    /** Test _checkLoadBalance().
+     *
+     * Run with more than one process to check a load imbalance greater than 1.
+     */
+    static
+    void testCheckLoadBalance(void);
+
+}; // class TestTimeDependent
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestTimeDependent::testLoadImbalanceAccessors", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent::testLoadImbalanceAccessors();
+}
+TEST_CASE("TestTimeDependent::testCheckLoadBalance", "[TestTimeDependent]") {
+    pylith::problems::TestTimeDependent::testCheckLoadBalance();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test get/setLoadImbalanceThreshold() and get/setLoadImbalanceInterval().
+void
+pylith::problems::TestTimeDependent::testLoadImbalanceAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const double tolerance = 1.0e-6;
+    TimeDependent problem;
+
+    // Defaults
+    CHECK_THAT(problem.getLoadImbalanceThreshold(), Catch::Matchers::WithinAbs(0.0, tolerance));
+    CHECK(size_t(10) == problem.getLoadImbalanceInterval());
+    CHECK_THAT(problem.getMaxLoadImbalance(), Catch::Matchers::WithinAbs(1.0, tolerance));
+    CHECK(!problem.exceededLoadImbalance());
+    CHECK(size_t(0) == problem.getNumRebalances());
+
+    problem.setLoadImbalanceThreshold(1.5);
+    CHECK_THAT(problem.getLoadImbalanceThreshold(), Catch::Matchers::WithinAbs(1.5, tolerance));
+    CHECK_THROWS_AS(problem.setLoadImbalanceThreshold(0.5), std::out_of_range);
+    problem.setLoadImbalanceThreshold(0.0);
+    CHECK_THAT(problem.getLoadImbalanceThreshold(), Catch::Matchers::WithinAbs(0.0, tolerance));
+
+    problem.setLoadImbalanceInterval(4);
+    CHECK(size_t(4) == problem.getLoadImbalanceInterval());
+    CHECK_THROWS_AS(problem.setLoadImbalanceInterval(0), std::out_of_range);
+
+    PYLITH_METHOD_END;
+} // testLoadImbalanceAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test _checkLoadBalance().
+void
+pylith::problems::TestTimeDependent::testCheckLoadBalance(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const double tolerance = 1.0e-6;
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    int commRank = 0, commSize = 1;
+    PetscErrorCode err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    TimeDependent problem;
+    const double threshold = 1.2;
+    problem.setLoadImbalanceThreshold(threshold);
+    pylith::topology::Mesh mesh;
+    problem.setMesh(&mesh);
+
+    // Time in integrators on process i is proportional to i+1, so the ratio of the maximum to the
+    // average is 2*size/(size+1).
+    problem._integratorTimes.resize(2);
+    problem._integratorTimes[0] = 1.0 * (commRank+1);
+    problem._integratorTimes[1] = 2.0 * (commRank+1);
+    problem._checkLoadBalance(10, comm);
+    const double imbalanceE = 2.0 * commSize / (commSize + 1.0);
+    CHECK_THAT(problem.getMaxLoadImbalance(), Catch::Matchers::WithinAbs(imbalanceE, tolerance));
+    CHECK((imbalanceE > threshold) == problem.exceededLoadImbalance());
+    CHECK(((commSize > 1) && (imbalanceE > threshold)) == problem._needRebalance);
+
+    // Only time since previous check is used; same time on all processes is balanced, and the
+    // maximum load imbalance is retained.
+    problem._integratorTimes[0] += 4.0;
+    problem._checkLoadBalance(20, comm);
+    CHECK_THAT(problem.getMaxLoadImbalance(), Catch::Matchers::WithinAbs(imbalanceE, tolerance));
+
+    // No time in integrators since previous check.
+    problem._checkLoadBalance(30, comm);
+    CHECK_THAT(problem.getMaxLoadImbalance(), Catch::Matchers::WithinAbs(imbalanceE, tolerance));
+
+    // Balanced load from the start.
+    TimeDependent problemBalanced;
+    problemBalanced.setLoadImbalanceThreshold(threshold);
+    problemBalanced._integratorTimes.resize(1);
+    problemBalanced._integratorTimes[0] = 3.0;
+    problemBalanced._checkLoadBalance(10, comm);
+    CHECK_THAT(problemBalanced.getMaxLoadImbalance(), Catch::Matchers::WithinAbs(1.0, tolerance));
+    CHECK(!problemBalanced.exceededLoadImbalance());
+    CHECK(!problemBalanced._needRebalance);
+
+    PYLITH_METHOD_END;
+} // testCheckLoadBalance
+
+
+// End of file
@@ -0,0 +1,4 @@
+#!/bin/bash
+#
+# Run unit tests that check values reduced over processes.
+exec ${MPIEXEC:-mpiexec} -n 2 ./libtest_problems_mpi "$@"
@@ -13,6 +13,8 @@
 #include "TestFieldMesh.hh" // Implementation of class methods
 
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::createSubfieldsIS()
+#include "pylith/topology/VectorPool.hh" // USES VectorPool
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/MeshOps.hh" // USES MeshOps::createDMMesh()
 #include "pylith/topology/Stratum.hh" // USES Stratum
@@ -24,6 +26,8 @@
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
+#include <stdexcept> // USES std::logic_error
+
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 #include "catch2/matchers/catch_matchers_exception.hpp"
@@ -84,13 +88,20 @@ pylith::topology::TestFieldMesh::testCopyConstructor(void) {
 
     PetscErrorCode err = 0;
 
+    const char *name = NULL;
+    err = PetscObjectGetName((PetscObject)_field->getDM(), &name);assert(!err);
+    const std::string labelDM = name;
+
     const std::string& label = "field A";
     Field field(*_field);
     field.setLabel(label.c_str());
 
-    const char *name = NULL;
+    // Layout is shared with source field, so DM keeps name of source field.
+    CHECK(field.hasSharedLayout());
+    CHECK(!_field->hasSharedLayout());
+    CHECK(_field->getDM() == field.getDM());
     err = PetscObjectGetName((PetscObject)field.getDM(), &name);assert(!err);
-    CHECK(label == std::string(name));
+    CHECK(labelDM == std::string(name));
 
     PetscSection section = field.getLocalSection();assert(section);
     PetscVec vec = field.getLocalVector();assert(vec);
@@ -124,7 +135,30 @@ pylith::topology::TestFieldMesh::testCopyConstructor(void) {
         CHECK(numConstraintsE == cdof);
     } // for
 
+    // Vectors are returned to the pool and reused by fields with the same layout.
+    VectorPool* pool = field._vectorPool;assert(pool);
+    CHECK(pool == _field->_vectorPool);
+    CHECK(size_t(1) == pool->getNumCheckedOut());
+    CHECK(size_t(0) == pool->getNumAvailable());
+    field.createGlobalVector();
+    CHECK(size_t(2) == pool->getNumCheckedOut());
     field.deallocate();
+    CHECK(size_t(0) == pool->getNumCheckedOut());
+    CHECK(size_t(2) == pool->getNumAvailable());
+
+    Field fieldB(*_field);
+    CHECK(size_t(1) == pool->getNumCheckedOut());
+    CHECK(size_t(1) == pool->getNumAvailable());
+    PylithReal norm = 1.0;
+    err = VecNorm(fieldB.getLocalVector(), NORM_INFINITY, &norm);assert(!err);
+    CHECK(0.0 == norm);
+    fieldB.deallocate();
+
+    // Layout of field shared with another field cannot be changed.
+    Field fieldC(*_field);
+    CHECK_THROWS_AS(fieldC.allocate(), std::logic_error);
+    CHECK_THROWS_AS(fieldC.createDiscretization(), std::logic_error);
+    fieldC.deallocate();
 
     PYLITH_METHOD_END;
 } // testCopyConstructor
@@ -213,6 +247,27 @@ pylith::topology::TestFieldMesh::testVectorAccessors(void) {
     err = VecGetSize(globalVec, &size);assert(!err);
     CHECK(ndof - ndofConstrained == size);
 
+    { // Split-phase scatters match blocking scatters.
+        PetscVec globalVecSplit = NULL;
+        PetscVec localVecOrig = NULL;
+        PetscBool isEqual = PETSC_FALSE;
+        err = VecDuplicate(globalVec, &globalVecSplit);assert(!err);
+        _field->scatterLocalToVectorBegin(globalVecSplit);
+        _field->scatterLocalToVectorEnd(globalVecSplit);
+        err = VecEqual(globalVec, globalVecSplit, &isEqual);assert(!err);
+        CHECK(isEqual);
+
+        err = VecDuplicate(localVec, &localVecOrig);assert(!err);
+        err = VecCopy(localVec, localVecOrig);assert(!err);
+        _field->scatterVectorToLocalBegin(globalVecSplit);
+        _field->scatterVectorToLocalEnd(globalVecSplit);
+        err = VecEqual(localVec, localVecOrig, &isEqual);assert(!err);
+        CHECK(isEqual);
+
+        err = VecDestroy(&globalVecSplit);assert(!err);
+        err = VecDestroy(&localVecOrig);assert(!err);
+    } // Split-phase scatters
+
     _field->createOutputVector();
     _field->scatterLocalToOutput();
     const PetscVec& outputVec = _field->getOutputVector();assert(outputVec);
@@ -314,6 +369,164 @@ pylith::topology::TestFieldMesh::testZeroLocal(void) {
 } // testZeroLocal
 
 
+// ------------------------------------------------------------------------------------------------
+// Test closure index created by VecVisitorMesh.
+void
+pylith::topology::TestFieldMesh::testClosureIndex(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_field);
+
+    PetscDM dm = _field->getDM();assert(dm);
+    PetscSection section = _field->getLocalSection();assert(section);
+    PetscSection indexSection = NULL;
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = PetscSectionGetClosureIndex(section, (PetscObject)dm, &indexSection, NULL);assert(!err);
+    CHECK(!indexSection);
+
+    // Values from closure are the same with and without the closure index.
+    Stratum cells(dm, Stratum::HEIGHT, 0);
+    const PetscInt cell = cells.begin();
+    PetscScalar* valuesNoIndex = NULL;
+    PetscInt sizeNoIndex = 0;
+    err = DMPlexVecGetClosure(dm, section, _field->getLocalVector(), cell, &sizeNoIndex, &valuesNoIndex);assert(!err);
+
+    VecVisitorMesh visitor(*_field);
+    PetscScalar* values = NULL;
+    PetscInt size = 0;
+    visitor.getClosure(&values, &size, cell);
+    err = PetscSectionGetClosureIndex(section, (PetscObject)dm, &indexSection, NULL);assert(!err);
+    CHECK(indexSection);
+    REQUIRE(sizeNoIndex == size);
+    for (PetscInt i = 0; i < size; ++i) {
+        CHECK(valuesNoIndex[i] == values[i]);
+    } // for
+    visitor.restoreClosure(&values, &size, cell);
+    err = DMPlexVecRestoreClosure(dm, section, _field->getLocalVector(), cell, &sizeNoIndex, &valuesNoIndex);assert(!err);
+
+    // Field with same layout shares closure index.
+    Field field(*_field);
+    err = PetscSectionGetClosureIndex(field.getLocalSection(), (PetscObject)field.getDM(), &indexSection, NULL);assert(!err);
+    CHECK(indexSection);
+    field.deallocate();
+
+    // Closure index is discarded when layout is reallocated.
+    visitor.clear();
+    _field->allocate();
+    err = PetscSectionGetClosureIndex(_field->getLocalSection(), (PetscObject)dm, &indexSection, NULL);assert(!err);
+    CHECK(!indexSection);
+
+    PYLITH_METHOD_END;
+} // testClosureIndex
+
+
+// ------------------------------------------------------------------------------------------------
+// Test FieldOps::createSubfieldsIS() against extracting subfields point by point.
+void
+pylith::topology::TestFieldMesh::testSubfieldsIS(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_mesh);
+    assert(_field);
+
+    PetscDM dm = _field->getDM();assert(dm);
+    PetscSection section = _field->getLocalSection();assert(section);
+    PetscErrorCode err = PETSC_SUCCESS;
+    const PylithReal tolerance = 1.0e-6;
+
+    const size_t numCases = 2;
+    const PetscInt numSubfieldsCases[numCases] = { 1, 2 };
+    const PetscInt subfieldIndicesCases[numCases][2] = { {1, -1}, {0, 1} };
+    for (size_t iCase = 0; iCase < numCases; ++iCase) {
+        const PetscInt numSubfields = numSubfieldsCases[iCase];
+        const PetscInt* subfieldIndices = subfieldIndicesCases[iCase];
+        INFO("Number of subfields: " << numSubfields);
+
+        PetscDM subDM = NULL;
+        PetscSection subSection = NULL;
+        err = DMCreateSubDM(dm, numSubfields, subfieldIndices, NULL, &subDM);PYLITH_CHECK_ERROR(err);
+        err = DMGetLocalSection(subDM, &subSection);PYLITH_CHECK_ERROR(err);
+
+        // Extract subfields using index set.
+        PetscVec subVec = NULL;
+        err = DMCreateLocalVector(subDM, &subVec);PYLITH_CHECK_ERROR(err);
+        PetscIS subfieldsIS = FieldOps::createSubfieldsIS(section, subfieldIndices, numSubfields, subSection);
+        err = VecISCopy(_field->getLocalVector(), subfieldsIS, SCATTER_REVERSE, subVec);PYLITH_CHECK_ERROR(err);
+
+        // Extract subfields point by point.
+        PetscInt pStart = 0, pEnd = 0, subSize = 0;
+        err = PetscSectionGetChart(subSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        err = VecGetLocalSize(subVec, &subSize);PYLITH_CHECK_ERROR(err);
+        scalar_array valuesE(subSize);
+        VecVisitorMesh fieldVisitor(*_field);
+        const PetscScalar* fieldArray = fieldVisitor.localArray();
+        size_t index = 0;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            for (PetscInt i = 0; i < numSubfields; ++i) {
+                const PetscInt off = fieldVisitor.sectionSubfieldOffset(subfieldIndices[i], point);
+                const PetscInt dof = fieldVisitor.sectionSubfieldDof(subfieldIndices[i], point);
+                for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                    valuesE[index++] = fieldArray[off+iDof];
+                } // for
+            } // for
+        } // for
+        REQUIRE(size_t(subSize) == index);
+
+        const PetscScalar* subArray = NULL;
+        err = VecGetArrayRead(subVec, &subArray);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < subSize; ++i) {
+            CHECK_THAT(subArray[i], Catch::Matchers::WithinAbs(valuesE[i], tolerance));
+        } // for
+
+        // Section for subfields with points in reverse order.
+        PetscSection permSection = NULL;
+        PetscIS permIS = NULL;
+        PetscInt* permutation = NULL;
+        err = PetscSectionCreate(PETSC_COMM_SELF, &permSection);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionSetChart(permSection, pStart, pEnd);PYLITH_CHECK_ERROR(err);
+        err = PetscMalloc1(pEnd-pStart, &permutation);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt dof = 0;
+            err = PetscSectionGetDof(subSection, point, &dof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionSetDof(permSection, point, dof);PYLITH_CHECK_ERROR(err);
+            permutation[point-pStart] = pEnd-1-point;
+        } // for
+        err = ISCreateGeneral(PETSC_COMM_SELF, pEnd-pStart, permutation, PETSC_OWN_POINTER, &permIS);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionSetPermutation(permSection, permIS);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionSetUp(permSection);PYLITH_CHECK_ERROR(err);
+
+        // Values with permuted layout must match values at the same points with the original layout.
+        PetscVec permVec = NULL;
+        err = VecCreateSeq(PETSC_COMM_SELF, subSize, &permVec);PYLITH_CHECK_ERROR(err);
+        PetscIS permSubfieldsIS = FieldOps::createSubfieldsIS(section, subfieldIndices, numSubfields, permSection);
+        err = VecISCopy(_field->getLocalVector(), permSubfieldsIS, SCATTER_REVERSE, permVec);PYLITH_CHECK_ERROR(err);
+
+        const PetscScalar* permArray = NULL;
+        err = VecGetArrayRead(permVec, &permArray);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt dof = 0, off = 0, permOff = 0;
+            err = PetscSectionGetDof(subSection, point, &dof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetOffset(subSection, point, &off);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetOffset(permSection, point, &permOff);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iDof = 0; iDof < dof; ++iDof) {
+                CHECK_THAT(permArray[permOff+iDof], Catch::Matchers::WithinAbs(subArray[off+iDof], tolerance));
+            } // for
+        } // for
+        err = VecRestoreArrayRead(permVec, &permArray);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreArrayRead(subVec, &subArray);PYLITH_CHECK_ERROR(err);
+
+        err = ISDestroy(&permSubfieldsIS);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&permVec);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&permIS);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionDestroy(&permSection);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&subfieldsIS);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&subVec);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&subDM);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testSubfieldsIS
+
+
 // ------------------------------------------------------------------------------------------------
 // Test view().
 void
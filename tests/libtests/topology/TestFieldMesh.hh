@@ -61,6 +61,12 @@ public:
     /// Test zeroLocal().
     void testZeroLocal(void);
 
+    /// Test closure index created by VecVisitorMesh.
+    void testClosureIndex(void);
+
+    /// Test FieldOps::createSubfieldsIS() against extracting subfields point by point.
+    void testSubfieldsIS(void);
+
     /// Test view().
     void testView(void);
 
@@ -58,6 +58,12 @@ TEST_CASE("TestFieldMesh::Quad::testAllocate", "[TestFieldMesh][Quad][testAlloca
 TEST_CASE("TestFieldMesh::Quad::testZeroLocal", "[TestFieldMesh][Quad][testZeroLocal]") {
     pylith::topology::TestFieldMesh(pylith::topology::TestFieldMesh_Cases::Quad()).testZeroLocal();
 }
+TEST_CASE("TestFieldMesh::Quad::testClosureIndex", "[TestFieldMesh][Quad][testClosureIndex]") {
+    pylith::topology::TestFieldMesh(pylith::topology::TestFieldMesh_Cases::Quad()).testClosureIndex();
+}
+TEST_CASE("TestFieldMesh::Quad::testSubfieldsIS", "[TestFieldMesh][Quad][testSubfieldsIS]") {
+    pylith::topology::TestFieldMesh(pylith::topology::TestFieldMesh_Cases::Quad()).testSubfieldsIS();
+}
 TEST_CASE("TestFieldMesh::Quad::testView", "[TestFieldMesh][Quad][testView]") {
     pylith::topology::TestFieldMesh(pylith::topology::TestFieldMesh_Cases::Quad()).testView();
 }
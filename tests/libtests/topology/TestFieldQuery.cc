@@ -42,6 +42,31 @@ namespace pylith {
             }
 
 
+            std::string
+            converterDisplacement(PylithScalar valueSubfield[],
+                                  const PylithInt numComponents,
+                                  const pylith::scalar_array dbValues,
+                                  const pylith::int_array dbIndices) {
+                assert(2 == numComponents);
+                assert(3 == dbIndices.size());
+                valueSubfield[0] = dbValues[dbIndices[0]] + dbValues[dbIndices[2]];
+                valueSubfield[1] = dbValues[dbIndices[1]] - dbValues[dbIndices[2]];
+                return std::string();
+            }
+
+
+            std::string
+            converterTemperature(PylithScalar valueSubfield[],
+                                 const PylithInt numComponents,
+                                 const pylith::scalar_array dbValues,
+                                 const pylith::int_array dbIndices) {
+                assert(1 == numComponents);
+                assert(2 == dbIndices.size());
+                valueSubfield[0] = dbValues[dbIndices[0]] + 2.0*dbValues[dbIndices[1]];
+                return std::string();
+            }
+
+
         } // _TestFieldQuery
     } // topology
 } // pylith
@@ -233,14 +258,75 @@ pylith::topology::TestFieldQuery::testQuery(void) {
     query.openDB(_data->auxDB, _data->normalizer->getLengthScale());
     PetscErrorCode err = DMPlexComputeL2DiffLocal(_field->getDM(), t, query._functions, (void**)query._contextPtrs,
                                                   _field->getLocalVector(), &norm);REQUIRE(!err);
-    query.closeDB(_data->auxDB);
     const PylithReal tolerance = 1.0e-6;
     CHECK_THAT(norm, Catch::Matchers::WithinAbs(0.0, tolerance));
 
+    // Batched queries should match projection with a query at every point.
+    PetscVec pointwiseVec = NULL;
+    err = VecDuplicate(_field->getLocalVector(), &pointwiseVec);REQUIRE(!err);
+    err = DMProjectFunctionLocal(_field->getDM(), t, query._functions, (void**)query._contextPtrs, INSERT_ALL_VALUES,
+                                 pointwiseVec);REQUIRE(!err);
+    err = VecAXPY(pointwiseVec, -1.0, _field->getLocalVector());REQUIRE(!err);
+    err = VecNorm(pointwiseVec, NORM_INFINITY, &norm);REQUIRE(!err);
+    err = VecDestroy(&pointwiseVec);REQUIRE(!err);
+    CHECK_THAT(norm, Catch::Matchers::WithinAbs(0.0, tolerance));
+    query.closeDB(_data->auxDB);
+
     PYLITH_METHOD_END;
 } // testQuery
 
 
+// ----------------------------------------------------------------------
+// Test queryDB() with subfields sharing spatial database values.
+void
+pylith::topology::TestFieldQuery::testQueryShared(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_query);
+    assert(_field);
+    assert(_data);
+    assert(_data->normalizer);
+
+    // Subfields with different discretizations use overlapping values from the same database, so
+    // the batched query shares the database query at each point between them.
+    const size_t numDispValues = 3;
+    const char* dispValues[numDispValues] = { "displacement_x", "displacement_y", "temperature" };
+    const size_t numTempValues = 2;
+    const char* tempValues[numTempValues] = { "temperature", "displacement_x" };
+
+    _query->setQuery("displacement", dispValues, numDispValues, _TestFieldQuery::converterDisplacement);
+    _query->setQuery("temperature", tempValues, numTempValues, _TestFieldQuery::converterTemperature);
+    _query->openDB(_data->auxDB, _data->normalizer->getLengthScale());
+    _query->queryDB();
+    _query->closeDB(_data->auxDB);
+
+    // Projection with a separate query for each subfield at every point.
+    pylith::topology::FieldQuery query(*_field);
+    query.setQuery("displacement", dispValues, numDispValues, _TestFieldQuery::converterDisplacement);
+    query.setQuery("temperature", tempValues, numTempValues, _TestFieldQuery::converterTemperature);
+    query.openDB(_data->auxDB, _data->normalizer->getLengthScale());
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscVec pointwiseVec = NULL;
+    err = VecDuplicate(_field->getLocalVector(), &pointwiseVec);REQUIRE(!err);
+    const PylithReal t = 0.0;
+    err = DMProjectFunctionLocal(_field->getDM(), t, query._functions, (void**)query._contextPtrs, INSERT_ALL_VALUES,
+                                 pointwiseVec);REQUIRE(!err);
+    query.closeDB(_data->auxDB);
+
+    PylithReal min = 0.0;
+    err = VecMin(_field->getLocalVector(), NULL, &min);REQUIRE(!err);
+    CHECK(min > FILL_VALUE);
+
+    PylithReal norm = 0.0;
+    err = VecAXPY(pointwiseVec, -1.0, _field->getLocalVector());REQUIRE(!err);
+    err = VecNorm(pointwiseVec, NORM_INFINITY, &norm);REQUIRE(!err);
+    err = VecDestroy(&pointwiseVec);REQUIRE(!err);
+    const PylithReal tolerance = 1.0e-6;
+    CHECK_THAT(norm, Catch::Matchers::WithinAbs(0.0, tolerance));
+
+    PYLITH_METHOD_END;
+} // testQueryShared
+
+
 // ----------------------------------------------------------------------
 // Test queryDB() with NULL database.
 void
@@ -49,6 +49,9 @@ public:
     /// Test queryDB().
     void testQuery(void);
 
+    /// Test queryDB() with subfields sharing spatial database values.
+    void testQueryShared(void);
+
     /// Test queryDB() with NULL database.
     void testQueryNull(void);
 
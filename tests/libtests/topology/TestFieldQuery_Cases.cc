@@ -107,6 +107,9 @@ TEST_CASE("TestFieldQuery::Quad::testOpenClose", "[TestFieldQuery][Tri][testOpen
 TEST_CASE("TestFieldQuery::Quad::testQuery", "[TestFieldQuery][Tri][testQuery]") {
     pylith::topology::TestFieldQuery(pylith::topology::TestFieldQuery_Cases::Tri()).testQuery();
 }
+TEST_CASE("TestFieldQuery::Quad::testQueryShared", "[TestFieldQuery][Tri][testQueryShared]") {
+    pylith::topology::TestFieldQuery(pylith::topology::TestFieldQuery_Cases::Tri()).testQueryShared();
+}
 TEST_CASE("TestFieldQuery::Quad::testQueryNull", "[TestFieldQuery][Tri][testQueryNull]") {
     pylith::topology::TestFieldQuery(pylith::topology::TestFieldQuery_Cases::Tri()).testQueryNull();
 }
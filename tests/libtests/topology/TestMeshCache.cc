@@ -0,0 +1,213 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/topology/MeshCache.hh" // USES MeshCache
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <cstdio> // USES std::remove()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class TestMeshCache;
+    } // topology
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::topology::TestMeshCache {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test isCurrent().
+    static
+    void testIsCurrent(void);
+
+    /// Test mesh read from cache matches mesh read from input file.
+    static
+    void testWriteRead(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Get coordinates of vertices in closure of each cell.
+     *
+     * @param[out] values Coordinates of vertices in closure of each cell.
+     * @param[in] mesh Finite-element mesh.
+     */
+    static
+    void _getCellCoordinates(pylith::scalar_array* values,
+                             const pylith::topology::Mesh& mesh);
+
+    /** Get number of points in stratum of label.
+     *
+     * @param[in] mesh Finite-element mesh.
+     * @param[in] labelName Name of label.
+     * @param[in] labelValue Value of label.
+     * @returns Number of points in stratum.
+     */
+    static
+    PetscInt _getStratumSize(const pylith::topology::Mesh& mesh,
+                             const char* labelName,
+                             const PetscInt labelValue);
+
+}; // TestMeshCache
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestMeshCache::testIsCurrent", "[TestMeshCache][testIsCurrent]") {
+    pylith::topology::TestMeshCache::testIsCurrent();
+}
+TEST_CASE("TestMeshCache::testWriteRead", "[TestMeshCache][testWriteRead]") {
+    pylith::topology::TestMeshCache::testWriteRead();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test isCurrent().
+void
+pylith::topology::TestMeshCache::testIsCurrent(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const char* filename = "mesh_cache_current.h5";
+    std::remove(filename);
+
+    Mesh mesh;
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/fourtri3.mesh");
+    iohandler.read(&mesh);
+
+    CHECK(!MeshCache::isCurrent(mesh, filename, "abc"));
+
+    MeshCache::write(mesh, filename, "abc");
+    CHECK(MeshCache::isCurrent(mesh, filename, "abc"));
+    CHECK(!MeshCache::isCurrent(mesh, filename, "abd"));
+    CHECK(!MeshCache::isCurrent(mesh, filename, ""));
+
+    PYLITH_METHOD_END;
+} // testIsCurrent
+
+
+// ------------------------------------------------------------------------------------------------
+// Test mesh read from cache matches mesh read from input file.
+void
+pylith::topology::TestMeshCache::testWriteRead(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const char* filename = "mesh_cache_roundtrip.h5";
+
+    Mesh meshE;
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/fourtri3.mesh");
+    iohandler.read(&meshE);
+    MeshCache::write(meshE, filename, "abc");
+
+    Mesh mesh;
+    MeshCache::read(&mesh, filename);
+    MeshOps::checkTopology(mesh);
+
+    CHECK(meshE.getDimension() == mesh.getDimension());
+    CHECK(MeshOps::getNumVertices(meshE) == MeshOps::getNumVertices(mesh));
+    CHECK(MeshOps::getNumCells(meshE) == MeshOps::getNumCells(mesh));
+    CHECK(MeshOps::getNumCorners(meshE) == MeshOps::getNumCorners(mesh));
+
+    pylith::scalar_array cellCoordinatesE;
+    _getCellCoordinates(&cellCoordinatesE, meshE);
+    pylith::scalar_array cellCoordinates;
+    _getCellCoordinates(&cellCoordinates, mesh);
+    REQUIRE(cellCoordinatesE.size() == cellCoordinates.size());
+    const PylithReal tolerance = 1.0e-12;
+    for (size_t i = 0; i < cellCoordinatesE.size(); ++i) {
+        CHECK_THAT(cellCoordinates[i], Catch::Matchers::WithinAbs(cellCoordinatesE[i], tolerance));
+    } // for
+
+    // Material and vertex group labels.
+    const int numLabels = 4;
+    const char* labelNames[numLabels] = { Mesh::cells_label_name, Mesh::cells_label_name, "fault", "end points" };
+    const PetscInt labelValues[numLabels] = { 1, 2, 1, 1 };
+    for (int iLabel = 0; iLabel < numLabels; ++iLabel) {
+        INFO("label: " << labelNames[iLabel] << ", value: " << labelValues[iLabel]);
+        const PetscInt sizeE = _getStratumSize(meshE, labelNames[iLabel], labelValues[iLabel]);
+        CHECK(sizeE > 0);
+        CHECK(sizeE == _getStratumSize(mesh, labelNames[iLabel], labelValues[iLabel]));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testWriteRead
+
+
+// ------------------------------------------------------------------------------------------------
+// Get coordinates of vertices in closure of each cell.
+void
+pylith::topology::TestMeshCache::_getCellCoordinates(pylith::scalar_array* values,
+                                                     const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(values);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmMesh = mesh.getDM();assert(dmMesh);
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmMesh, &spaceDim);PYLITH_CHECK_ERROR(err);
+    const PetscInt numCorners = MeshOps::getNumCorners(mesh);
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+    CoordsVisitor coordsVisitor(dmMesh);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();assert(coordsArray);
+
+    values->resize(cellsStratum.size()*numCorners*spaceDim);
+    size_t index = 0;
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize*2; iPoint += 2) {
+            const PetscInt point = closure[iPoint];
+            if ((point < verticesStratum.begin()) || (point >= verticesStratum.end())) {
+                continue;
+            } // if
+            const PetscInt off = coordsVisitor.sectionOffset(point);
+            for (int iDim = 0; iDim < spaceDim; ++iDim) {
+                (*values)[index++] = coordsArray[off+iDim];
+            } // for
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+    assert(index == values->size());
+
+    PYLITH_METHOD_END;
+} // _getCellCoordinates
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of points in stratum of label.
+PetscInt
+pylith::topology::TestMeshCache::_getStratumSize(const pylith::topology::Mesh& mesh,
+                                                 const char* labelName,
+                                                 const PetscInt labelValue) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscInt size = 0;
+    err = DMGetStratumSize(mesh.getDM(), labelName, labelValue, &size);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(size);
+} // _getStratumSize
+
+
+// End of file
@@ -18,6 +18,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -55,6 +56,10 @@ public:
     static
     void testCheckMaterialIds(void);
 
+    /// Test checkMaterialLabels() with label values larger than 2^31.
+    static
+    void testCheckMaterialIdsLarge(void);
+
 }; // class TestMeshOps
 
 // ------------------------------------------------------------------------------------------------
@@ -70,6 +75,9 @@ TEST_CASE("TestMeshOps::testIsSimplexMesh", "[TestMeshOps]") {
 TEST_CASE("TestMeshOps::testCheckMaterialIds", "[TestMeshOps]") {
     pylith::topology::TestMeshOps().testCheckMaterialIds();
 }
+TEST_CASE("TestMeshOps::testCheckMaterialIdsLarge", "[TestMeshOps]") {
+    pylith::topology::TestMeshOps().testCheckMaterialIdsLarge();
+}
 
 // ------------------------------------------------------------------------------------------------
 // Test nondimensionalize().
@@ -205,4 +213,54 @@ pylith::topology::TestMeshOps::testCheckMaterialIds(void) {
 } // testCheckMaterialIds
 
 
+// ------------------------------------------------------------------------------------------------
+// Test checkMaterialLabels() with label values larger than 2^31.
+void
+pylith::topology::TestMeshOps::testCheckMaterialIdsLarge(void) {
+    PYLITH_METHOD_BEGIN;
+
+#if defined(PETSC_USE_64BIT_INDICES)
+    Mesh mesh;
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri3.mesh");
+    iohandler.read(&mesh);
+
+    // Shift label values by 2^32, so truncating them to int gives the original values.
+    const PetscInt shift = PetscInt(1) << 32;
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDMLabel materialsLabel = NULL;
+    err = DMGetLabel(mesh.getDM(), Mesh::cells_label_name, &materialsLabel);PYLITH_CHECK_ERROR(err);assert(materialsLabel);
+    Stratum cellsStratum(mesh.getDM(), Stratum::HEIGHT, 0);
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        PetscInt value = -1;
+        err = DMLabelGetValue(materialsLabel, cell, &value);PYLITH_CHECK_ERROR(err);
+        if (value < 0) {
+            continue;
+        } // if
+        err = DMLabelClearValue(materialsLabel, cell, value);PYLITH_CHECK_ERROR(err);
+        err = DMLabelSetValue(materialsLabel, cell, value + shift);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    pylith::int_array materialValues(2);
+    materialValues[0] = 4 + shift;
+    materialValues[1] = 3 + shift;
+    MeshOps::checkMaterialLabels(mesh, materialValues);
+
+    // Material with truncated label value has no cells.
+    pylith::int_array materialValuesExtra(3);
+    materialValuesExtra[0] = 4 + shift;
+    materialValuesExtra[1] = 3 + shift;
+    materialValuesExtra[2] = 3;
+    REQUIRE_THROWS_AS(MeshOps::checkMaterialLabels(mesh, materialValuesExtra), std::runtime_error);
+
+    // Truncated label values do not match any cells.
+    materialValues[0] = 4;
+    materialValues[1] = 3;
+    REQUIRE_THROWS_AS(MeshOps::checkMaterialLabels(mesh, materialValues), std::runtime_error);
+#endif
+
+    PYLITH_METHOD_END;
+} // testCheckMaterialIdsLarge
+
+
 // End of file
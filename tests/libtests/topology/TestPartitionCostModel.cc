@@ -0,0 +1,217 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/topology/PartitionCostModel.hh" // USES PartitionCostModel
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include <stdexcept> // USES std::out_of_range
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class TestPartitionCostModel;
+    } // topology
+} // pylith
+
+class pylith::topology::TestPartitionCostModel {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test setDefaultCost(), getDefaultCost(), setCellCost(), getCellCost().
+    static
+    void testAccessors(void);
+
+    /// Test setWeights().
+    static
+    void testSetWeights(void);
+
+    /// Test getNumCells().
+    static
+    void testGetNumCells(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create mesh with four triangles; cells 0 and 1 have material-id 1, cell 2 has material-id 2,
+     * and cell 3 has no material-id.
+     *
+     * @param[out] mesh Finite-element mesh.
+     */
+    static
+    void _createMesh(Mesh* mesh);
+
+}; // class TestPartitionCostModel
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestPartitionCostModel::testAccessors", "[TestPartitionCostModel]") {
+    pylith::topology::TestPartitionCostModel::testAccessors();
+}
+TEST_CASE("TestPartitionCostModel::testSetWeights", "[TestPartitionCostModel]") {
+    pylith::topology::TestPartitionCostModel::testSetWeights();
+}
+TEST_CASE("TestPartitionCostModel::testGetNumCells", "[TestPartitionCostModel]") {
+    pylith::topology::TestPartitionCostModel::testGetNumCells();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test setDefaultCost(), getDefaultCost(), setCellCost(), getCellCost().
+void
+pylith::topology::TestPartitionCostModel::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const PylithReal tolerance = 1.0e-6;
+    PartitionCostModel costModel;
+
+    // Defaults
+    CHECK_THAT(costModel.getDefaultCost(), Catch::Matchers::WithinAbs(1.0, tolerance));
+    CHECK_THAT(costModel.getCellCost(4), Catch::Matchers::WithinAbs(1.0, tolerance));
+
+    costModel.setDefaultCost(2.0);
+    CHECK_THAT(costModel.getDefaultCost(), Catch::Matchers::WithinAbs(2.0, tolerance));
+    CHECK_THAT(costModel.getCellCost(4), Catch::Matchers::WithinAbs(2.0, tolerance));
+    CHECK_THROWS_AS(costModel.setDefaultCost(0.0), std::out_of_range);
+
+    costModel.setCellCost(4, 3.5);
+    CHECK_THAT(costModel.getCellCost(4), Catch::Matchers::WithinAbs(3.5, tolerance));
+    CHECK_THAT(costModel.getCellCost(5), Catch::Matchers::WithinAbs(2.0, tolerance));
+    CHECK_THROWS_AS(costModel.setCellCost(5, -1.0), std::out_of_range);
+
+    costModel.deallocate();
+    CHECK_THAT(costModel.getCellCost(4), Catch::Matchers::WithinAbs(2.0, tolerance));
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ------------------------------------------------------------------------------------------------
+// Test setWeights().
+void
+pylith::topology::TestPartitionCostModel::testSetWeights(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Mesh mesh;
+    _createMesh(&mesh);
+
+    // Least expensive cell has weight 10.
+    PartitionCostModel costModel;
+    costModel.setDefaultCost(2.0);
+    costModel.setCellCost(1, 0.5);
+    costModel.setCellCost(2, 1.75);
+    costModel.setWeights(&mesh);
+
+    const PetscInt numCells = 4;
+    const PetscInt weightsE[numCells] = { 10, 10, 35, 40 };
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscSection weightsSection = NULL;
+    err = DMGetLocalSection(mesh.getDM(), &weightsSection);PYLITH_CHECK_ERROR(err);
+    REQUIRE(weightsSection);
+    Stratum cellsStratum(mesh.getDM(), Stratum::HEIGHT, 0);
+    REQUIRE(numCells == cellsStratum.size());
+    for (PetscInt cell = cellsStratum.begin(), iCell = 0; cell < cellsStratum.end(); ++cell, ++iCell) {
+        PetscInt weight = 0;
+        err = PetscSectionGetDof(weightsSection, cell, &weight);PYLITH_CHECK_ERROR(err);
+        INFO("Cell " << cell);
+        CHECK(weightsE[iCell] == weight);
+    } // for
+
+    // Weights are limited to [1, 1000].
+    PartitionCostModel costModelLimits;
+    costModelLimits.setCellCost(1, 0.001);
+    costModelLimits.setCellCost(2, 0.0001);
+    costModelLimits.setWeights(&mesh);
+    err = DMGetLocalSection(mesh.getDM(), &weightsSection);PYLITH_CHECK_ERROR(err);
+    PetscInt weight = 0;
+    err = PetscSectionGetDof(weightsSection, cellsStratum.begin(), &weight);PYLITH_CHECK_ERROR(err);
+    CHECK(100 == weight);
+    err = PetscSectionGetDof(weightsSection, cellsStratum.begin()+2, &weight);PYLITH_CHECK_ERROR(err);
+    CHECK(10 == weight);
+    err = PetscSectionGetDof(weightsSection, cellsStratum.begin()+3, &weight);PYLITH_CHECK_ERROR(err);
+    CHECK(1000 == weight);
+
+    PYLITH_METHOD_END;
+} // testSetWeights
+
+
+// ------------------------------------------------------------------------------------------------
+// Test getNumCells().
+void
+pylith::topology::TestPartitionCostModel::testGetNumCells(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Mesh mesh;
+    _createMesh(&mesh);
+
+    CHECK(2 == PartitionCostModel::getNumCells(mesh, 1));
+    CHECK(1 == PartitionCostModel::getNumCells(mesh, 2));
+    CHECK(0 == PartitionCostModel::getNumCells(mesh, 3));
+
+    PYLITH_METHOD_END;
+} // testGetNumCells
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh with four triangles.
+void
+pylith::topology::TestPartitionCostModel::_createMesh(Mesh* mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 5;
+    const int numCells = 4;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        1.0, 1.0,
+        0.0, 1.0,
+        0.5, 0.5,
+    };
+    const PylithInt cellsValues[numCells*numCorners] = {
+        0, 1, 4,
+        1, 2, 4,
+        2, 3, 4,
+        3, 0, 4,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    pylith::meshio::MeshBuilder::buildMesh(mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    mesh->setCoordSys(&cs);
+
+    const PetscInt materialIds[numCells-1] = { 1, 1, 2 };
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dm = mesh->getDM();
+    err = DMCreateLabel(dm, Mesh::cells_label_name);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = 0; cell < numCells-1; ++cell) {
+        err = DMSetLabelValue(dm, Mesh::cells_label_name, cell, materialIds[cell]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _createMesh
+
+
+// End of file
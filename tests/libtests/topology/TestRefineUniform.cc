@@ -16,6 +16,7 @@
 #include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
@@ -185,6 +186,176 @@ pylith::topology::TestRefineUniform::testRefine(void) {
 } // testRefine
 
 
+// ------------------------------------------------------------------------------------------------
+// Test refine() with setKeepHierarchy().
+void
+pylith::topology::TestRefineUniform::testKeepHierarchy(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_data);
+
+    Mesh mesh(_data->cellDim);
+    _initializeMesh(&mesh);
+
+    PetscErrorCode err;
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(mesh.getDM(), 0, &cStart, &cEnd);assert(!err);
+    const PetscInt numCellsCoarse = cEnd - cStart;
+
+    RefineUniform refiner;
+    CHECK(!refiner.getKeepHierarchy());
+    refiner.setKeepHierarchy(true);
+    CHECK(refiner.getKeepHierarchy());
+
+    Mesh newMesh(_data->cellDim);
+    refiner.refine(&newMesh, mesh, _data->refineLevel);
+    mesh.deallocate(); // Hierarchy holds reference to coarse mesh.
+
+    // Check number of levels and number of cells on coarsest level.
+    const PetscDM dmMesh = newMesh.getDM();assert(dmMesh);
+    PetscDM dmCoarse = NULL;
+    PetscDM dmCoarsest = NULL;
+    int numLevels = 0;
+    err = DMGetCoarseDM(dmMesh, &dmCoarse);assert(!err);
+    while (dmCoarse) {
+        ++numLevels;
+        dmCoarsest = dmCoarse;
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);assert(!err);
+    } // while
+    REQUIRE(_data->refineLevel == numLevels);
+    err = DMPlexGetHeightStratum(dmCoarsest, 0, &cStart, &cEnd);assert(!err);
+    CHECK(numCellsCoarse == cEnd - cStart);
+
+    // Check clone shares hierarchy.
+    Mesh* meshClone = newMesh.clone();assert(meshClone);
+    PetscDM dmCloneCoarse = NULL;
+    err = DMGetCoarseDM(meshClone->getDM(), &dmCloneCoarse);assert(!err);
+    REQUIRE(dmCloneCoarse);
+    err = DMGetCoarseDM(dmMesh, &dmCoarse);assert(!err);
+    CHECK(dmCloneCoarse == dmCoarse);
+    delete meshClone;meshClone = NULL;
+
+    PYLITH_METHOD_END;
+} // testKeepHierarchy
+
+
+// ------------------------------------------------------------------------------------------------
+// Test Field::createCoarseDiscretization() with mesh hierarchy from refine().
+void
+pylith::topology::TestRefineUniform::testCoarseDiscretization(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_data);
+
+    Mesh mesh(_data->cellDim);
+    _initializeMesh(&mesh);
+
+    RefineUniform refiner;
+    refiner.setKeepHierarchy(true);
+    Mesh newMesh(_data->cellDim);
+    refiner.refine(&newMesh, mesh, _data->refineLevel);
+    mesh.deallocate();
+
+    // Solution with displacement and fault Lagrange multiplier subfields.
+    pylith::topology::Field::Description descriptionDisp;
+    descriptionDisp.label = "displacement";
+    descriptionDisp.vectorFieldType = pylith::topology::Field::VECTOR;
+    descriptionDisp.numComponents = _data->spaceDim;
+    descriptionDisp.componentNames.resize(_data->spaceDim);
+    for (int i = 0; i < _data->spaceDim; ++i) {
+        descriptionDisp.componentNames[i] = std::string("displacement_") + std::string("xyz").substr(i, 1);
+    } // for
+    descriptionDisp.scale = 1.0;
+    descriptionDisp.validator = NULL;
+
+    pylith::topology::Field::Description descriptionLagrange(descriptionDisp);
+    descriptionLagrange.label = "lagrange_multiplier_fault";
+    for (int i = 0; i < _data->spaceDim; ++i) {
+        descriptionLagrange.componentNames[i] = std::string("lagrange_multiplier_fault_") + std::string("xyz").substr(i, 1);
+    } // for
+
+    const bool isFaultOnly = true;
+    pylith::topology::Field solution(newMesh);
+    solution.setLabel("solution");
+    solution.subfieldAdd(descriptionDisp, pylith::topology::Field::Discretization(1, 1));
+    solution.subfieldAdd(descriptionLagrange, pylith::topology::Field::Discretization(1, 1, _data->cellDim-1, -1, isFaultOnly));
+    solution.subfieldsSetup();
+    solution.createDiscretization();
+
+    // Essential boundary condition on the displacement.
+    const char* bcLabelName = "end points";
+    const PetscInt bcLabelValue = 1;
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscDM dmFine = solution.getDM();
+    PetscDMLabel bcLabel = NULL;
+    err = DMGetLabel(dmFine, bcLabelName, &bcLabel);PYLITH_CHECK_ERROR(err);
+    REQUIRE(bcLabel);
+    PetscDS dsFine = NULL;
+    err = DMGetDS(dmFine, &dsFine);PYLITH_CHECK_ERROR(err);
+    const PetscInt iDisp = solution.getSubfieldInfo("displacement").index;
+    err = PetscDSAddBoundary(dsFine, DM_BC_ESSENTIAL, "bc", bcLabel, 1, &bcLabelValue, iDisp, 0, NULL,
+                             NULL, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+
+    solution.createCoarseDiscretization();
+
+    PetscInt numDSFine = 0;
+    err = DMGetNumDS(dmFine, &numDSFine);PYLITH_CHECK_ERROR(err);
+    CHECK(numDSFine > 1); // Cohesive cells have their own DS.
+
+    const PetscInt iLagrange = solution.getSubfieldInfo("lagrange_multiplier_fault").index;
+    PetscDM dmCoarse = NULL, dmMeshCoarse = NULL;
+    err = DMGetCoarseDM(dmFine, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    err = DMGetCoarseDM(newMesh.getDM(), &dmMeshCoarse);PYLITH_CHECK_ERROR(err);
+    int numLevels = 0;
+    while (dmCoarse) {
+        INFO("Coarse level " << numLevels);
+        ++numLevels;
+
+        // Field has its own coarse levels; the coarse levels of the mesh are not discretized.
+        REQUIRE(dmMeshCoarse);
+        CHECK(dmCoarse != dmMeshCoarse);
+        PetscInt numFields = 0;
+        err = DMGetNumFields(dmMeshCoarse, &numFields);PYLITH_CHECK_ERROR(err);
+        CHECK(0 == numFields);
+        err = DMGetNumFields(dmCoarse, &numFields);PYLITH_CHECK_ERROR(err);
+        CHECK(2 == numFields);
+
+        // Cohesive cells on coarse level with boundary condition.
+        PetscInt numDSCoarse = 0;
+        err = DMGetNumDS(dmCoarse, &numDSCoarse);PYLITH_CHECK_ERROR(err);
+        CHECK(numDSFine == numDSCoarse);
+        PetscDS dsCoarse = NULL;
+        err = DMGetDS(dmCoarse, &dsCoarse);PYLITH_CHECK_ERROR(err);
+        PetscInt numBoundaries = 0;
+        err = PetscDSGetNumBoundary(dsCoarse, &numBoundaries);PYLITH_CHECK_ERROR(err);
+        CHECK(1 == numBoundaries);
+
+        // Lagrange multiplier subfield only on fault; displacement constrained on boundary.
+        PetscSection sectionCoarse = NULL;
+        err = DMGetLocalSection(dmCoarse, &sectionCoarse);PYLITH_CHECK_ERROR(err);
+        PetscInt pStart = 0, pEnd = 0;
+        err = PetscSectionGetChart(sectionCoarse, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        PetscInt numDofDisp = 0, numDofLagrange = 0, numConstrained = 0;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt dof = 0, cdof = 0;
+            err = PetscSectionGetFieldDof(sectionCoarse, point, iDisp, &dof);PYLITH_CHECK_ERROR(err);
+            numDofDisp += dof;
+            err = PetscSectionGetFieldDof(sectionCoarse, point, iLagrange, &dof);PYLITH_CHECK_ERROR(err);
+            numDofLagrange += dof;
+            err = PetscSectionGetFieldConstraintDof(sectionCoarse, point, iDisp, &cdof);PYLITH_CHECK_ERROR(err);
+            numConstrained += cdof;
+        } // for
+        CHECK(numDofDisp > numDofLagrange);
+        CHECK(numDofLagrange > 0);
+        CHECK(numConstrained > 0);
+
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMGetCoarseDM(dmMeshCoarse, &dmMeshCoarse);PYLITH_CHECK_ERROR(err);
+    } // while
+    CHECK(_data->refineLevel == numLevels);
+
+    PYLITH_METHOD_END;
+} // testCoarseDiscretization
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::topology::TestRefineUniform::_initializeMesh(Mesh* const mesh) {
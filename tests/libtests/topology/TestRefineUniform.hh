@@ -34,6 +34,12 @@ public:
     /// Test refine().
     void testRefine(void);
 
+    /// Test refine() with setKeepHierarchy().
+    void testKeepHierarchy(void);
+
+    /// Test Field::createCoarseDiscretization() with mesh hierarchy from refine().
+    void testCoarseDiscretization(void);
+
     // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
 private:
 
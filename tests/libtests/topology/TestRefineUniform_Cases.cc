@@ -51,6 +51,12 @@ TEST_CASE("TestRefineUniform::Tri_2xNoFault::testRefine", "[TestRefineUniform][T
 TEST_CASE("TestRefineUniform::Tri_2xFault::testRefine", "[TestRefineUniform][Tri][Fault]") {
     pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Tri_2xFault()).testRefine();
 }
+TEST_CASE("TestRefineUniform::Tri_2xFault::testKeepHierarchy", "[TestRefineUniform][Tri][Fault]") {
+    pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Tri_2xFault()).testKeepHierarchy();
+}
+TEST_CASE("TestRefineUniform::Tri_2xFault::testCoarseDiscretization", "[TestRefineUniform][Tri][Fault]") {
+    pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Tri_2xFault()).testCoarseDiscretization();
+}
 
 TEST_CASE("TestRefineUniform::Quad_2xNoFault::testRefine", "[TestRefineUniform][Quad][NoFault]") {
     pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Quad_2xNoFault()).testRefine();
@@ -72,6 +78,12 @@ TEST_CASE("TestRefineUniform::Hex_2xNoFault::testRefine", "[TestRefineUniform][H
 TEST_CASE("TestRefineUniform::Hex_2xFault::testRefine", "[TestRefineUniform][Hex][Fault]") {
     pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Hex_2xFault()).testRefine();
 }
+TEST_CASE("TestRefineUniform::Hex_2xFault::testKeepHierarchy", "[TestRefineUniform][Hex][Fault]") {
+    pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Hex_2xFault()).testKeepHierarchy();
+}
+TEST_CASE("TestRefineUniform::Hex_2xFault::testCoarseDiscretization", "[TestRefineUniform][Hex][Fault]") {
+    pylith::topology::TestRefineUniform(pylith::topology::TestRefineUniform_Cases::Hex_2xFault()).testCoarseDiscretization();
+}
 
 // ------------------------------------------------------------------------------------------------
 pylith::topology::TestRefineUniform_Data*
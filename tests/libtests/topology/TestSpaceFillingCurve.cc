@@ -0,0 +1,269 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include <set> // USES std::set
+#include <vector> // USES std::vector
+#include <cstdlib> // USES abs()
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+#include "catch2/matchers/catch_matchers_exception.hpp"
+
+// ------------------------------------------------------------------------------------------------
+// Setup testing data.
+pylith::topology::TestSpaceFillingCurve::TestSpaceFillingCurve(TestSpaceFillingCurve_Data* data) :
+    _data(data) {
+    PYLITH_METHOD_BEGIN;
+    assert(_data);
+
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ------------------------------------------------------------------------------------------------
+// Tear down testing data.
+pylith::topology::TestSpaceFillingCurve::~TestSpaceFillingCurve(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _data;_data = NULL;
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ------------------------------------------------------------------------------------------------
+// Test reorder().
+void
+pylith::topology::TestSpaceFillingCurve::testReorder(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    assert(_mesh);
+
+    // Get original DM and create Mesh for it
+    const PetscDM dmOrig = _mesh->getDM();
+    PetscObjectReference((PetscObject) dmOrig);
+    Mesh meshOrig;
+    meshOrig.setDM(dmOrig);
+
+    SpaceFillingCurve::reorder(_mesh, _data->curve);
+
+    const PetscDM& dmMesh = _mesh->getDM();assert(dmMesh);
+
+    // Check vertices (size only)
+    topology::Stratum verticesStratumE(dmOrig, topology::Stratum::DEPTH, 0);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    CHECK(verticesStratumE.size() == verticesStratum.size());
+
+    // Check cells (size only)
+    topology::Stratum cellsStratumE(dmOrig, topology::Stratum::HEIGHT, 0);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    CHECK(cellsStratumE.size() == cellsStratum.size());
+
+    // Check groups
+    PetscInt numGroupsE, numGroups;
+    PetscErrorCode err;
+    err = DMGetNumLabels(dmOrig, &numGroupsE);REQUIRE(!err);
+    err = DMGetNumLabels(dmMesh, &numGroups);REQUIRE(!err);
+    REQUIRE(numGroupsE == numGroups);
+
+    for (PetscInt iGroup = 0; iGroup < numGroups; ++iGroup) {
+        const char *name = NULL;
+        err = DMGetLabelName(dmMesh, iGroup, &name);REQUIRE(!err);
+
+        PetscInt numPointsE, numPoints;
+        err = DMGetStratumSize(dmOrig, name, 1, &numPointsE);REQUIRE(!err);
+        err = DMGetStratumSize(dmMesh, name, 1, &numPoints);REQUIRE(!err);
+        CHECK(numPointsE == numPoints);
+    } // for
+
+    // Check element centroids
+    PylithScalar coordsCheckOrig = 0.0;
+    PylithInt numCellsOrig = 0;
+    PylithInt totalClosureSizeOrig = 0;
+    { // original
+        Stratum cellsStratum(dmOrig, Stratum::HEIGHT, 0);
+        const PetscInt cStart = cellsStratum.begin();
+        const PetscInt cEnd = cellsStratum.end();
+        numCellsOrig = cEnd - cStart;
+        pylith::topology::CoordsVisitor coordsVisitor(dmOrig);
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscScalar* coordsCell = NULL;
+            PetscInt coordsSize = 0;
+            PylithScalar value = 0.0;
+            coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+            totalClosureSizeOrig += coordsSize;
+            for (int i = 0; i < coordsSize; ++i) {
+                value += coordsCell[i];
+            } // for
+            coordsCheckOrig += value*value;
+            coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+        } // for
+    } // original
+    PylithScalar coordsCheckReorder = 0.0;
+    PylithInt numCellsReorder = 0;
+    PylithInt totalClosureSizeReorder = 0;
+    { // reordered
+        Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+        const PetscInt cStart = cellsStratum.begin();
+        const PetscInt cEnd = cellsStratum.end();
+        numCellsReorder = cEnd - cStart;
+        pylith::topology::CoordsVisitor coordsVisitor(dmMesh);
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscScalar* coordsCell = NULL;
+            PetscInt coordsSize = 0;
+            PylithScalar value = 0.0;
+            coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+            totalClosureSizeReorder += coordsSize;
+            for (int i = 0; i < coordsSize; ++i) {
+                value += coordsCell[i];
+            } // for
+            coordsCheckReorder += value*value;
+            coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+        } // for
+    } // reordered
+    CHECK(numCellsOrig == numCellsReorder);
+    CHECK(totalClosureSizeOrig == totalClosureSizeReorder);
+    const PylithScalar tolerance = 1.0e-6;
+    CHECK_THAT(coordsCheckReorder, Catch::Matchers::WithinAbs(coordsCheckOrig, tolerance*coordsCheckOrig));
+
+    // Verify cells of each material are consecutive and cohesive cells are at the end.
+    PetscDMLabel materialLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &materialLabel);REQUIRE(!err);REQUIRE(materialLabel);
+    std::set<PetscInt> materialsDone;
+    PetscInt materialPrev = -1;
+    bool foundCohesive = false;
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        PetscInt material = -1;
+        err = DMLabelGetValue(materialLabel, cell, &material);REQUIRE(!err);
+        if (material != materialPrev) {
+            INFO("Cells in material "<<material<<" are not consecutive.");
+            CHECK(0 == materialsDone.count(material));
+            materialsDone.insert(materialPrev);
+            materialPrev = material;
+        } // if
+        const bool isCohesive = MeshOps::isCohesiveCell(dmMesh, cell);
+        INFO("Cell "<<cell<<" is a bulk cell after a cohesive cell.");
+        CHECK((isCohesive || !foundCohesive));
+        foundCohesive = foundCohesive || isCohesive;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testReorder
+
+
+// ------------------------------------------------------------------------------------------------
+// Test computeIndex().
+void
+pylith::topology::TestSpaceFillingCurve::testComputeIndex(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int numBits = 3;
+    const uint32_t numPerDim = uint32_t(1) << numBits;
+    for (int dim = 2; dim <= 3; ++dim) {
+        const size_t numPoints = (2 == dim) ? numPerDim*numPerDim : numPerDim*numPerDim*numPerDim;
+
+        // Hilbert: indices are a permutation and consecutive points along the curve are neighbors.
+        std::vector<std::vector<uint32_t> > pointsHilbert(numPoints);
+        std::vector<size_t> numHilbert(numPoints, 0);
+        std::vector<size_t> numMorton(numPoints, 0);
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            uint32_t coords[3] = { uint32_t(iPoint % numPerDim), uint32_t((iPoint / numPerDim) % numPerDim), uint32_t(iPoint / (numPerDim*numPerDim)) };
+            const std::vector<uint32_t> point(coords, coords+dim);
+
+            const uint64_t indexMorton = SpaceFillingCurve::computeIndex(coords, dim, numBits, SpaceFillingCurve::MORTON);
+            REQUIRE(indexMorton < numPoints);
+            numMorton[indexMorton] += 1;
+
+            const uint64_t indexHilbert = SpaceFillingCurve::computeIndex(coords, dim, numBits, SpaceFillingCurve::HILBERT);
+            REQUIRE(indexHilbert < numPoints);
+            numHilbert[indexHilbert] += 1;
+            pointsHilbert[indexHilbert] = point;
+        } // for
+        for (size_t i = 0; i < numPoints; ++i) {
+            CHECK(1 == numMorton[i]);
+            CHECK(1 == numHilbert[i]);
+        } // for
+        for (size_t i = 1; i < numPoints; ++i) {
+            int distance = 0;
+            for (int iDim = 0; iDim < dim; ++iDim) {
+                distance += abs(int(pointsHilbert[i][iDim]) - int(pointsHilbert[i-1][iDim]));
+            } // for
+            INFO("dim="<<dim<<", Hilbert index="<<i);
+            CHECK(1 == distance);
+        } // for
+    } // for
+
+    { // Morton interleaves bits with first coordinate as most significant.
+        uint32_t coords[2] = { 1, 0 };
+        CHECK(2 == SpaceFillingCurve::computeIndex(coords, 2, 1, SpaceFillingCurve::MORTON));
+    } // Morton
+
+    PYLITH_METHOD_END;
+} // testComputeIndex
+
+
+// ------------------------------------------------------------------------------------------------
+void
+pylith::topology::TestSpaceFillingCurve::_initialize() {
+    PYLITH_METHOD_BEGIN;
+    assert(_data);
+
+    delete _mesh;_mesh = new Mesh;assert(_mesh);
+
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename(_data->filename);
+    iohandler.read(_mesh);
+    assert(pylith::topology::MeshOps::getNumCells(*_mesh) > 0);
+    assert(pylith::topology::MeshOps::getNumVertices(*_mesh) > 0);
+
+    // Adjust topology if necessary.
+    if (_data->faultLabel) {
+        pylith::faults::FaultCohesiveStub fault;
+        fault.setCohesiveLabelValue(100);
+        fault.setSurfaceLabelName(_data->faultLabel);
+        fault.adjustTopology(_mesh);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Constructor
+pylith::topology::TestSpaceFillingCurve_Data::TestSpaceFillingCurve_Data(void) :
+    filename(NULL),
+    faultLabel(NULL),
+    curve(SpaceFillingCurve::HILBERT) {}
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor
+pylith::topology::TestSpaceFillingCurve_Data::~TestSpaceFillingCurve_Data(void) {}
+
+
+// End of file
@@ -0,0 +1,76 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+#pragma once
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve::CurveEnum
+
+namespace pylith {
+    namespace topology {
+        class TestSpaceFillingCurve;
+        class TestSpaceFillingCurve_Data;
+    } // topology
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::topology::TestSpaceFillingCurve : public pylith::utils::GenericComponent {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    TestSpaceFillingCurve(TestSpaceFillingCurve_Data* data);
+
+    /// Destructor.
+    ~TestSpaceFillingCurve(void);
+
+    /// Test reorder().
+    void testReorder(void);
+
+    /// Test computeIndex().
+    static
+    void testComputeIndex(void);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    TestSpaceFillingCurve_Data* _data; ///< Data for testing.
+    Mesh* _mesh; ///< Finite-element mesh.
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Setup mesh.
+    void _initialize();
+
+
+}; // class TestSpaceFillingCurve
+
+// ------------------------------------------------------------------------------------------------
+class pylith::topology::TestSpaceFillingCurve_Data {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestSpaceFillingCurve_Data(void);
+
+    /// Destructor
+    ~TestSpaceFillingCurve_Data(void);
+
+    // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    const char* filename; ///< Name of mesh file.
+    const char* faultLabel; ///< Label for fault (use NULL for no fault).
+    SpaceFillingCurve::CurveEnum curve; ///< Type of space-filling curve.
+
+};  // TestSpaceFillingCurve_Data
+
+// End of file
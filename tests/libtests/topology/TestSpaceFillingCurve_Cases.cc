@@ -0,0 +1,213 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "catch2/catch_test_macros.hpp"
+
+namespace pylith {
+    namespace topology {
+        class TestSpaceFillingCurve_Cases;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+class pylith::topology::TestSpaceFillingCurve_Cases {
+public:
+
+    // Data factory methods
+    static TestSpaceFillingCurve_Data* Tri_NoFault(void);
+
+    static TestSpaceFillingCurve_Data* Tri_Fault(void);
+
+    static TestSpaceFillingCurve_Data* Quad_NoFault(void);
+
+    static TestSpaceFillingCurve_Data* Quad_Fault(void);
+
+    static TestSpaceFillingCurve_Data* Tet_NoFault(void);
+
+    static TestSpaceFillingCurve_Data* Tet_Fault(void);
+
+    static TestSpaceFillingCurve_Data* Hex_NoFault(void);
+
+    static TestSpaceFillingCurve_Data* Hex_Fault(void);
+
+    static TestSpaceFillingCurve_Data* Tri_Fault_Morton(void);
+
+    static TestSpaceFillingCurve_Data* Hex_Fault_Morton(void);
+
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestSpaceFillingCurve::Tri_NoFault::testReorder", "[TestSpaceFillingCurve][Tri][NoFault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Tri_NoFault()).testReorder();
+}
+TEST_CASE("TestSpaceFillingCurve::Tri_Fault::testReorder", "[TestSpaceFillingCurve][Tri][Fault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Tri_Fault()).testReorder();
+}
+
+TEST_CASE("TestSpaceFillingCurve::Quad_NoFault::testReorder", "[TestSpaceFillingCurve][Quad][NoFault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Quad_NoFault()).testReorder();
+}
+TEST_CASE("TestSpaceFillingCurve::Quad_Fault::testReorder", "[TestSpaceFillingCurve][Quad][Fault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Quad_Fault()).testReorder();
+}
+
+TEST_CASE("TestSpaceFillingCurve::Tet_NoFault::testReorder", "[TestSpaceFillingCurve][Tet][NoFault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Tet_NoFault()).testReorder();
+}
+TEST_CASE("TestSpaceFillingCurve::Tet_Fault::testReorder", "[TestSpaceFillingCurve][Tet][Fault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Tet_Fault()).testReorder();
+}
+
+TEST_CASE("TestSpaceFillingCurve::Hex_NoFault::testReorder", "[TestSpaceFillingCurve][Hex][NoFault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Hex_NoFault()).testReorder();
+}
+TEST_CASE("TestSpaceFillingCurve::Hex_Fault::testReorder", "[TestSpaceFillingCurve][Hex][Fault][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Hex_Fault()).testReorder();
+}
+
+TEST_CASE("TestSpaceFillingCurve::Tri_Fault_Morton::testReorder", "[TestSpaceFillingCurve][Tri][Fault][Morton][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Tri_Fault_Morton()).testReorder();
+}
+TEST_CASE("TestSpaceFillingCurve::Hex_Fault_Morton::testReorder", "[TestSpaceFillingCurve][Hex][Fault][Morton][testReorder]") {
+    pylith::topology::TestSpaceFillingCurve(pylith::topology::TestSpaceFillingCurve_Cases::Hex_Fault_Morton()).testReorder();
+}
+
+TEST_CASE("TestSpaceFillingCurve::testComputeIndex", "[TestSpaceFillingCurve][testComputeIndex]") {
+    pylith::topology::TestSpaceFillingCurve::testComputeIndex();
+}
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Tri_NoFault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_tri3.mesh";
+    data->faultLabel = NULL;
+
+    return data;
+}   // Tri_NoFault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Tri_Fault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_tri3.mesh";
+    data->faultLabel = "fault";
+
+    return data;
+}   // Tri_Fault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Quad_NoFault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_quad4.mesh";
+    data->faultLabel = NULL;
+
+    return data;
+}   // Quad_NoFault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Quad_Fault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_quad4.mesh";
+    data->faultLabel = "fault";
+
+    return data;
+}   // Quad_Fault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Tet_NoFault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_tet4.mesh";
+    data->faultLabel = NULL;
+
+    return data;
+}   // Tet_NoFault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Tet_Fault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_tet4.mesh";
+    data->faultLabel = "fault";
+
+    return data;
+}   // Tet_Fault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Hex_NoFault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_hex8.mesh";
+    data->faultLabel = NULL;
+
+    return data;
+}   // Hex_NoFault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Hex_Fault(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_hex8.mesh";
+    data->faultLabel = "fault";
+
+    return data;
+}   // Hex_fault
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Tri_Fault_Morton(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_tri3.mesh";
+    data->faultLabel = "fault";
+    data->curve = SpaceFillingCurve::MORTON;
+
+    return data;
+}   // Tri_Fault_Morton
+
+
+// ------------------------------------------------------------------------------------------------
+pylith::topology::TestSpaceFillingCurve_Data*
+pylith::topology::TestSpaceFillingCurve_Cases::Hex_Fault_Morton(void) {
+    TestSpaceFillingCurve_Data* data = new TestSpaceFillingCurve_Data();assert(data);
+
+    data->filename = "data/reorder_hex8.mesh";
+    data->faultLabel = "fault";
+    data->curve = SpaceFillingCurve::MORTON;
+
+    return data;
+}   // Hex_Fault_Morton
+
+
+// End of file
@@ -15,6 +15,7 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/MeshOps.hh" // USES createLowerDimMesh()
 #include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/SubdomainView.hh" // USES SubdomainView
 #include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder::buildMesh()
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
@@ -182,6 +183,120 @@ pylith::topology::TestSubmesh::testCreateSubdomainMesh(void) {
 } // testCreateLowerDimMesh
 
 
+// ------------------------------------------------------------------------------------------------
+// Test SubdomainView.
+void
+pylith::topology::TestSubmesh::testSubdomainView(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_data);
+
+    _buildMesh();
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    { // Subdomain with subset of cells
+        SubdomainView view(*_domainMesh, _data->subdomainLabel, _data->subdomainLabelValue, "Test subdomain");
+        CHECK(std::string(_data->subdomainLabel) == std::string(view.getLabelName()));
+        CHECK(_data->subdomainLabelValue == view.getLabelValue());
+        CHECK(view.getParentDM() == _domainMesh->getDM());
+        REQUIRE(_data->subdomainNumCells == view.getNumCells());
+        CHECK(!view.isEntireDomain());
+
+        PetscInt cellsBegin = 0, cellsEnd = 0;
+        view.getCellRange(&cellsBegin, &cellsEnd);
+        const PetscInt* cells = NULL;
+        err = ISGetIndices(view.getCellsIS(), &cells);REQUIRE(!err);
+        for (PetscInt iCell = 0; iCell < view.getNumCells(); ++iCell) {
+            PetscInt value = 0;
+            err = DMGetLabelValue(_domainMesh->getDM(), _data->subdomainLabel, cells[iCell], &value);REQUIRE(!err);
+            CHECK(_data->subdomainLabelValue == value);
+            CHECK(cells[iCell] >= cellsBegin);
+            CHECK(cells[iCell] < cellsEnd);
+        } // for
+        err = ISRestoreIndices(view.getCellsIS(), &cells);REQUIRE(!err);
+
+        // Region mesh shares the topology of the domain mesh and does not create the subdomain mesh.
+        const Mesh& regionMesh = view.getRegionMesh();
+        CHECK(!view.hasMesh());
+        PetscInt pStart = 0, pEnd = 0, pStartDomain = 0, pEndDomain = 0;
+        err = DMPlexGetChart(regionMesh.getDM(), &pStart, &pEnd);REQUIRE(!err);
+        err = DMPlexGetChart(_domainMesh->getDM(), &pStartDomain, &pEndDomain);REQUIRE(!err);
+        CHECK(pStartDomain == pStart);
+        CHECK(pEndDomain == pEnd);
+        PetscBool hasRegionLabel = PETSC_TRUE;
+        err = DMHasLabel(_domainMesh->getDM(), SubdomainView::getRegionLabelName(), &hasRegionLabel);REQUIRE(!err);
+        CHECK(!hasRegionLabel);
+        PetscDMLabel regionLabel = NULL;
+        err = DMGetLabel(regionMesh.getDM(), SubdomainView::getRegionLabelName(), &regionLabel);REQUIRE(!err);
+        REQUIRE(regionLabel);
+        Stratum regionCellsStratum(regionMesh.getDM(), Stratum::HEIGHT, 0);
+        Stratum regionVerticesStratum(regionMesh.getDM(), Stratum::DEPTH, 0);
+        PetscInt numRegionCells = 0, numRegionVertices = 0;
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            PetscInt value = -1;
+            err = DMLabelGetValue(regionLabel, point, &value);REQUIRE(!err);
+            if (1 != value) {
+                continue;
+            } // if
+            if ((point >= regionCellsStratum.begin()) && (point < regionCellsStratum.end())) {
+                ++numRegionCells;
+            } else if ((point >= regionVerticesStratum.begin()) && (point < regionVerticesStratum.end())) {
+                ++numRegionVertices;
+            } // if/else
+        } // for
+        CHECK(_data->subdomainNumCells == numRegionCells);
+        CHECK(_data->subdomainNumVertices == numRegionVertices);
+
+        // Mesh is created on demand and holds only the label defining the subdomain.
+        CHECK(!view.hasMesh());
+        const Mesh& mesh = view.getMesh();
+        CHECK(view.hasMesh());
+        Stratum verticesStratum(mesh.getDM(), Stratum::DEPTH, 0);
+        CHECK(_data->subdomainNumVertices == verticesStratum.size());
+        Stratum cellsStratum(mesh.getDM(), Stratum::HEIGHT, 0);
+        CHECK(_data->subdomainNumCells == cellsStratum.size());
+        PetscBool hasLabel = PETSC_FALSE;
+        err = DMHasLabel(mesh.getDM(), _data->subdomainLabel, &hasLabel);REQUIRE(!err);
+        CHECK(hasLabel);
+        err = DMHasLabel(mesh.getDM(), _data->groupLabel, &hasLabel);REQUIRE(!err);
+        CHECK(!hasLabel);
+    } // Subdomain with subset of cells
+
+    { // View holds a reference to the parent DM, so it outlives the parent mesh.
+        Mesh* parentMesh = _domainMesh->clone();assert(parentMesh);
+        SubdomainView view(*parentMesh, _data->subdomainLabel, _data->subdomainLabelValue, "Test subdomain");
+        PetscDM parentDM = parentMesh->getDM();
+        delete parentMesh;parentMesh = NULL;
+        CHECK(parentDM == view.getParentDM());
+        CHECK(_data->subdomainNumCells == view.getNumCells());
+        const Mesh& mesh = view.getMesh();
+        Stratum cellsStratum(mesh.getDM(), Stratum::HEIGHT, 0);
+        CHECK(_data->subdomainNumCells == cellsStratum.size());
+    } // View outlives parent mesh
+
+    { // Subdomain covering entire domain shares DM topology with domain mesh.
+        Stratum cellsStratum(_domainMesh->getDM(), Stratum::HEIGHT, 0);
+        for (PetscInt c = cellsStratum.begin(); c < cellsStratum.end(); ++c) {
+            err = DMSetLabelValue(_domainMesh->getDM(), "entire-domain", c, 1);REQUIRE(!err);
+        } // for
+        SubdomainView view(*_domainMesh, "entire-domain", 1, "Entire domain");
+        CHECK(cellsStratum.size() == view.getNumCells());
+        CHECK(view.isEntireDomain());
+
+        const Mesh& mesh = view.getMesh();
+        PetscInt pStart = 0, pEnd = 0, pStartDomain = 0, pEndDomain = 0;
+        err = DMPlexGetChart(mesh.getDM(), &pStart, &pEnd);REQUIRE(!err);
+        err = DMPlexGetChart(_domainMesh->getDM(), &pStartDomain, &pEndDomain);REQUIRE(!err);
+        CHECK(pStartDomain == pStart);
+        CHECK(pEndDomain == pEnd);
+
+        // Region mesh is the mesh of the view.
+        CHECK(&mesh == &view.getRegionMesh());
+    } // Subdomain covering entire domain
+
+    PYLITH_METHOD_END;
+} // testSubdomainView
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::topology::TestSubmesh::_buildMesh(void) {
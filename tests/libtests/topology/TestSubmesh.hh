@@ -38,6 +38,9 @@ public:
     /// Test MeshOps::testCreateSubdomainMesh().
     void testCreateSubdomainMesh(void);
 
+    /// Test SubdomainView.
+    void testSubdomainView(void);
+
     /// Test coordsys(), debug(), comm().
     void testAccessors(void);
 
@@ -49,6 +49,9 @@ TEST_CASE("TestSubmesh::Tri::testCreateLowerDimMesh", "[TestSubmesh][Tri][testCr
 TEST_CASE("TestSubmesh::Tri::testCreateSubdomainMesh", "[TestSubmesh][Tri][testCreateSubdomainMesh]") {
     pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Tri()).testCreateSubdomainMesh();
 }
+TEST_CASE("TestSubmesh::Tri::testSubdomainView", "[TestSubmesh][Tri][testSubdomainView]") {
+    pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Tri()).testSubdomainView();
+}
 
 TEST_CASE("TestSubmesh::Quad::testAccessors", "[TestSubmesh][Quad][testAccessors]") {
     pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Quad()).testAccessors();
@@ -62,6 +65,9 @@ TEST_CASE("TestSubmesh::Quad::testCreateLowerDimMesh", "[TestSubmesh][Quad][test
 TEST_CASE("TestSubmesh::Quad::testCreateSubdomainMesh", "[TestSubmesh][Quad][testCreateSubdomainMesh]") {
     pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Quad()).testCreateSubdomainMesh();
 }
+TEST_CASE("TestSubmesh::Quad::testSubdomainView", "[TestSubmesh][Quad][testSubdomainView]") {
+    pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Quad()).testSubdomainView();
+}
 
 TEST_CASE("TestSubmesh::Tet::testAccessors", "[TestSubmesh][Tet][testAccessors]") {
     pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Tet()).testAccessors();
@@ -75,6 +81,9 @@ TEST_CASE("TestSubmesh::Tet::testCreateLowerDimMesh", "[TestSubmesh][Tet][testCr
 TEST_CASE("TestSubmesh::Tet::testCreateSubdomainMesh", "[TestSubmesh][Tet][testCreateSubdomainMesh]") {
     pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Tet()).testCreateSubdomainMesh();
 }
+TEST_CASE("TestSubmesh::Tet::testSubdomainView", "[TestSubmesh][Tet][testSubdomainView]") {
+    pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Tet()).testSubdomainView();
+}
 
 TEST_CASE("TestSubmesh::Hex::testAccessors", "[TestSubmesh][Hex][testAccessors]") {
     pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Hex()).testAccessors();
@@ -88,6 +97,9 @@ TEST_CASE("TestSubmesh::Hex::testCreateLowerDimMesh", "[TestSubmesh][Hex][testCr
 TEST_CASE("TestSubmesh::Hex::testCreateSubdomainMesh", "[TestSubmesh][Hex][testCreateSubdomainMesh]") {
     pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Hex()).testCreateSubdomainMesh();
 }
+TEST_CASE("TestSubmesh::Hex::testSubdomainView", "[TestSubmesh][Hex][testSubdomainView]") {
+    pylith::topology::TestSubmesh(pylith::topology::TestSubmesh_Cases::Hex()).testSubdomainView();
+}
 
 // ------------------------------------------------------------------------------------------------
 pylith::topology::TestSubmesh_Data*
@@ -0,0 +1,141 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/utils/MemoryRegistry.hh" // USES MemoryRegistry
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "catch2/catch_test_macros.hpp"
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestMemoryRegistry;
+    }
+}
+
+class pylith::utils::TestMemoryRegistry {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test add() and remove().
+    static
+    void testAddRemove(void);
+
+    /// Test pushOwner(), popOwner(), and OwnerScope.
+    static
+    void testOwner(void);
+
+    /// Test pushStage(), popStage(), and high-water marks.
+    static
+    void testStage(void);
+
+}; // class TestMemoryRegistry
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestMemoryRegistry::testAddRemove", "[TestMemoryRegistry]") {
+    pylith::utils::TestMemoryRegistry::testAddRemove();
+}
+TEST_CASE("TestMemoryRegistry::testOwner", "[TestMemoryRegistry]") {
+    pylith::utils::TestMemoryRegistry::testOwner();
+}
+TEST_CASE("TestMemoryRegistry::testStage", "[TestMemoryRegistry]") {
+    pylith::utils::TestMemoryRegistry::testStage();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test add() and remove().
+void
+pylith::utils::TestMemoryRegistry::testAddRemove(void) {
+    PYLITH_METHOD_BEGIN;
+
+    int objectA = 0, objectB = 0;
+    const size_t bytesStart = MemoryRegistry::getLocalBytes();
+
+    MemoryRegistry::add(&objectA, "field", "A", 100);
+    MemoryRegistry::add(&objectB, "matrix", "B", 50);
+    CHECK(bytesStart + 150 == MemoryRegistry::getLocalBytes());
+
+    // Updating an object replaces its size.
+    MemoryRegistry::add(&objectA, "field", "A", 200);
+    CHECK(bytesStart + 250 == MemoryRegistry::getLocalBytes());
+
+    MemoryRegistry::remove(&objectA);
+    CHECK(bytesStart + 50 == MemoryRegistry::getLocalBytes());
+
+    // Removing an object that is not registered has no effect.
+    MemoryRegistry::remove(&objectA);
+    CHECK(bytesStart + 50 == MemoryRegistry::getLocalBytes());
+
+    MemoryRegistry::remove(&objectB);
+    CHECK(bytesStart == MemoryRegistry::getLocalBytes());
+
+    PYLITH_METHOD_END;
+} // testAddRemove
+
+
+// ------------------------------------------------------------------------------------------------
+// Test pushOwner(), popOwner(), and OwnerScope.
+void
+pylith::utils::TestMemoryRegistry::testOwner(void) {
+    PYLITH_METHOD_BEGIN;
+
+    int objectA = 0, objectB = 0;
+    { // scope
+        MemoryRegistry::OwnerScope owner("material_upper");
+        MemoryRegistry::add(&objectA, "field", "A", 1024*1024);
+    } // scope
+    MemoryRegistry::pushOwner("fault_main");
+    MemoryRegistry::add(&objectB, "field", "B", 2*1024*1024);
+    MemoryRegistry::popOwner();
+
+    // Owner is set when the object is first registered.
+    MemoryRegistry::add(&objectA, "field", "A", 3*1024*1024);
+
+    const std::string& report = MemoryRegistry::report(PETSC_COMM_WORLD);
+    INFO(report);
+    CHECK(std::string::npos != report.find("material_upper"));
+    CHECK(std::string::npos != report.find("fault_main"));
+    CHECK(std::string::npos != report.find("3.00"));
+    CHECK(std::string::npos != report.find("2.00"));
+
+    MemoryRegistry::remove(&objectA);
+    MemoryRegistry::remove(&objectB);
+
+    PYLITH_METHOD_END;
+} // testOwner
+
+
+// ------------------------------------------------------------------------------------------------
+// Test pushStage(), popStage(), and high-water marks.
+void
+pylith::utils::TestMemoryRegistry::testStage(void) {
+    PYLITH_METHOD_BEGIN;
+
+    int objectA = 0;
+    MemoryRegistry::pushStage("Test Stage");
+    MemoryRegistry::add(&objectA, "output", "A", 5*1024*1024);
+    MemoryRegistry::remove(&objectA);
+    MemoryRegistry::popStage();
+
+    // High-water mark remains after memory is released.
+    const std::string& report = MemoryRegistry::report(PETSC_COMM_WORLD);
+    INFO(report);
+    const size_t pos = report.find("Test Stage");
+    REQUIRE(std::string::npos != pos);
+    CHECK(std::string::npos != report.find("5.00", pos));
+
+    PYLITH_METHOD_END;
+} // testStage
+
+
+// End of file
@@ -0,0 +1,225 @@
+// =================================================================================================
+// This code is part of PyLith, developed through the Computational Infrastructure
+// for Geodynamics (https://github.com/geodynamics/pylith).
+//
+// Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+// All rights reserved.
+//
+// See https://mit-license.org/ and LICENSE.md and for license information.
+// =================================================================================================
+
+#include <portinfo>
+
+#include "pylith/utils/PetscOptions.hh" // USES PetscDefaults
+
+#include "pylith/materials/Elasticity.hh" // USES Elasticity
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <string> // USES std::string
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class TestPetscDefaults;
+    } // utils
+} // pylith
+
+class pylith::utils::TestPetscDefaults {
+    // PUBLIC METHODS /////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test set() with solver defaults for mesh with and without a hierarchy.
+    static
+    void testGeometricMultigrid(void);
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create mesh with two triangles.
+     *
+     * @param[out] mesh Finite-element mesh.
+     * @param[in] keepHierarchy Refine mesh and keep original mesh as coarse level.
+     */
+    static
+    void _createMesh(pylith::topology::Mesh* mesh,
+                     const bool keepHierarchy);
+
+    /** Get value of option from PETSc options database.
+     *
+     * @param[in] name Name of option.
+     * @returns Value of option or "<none>" if option is not set.
+     */
+    static
+    std::string _getOption(const char* name);
+
+    /// Clear options set by solver defaults from PETSc options database.
+    static
+    void _clearOptions(void);
+
+}; // class TestPetscDefaults
+
+// ------------------------------------------------------------------------------------------------
+TEST_CASE("TestPetscDefaults::testGeometricMultigrid", "[TestPetscDefaults]") {
+    pylith::utils::TestPetscDefaults::testGeometricMultigrid();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Test set() with solver defaults for mesh with and without a hierarchy.
+void
+pylith::utils::TestPetscDefaults::testGeometricMultigrid(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Solver defaults for elasticity with a fault use algebraic multigrid.
+    pylith::materials::Elasticity material;
+    material.setFormulation(pylith::problems::Physics::QUASISTATIC);
+
+    pylith::topology::Field::Description description;
+    description.label = "displacement";
+    description.vectorFieldType = pylith::topology::Field::VECTOR;
+    description.numComponents = 2;
+    description.componentNames.resize(2);
+    description.componentNames[0] = "displacement_x";
+    description.componentNames[1] = "displacement_y";
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    pylith::topology::Field::Description descriptionLagrange(description);
+    descriptionLagrange.label = "lagrange_multiplier_fault";
+    descriptionLagrange.componentNames[0] = "lagrange_multiplier_fault_x";
+    descriptionLagrange.componentNames[1] = "lagrange_multiplier_fault_y";
+
+    const bool isFaultOnly = true;
+    const pylith::topology::Field::Discretization discretization(1, 1);
+    const pylith::topology::Field::Discretization discretizationFault(1, 1, 1, -1, isFaultOnly);
+
+    { // Mesh without hierarchy keeps algebraic multigrid.
+        pylith::topology::Mesh mesh;
+        _createMesh(&mesh, false);
+        pylith::topology::Field solution(mesh);
+        solution.subfieldAdd(description, discretization);
+        solution.subfieldAdd(descriptionLagrange, discretizationFault);
+
+        _clearOptions();
+        PetscDefaults::set(solution, &material, PetscDefaults::SOLVER);
+        CHECK(std::string("gamg") == _getOption("-pc_type"));
+        CHECK(std::string("vpbjacobi") == _getOption("-mg_fine_pc_type"));
+        CHECK(std::string("<none>") == _getOption("-pc_mg_levels"));
+        CHECK(std::string("<none>") == _getOption("-pc_mg_galerkin"));
+        CHECK(std::string("<none>") == _getOption("-mg_levels_pc_type"));
+    } // Mesh without hierarchy
+
+    { // Mesh with hierarchy uses geometric multigrid with Galerkin coarse operators.
+        pylith::topology::Mesh mesh;
+        _createMesh(&mesh, true);
+        pylith::topology::Field solution(mesh);
+        solution.subfieldAdd(description, discretization);
+        solution.subfieldAdd(descriptionLagrange, discretizationFault);
+
+        _clearOptions();
+        PetscDefaults::set(solution, &material, PetscDefaults::SOLVER);
+        CHECK(std::string("mg") == _getOption("-pc_type"));
+        CHECK(std::string("2") == _getOption("-pc_mg_levels"));
+        CHECK(std::string("both") == _getOption("-pc_mg_galerkin"));
+        CHECK(std::string("vpbjacobi") == _getOption("-mg_levels_pc_type"));
+    } // Mesh with hierarchy
+
+    _clearOptions();
+
+    PYLITH_METHOD_END;
+} // testGeometricMultigrid
+
+
+// ------------------------------------------------------------------------------------------------
+// Create mesh with two triangles.
+void
+pylith::utils::TestPetscDefaults::_createMesh(pylith::topology::Mesh* mesh,
+                                              const bool keepHierarchy) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 2;
+    const int numCorners = 3;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        1.0, 0.0,
+        0.0, 1.0,
+        1.0, 1.0,
+    };
+    const PylithInt cellsValues[numCells*numCorners] = {
+        0, 1, 2,
+        1, 3, 2,
+    };
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    pylith::meshio::MeshBuilder::buildMesh(mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, cellDim);
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    mesh->setCoordSys(&cs);
+
+    if (keepHierarchy) {
+        PetscErrorCode err = PETSC_SUCCESS;
+        PetscDM dmCoarse = mesh->getDM();
+        PetscDM dmFine = NULL;
+        err = PetscObjectReference((PetscObject) dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMRefine(dmCoarse, mesh->getComm(), &dmFine);PYLITH_CHECK_ERROR(err);
+        err = DMSetCoarseDM(dmFine, dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&dmCoarse);PYLITH_CHECK_ERROR(err); // Fine DM holds reference.
+        mesh->setDM(dmFine);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _createMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Get value of option from PETSc options database.
+std::string
+pylith::utils::TestPetscDefaults::_getOption(const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    char value[PETSC_MAX_PATH_LEN];
+    PetscBool isSet = PETSC_FALSE;
+    PetscErrorCode err = PetscOptionsGetString(NULL, NULL, name, value, sizeof(value), &isSet);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(isSet ? std::string(value) : std::string("<none>"));
+} // _getOption
+
+
+// ------------------------------------------------------------------------------------------------
+// Clear options set by solver defaults from PETSc options database.
+void
+pylith::utils::TestPetscDefaults::_clearOptions(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const char* names[] = {
+        "-ts_type",
+        "-pc_type",
+        "-dm_reorder_section",
+        "-dm_reorder_section_type",
+        "-mg_fine_pc_type",
+        "-pc_mg_levels",
+        "-pc_mg_galerkin",
+        "-mg_levels_pc_type",
+    };
+    const size_t numNames = sizeof(names) / sizeof(const char*);
+    for (size_t i = 0; i < numNames; ++i) {
+        PetscErrorCode err = PetscOptionsClearValue(NULL, names[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _clearOptions
+
+
+// End of file
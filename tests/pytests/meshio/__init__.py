@@ -5,10 +5,12 @@ from . import (
     TestDataWriterVTK,
     TestOutputObserver,
     TestOutputPhysics,
+    TestOutputPhysicsReductions,
     TestOutputSoln,
     TestOutputSolnDomain,
     TestOutputSolnBoundary,
     TestOutputSolnPoints,
+    TestOutputSolnReductions,
     TestOutputTrigger,
     TestOutputTriggerStep,
     TestOutputTriggerTime,
@@ -42,10 +44,12 @@ def test_modules():
         TestDataWriterVTK,
         TestOutputObserver,
         TestOutputPhysics,
+        TestOutputPhysicsReductions,
         TestOutputSoln,
         TestOutputSolnDomain,
         TestOutputSolnBoundary,
         TestOutputSolnPoints,
+        TestOutputSolnReductions,
         TestOutputTrigger,
         TestOutputTriggerStep,
         TestOutputTriggerTime,
@@ -10,7 +10,7 @@
 
 import unittest
 
-from pylith.testing.TestCases import TestComponent, make_suite
+from pylith.testing.TestCases import TestComponent, make_suite, configureComponent
 from pylith.problems.TimeDependent import (TimeDependent, problem)
 
 
@@ -20,6 +20,17 @@ class TestTimeDependent(TestComponent):
     _class = TimeDependent
     _factory = problem
 
+    def test_load_imbalance(self):
+        obj = TimeDependent()
+        self.assertEqual(0.0, obj.loadImbalanceThreshold)
+        self.assertEqual(10, obj.loadImbalanceInterval)
+
+        obj.inventory.loadImbalanceThreshold = 1.5
+        obj.inventory.loadImbalanceInterval = 5
+        configureComponent(obj)
+        self.assertEqual(1.5, obj.loadImbalanceThreshold)
+        self.assertEqual(5, obj.loadImbalanceInterval)
+
 
 def load_tests(loader, tests, pattern):
     TEST_CLASSES = [TestTimeDependent]
@@ -0,0 +1,162 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+import unittest
+import unittest.mock
+import json
+import os
+import tempfile
+
+from pylith.testing.TestCases import TestComponent, configureComponent, make_suite
+import pylith.topology.PartitionCostModel
+from pylith.topology.PartitionCostModel import PartitionCostModel, ModulePartitionCostModel
+from pylith.problems.SubfieldDisplacement import SubfieldDisplacement
+from pylith.problems.SubfieldLagrangeFault import SubfieldLagrangeFault
+
+
+class Elasticity:
+    """Material with bulk physics named like the PyLith component.
+    """
+
+    def __init__(self, labelValue, rheology=None):
+        self.labelValue = labelValue
+        self.rheology = rheology
+
+
+class IsotropicLinearMaxwell:
+    """Bulk rheology named like the PyLith component.
+    """
+
+
+class Interface:
+    """Fault with cohesive cells.
+    """
+
+    def __init__(self, labelValue):
+        self.labelValue = labelValue
+
+    def getCohesiveLabelValue(self):
+        return self.labelValue
+
+
+class Components:
+    """Container with components.
+    """
+
+    def __init__(self, components):
+        self._components = components
+
+    def components(self):
+        return self._components
+
+
+class Mesh:
+
+    def __init__(self, dim):
+        self.dim = dim
+
+    def getDimension(self):
+        return self.dim
+
+
+class Problem:
+    """Problem with solution subfields, materials, and interfaces.
+    """
+
+    def __init__(self, subfields, materials, interfaces, integratorTimes={}):
+        self.solution = unittest.mock.Mock()
+        self.solution.subfields = Components(subfields)
+        self.materials = Components(materials)
+        self.interfaces = Components(interfaces) if interfaces is not None else None
+        self.integratorTimes = integratorTimes
+        self._mesh = Mesh(2)
+
+    def mesh(self):
+        return self._mesh
+
+    def getIntegratorTime(self, labelValue):
+        return self.integratorTimes.get(labelValue, 0.0)
+
+
+class TestPartitionCostModel(TestComponent):
+    """Unit testing of PartitionCostModel object.
+    """
+    _class = PartitionCostModel
+    _factory = pylith.topology.PartitionCostModel.partition_cost_model
+
+    @staticmethod
+    def _createSubfield(cls, basisOrder):
+        subfield = cls()
+        subfield.inventory.basisOrder = basisOrder
+        configureComponent(subfield)
+        return subfield
+
+    def test_estimateCosts(self):
+        costModel = PartitionCostModel()
+        configureComponent(costModel)
+
+        displacement = self._createSubfield(SubfieldDisplacement, 2)
+        lagrange = self._createSubfield(SubfieldLagrangeFault, 1)
+        materials = [Elasticity(1), Elasticity(2, IsotropicLinearMaxwell())]
+        problem = Problem([displacement, lagrange], materials, [Interface(100)])
+
+        # Domain: (2+1)**2 = 9, fault: 2*(2+1)**1 + (1+1)**1 = 8.
+        costs = costModel._estimateCosts(Mesh(2), problem)
+        self.assertEqual(set([1, 2, 100]), set(costs.keys()))
+        self.assertAlmostEqual(9.0, costs[1])
+        self.assertAlmostEqual(1.5*9.0, costs[2])
+        self.assertAlmostEqual(2.0*8.0, costs[100])
+
+        # No interfaces.
+        problem = Problem([displacement], materials[:1], None)
+        costs = costModel._estimateCosts(Mesh(3), problem)
+        self.assertEqual({1: 27.0}, costs)
+
+    def test_writeCalibration(self):
+        costModel = PartitionCostModel()
+        costModel.inventory.calibrationFilename = os.path.join(tempfile.mkdtemp(), "costs.json")
+        configureComponent(costModel)
+
+        materials = [Elasticity(1), Elasticity(2), Elasticity(3)]
+        problem = Problem([], materials, [Interface(100)], integratorTimes={1: 2.0, 2: 3.0, 100: 4.0})
+        numCells = {1: 10, 2: 5, 3: 4, 100: 2}
+        with unittest.mock.patch.object(ModulePartitionCostModel, "getNumCells", side_effect=lambda mesh, labelValue: numCells[labelValue]):
+            costModel.writeCalibration(problem)
+
+        with open(costModel.calibrationFilename, "r") as fin:
+            data = json.load(fin)
+        self.assertEqual("material-id", data["label"])
+        # Cost per cell relative to least expensive cell; material 3 has no time.
+        costs = data["costs"]
+        self.assertEqual(set(["1", "2", "100"]), set(costs.keys()))
+        self.assertAlmostEqual(1.0, costs["1"])
+        self.assertAlmostEqual(3.0, costs["2"])
+        self.assertAlmostEqual(10.0, costs["100"])
+
+        # Calibration file can be read as weights file.
+        self.assertEqual({1: 1.0, 2: 3.0, 100: 10.0}, costModel._readCosts(costModel.calibrationFilename))
+
+
+def load_tests(loader, tests, pattern):
+    TEST_CLASSES = [TestPartitionCostModel]
+    return make_suite(TEST_CLASSES, loader)
+
+
+if __name__ == "__main__":
+    from pylith.utils.PetscManager import PetscManager
+    petsc = PetscManager()
+    petsc.initialize()
+
+    unittest.main(verbosity=2)
+
+    petsc.finalize()
+
+
+# End of file
@@ -0,0 +1,49 @@
+# =================================================================================================
+# This code is part of PyLith, developed through the Computational Infrastructure
+# for Geodynamics (https://github.com/geodynamics/pylith).
+#
+# Copyright (c) 2010-2024, University of California, Davis and the PyLith Development Team.
+# All rights reserved.
+#
+# See https://mit-license.org/ and LICENSE.md and for license information. 
+# =================================================================================================
+
+import unittest
+
+from pylith.testing.TestCases import make_suite
+from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+
+
+class TestSpaceFillingCurve(unittest.TestCase):
+    """Unit testing of SpaceFillingCurve object.
+    """
+
+    def test_constructor(self):
+        ordering = SpaceFillingCurve()
+        self.assertTrue(not ordering is None)
+        self.assertEqual("hilbert", ordering.curve)
+
+        ordering = SpaceFillingCurve("morton")
+        self.assertEqual("morton", ordering.curve)
+
+    def test_constructor_bad_curve(self):
+        with self.assertRaises(ValueError):
+            SpaceFillingCurve("peano")
+
+
+def load_tests(loader, tests, pattern):
+    TEST_CLASSES = [TestSpaceFillingCurve]
+    return make_suite(TEST_CLASSES, loader)
+
+
+if __name__ == "__main__":
+    from pylith.utils.PetscManager import PetscManager
+    petsc = PetscManager()
+    petsc.initialize()
+
+    unittest.main(verbosity=2)
+
+    petsc.finalize()
+
+
+# End of file
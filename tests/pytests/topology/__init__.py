@@ -5,8 +5,10 @@ from . import (
     TestMeshGenerator,
     TestMeshImporter,
     TestMeshRefiner,
+    TestPartitionCostModel,
     TestRefineUniform,
     TestReverseCuthillMcKee,
+    TestSpaceFillingCurve,
     TestSubfield,
 )
 
@@ -19,8 +21,10 @@ def test_modules():
         TestMeshGenerator,
         TestMeshImporter,
         TestMeshRefiner,
+        TestPartitionCostModel,
         TestRefineUniform,
         TestReverseCuthillMcKee,
+        TestSpaceFillingCurve,
         TestSubfield,
     ]
     return modules
@@ -17,7 +17,8 @@
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor.
 pylith::problems::ObserverSolnStub::ObserverSolnStub(void) :
-    _timeScale(1.0) {}
+    _timeScale(1.0),
+    _willWrite(true) {}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -51,6 +52,25 @@ pylith::problems::ObserverSolnStub::verifyConfiguration(const pylith::topology::
 } // verifyConfiguration
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set whether observer will write output.
+void
+pylith::problems::ObserverSolnStub::setWillWrite(const bool value) {
+    _willWrite = value;
+} // setWillWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether observer will write output at time t.
+bool
+pylith::problems::ObserverSolnStub::willWrite(const PylithReal t,
+                                              const PylithInt tindex,
+                                              const pylith::topology::Field& solution) {
+    pylith::testing::StubMethodTracker tracker("pylith::problems::ObserverSolnStub::willWrite");
+    return _willWrite;
+} // willWrite
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Receive update (subject of observer).
 void
@@ -43,6 +43,23 @@ public:
      */
     void verifyConfiguration(const pylith::topology::Field& solution) const;
 
+    /** Set whether observer will write output.
+     *
+     * @param[in] value True if observer will write output, false otherwise.
+     */
+    void setWillWrite(const bool value);
+
+    /** Check whether observer will write output at time t.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @param[in] solution Solution at time t.
+     * @returns Value set by setWillWrite() (default is true).
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex,
+                   const pylith::topology::Field& solution);
+
     /** Receive update (subject of observer).
      *
      * @param[in] t Current time.
@@ -59,6 +76,7 @@ public:
 protected:
 
     PylithReal _timeScale; ///< Time scale.
+    bool _willWrite; ///< True if observer will write output.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private: